@@ -11,10 +11,83 @@ Kernel Module which creates a device to listen to Tuxs heart.
 @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
 """
 
-import sys
+import argparse
+import struct
 
+# IMA ADPCM as in src/adpcm.c: blocks of a 4 byte header and two frames per byte
+ADPCM_BLOCK_SIZE = 256
+ADPCM_BLOCK_FRAMES = 1 + 2 * (ADPCM_BLOCK_SIZE - 4)
 
-def convert(audio_file):
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8] * 2
+
+ADPCM_STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+]
+
+
+def adpcm_encode_frame(sample, predictor, index):
+    """
+    Encode one frame into a nibble and return it with the
+    predictor and step index the decoder ends up with.
+    """
+    step = ADPCM_STEP_TABLE[index]
+    diff = sample - predictor
+    nibble = 0
+    if diff < 0:
+        nibble = 8
+        diff = -diff
+
+    delta = step >> 3
+    if diff >= step:
+        nibble |= 4
+        diff -= step
+        delta += step
+    if diff >= step >> 1:
+        nibble |= 2
+        diff -= step >> 1
+        delta += step >> 1
+    if diff >= step >> 2:
+        nibble |= 1
+        delta += step >> 2
+
+    predictor += -delta if nibble & 8 else delta
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + ADPCM_INDEX_TABLE[nibble]))
+    return nibble, predictor, index
+
+
+def adpcm_encode(data):
+    """
+    Encode s16_le mono PCM as IMA ADPCM blocks.
+    """
+    frames = [f for (f,) in struct.iter_unpack('<h', data)]
+    encoded = bytearray()
+    index = 0
+
+    for start in range(0, len(frames), ADPCM_BLOCK_FRAMES):
+        block = frames[start:start + ADPCM_BLOCK_FRAMES]
+        predictor = block[0]
+        encoded += struct.pack('<hBB', predictor, index, 0)
+
+        nibbles = []
+        for sample in block[1:]:
+            nibble, predictor, index = adpcm_encode_frame(sample, predictor, index)
+            nibbles.append(nibble)
+        if len(nibbles) % 2:
+            nibbles.append(0)
+
+        encoded += bytes(low | high << 4 for low, high in zip(nibbles[::2], nibbles[1::2]))
+
+    return encoded
+
+
+def convert(audio_file, adpcm=False):
     """
     Convert the given audio file to a C compatible
     char array.
@@ -22,8 +95,18 @@ def convert(audio_file):
     with open(audio_file, 'rb') as raw_audio_file:
         data = raw_audio_file.read()
 
-    print(',\n'.join(hex(b) for b in bytearray(data)))
+    if not adpcm:
+        print(',\n'.join(hex(b) for b in bytearray(data)))
+        return
+
+    encoded = adpcm_encode(data)
+    print('// {0} bytes of s16_le PCM as {1} bytes of IMA ADPCM'.format(len(data), len(encoded)))
+    print(',\n'.join(', '.join(hex(b) for b in encoded[i:i + 16]) for i in range(0, len(encoded), 16)))
 
 
 if __name__ == '__main__':
-    convert(sys.argv[1])
+    parser = argparse.ArgumentParser(description='Convert a raw s16_le mono audio file into a C byte array.')
+    parser.add_argument('audio_file')
+    parser.add_argument('--adpcm', action='store_true', help='encode the audio as IMA ADPCM, see src/adpcm.c')
+    args = parser.parse_args()
+    convert(args.audio_file, args.adpcm)
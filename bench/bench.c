@@ -0,0 +1,422 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Userspace microbenchmarks of the heartbeat engine core.
+ *
+ * Build and run with `make bench`, no root or module loading required.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "heartbeat.h"
+
+// size of the silence page of the module
+#define SILENCE_SIZE 4096
+
+// number of beats generated in the generator benchmark
+#define BENCH_BEATS 10000000
+
+// bytes streamed per read size in the read path benchmark
+#define BENCH_READ_BYTES (512UL * 1024 * 1024)
+
+// samples taken per CPU count in the sampling benchmark
+#define BENCH_SAMPLES 1000
+
+// CPU times a kernel_cpustat holds, in the order of enum cpu_usage_stat
+enum bench_cputime {
+    CPUTIME_USER,
+    CPUTIME_NICE,
+    CPUTIME_SYSTEM,
+    CPUTIME_SOFTIRQ,
+    CPUTIME_IRQ,
+    CPUTIME_IDLE,
+    CPUTIME_IOWAIT,
+    CPUTIME_STEAL,
+    CPUTIME_GUEST,
+    CPUTIME_GUEST_NICE,
+    NR_CPUTIMES
+};
+
+static char silence[SILENCE_SIZE];
+static struct devheart_beat_template_t templates[TEMPO_LEVELS];
+
+// heartbeat being read, like struct devheart_sound_buffer_t in the module
+struct bench_stream {
+    struct devheart_heartbeat_t heartbeat;
+    u32 random;
+};
+
+// simulated kernel_cpustat and NO_HZ idle times of a CPU
+struct bench_cpu {
+    u64 cpustat[NR_CPUTIMES];
+    u64 idle;
+    u64 iowait;
+} __attribute__((aligned(64)));
+
+// keeps the compiler from optimizing the benchmarked work away
+static volatile u64 sink;
+
+static u64 now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static u32 xorshift(u32 *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Mirrors generate_heartbeat() of the module, with a random utilization.
+static size_t generate(struct bench_stream *stream) {
+    struct devheart_beat_template_t *template;
+    unsigned int level = heartbeat_tempo_level(xorshift(&stream->random) % 101);
+
+    template = &templates[level];
+    if(unlikely(!template->ready)) {
+        heartbeat_render_template(template, level, &left_ventricle_beat_sound, &right_ventricle_beat_sound,
+                                  &devheart_formats[DEVHEART_FORMAT_S16_LE_44100]);
+        template->ready = true;
+    }
+
+    heartbeat_start(&stream->heartbeat, template, silence, SILENCE_SIZE);
+    return template->size;
+}
+
+// Generates the next heartbeat once the read path has exhausted the current one.
+static void next(struct devheart_heartbeat_t *heartbeat) {
+    generate(container_of(heartbeat, struct bench_stream, heartbeat));
+}
+
+// Stands in for copy_to_iter() of the module.
+static size_t copy(void *to, const char *data, size_t length) {
+    memcpy(to, data, length);
+    return length;
+}
+
+static void bench_generate(void) {
+    struct bench_stream stream = { .random = 2463534242U };
+    u64 start, elapsed, bytes = 0;
+    unsigned int i;
+
+    start = now_ns();
+    for(i = 0; i < BENCH_BEATS; i++) {
+        bytes += generate(&stream);
+    }
+    elapsed = now_ns() - start;
+    sink = bytes;
+
+    printf("generate_heartbeat: %.2f M beats/s, %.1f ns per beat\n",
+           BENCH_BEATS * 1e3 / elapsed, (double)elapsed / BENCH_BEATS);
+}
+
+static void bench_synth(void) {
+    struct devheart_synth_beat_t lub, dub;
+    struct devheart_sound_t *sound;
+    unsigned int level;
+    u64 start, elapsed;
+
+    synth_beat_for_level(&lub, &synth_lub, 0);
+    sound = malloc(sizeof(*sound) + synth_beat_size(&lub));
+    if(!sound) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    // what switching to the synth samples costs: both beats of every tempo level
+    start = now_ns();
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        synth_beat_for_level(&lub, &synth_lub, level);
+        synth_beat_for_level(&dub, &synth_dub, level);
+        synth_render_beat(sound, &lub);
+        synth_render_beat(sound, &dub);
+    }
+    elapsed = now_ns() - start;
+    sink = sound->data[0];
+    free(sound);
+
+    printf("synthesize all %u tempo levels: %.1f us\n", TEMPO_LEVELS, elapsed / 1e3);
+}
+
+// number of times the built-in samples are decoded in the ADPCM benchmark
+#define BENCH_DECODES 1000
+
+static void bench_adpcm(void) {
+    const struct devheart_adpcm_sound_t *encoded[] = { &left_ventricle_beat_adpcm, &right_ventricle_beat_adpcm };
+    const struct devheart_sound_t *raw[] = { &left_ventricle_beat_sound, &right_ventricle_beat_sound };
+    struct devheart_sound_t *decoded[2];
+    size_t raw_size = 0, encoded_size = 0;
+    u64 start, cold, elapsed;
+    unsigned int i, round;
+
+    for(i = 0; i < 2; i++) {
+        if(encoded[i]->encoded_size != adpcm_encoded_size(encoded[i]->size)) {
+            fprintf(stderr, "ADPCM sample %u has %zu bytes, %zu bytes of PCM take %zu\n",
+                    i, encoded[i]->encoded_size, encoded[i]->size, adpcm_encoded_size(encoded[i]->size));
+            exit(EXIT_FAILURE);
+        }
+
+        decoded[i] = malloc(sizeof(*decoded[i]) + encoded[i]->size);
+        if(!decoded[i]) {
+            perror("malloc");
+            exit(EXIT_FAILURE);
+        }
+        raw_size += raw[i]->size;
+        encoded_size += encoded[i]->encoded_size;
+    }
+
+    // what loading a module with ADPCM samples adds: decoding them once, into cold memory
+    start = now_ns();
+    for(i = 0; i < 2; i++) {
+        adpcm_decode(decoded[i], encoded[i]);
+    }
+    cold = now_ns() - start;
+
+    start = now_ns();
+    for(round = 0; round < BENCH_DECODES; round++) {
+        for(i = 0; i < 2; i++) {
+            adpcm_decode(decoded[i], encoded[i]);
+        }
+    }
+    elapsed = now_ns() - start;
+    sink = decoded[0]->data[0];
+
+    printf("samples: %zu bytes raw, %zu bytes ADPCM (%.1f%%)\n",
+           raw_size, encoded_size, encoded_size * 100.0 / raw_size);
+    printf("adpcm_decode: %.1f us cold, %.1f us warm, %.1f MB/s of PCM\n",
+           cold / 1e3, elapsed / 1e3 / BENCH_DECODES, (double)raw_size * BENCH_DECODES * 1e3 / elapsed);
+
+    for(i = 0; i < 2; i++) {
+        free(decoded[i]);
+    }
+}
+
+// number of times the built-in samples are converted per format in the format benchmark
+#define BENCH_CONVERSIONS 1000
+
+static void bench_format(unsigned int index) {
+    const struct devheart_format_t *format = &devheart_formats[index];
+    const struct devheart_sound_t *raw[] = { &left_ventricle_beat_sound, &right_ventricle_beat_sound };
+    size_t raw_size = 0, size = 0;
+    char *out[2];
+    u64 start, elapsed;
+    unsigned int i, round;
+
+    for(i = 0; i < 2; i++) {
+        out[i] = malloc(format_size(format, raw[i]->size));
+        if(!out[i]) {
+            perror("malloc");
+            exit(EXIT_FAILURE);
+        }
+        raw_size += raw[i]->size;
+        size += format_size(format, raw[i]->size);
+    }
+
+    // what a sample set costs the first reader of a format: converting both beats once
+    start = now_ns();
+    for(round = 0; round < BENCH_CONVERSIONS; round++) {
+        for(i = 0; i < 2; i++) {
+            format_convert(format, out[i], raw[i]->data, raw[i]->size);
+        }
+    }
+    elapsed = now_ns() - start;
+    sink = out[0][0];
+
+    printf("format %-18s: %6zu bytes, %7.1f us per sample set, %7.1f MB/s of PCM\n",
+           format->name, size, elapsed / 1e3 / BENCH_CONVERSIONS,
+           (double)raw_size * BENCH_CONVERSIONS * 1e3 / elapsed);
+
+    for(i = 0; i < 2; i++) {
+        free(out[i]);
+    }
+}
+
+// heartbeat rendered into one flat buffer per beat, like the module did before the segments
+struct bench_flat {
+    char *buffer;
+    size_t size;
+    size_t current_offset;
+    u32 random;
+};
+
+static void flat_generate(struct bench_flat *flat) {
+    unsigned int level = heartbeat_tempo_level(xorshift(&flat->random) % 101);
+    size_t short_pause = BASE_PAUSE_FACTOR * level, long_pause = BASE_PAUSE_FACTOR * level * 60;
+    size_t offset = 0;
+
+    free(flat->buffer);
+    flat->size = left_ventricle_beat_sound.size + short_pause + right_ventricle_beat_sound.size + long_pause;
+    flat->buffer = calloc(1, flat->size);
+    if(!flat->buffer) {
+        perror("calloc");
+        exit(EXIT_FAILURE);
+    }
+
+    memcpy(flat->buffer + offset, left_ventricle_beat_sound.data, left_ventricle_beat_sound.size);
+    offset += left_ventricle_beat_sound.size;
+    memset(flat->buffer + offset, 0xFF, short_pause);
+    offset += short_pause;
+    memcpy(flat->buffer + offset, right_ventricle_beat_sound.data, right_ventricle_beat_sound.size);
+    offset += right_ventricle_beat_sound.size;
+    memset(flat->buffer + offset, 0xFF, long_pause);
+
+    flat->current_offset = 0;
+}
+
+/*
+ * Read path of the flat heartbeat buffer, byte by byte and ending every
+ * read at the end of the heartbeat, or in whole spans across heartbeats.
+ */
+static void bench_read_flat(size_t read_size, bool spans) {
+    struct bench_flat flat = { .random = 2463534242U };
+    volatile char *buffer = malloc(read_size);
+    size_t length, chunk, copied = 0;
+    u64 start, elapsed, reads = 0;
+
+    if(!buffer) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    flat_generate(&flat);
+
+    start = now_ns();
+    while(copied < BENCH_READ_BYTES) {
+        length = 0;
+        if(spans) {
+            for(; length < read_size; length += chunk) {
+                if(flat.current_offset >= flat.size) {
+                    flat_generate(&flat);
+                }
+                chunk = min(read_size - length, flat.size - flat.current_offset);
+                memcpy((char *)buffer + length, flat.buffer + flat.current_offset, chunk);
+                flat.current_offset += chunk;
+            }
+        }
+        else {
+            if(flat.current_offset >= flat.size) {
+                flat_generate(&flat);
+            }
+            // one put_user() per byte
+            for(; length < read_size && flat.current_offset < flat.size; length++) {
+                buffer[length] = flat.buffer[flat.current_offset++];
+            }
+        }
+        copied += length;
+        reads++;
+    }
+    elapsed = now_ns() - start;
+    sink = buffer[0];
+    free((char *)buffer);
+    free(flat.buffer);
+
+    printf("read %6zu bytes, flat %s: %8.1f MB/s, %7.1f ns per read\n",
+           read_size, spans ? "spans   " : "per byte", copied * 1e3 / elapsed, (double)elapsed / reads);
+}
+
+static void bench_read(size_t read_size) {
+    struct bench_stream stream = { .random = 2463534242U };
+    char *buffer = malloc(read_size);
+    size_t copied = 0;
+    u64 start, elapsed, reads = 0;
+
+    if(!buffer) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+
+    generate(&stream);
+
+    start = now_ns();
+    while(copied < BENCH_READ_BYTES) {
+        // one read() call, through the read loop of the module
+        copied += heartbeat_copy(&stream.heartbeat, read_size, next, copy, buffer);
+        reads++;
+    }
+    elapsed = now_ns() - start;
+    sink = buffer[read_size - 1];
+    free(buffer);
+
+    printf("read %6zu bytes: %8.1f MB/s, %7.1f ns per read\n",
+           read_size, copied * 1e3 / elapsed, (double)elapsed / reads);
+}
+
+static void bench_cpu_stat(unsigned int cpus) {
+    struct bench_cpu *cpu = aligned_alloc(64, cpus * sizeof(*cpu));
+    struct devheart_cpu_baseline_t *baselines = calloc(cpus, sizeof(*baselines));
+    struct devheart_cpu_sample_t sample = { 0 };
+    u64 accumulated_idle = 0, accumulated_total = 0;
+    u64 idle, busy, start, elapsed;
+    unsigned int round, i;
+
+    if(!cpu || !baselines) {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    memset(cpu, 0, cpus * sizeof(*cpu));
+
+    start = now_ns();
+    for(round = 0; round < BENCH_SAMPLES; round++) {
+        // mirrors cpu_stat() of the module: read every CPU once and accumulate its delta
+        for(i = 0; i < cpus; i++) {
+            const u64 *cpustat = cpu[i].cpustat;
+
+            busy = cpustat[CPUTIME_USER] + cpustat[CPUTIME_NICE] + cpustat[CPUTIME_SYSTEM]
+                + cpustat[CPUTIME_IRQ] + cpustat[CPUTIME_SOFTIRQ] + cpustat[CPUTIME_STEAL];
+            idle = cpu[i].idle + cpu[i].iowait;
+            cpu_times_accumulate(&baselines[i], idle, busy, &accumulated_idle, &accumulated_total);
+
+            // let some time pass on the simulated CPU
+            cpu[i].cpustat[CPUTIME_USER] += i & 3;
+            cpu[i].idle += 3 - (i & 3);
+        }
+        cpu_sample_update(&sample, accumulated_idle, accumulated_total, round + 1, 0);
+    }
+    elapsed = now_ns() - start;
+    sink = sample.utilization;
+
+    printf("cpu_stat over %4u CPUs: %9.1f ns per sample, %5.2f ns per CPU\n",
+           cpus, (double)elapsed / BENCH_SAMPLES, (double)elapsed / BENCH_SAMPLES / cpus);
+
+    free(baselines);
+    free(cpu);
+}
+
+int main(void) {
+    size_t read_size;
+    unsigned int cpus, format;
+
+    memset(silence, 0xFF, sizeof(silence));
+
+    bench_generate();
+    bench_synth();
+    bench_adpcm();
+
+    for(format = 0; format < DEVHEART_NR_FORMATS; format++) {
+        bench_format(format);
+    }
+
+    for(read_size = 64; read_size <= 64 * 1024; read_size *= 4) {
+        bench_read_flat(read_size, false);
+        bench_read_flat(read_size, true);
+    }
+
+    for(read_size = 64; read_size <= 64 * 1024; read_size *= 4) {
+        bench_read(read_size);
+    }
+
+    for(cpus = 1; cpus <= 4096; cpus *= 2) {
+        bench_cpu_stat(cpus);
+    }
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Kernel types and helpers the heartbeat engine core needs, for its userspace build.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifndef DEVHEART_USERSPACE_H
+#define DEVHEART_USERSPACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/types.h>
+
+typedef int8_t s8;
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define min_t(type, a, b) min((type)(a), (type)(b))
+#define max_t(type, a, b) max((type)(a), (type)(b))
+
+static inline int fls(unsigned int x) {
+    return x ? 32 - __builtin_clz(x) : 0;
+}
+#define clamp(value, low, high) min(max(value, low), high)
+#define clamp_t(type, value, low, high) clamp((type)(value), (type)(low), (type)(high))
+
+#define container_of(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+#define likely(x) __builtin_expect(!!(x), 1)
+#define unlikely(x) __builtin_expect(!!(x), 0)
+
+#define div64_u64(dividend, divisor) ((u64)(dividend) / (u64)(divisor))
+#define div_u64(dividend, divisor) ((u64)(dividend) / (u32)(divisor))
+#define div_s64(dividend, divisor) ((s64)(dividend) / (s32)(divisor))
+
+#endif /* DEVHEART_USERSPACE_H */
@@ -0,0 +1,104 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> IMA ADPCM decoder, built into the module and into the userspace benchmarks.
+ *
+ * Samples are encoded by `audio2header.py --adpcm` in blocks of a 4 byte
+ * header (s16_le first frame, u8 step index, u8 reserved) followed by two
+ * frames per byte, low nibble first. Every block decodes on its own.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#include "heartbeat.h"
+
+#define ADPCM_BLOCK_SIZE 256
+#define ADPCM_BLOCK_HEADER 4
+#define ADPCM_BLOCK_FRAMES (1 + 2 * (ADPCM_BLOCK_SIZE - ADPCM_BLOCK_HEADER))
+
+static const s8 adpcm_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8,
+};
+
+static const u16 adpcm_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+};
+
+// Returns the bytes of IMA ADPCM size bytes of PCM are encoded in.
+size_t adpcm_encoded_size(size_t size) {
+    size_t frames = size / SAMPLE_SIZE;
+    size_t blocks = frames / ADPCM_BLOCK_FRAMES;
+    size_t rest = frames % ADPCM_BLOCK_FRAMES;
+
+    if(rest) {
+        return blocks * ADPCM_BLOCK_SIZE + ADPCM_BLOCK_HEADER + rest / 2;
+    }
+    return blocks * ADPCM_BLOCK_SIZE;
+}
+
+static inline void adpcm_put_frame(char *data, int frame) {
+    data[0] = frame & 0xff;
+    data[1] = (frame >> 8) & 0xff;
+}
+
+static inline int adpcm_decode_nibble(u8 nibble, int *predictor, int *index) {
+    int step = adpcm_step_table[*index];
+    int delta = step >> 3;
+
+    if(nibble & 4) {
+        delta += step;
+    }
+    if(nibble & 2) {
+        delta += step >> 1;
+    }
+    if(nibble & 1) {
+        delta += step >> 2;
+    }
+
+    *predictor = clamp(*predictor + ((nibble & 8) ? -delta : delta), -32768, 32767);
+    *index = clamp(*index + adpcm_index_table[nibble], 0, 88);
+    return *predictor;
+}
+
+// Decodes the samples into sound, which must hold adpcm->size bytes of data.
+void adpcm_decode(struct devheart_sound_t *sound, const struct devheart_adpcm_sound_t *adpcm) {
+    size_t frames = adpcm->size / SAMPLE_SIZE;
+    const u8 *block = adpcm->data;
+    const u8 *nibbles;
+    char *data = sound->data;
+    size_t frame, block_frames, i;
+    int predictor, index;
+
+    for(frame = 0; frame < frames; frame += block_frames, block += ADPCM_BLOCK_SIZE) {
+        block_frames = min_t(size_t, frames - frame, ADPCM_BLOCK_FRAMES);
+        nibbles = block + ADPCM_BLOCK_HEADER;
+
+        predictor = (s16)(block[0] | block[1] << 8);
+        index = min_t(int, block[2], 88);
+        adpcm_put_frame(data, predictor);
+        data += SAMPLE_SIZE;
+
+        for(i = 1; i + 1 < block_frames; i += 2, nibbles++) {
+            adpcm_put_frame(data, adpcm_decode_nibble(*nibbles & 0x0f, &predictor, &index));
+            adpcm_put_frame(data + SAMPLE_SIZE, adpcm_decode_nibble(*nibbles >> 4, &predictor, &index));
+            data += 2 * SAMPLE_SIZE;
+        }
+
+        // the last byte of a block with an even number of frames is only half used
+        if(i < block_frames) {
+            adpcm_put_frame(data, adpcm_decode_nibble(*nibbles & 0x0f, &predictor, &index));
+            data += SAMPLE_SIZE;
+        }
+    }
+
+    sound->size = frames * SAMPLE_SIZE;
+}
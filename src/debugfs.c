@@ -0,0 +1,114 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> debugfs instrumentation in /sys/kernel/debug/devheart/.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+
+#include "devheart.h"
+
+DEFINE_PER_CPU(struct devheart_stats_t, devheart_stats);
+
+static struct dentry *debugfs_dir;
+
+static const char * const stat_names[NR_STATS] = {
+    [STAT_BYTES_SERVED] = "bytes_served",
+    [STAT_READ_CALLS] = "read_calls",
+    [STAT_GENERATE_CALLS] = "generate_heartbeat_calls",
+    [STAT_TEMPLATE_HITS] = "template_cache_hits",
+    [STAT_TEMPLATE_MISSES] = "template_cache_misses",
+    [STAT_ALLOC_FAILURES] = "allocation_failures",
+    [STAT_SAMPLER_RUNS] = "sampler_runs",
+    [STAT_CPU_STAT_CALLS] = "cpu_stat_calls",
+    [STAT_OPENS] = "opens",
+    [STAT_RELEASES] = "releases",
+};
+
+static const char * const histogram_names[NR_HISTOGRAMS] = {
+    [HISTOGRAM_READ_SIZE] = "read_size_bytes",
+    [HISTOGRAM_GENERATE_NS] = "generate_heartbeat_ns",
+    [HISTOGRAM_CPU_STAT_NS] = "cpu_stat_ns",
+};
+
+// sums a counter over all CPUs, only ever done by the (rare) debugfs reader
+static unsigned long stat_sum(enum devheart_stat stat) {
+    unsigned long sum = 0;
+    int cpu;
+
+    for_each_possible_cpu(cpu) {
+        sum += per_cpu(devheart_stats, cpu).counters[stat];
+    }
+    return sum;
+}
+
+static int stats_show(struct seq_file *m, void *v) {
+    unsigned int stat;
+
+    for(stat = 0; stat < NR_STATS; stat++) {
+        seq_printf(m, "%s: %lu\n", stat_names[stat], stat_sum(stat));
+    }
+    seq_printf(m, "active_opens: %ld\n", (long)(stat_sum(STAT_OPENS) - stat_sum(STAT_RELEASES)));
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(stats);
+
+static int histograms_show(struct seq_file *m, void *v) {
+    unsigned long buckets[HISTOGRAM_BUCKETS];
+    unsigned int histogram, bucket;
+    int cpu;
+
+    for(histogram = 0; histogram < NR_HISTOGRAMS; histogram++) {
+        memset(buckets, 0, sizeof(buckets));
+        for_each_possible_cpu(cpu) {
+            for(bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+                buckets[bucket] += per_cpu(devheart_stats, cpu).histograms[histogram][bucket];
+            }
+        }
+
+        seq_printf(m, "%s:\n", histogram_names[histogram]);
+        for(bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+            if(!buckets[bucket]) {
+                continue;
+            }
+            if(bucket == HISTOGRAM_BUCKETS - 1) {
+                seq_printf(m, "  >= %llu: %lu\n", 1ULL << (bucket - 1), buckets[bucket]);
+            }
+            else {
+                seq_printf(m, "  < %llu: %lu\n", 1ULL << bucket, buckets[bucket]);
+            }
+        }
+    }
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(histograms);
+
+static int template_cache_show(struct seq_file *m, void *v) {
+    seq_printf(m, "hits: %lu\n", stat_sum(STAT_TEMPLATE_HITS));
+    seq_printf(m, "misses: %lu\n", stat_sum(STAT_TEMPLATE_MISSES));
+    seq_printf(m, "cached_levels: %u\n", template_cache_levels());
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(template_cache);
+
+// debugfs is best effort, the module works without it
+void devheart_debugfs_init(void) {
+    debugfs_dir = debugfs_create_dir(KBUILD_MODNAME, NULL);
+    debugfs_create_file("stats", S_IRUSR, debugfs_dir, NULL, &stats_fops);
+    debugfs_create_file("histograms", S_IRUSR, debugfs_dir, NULL, &histograms_fops);
+    debugfs_create_file("template_cache", S_IRUSR, debugfs_dir, NULL, &template_cache_fops);
+}
+
+void devheart_debugfs_exit(void) {
+    debugfs_remove_recursive(debugfs_dir);
+}
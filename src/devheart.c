@@ -13,292 +13,868 @@
 #include <linux/kernel.h>
 #include <linux/init.h>
 #include <linux/fs.h>
+#include <linux/splice.h> // SPLICE_F_NONBLOCK
 #include <linux/miscdevice.h>
 #include <linux/slab.h>
-#include <linux/uaccess.h>
-#include <linux/kthread.h>
+#include <linux/uio.h> // copy_to_iter
+#include <linux/workqueue.h>
 #include <linux/sched.h>
-#include <linux/cpumask.h> // for_each_possible_cpu
+#include <linux/mutex.h>
+#include <linux/atomic.h>
+#include <linux/cpumask.h> // for_each_online_cpu
+#include <linux/percpu.h>
+#include <linux/spinlock.h>
+#include <linux/ktime.h>
 #include <linux/kernel_stat.h> // kcpustat_cpu
-#include <linux/delay.h> // msleep_interruptible
 #include <linux/tick.h> // get_cpu_idle_time_us
-#include <linux/vmalloc.h> // vmalloc
+#include <linux/gfp.h> // __get_free_page
+#include <linux/moduleparam.h>
+#include <linux/jiffies.h>
+#include <linux/math64.h> // div_s64, div64_u64
+#include <linux/uaccess.h> // get_user, put_user
 
 #include "devheart.h"
 
+#define CREATE_TRACE_POINTS
+#include "devheart_trace.h"
+
 // module header information
 MODULE_LICENSE("GPL");
 MODULE_AUTHOR("Timo Furrer");
 MODULE_DESCRIPTION("Kernel Module to listen to Tuxs heart.");
 
-// device name to use
+// device names to use
 #define DEVICE_NAME "heart"
+#define LIVE_DEVICE_NAME "heart-live"
+#define WAV_DEVICE_NAME "heart.wav"
 
-// interval in milliseconds in which to measure CPU utilization
+// default and bounds of the interval in milliseconds in which to measure CPU utilization
 #define CPU_MEASURE_INTERVAL 1000
+#define CPU_MEASURE_INTERVAL_MIN 10
+#define CPU_MEASURE_INTERVAL_MAX 60000
+
+// number of samples to average in the cpu_stat microbenchmark
+#define BENCH_CPU_STAT_ROUNDS 1000
+
+// sample CPU utilization only when the next heartbeat is generated
+static bool lazy_sampling;
+module_param(lazy_sampling, bool, S_IRUGO);
+MODULE_PARM_DESC(lazy_sampling, "Measure CPU utilization per heartbeat instead of every second (default: off)");
+
+static unsigned int sample_interval_ms = CPU_MEASURE_INTERVAL;
 
-// base factor for pause length between heartbeats
-#define BASE_PAUSE_FACTOR 64
+static int sample_interval_set(const char *val, const struct kernel_param *kp) {
+    unsigned int interval;
+    int ret;
+
+    ret = kstrtouint(val, 0, &interval);
+    if(ret) {
+        return ret;
+    }
 
-// heart beat sound data
-extern struct devheart_sound_t left_ventricle_beat_sound;
-extern struct devheart_sound_t right_ventricle_beat_sound;
+    if(interval < CPU_MEASURE_INTERVAL_MIN || interval > CPU_MEASURE_INTERVAL_MAX) {
+        return -EINVAL;
+    }
 
-// kernel thread instance
-struct task_struct *task;
+    WRITE_ONCE(sample_interval_ms, interval);
+    return 0;
+}
 
-// current data which is being read
-// FIXME: refactor - find better way to do this ...
-struct devheart_sound_buffer_t {
-    char *buffer;
-    size_t size;
-    size_t current_offset;
-    int current_cpu_utilization;
+static const struct kernel_param_ops sample_interval_ops = {
+    .set = sample_interval_set,
+    .get = param_get_uint,
 };
 
+module_param_cb(sample_interval_ms, &sample_interval_ops, &sample_interval_ms, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(sample_interval_ms, "Interval in milliseconds in which to measure CPU utilization (10-60000, default: 1000)");
+
+// half-life of the utilization smoothing, 0 disables it
+static unsigned int half_life_ms;
+module_param(half_life_ms, uint, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(half_life_ms, "Half-life in milliseconds of the CPU utilization moving average (default: 0 = off)");
+
+// log the sampling cost against the number of CPUs when the module is loaded
+static bool bench_cpu_stat;
+module_param(bench_cpu_stat, bool, S_IRUGO);
+MODULE_PARM_DESC(bench_cpu_stat, "Benchmark cpu_stat against the number of online CPUs on load (default: off)");
+
+// CPU sampler shared by all listeners: started on first open, stopped on last release
+static void measure_cpu_utilization(struct work_struct *work);
+static DECLARE_DEFERRABLE_WORK(sampler_work, measure_cpu_utilization);
+static unsigned int sampler_users;
+static DEFINE_MUTEX(sampler_lock);
+
+// latest CPU utilization in percent, published lock-free to all readers
+static atomic_t current_cpu_utilization = ATOMIC_INIT(0);
+
 // single byte to represent the pause between two heartbeats (~silence)
 const char PAUSE_SOUND_BYTE = 0xFF;
 
-static u64 get_idle_time(int cpu)
+// page of silence per output format shared by all silence runs, PAUSE_SOUND_BYTEs in the native one
+static char *silence_pages[DEVHEART_NR_FORMATS];
+
+// page holding the WAV header of every output format, served in front of the first heartbeat of a WAV stream
+static u8 *wav_headers;
+static size_t wav_header_sizes[DEVHEART_NR_FORMATS];
+
+static DEFINE_PER_CPU(struct devheart_cpu_baseline_t, cpu_baseline);
+
+// CPU times accumulated from the per-CPU deltas of all online CPUs
+static u64 accumulated_idle_time;
+static u64 accumulated_total_time;
+static unsigned long accumulated_timestamp; // jiffies
+static DEFINE_SPINLOCK(cpu_stat_lock);
+
+static u64 get_idle_time(int cpu, const u64 *cpustat)
 {
-    u64 idle, idle_time = -1ULL;
+    u64 idle, idle_time;
 
-    if (cpu_online(cpu)) {
-        idle_time = get_cpu_idle_time_us(cpu, NULL);
-    }
+    idle_time = get_cpu_idle_time_us(cpu, NULL);
 
     if (idle_time == -1ULL) {
-        /* !NO_HZ or cpu offline so we can rely on cpustat.idle */
-        idle = kcpustat_cpu(cpu).cpustat[CPUTIME_IDLE];
+        /* !NO_HZ so we can rely on cpustat.idle */
+        idle = cpustat[CPUTIME_IDLE];
     }
     else {
-        idle = usecs_to_cputime64(idle_time);
+        idle = idle_time * NSEC_PER_USEC;
     }
 
     return idle;
 }
 
-static u64 get_iowait_time(int cpu)
+static u64 get_iowait_time(int cpu, const u64 *cpustat)
 {
-    u64 iowait, iowait_time = -1ULL;
+    u64 iowait, iowait_time;
 
-    if (cpu_online(cpu)) {
-        iowait_time = get_cpu_iowait_time_us(cpu, NULL);
-    }
+    iowait_time = get_cpu_iowait_time_us(cpu, NULL);
 
     if (iowait_time == -1ULL) {
-        /* !NO_HZ or cpu offline so we can rely on cpustat.iowait */
-        iowait = kcpustat_cpu(cpu).cpustat[CPUTIME_IOWAIT];
+        /* !NO_HZ so we can rely on cpustat.iowait */
+        iowait = cpustat[CPUTIME_IOWAIT];
     }
     else {
-        iowait = usecs_to_cputime64(iowait_time);
+        iowait = iowait_time * NSEC_PER_USEC;
     }
 
     return iowait;
 }
 
+/*
+ * Reads the raw idle and busy times of an online CPU. The busy fields are
+ * adjacent in the CPU's kernel_cpustat, so they are gathered in a single
+ * pass over one or two cache lines instead of one kcpustat_cpu() per field.
+ */
+static void read_cpu_times(int cpu, u64 *idle, u64 *busy) {
+    const u64 *cpustat = kcpustat_cpu(cpu).cpustat;
+
+    *busy = cpustat[CPUTIME_USER] + cpustat[CPUTIME_NICE] + cpustat[CPUTIME_SYSTEM]
+        + cpustat[CPUTIME_IRQ] + cpustat[CPUTIME_SOFTIRQ] + cpustat[CPUTIME_STEAL];
+    *idle = get_idle_time(cpu, cpustat) + get_iowait_time(cpu, cpustat);
+}
+
+/*
+ * Returns the accumulated idle and total CPU times. Only online CPUs are
+ * visited and each contributes the delta since its own baseline, so CPUs
+ * which are not present cost nothing and hotplug does not make the totals
+ * jump.
+ */
 void cpu_stat(u64 *idle_time, u64 *total_time) {
+    u64 idle, busy;
+    u64 start = ktime_get_ns();
     int i;
-    u64 user, nice, system, idle, iowait, irq, softirq, steal = 0;
 
-    for_each_possible_cpu(i) {
-        user += kcpustat_cpu(i).cpustat[CPUTIME_USER];
-        nice += kcpustat_cpu(i).cpustat[CPUTIME_NICE];
-        system += kcpustat_cpu(i).cpustat[CPUTIME_SYSTEM];
-        idle += get_idle_time(i);
-        iowait += get_iowait_time(i);
-        irq += kcpustat_cpu(i).cpustat[CPUTIME_IRQ];
-        softirq += kcpustat_cpu(i).cpustat[CPUTIME_SOFTIRQ];
-        steal += kcpustat_cpu(i).cpustat[CPUTIME_STEAL];
+    spin_lock(&cpu_stat_lock);
+    for_each_online_cpu(i) {
+        read_cpu_times(i, &idle, &busy);
+        cpu_times_accumulate(per_cpu_ptr(&cpu_baseline, i), idle, busy, &accumulated_idle_time, &accumulated_total_time);
     }
 
-    *idle_time = idle + iowait;
-    *total_time = *idle_time + user + nice + system + irq + softirq + steal;
+    accumulated_timestamp = jiffies;
+
+    *idle_time = accumulated_idle_time;
+    *total_time = accumulated_total_time;
+    spin_unlock(&cpu_stat_lock);
+
+    stat_inc(STAT_CPU_STAT_CALLS);
+    stat_histogram(HISTOGRAM_CPU_STAT_NS, ktime_get_ns() - start);
 }
 
-int measure_cpu_utilization(void *data) {
-    static u64 previous_cpu_idle_time = 0;
-    static u64 previous_cpu_total_time = 0;
-    struct devheart_sound_buffer_t *sound_buffer = data;
+/*
+ * Returns the accumulated idle and total CPU times of the CPUs
+ * first_cpu .. first_cpu + nr_cpus - 1. The per-CPU times are refreshed
+ * at most once per jiffy, so many groups sampled at once share one walk.
+ */
+static void cpu_group_stat(unsigned int first_cpu, unsigned int nr_cpus, u64 *idle_time, u64 *total_time) {
+    const struct devheart_cpu_baseline_t *baseline;
+    u64 idle, total;
+    unsigned int i;
 
-    u64 current_cpu_idle_time, current_cpu_total_time = 0;
-    u64 delta_idle_time, delta_total_time = 0;
+    if(READ_ONCE(accumulated_timestamp) != jiffies) {
+        cpu_stat(&idle, &total);
+    }
 
-    // initial fetch of cpu times
-    cpu_stat(&previous_cpu_idle_time, &previous_cpu_total_time);
+    idle = 0;
+    total = 0;
+
+    spin_lock(&cpu_stat_lock);
+    for(i = first_cpu; i < first_cpu + nr_cpus && i < nr_cpu_ids; i++) {
+        if(!cpu_possible(i)) {
+            continue;
+        }
+        baseline = per_cpu_ptr(&cpu_baseline, i);
+        idle += baseline->accumulated_idle;
+        total += baseline->accumulated_total;
+    }
+    spin_unlock(&cpu_stat_lock);
 
-    while(!kthread_should_stop()) {
-        msleep_interruptible(CPU_MEASURE_INTERVAL);
+    *idle_time = idle;
+    *total_time = total;
+}
 
-        // get current CPU stats
-        cpu_stat(&current_cpu_idle_time, &current_cpu_total_time);
+/*
+ * Logs the cost of reading the CPU times of 1, 2, 4, ... online CPUs, to
+ * see how sampling scales with the CPU count of the machine.
+ */
+static void bench_cpu_stat_scaling(void) {
+    unsigned int cpus, count, online = num_online_cpus();
+    u64 idle, busy;
+    ktime_t start;
+    s64 elapsed;
+    int i, round;
+
+    for(cpus = 1; ; cpus = min(cpus * 2, online)) {
+        start = ktime_get();
+        for(round = 0; round < BENCH_CPU_STAT_ROUNDS; round++) {
+            count = 0;
+            for_each_online_cpu(i) {
+                if(count++ == cpus) {
+                    break;
+                }
+                read_cpu_times(i, &idle, &busy);
+            }
+        }
+        elapsed = ktime_to_ns(ktime_sub(ktime_get(), start));
+
+        elapsed = div_s64(elapsed, BENCH_CPU_STAT_ROUNDS);
+        pr_info("cpu_stat over %u CPUs: %lld ns per sample, %lld ns per CPU\n",
+                cpus, elapsed, div_s64(elapsed, cpus));
+
+        if(cpus == online) {
+            break;
+        }
+    }
+}
 
-        // calculate CPU stat difference since last measurement
-        delta_idle_time = current_cpu_idle_time - previous_cpu_idle_time;
-        delta_total_time = current_cpu_total_time - previous_cpu_total_time;
+// Derives the CPU utilization from the given current CPU times and the previous sample.
+static int update_cpu_sample(struct devheart_cpu_sample_t *sample, u64 idle_time, u64 total_time) {
+    return cpu_sample_update(sample, idle_time, total_time, ktime_to_ms(ktime_get()), READ_ONCE(half_life_ms));
+}
+
+/*
+ * The very first sample only takes the baseline: its delta would span
+ * next to no time, so it starts at the last shared utilization instead.
+ */
+static int seed_cpu_sample(struct devheart_cpu_sample_t *sample, u64 idle_time, u64 total_time) {
+    sample->utilization = atomic_read(&current_cpu_utilization);
+    sample->smoothed = (u32)sample->utilization << EWMA_SHIFT;
+    sample->idle_time = idle_time;
+    sample->total_time = total_time;
+    sample->timestamp = max_t(unsigned long, ktime_to_ms(ktime_get()), 1);
+    return sample->utilization;
+}
 
-        // calculate CPU usage in percentage
-        sound_buffer->current_cpu_utilization = (1000 * (delta_total_time - delta_idle_time) / delta_total_time + 5) / 10;
-        pr_info("current CPU utilization is %d%%\n", sound_buffer->current_cpu_utilization);
+// Measures the CPU utilization of the whole machine since the given previous sample.
+static int sample_cpu_utilization(struct devheart_cpu_sample_t *sample) {
+    u64 idle_time, total_time;
 
-        previous_cpu_idle_time = current_cpu_idle_time;
-        previous_cpu_total_time = current_cpu_total_time;
+    cpu_stat(&idle_time, &total_time);
+    if(!sample->timestamp) {
+        return seed_cpu_sample(sample, idle_time, total_time);
     }
+    return update_cpu_sample(sample, idle_time, total_time);
+}
 
-    return 0;
+// Measures the CPU utilization of a CPU group since the given previous sample.
+int sample_cpu_group_utilization(struct devheart_cpu_sample_t *sample, unsigned int first_cpu, unsigned int nr_cpus) {
+    u64 idle_time, total_time;
+
+    cpu_group_stat(first_cpu, nr_cpus, &idle_time, &total_time);
+    if(!sample->timestamp) {
+        return seed_cpu_sample(sample, idle_time, total_time);
+    }
+    return update_cpu_sample(sample, idle_time, total_time);
 }
 
-static ssize_t generate_heartbeat(struct devheart_sound_buffer_t *sound_buffer) {
-    size_t data_size;
-    int utilization_factor, short_pause_factor, long_pause_factor;
-    size_t offset = 0;
+/*
+ * Starts the shared utilization at the average since boot, so the first
+ * heartbeats have something to go by before a sample has been taken.
+ */
+static void __init seed_cpu_utilization(void) {
+    u64 idle, busy, idle_time = 0, busy_time = 0;
+    u64 percent;
     int i;
 
-    pr_debug("=====> Generating new heartbeat ... for %d%%\n", sound_buffer->current_cpu_utilization);
+    for_each_online_cpu(i) {
+        read_cpu_times(i, &idle, &busy);
+        idle_time += idle;
+        busy_time += busy;
+    }
 
-    // TODO: experiment and improve!
-    utilization_factor = (100 - sound_buffer->current_cpu_utilization) / 6;
-    short_pause_factor = utilization_factor;
-    long_pause_factor = utilization_factor * 60;
+    // a hundredth of the total first, 100 * busy may not fit into 64 bits
+    percent = div64_u64(idle_time + busy_time, 100);
+    if(percent) {
+        atomic_set(&current_cpu_utilization, (int)min_t(u64, div64_u64(busy_time, percent), 100));
+    }
+}
+
+// previous measurement of the shared sampler, only touched by the sampler
+static struct devheart_cpu_sample_t sampler_sample;
 
-    // beats
-    data_size = left_ventricle_beat_sound.size + right_ventricle_beat_sound.size;
+/*
+ * Runs every sample_interval_ms on a deferrable timer, so an idle CPU
+ * is not woken up just to take a sample - it piggybacks on the next
+ * wakeup that happens anyway.
+ */
+static void measure_cpu_utilization(struct work_struct *work) {
+    u64 start = ktime_get_ns();
+    int utilization = sample_cpu_utilization(&sampler_sample);
 
-    // pause between the two beats
-    data_size += BASE_PAUSE_FACTOR * short_pause_factor;
+    stat_inc(STAT_SAMPLER_RUNS);
+    atomic_set(&current_cpu_utilization, utilization);
+    trace_devheart_sample(utilization, ktime_get_ns() - start);
 
-    // pause after the two beats
-    data_size += BASE_PAUSE_FACTOR * long_pause_factor;
+    queue_delayed_work(system_power_efficient_wq, &sampler_work, msecs_to_jiffies(READ_ONCE(sample_interval_ms)));
+}
 
-    // generate heartbeat
-    sound_buffer->buffer = vzalloc(data_size * sizeof(char));
-    if(!sound_buffer->buffer) {
-        pr_err("could not allocate kernel memory for next heartbeat -> defibrillate, NOW!\n");
-        return -ENOMEM;
+static void sampler_get(void) {
+    if(lazy_sampling) {
+        return;
     }
 
-    // write sound data to buffer
-    memcpy(sound_buffer->buffer, left_ventricle_beat_sound.data, left_ventricle_beat_sound.size);
-    offset += left_ventricle_beat_sound.size;
+    mutex_lock(&sampler_lock);
+    if(sampler_users++ == 0) {
+        // initial fetch of cpu times
+        sampler_sample.timestamp = 0;
+        sample_cpu_utilization(&sampler_sample);
+        queue_delayed_work(system_power_efficient_wq, &sampler_work, msecs_to_jiffies(READ_ONCE(sample_interval_ms)));
+    }
+    mutex_unlock(&sampler_lock);
+}
+
+static void sampler_put(void) {
+    if(lazy_sampling) {
+        return;
+    }
+
+    mutex_lock(&sampler_lock);
+    if(--sampler_users == 0) {
+        // also waits for a self-requeueing run to finish
+        cancel_delayed_work_sync(&sampler_work);
+    }
+    mutex_unlock(&sampler_lock);
+}
+
+/*
+ * Returns the heartbeat template of a tempo level, rendering it the
+ * first time the level is used.
+ */
+const struct devheart_beat_template_t *beat_template(struct devheart_samples_t *samples, unsigned int format,
+                                                     unsigned int level) {
+    struct devheart_beats_t *beats = samples_beats(samples, format);
+    struct devheart_beat_template_t *template = &beats->templates[level];
+
+    if(likely(smp_load_acquire(&template->ready))) {
+        stat_inc(STAT_TEMPLATE_HITS);
+        return template;
+    }
+
+    spin_lock(&samples->templates_lock);
+    if(!template->ready) {
+        heartbeat_render_template(template, level, beats->left[level], beats->right[level], &devheart_formats[format]);
+        smp_store_release(&template->ready, true);
+    }
+    spin_unlock(&samples->templates_lock);
+
+    stat_inc(STAT_TEMPLATE_MISSES);
+    return template;
+}
+
+size_t generate_heartbeat(struct devheart_sound_buffer_t *sound_buffer) {
+    const struct devheart_beat_template_t *template;
+    u64 start = ktime_get_ns();
+    unsigned int level;
+    int utilization;
 
-    for(i = 0; i < short_pause_factor * BASE_PAUSE_FACTOR; i++) {
-        memcpy(sound_buffer->buffer + offset, &PAUSE_SOUND_BYTE, sizeof(PAUSE_SOUND_BYTE));
-        offset += sizeof(PAUSE_SOUND_BYTE);
+    // lazily measure the utilization over the interval since the previous heartbeat
+    if(sound_buffer->nr_cpus) {
+        utilization = sample_cpu_group_utilization(&sound_buffer->cpu_sample, sound_buffer->first_cpu, sound_buffer->nr_cpus);
     }
+    else if(lazy_sampling) {
+        // the last measurement of any listener seeds the first beat of the next
+        utilization = sample_cpu_utilization(&sound_buffer->cpu_sample);
+        atomic_set(&current_cpu_utilization, utilization);
+    }
+    else {
+        utilization = atomic_read(&current_cpu_utilization);
+    }
+
+    // the utilization maps to one of a few tempo levels, each with a cached heartbeat
+    level = heartbeat_tempo_level(utilization);
+    samples_follow(&sound_buffer->samples);
+    template = beat_template(sound_buffer->samples, sound_buffer->format, level);
 
-    memcpy(sound_buffer->buffer + offset, right_ventricle_beat_sound.data, right_ventricle_beat_sound.size);
-    offset += right_ventricle_beat_sound.size;
+    heartbeat_start(&sound_buffer->heartbeat, template, silence_pages[sound_buffer->format], PAGE_SIZE);
 
-    for(i = 0; i < long_pause_factor * BASE_PAUSE_FACTOR; i++) {
-        memcpy(sound_buffer->buffer + offset, &PAUSE_SOUND_BYTE, sizeof(PAUSE_SOUND_BYTE));
-        offset += sizeof(PAUSE_SOUND_BYTE);
+    stat_inc(STAT_GENERATE_CALLS);
+    stat_histogram(HISTOGRAM_GENERATE_NS, ktime_get_ns() - start);
+    trace_devheart_generate(utilization, level, template->segments[SEGMENT_SHORT_PAUSE].size,
+                            template->segments[SEGMENT_LONG_PAUSE].size, template->size);
+    return template->size;
+}
+
+// Puts the heartbeat after the current one in place, on the live timeline or freshly generated.
+static void heartbeat_next(struct devheart_heartbeat_t *heartbeat) {
+    struct devheart_sound_buffer_t *sound_buffer = container_of(heartbeat, struct devheart_sound_buffer_t, heartbeat);
+
+    if(sound_buffer->live) {
+        live_next_beat(sound_buffer);
+    }
+    else {
+        generate_heartbeat(sound_buffer);
     }
+}
 
-    sound_buffer->size = data_size;
-    sound_buffer->current_offset = 0;
-    return data_size;
+/*
+ * Returns the contiguous span of sound data at the current read position
+ * and moves on to the next heartbeat if the current one is exhausted.
+ * Silence runs are handed out in chunks of at most one silence page.
+ */
+size_t heartbeat_span(struct devheart_sound_buffer_t *sound_buffer, const char **data) {
+    return heartbeat_span_at(&sound_buffer->heartbeat, heartbeat_next, data);
+}
+
+// Returns the contiguous span of sound data ahead bytes into the current heartbeat, 0 past its end.
+size_t heartbeat_span_ahead(struct devheart_sound_buffer_t *sound_buffer, size_t ahead, const char **data) {
+    return heartbeat_peek(&sound_buffer->heartbeat, ahead, data);
+}
+
+// Puts the WAV header of the stream format in front of the heartbeat just generated.
+static void wav_header_start(struct devheart_sound_buffer_t *sound_buffer) {
+    sound_buffer->heartbeat.segments[SEGMENT_HEADER].data = wav_headers + sound_buffer->format * WAV_HEADER_MAX;
+    sound_buffer->heartbeat.segments[SEGMENT_HEADER].size = wav_header_sizes[sound_buffer->format];
+}
+
+void heartbeat_advance(struct devheart_sound_buffer_t *sound_buffer, size_t length) {
+    sound_buffer->heartbeat.current_offset += length;
 }
 
+static size_t heartbeat_copy_iter(void *to, const char *data, size_t length) {
+    return copy_to_iter(data, length, to);
+}
+
+// Copies length bytes of the stream to the iterator, stops early on a fault and returns the bytes copied.
+size_t heartbeat_copy_to_iter(struct devheart_sound_buffer_t *sound_buffer, size_t length, struct iov_iter *to) {
+    return heartbeat_copy(&sound_buffer->heartbeat, length, heartbeat_next, heartbeat_copy_iter, to);
+}
+
+static struct miscdevice heart_live_dev;
+static struct miscdevice heart_wav_dev;
+
 static int device_open(struct inode *inode, struct file *file) {
     struct devheart_sound_buffer_t *sound_buffer;
+    bool live = file->private_data == &heart_live_dev; // set by misc_open()
+    bool wav = file->private_data == &heart_wav_dev;
 
     pr_info("Okay, let's listen to Master Tuxs heart ...\n");
 
     sound_buffer = kzalloc(sizeof(*sound_buffer), GFP_KERNEL);
     if(!sound_buffer) {
         pr_err("could not allocate kernel memory for heartbeat read data\n");
+        stat_inc(STAT_ALLOC_FAILURES);
         return -ENOMEM;
     }
+    mutex_init(&sound_buffer->lock);
+    pace_init(&sound_buffer->pace);
 
-    task = kthread_run(&measure_cpu_utilization, sound_buffer, "heartmonitor");
-    if(!task) {
-        pr_err("could not start kernel thread to measure CPU utilization\n");
-        return -ENOMEM;
-    }
+    sampler_get();
 
-    // generate first heartbeat on open to be ready when it staaaarts!
-    generate_heartbeat(sound_buffer);
+    if(live) {
+        // join the heartbeat everybody else is listening to right now
+        live_join(sound_buffer);
+    }
+    else {
+        // generate first heartbeat on open to be ready when it staaaarts!
+        generate_heartbeat(sound_buffer);
+        if(wav) {
+            sound_buffer->wav = true;
+            wav_header_start(sound_buffer);
+        }
+        pace_start(&sound_buffer->pace, SAMPLE_RATE * SAMPLE_SIZE, SAMPLE_SIZE);
+    }
 
     // store context object
     file->private_data = sound_buffer;
+
+    // reads honour IOCB_NOWAIT, so io_uring may complete them inline
+    file->f_mode |= FMODE_NOWAIT;
+
+    stat_inc(STAT_OPENS);
     return 0;
 }
 
 static int device_release(struct inode *inode, struct file *file) {
     struct devheart_sound_buffer_t *sound_buffer = file->private_data;
 
-    kthread_stop(task);
+    ring_release(sound_buffer);
+    pace_stop(&sound_buffer->pace);
+    if(sound_buffer->live) {
+        live_leave(sound_buffer);
+    }
+    sampler_put();
+    samples_put(sound_buffer->samples);
     kfree(sound_buffer);
+    stat_inc(STAT_RELEASES);
 
     pr_info("I'll check in on you later, Master Tux!\n");
     return 0;
 }
 
-static ssize_t device_read(struct file *file, char *buffer, size_t length, loff_t *offset) {
+static ssize_t device_read_iter(struct kiocb *iocb, struct iov_iter *to) {
     struct devheart_sound_buffer_t *sound_buffer;
+    bool nonblock = (iocb->ki_flags & IOCB_NOWAIT) || (iocb->ki_filp->f_flags & O_NONBLOCK);
+    size_t requested = iov_iter_count(to);
+    size_t length = requested;
     size_t bytes_read;
+    ssize_t allowed;
 
     // read sound buffer
-    sound_buffer = file->private_data;
+    sound_buffer = iocb->ki_filp->private_data;
 
-    // check if current sound buffer is exhausted
-    if(sound_buffer->size - sound_buffer->current_offset <= 0) {
-        // generate next heartbeat including pauses
-        vfree(sound_buffer->buffer - sound_buffer->current_offset);
-        generate_heartbeat(sound_buffer);
+    // in paced mode only serve what is due by now
+    allowed = pace_wait_for(&sound_buffer->pace, nonblock, length);
+    if(allowed < 0) {
+        return allowed;
+    }
+    length = allowed;
+
+    if(iocb->ki_flags & IOCB_NOWAIT) {
+        if(!mutex_trylock(&sound_buffer->lock)) {
+            return -EAGAIN;
+        }
+    }
+    else {
+        mutex_lock(&sound_buffer->lock);
+    }
+
+    // the stream belongs to the ring once it is mapped
+    if(sound_buffer->ring) {
+        mutex_unlock(&sound_buffer->lock);
+        return -EBUSY;
     }
 
-    bytes_read = 0;
-    while(length && (sound_buffer->size - sound_buffer->current_offset) > 0) {
-        put_user(*(sound_buffer->buffer++), buffer++);
-        length--;
-        sound_buffer->current_offset++;
-        bytes_read++;
+    bytes_read = heartbeat_copy_to_iter(sound_buffer, length, to);
+    length -= bytes_read;
+
+    pace_consume(&sound_buffer->pace, bytes_read);
+    mutex_unlock(&sound_buffer->lock);
+
+    stat_inc(STAT_READ_CALLS);
+    stat_add(STAT_BYTES_SERVED, bytes_read);
+    stat_histogram(HISTOGRAM_READ_SIZE, bytes_read);
+
+    trace_devheart_read(requested, bytes_read);
+
+    if(length && !bytes_read) {
+        return -EFAULT;
     }
 
-    *offset = bytes_read;
+    iocb->ki_pos += bytes_read;
     return bytes_read;
 }
 
+static ssize_t device_splice_read(struct file *file, loff_t *offset, struct pipe_inode_info *pipe,
+                                  size_t length, unsigned int flags) {
+    struct devheart_sound_buffer_t *sound_buffer = file->private_data;
+    ssize_t allowed;
+    ssize_t ret;
+
+    // in paced mode only splice what is due by now
+    allowed = pace_wait_for(&sound_buffer->pace, (flags & SPLICE_F_NONBLOCK) || (file->f_flags & O_NONBLOCK), length);
+    if(allowed < 0) {
+        return allowed;
+    }
+
+    mutex_lock(&sound_buffer->lock);
+
+    // the stream belongs to the ring once it is mapped
+    if(sound_buffer->ring) {
+        mutex_unlock(&sound_buffer->lock);
+        return -EBUSY;
+    }
+
+    ret = heartbeat_splice_read(sound_buffer, pipe, allowed);
+    mutex_unlock(&sound_buffer->lock);
+
+    if(ret > 0) {
+        stat_add(STAT_BYTES_SERVED, ret);
+        *offset += ret;
+    }
+    return ret;
+}
+
+static __poll_t device_poll(struct file *file, poll_table *wait) {
+    struct devheart_sound_buffer_t *sound_buffer = file->private_data;
+
+    if(READ_ONCE(sound_buffer->ring)) {
+        return ring_poll(sound_buffer, file, wait);
+    }
+
+    return pace_poll(&sound_buffer->pace, file, wait);
+}
+
+static int device_mmap(struct file *file, struct vm_area_struct *vma) {
+    return ring_mmap(file->private_data, vma);
+}
+
+/*
+ * Switches the stream of an open heart to another output format. The
+ * stream restarts with a fresh heartbeat and pacing in the new format.
+ */
+static int set_format(struct devheart_sound_buffer_t *sound_buffer, unsigned int format) {
+    const struct devheart_format_t *f;
+    int ret;
+
+    if(format >= DEVHEART_NR_FORMATS) {
+        return -EINVAL;
+    }
+
+    // the live heartbeat is shared and only beats in the native format
+    if(sound_buffer->live) {
+        return format == DEVHEART_FORMAT_S16_LE_44100 ? 0 : -EINVAL;
+    }
+
+    ret = samples_use_format(format);
+    if(ret) {
+        return ret;
+    }
+
+    mutex_lock(&sound_buffer->lock);
+    if(sound_buffer->ring) {
+        mutex_unlock(&sound_buffer->lock);
+        return -EBUSY;
+    }
+
+    // a WAV stream cannot change its format once its header is on the way
+    if(sound_buffer->wav &&
+       (sound_buffer->heartbeat.current_segment != SEGMENT_HEADER || sound_buffer->heartbeat.current_offset)) {
+        mutex_unlock(&sound_buffer->lock);
+        return -EBUSY;
+    }
+
+    f = &devheart_formats[format];
+    sound_buffer->format = format;
+    generate_heartbeat(sound_buffer);
+    if(sound_buffer->wav) {
+        wav_header_start(sound_buffer);
+    }
+    pace_stop(&sound_buffer->pace);
+    pace_start(&sound_buffer->pace, f->rate * f->frame_size, f->frame_size);
+    mutex_unlock(&sound_buffer->lock);
+    return 0;
+}
+
+static long device_ioctl(struct file *file, unsigned int cmd, unsigned long arg) {
+    struct devheart_sound_buffer_t *sound_buffer = file->private_data;
+    u32 __user *argp = (u32 __user *)arg;
+    u32 format;
+
+    switch(cmd) {
+    case DEVHEART_GET_FORMAT:
+        return put_user(READ_ONCE(sound_buffer->format), argp);
+    case DEVHEART_SET_FORMAT:
+        if(get_user(format, argp)) {
+            return -EFAULT;
+        }
+        return set_format(sound_buffer, format);
+    default:
+        return -ENOTTY;
+    }
+}
+
 static ssize_t device_write(struct file *file, const char *buffer, size_t length, loff_t *offset) {
-    pr_err("I'm sooo sorry, but you cannot influence Master Tux' healt ...\n");
+    pr_err_ratelimited("I'm sooo sorry, but you cannot influence Master Tux' healt ...\n");
     return -EINVAL;
 }
 
 static const struct file_operations fileops = {
     .owner = THIS_MODULE,
-    .read = device_read,
+    .read_iter = device_read_iter,
+    .splice_read = device_splice_read,
     .write = device_write,
+    .poll = device_poll,
+    .mmap = device_mmap,
+    .unlocked_ioctl = device_ioctl,
+    .compat_ioctl = compat_ptr_ioctl,
     .open = device_open,
     .release = device_release
 };
 
+// writable for everybody, a shared writable mmap() of the ring needs a file opened O_RDWR
 static struct miscdevice heart_dev = {
     .minor = MISC_DYNAMIC_MINOR,
     .name = DEVICE_NAME,
     .fops = &fileops,
+    .mode = S_IRUGO | S_IWUGO,
+};
+
+static struct miscdevice heart_live_dev = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name = LIVE_DEVICE_NAME,
+    .fops = &fileops,
     .mode = S_IRUGO,
 };
 
+static struct miscdevice heart_wav_dev = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name = WAV_DEVICE_NAME,
+    .fops = &fileops,
+    .mode = S_IRUGO,
+};
+
+static int __init wav_headers_init(void) {
+    unsigned int format;
+
+    BUILD_BUG_ON(DEVHEART_NR_FORMATS * WAV_HEADER_MAX > PAGE_SIZE);
+
+    // a page of its own, pipes may keep it after the module is gone
+    wav_headers = (u8 *)get_zeroed_page(GFP_KERNEL);
+    if(!wav_headers) {
+        pr_err("could not allocate kernel memory for the WAV headers\n");
+        stat_inc(STAT_ALLOC_FAILURES);
+        return -ENOMEM;
+    }
+
+    for(format = 0; format < DEVHEART_NR_FORMATS; format++) {
+        wav_header_sizes[format] = format_wav_header(&devheart_formats[format], wav_headers + format * WAV_HEADER_MAX);
+    }
+    return 0;
+}
+
+static void silence_exit(void) {
+    unsigned int format;
+
+    for(format = 0; format < DEVHEART_NR_FORMATS; format++) {
+        free_page((unsigned long)silence_pages[format]);
+    }
+}
+
+// Fills one silence page per output format with the pause sample in that format.
+static int __init silence_init(void) {
+    s16 pause = (s16)((u8)PAUSE_SOUND_BYTE | (u8)PAUSE_SOUND_BYTE << 8);
+    unsigned int format;
+
+    for(format = 0; format < DEVHEART_NR_FORMATS; format++) {
+        silence_pages[format] = (char *)__get_free_page(GFP_KERNEL);
+        if(!silence_pages[format]) {
+            pr_err("could not allocate kernel memory for the silence between heartbeats\n");
+            stat_inc(STAT_ALLOC_FAILURES);
+            silence_exit();
+            return -ENOMEM;
+        }
+        format_fill(&devheart_formats[format], silence_pages[format], PAGE_SIZE, pause);
+    }
+    return 0;
+}
+
 static int __init heart_init(void)
 {
     int ret;
 
+    seed_cpu_utilization();
+
+    ret = silence_init();
+    if(ret) {
+        return ret;
+    }
+
+    ret = wav_headers_init();
+    if(ret) {
+        goto err_free_silence;
+    }
+
+    ret = samples_init();
+    if(ret) {
+        goto err_free_wav_headers;
+    }
+
     ret = misc_register(&heart_dev);
     if(ret) {
         pr_err("could not register heart device as misc devie\n");
-        return ret;
+        goto err_samples;
+    }
+
+    ret = misc_register(&heart_live_dev);
+    if(ret) {
+        pr_err("could not register live heart device as misc device\n");
+        goto err_deregister;
+    }
+
+    ret = misc_register(&heart_wav_dev);
+    if(ret) {
+        pr_err("could not register WAV heart device as misc device\n");
+        goto err_deregister_live;
+    }
+
+    ret = multichannel_init();
+    if(ret) {
+        goto err_deregister_wav;
+    }
+
+    ret = samples_attach(heart_dev.this_device);
+    if(ret) {
+        goto err_multichannel;
+    }
+
+    devheart_debugfs_init();
+
+    if(bench_cpu_stat) {
+        bench_cpu_stat_scaling();
     }
 
     pr_info("Listen to Tux's heart!\n");
     pr_info("--> cat /dev/" DEVICE_NAME " | aplay -r 44100 -f s16_le\n");
+    pr_info("--> cat /dev/" LIVE_DEVICE_NAME " | aplay -r 44100 -f s16_le\n");
+    pr_info("--> aplay /dev/" WAV_DEVICE_NAME "\n");
 
     return 0;
+
+err_multichannel:
+    multichannel_exit();
+err_deregister_wav:
+    misc_deregister(&heart_wav_dev);
+err_deregister_live:
+    misc_deregister(&heart_live_dev);
+err_deregister:
+    misc_deregister(&heart_dev);
+err_samples:
+    samples_exit();
+err_free_wav_headers:
+    free_page((unsigned long)wav_headers);
+err_free_silence:
+    silence_exit();
+    return ret;
 }
 
 static void __exit heart_exit(void)
 {
+    devheart_debugfs_exit();
+    multichannel_exit();
+    misc_deregister(&heart_wav_dev);
+    misc_deregister(&heart_live_dev);
     misc_deregister(&heart_dev);
+    samples_exit();
+    free_page((unsigned long)wav_headers);
+    silence_exit();
 }
 
 module_init(heart_init);
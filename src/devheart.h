@@ -7,13 +7,196 @@
  */
 
 #ifndef DEVHEART_H
+#define DEVHEART_H
 
 #include <linux/kernel.h> // size_t
+#include <linux/types.h>
+#include <linux/ktime.h>
+#include <linux/hrtimer.h>
+#include <linux/wait.h>
+#include <linux/poll.h>
+#include <linux/mutex.h>
+#include <linux/mm_types.h> // vm_area_struct
+#include <linux/percpu.h>
+#include <linux/bitops.h> // fls64
+#include <linux/kref.h>
+#include <linux/rcupdate.h>
+#include <linux/spinlock.h>
 
-// raw sound data
-struct devheart_sound_t {
-    size_t size;
-    char data[];
+#include "heartbeat.h"
+
+// real-time pacing state of a reader
+struct devheart_pace_t {
+    bool enabled;
+    bool timeline; // bytes_served is a position on a shared timeline and never skips
+    ktime_t start;
+    u64 bytes_served;
+    u32 byte_rate;
+    u32 frame_size;
+    struct hrtimer timer; // wakes the reader once its next frame is due
+    wait_queue_head_t wait;
+};
+
+// longest name of a sample set
+#define DEVHEART_SAMPLES_NAME_MAX 32
+
+// beats of a sample set in one output format, with the heartbeat templates made of them
+struct devheart_beats_t {
+    const struct devheart_sound_t *left[TEMPO_LEVELS];
+    const struct devheart_sound_t *right[TEMPO_LEVELS];
+    struct devheart_beat_template_t templates[TEMPO_LEVELS];
+    char *data; // vmalloc()ed block of converted beats, NULL for the native ones
+};
+
+// a set of beat samples and the heartbeat templates rendered from it
+struct devheart_samples_t {
+    struct kref ref;
+    struct rcu_head rcu;
+    // beats of each tempo level, the same for all levels unless synthesized
+    struct devheart_beats_t native;
+    struct devheart_beats_t *converted[DEVHEART_NR_FORMATS]; // NULL until a listener chooses the format
+    char *data; // vmalloc()ed block holding the beats
+    spinlock_t templates_lock;
+    char name[DEVHEART_SAMPLES_NAME_MAX];
+};
+
+struct devheart_ring_t;
+
+// current heartbeat which is being read
+struct devheart_sound_buffer_t {
+    struct devheart_cpu_sample_t cpu_sample; // only used with lazy_sampling or a CPU group
+    unsigned int first_cpu; // CPU group this heartbeat follows ...
+    unsigned int nr_cpus;   // ... or 0 to follow the whole machine
+    struct devheart_samples_t *samples; // the current heartbeat is made of, referenced
+    unsigned int format; // enum devheart_format of the stream
+    struct devheart_heartbeat_t heartbeat;
+    struct devheart_pace_t pace;
+    struct devheart_ring_t *ring; // mmap()ed ring which owns the stream, if any
+    bool wav; // starts with a WAV header
+    bool live; // follows the shared live timeline ...
+    u64 beat;  // ... and is in this beat of it
+    struct mutex lock; // serializes readers and the ring producer
+};
+
+// heartbeat generation and the read position within it
+size_t generate_heartbeat(struct devheart_sound_buffer_t *sound_buffer);
+size_t heartbeat_span(struct devheart_sound_buffer_t *sound_buffer, const char **data);
+size_t heartbeat_span_ahead(struct devheart_sound_buffer_t *sound_buffer, size_t ahead, const char **data);
+void heartbeat_advance(struct devheart_sound_buffer_t *sound_buffer, size_t length);
+struct iov_iter;
+size_t heartbeat_copy_to_iter(struct devheart_sound_buffer_t *sound_buffer, size_t length, struct iov_iter *to);
+
+// single byte to represent the pause between two heartbeats (~silence)
+extern const char PAUSE_SOUND_BYTE;
+
+// cached heartbeat of a tempo level in a format, rendered on first use
+const struct devheart_beat_template_t *beat_template(struct devheart_samples_t *samples, unsigned int format,
+                                                     unsigned int level);
+
+// beat samples, swappable at runtime
+struct device;
+int samples_init(void);
+int samples_attach(struct device *device);
+void samples_exit(void);
+void samples_put(struct devheart_samples_t *samples);
+void samples_hold(struct devheart_samples_t **held, struct devheart_samples_t *samples);
+void samples_follow(struct devheart_samples_t **held);
+int samples_use_format(unsigned int format);
+
+// beats of the samples in a format a listener has chosen with samples_use_format()
+static inline struct devheart_beats_t *samples_beats(struct devheart_samples_t *samples, unsigned int format) {
+    if(format == DEVHEART_FORMAT_S16_LE_44100) {
+        return &samples->native;
+    }
+    return smp_load_acquire(&samples->converted[format]);
+}
+
+// number of heartbeat templates of the current samples cached so far
+unsigned int template_cache_levels(void);
+
+// CPU utilization of a CPU group since the given previous sample
+int sample_cpu_group_utilization(struct devheart_cpu_sample_t *sample, unsigned int first_cpu, unsigned int nr_cpus);
+
+// pacing of reads to the real-time byte rate
+void pace_init(struct devheart_pace_t *pace);
+void pace_start(struct devheart_pace_t *pace, u32 byte_rate, u32 frame_size);
+void pace_start_at(struct devheart_pace_t *pace, u32 byte_rate, u32 frame_size, ktime_t start, u64 position);
+void pace_stop(struct devheart_pace_t *pace);
+size_t pace_available(const struct devheart_pace_t *pace);
+bool pace_lagging(const struct devheart_pace_t *pace);
+ssize_t pace_wait_for(struct devheart_pace_t *pace, bool nonblock, size_t length);
+void pace_consume(struct devheart_pace_t *pace, size_t length);
+__poll_t pace_poll(struct devheart_pace_t *pace, struct file *file, poll_table *wait);
+
+// mmap()able ring of PCM bytes
+int ring_mmap(struct devheart_sound_buffer_t *sound_buffer, struct vm_area_struct *vma);
+__poll_t ring_poll(struct devheart_sound_buffer_t *sound_buffer, struct file *file, poll_table *wait);
+void ring_release(struct devheart_sound_buffer_t *sound_buffer);
+
+// zero-copy splice into pipes
+struct pipe_inode_info;
+ssize_t heartbeat_splice_read(struct devheart_sound_buffer_t *sound_buffer, struct pipe_inode_info *pipe,
+                              size_t length);
+
+// live heartbeat timeline shared by all listeners
+void live_join(struct devheart_sound_buffer_t *sound_buffer);
+void live_next_beat(struct devheart_sound_buffer_t *sound_buffer);
+void live_leave(struct devheart_sound_buffer_t *sound_buffer);
+
+// counters exposed in debugfs
+enum devheart_stat {
+    STAT_BYTES_SERVED = 0,
+    STAT_READ_CALLS,
+    STAT_GENERATE_CALLS,
+    STAT_TEMPLATE_HITS,
+    STAT_TEMPLATE_MISSES,
+    STAT_ALLOC_FAILURES,
+    STAT_SAMPLER_RUNS,
+    STAT_CPU_STAT_CALLS,
+    STAT_OPENS,
+    STAT_RELEASES,
+    NR_STATS
 };
 
+// log2 histograms exposed in debugfs
+enum devheart_histogram {
+    HISTOGRAM_READ_SIZE = 0,  // bytes
+    HISTOGRAM_GENERATE_NS,
+    HISTOGRAM_CPU_STAT_NS,
+    NR_HISTOGRAMS
+};
+
+#define HISTOGRAM_BUCKETS 32
+
+// per-CPU, so updating them never contends on the hot paths
+struct devheart_stats_t {
+    unsigned long counters[NR_STATS];
+    unsigned long histograms[NR_HISTOGRAMS][HISTOGRAM_BUCKETS];
+};
+
+DECLARE_PER_CPU(struct devheart_stats_t, devheart_stats);
+
+static inline void stat_add(enum devheart_stat stat, unsigned long value) {
+    this_cpu_add(devheart_stats.counters[stat], value);
+}
+
+static inline void stat_inc(enum devheart_stat stat) {
+    this_cpu_inc(devheart_stats.counters[stat]);
+}
+
+// bucket n counts values in [2^(n-1), 2^n)
+static inline void stat_histogram(enum devheart_histogram histogram, u64 value) {
+    unsigned int bucket = min_t(unsigned int, fls64(value), HISTOGRAM_BUCKETS - 1);
+
+    this_cpu_inc(devheart_stats.histograms[histogram][bucket]);
+}
+
+// debugfs instrumentation
+void devheart_debugfs_init(void);
+void devheart_debugfs_exit(void);
+
+// multichannel device with one heartbeat per CPU group
+int multichannel_init(void);
+void multichannel_exit(void);
+
 #endif /* DEVHEART_H */
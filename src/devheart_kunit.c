@@ -0,0 +1,289 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> KUnit suite verifying and benchmarking the heartbeat generator and read path.
+ *
+ * Linked into the module by `make KUNIT=1` only, the suite runs
+ * once the module is loaded, e.g. in a UML or QEMU guest booted with the
+ * .kunitconfig of this repository, and checks that the segment based
+ * heartbeats are byte for byte what the original flat buffer generator
+ * produced before a faster read path is trusted.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#include <kunit/test.h>
+#include <linux/kernel.h>
+#include <linux/string.h> // memchr_inv
+#include <linux/vmalloc.h>
+#include <linux/uio.h> // iov_iter_kvec
+#include <linux/ktime.h>
+#include <linux/math64.h> // div64_u64
+#include <linux/sched.h> // cond_resched
+
+#include "devheart.h"
+
+// heartbeats generated in the generator benchmark
+#define KUNIT_BENCH_BEATS 100000
+
+// bytes read per read size in the read path benchmark
+#define KUNIT_BENCH_READ_BYTES (64 * 1024 * 1024)
+
+// largest read of the read path benchmark
+#define KUNIT_BENCH_READ_MAX (64 * 1024)
+
+// bytes the last read of a heartbeat reaches into the next one
+#define KUNIT_STRADDLE 64
+
+// read sizes cycled through while verifying, chosen to straddle segment and silence page boundaries
+static const size_t kunit_chunks[] = { 1, 3, 61, PAGE_SIZE - 1, PAGE_SIZE + 1, 3 * PAGE_SIZE };
+
+// state of a test case, set up by devheart_kunit_init()
+struct devheart_kunit_t {
+    struct devheart_sound_buffer_t sound_buffer;
+    char *expected; // reference heartbeat
+    char *actual;   // heartbeat as read, with room to straddle into the next one
+};
+
+// pause lengths of a utilization as the original generator computed them
+static void reference_pauses(int utilization, size_t *short_pause, size_t *long_pause) {
+    int utilization_factor = (100 - utilization) / 6;
+
+    *short_pause = BASE_PAUSE_FACTOR * utilization_factor;
+    *long_pause = BASE_PAUSE_FACTOR * utilization_factor * 60;
+}
+
+static size_t reference_heartbeat_size(const struct devheart_samples_t *samples, int utilization) {
+    unsigned int level = heartbeat_tempo_level(utilization);
+    size_t short_pause, long_pause;
+
+    reference_pauses(utilization, &short_pause, &long_pause);
+    return samples->native.left[level]->size + short_pause + samples->native.right[level]->size + long_pause;
+}
+
+/*
+ * Renders the heartbeat of a utilization into one flat buffer, the way
+ * the module did before heartbeats were described as segments.
+ */
+static size_t reference_heartbeat(const struct devheart_samples_t *samples, char *buffer, int utilization) {
+    const struct devheart_sound_t *left = samples->native.left[heartbeat_tempo_level(utilization)];
+    const struct devheart_sound_t *right = samples->native.right[heartbeat_tempo_level(utilization)];
+    size_t short_pause, long_pause;
+    size_t offset = 0;
+
+    reference_pauses(utilization, &short_pause, &long_pause);
+
+    memcpy(buffer + offset, left->data, left->size);
+    offset += left->size;
+
+    memset(buffer + offset, PAUSE_SOUND_BYTE, short_pause);
+    offset += short_pause;
+
+    memcpy(buffer + offset, right->data, right->size);
+    offset += right->size;
+
+    memset(buffer + offset, PAUSE_SOUND_BYTE, long_pause);
+    offset += long_pause;
+
+    return offset;
+}
+
+// Reads length bytes of the heartbeat into buffer, the way device_read_iter() does.
+static size_t kunit_read(struct devheart_sound_buffer_t *sound_buffer, char *buffer, size_t length) {
+    struct kvec kvec = { .iov_base = buffer, .iov_len = length };
+    struct iov_iter iter;
+
+    iov_iter_kvec(&iter, ITER_DEST, &kvec, 1, length);
+    return heartbeat_copy_to_iter(sound_buffer, length, &iter);
+}
+
+// Points the read position at the start of the cached heartbeat of a utilization.
+static const struct devheart_beat_template_t *kunit_start_heartbeat(struct devheart_sound_buffer_t *sound_buffer,
+                                                                    int utilization) {
+    const struct devheart_beat_template_t *template;
+
+    template = beat_template(sound_buffer->samples, DEVHEART_FORMAT_S16_LE_44100,
+                             heartbeat_tempo_level(utilization));
+    heartbeat_start(&sound_buffer->heartbeat, template, sound_buffer->heartbeat.silence,
+                    sound_buffer->heartbeat.silence_size);
+    return template;
+}
+
+// The cached heartbeat of every utilization is as long as the reference one.
+static void devheart_template_sizes(struct kunit *test) {
+    struct devheart_kunit_t *ctx = test->priv;
+    struct devheart_samples_t *samples = ctx->sound_buffer.samples;
+    const struct devheart_beat_template_t *template;
+    int utilization;
+
+    for(utilization = 0; utilization <= 100; utilization++) {
+        template = beat_template(samples, DEVHEART_FORMAT_S16_LE_44100, heartbeat_tempo_level(utilization));
+        KUNIT_EXPECT_EQ_MSG(test, template->size, reference_heartbeat_size(samples, utilization),
+                            "heartbeat at %d%%", utilization);
+    }
+}
+
+/*
+ * Walking the segments of the cached heartbeat of every utilization
+ * covers the reference heartbeat exactly: sample segments hold its
+ * bytes, silent ones stand for a run of pause bytes.
+ */
+static void devheart_segment_walk(struct kunit *test) {
+    struct devheart_kunit_t *ctx = test->priv;
+    const struct devheart_beat_template_t *template;
+    const struct devheart_segment_t *segment;
+    size_t size, offset;
+    int utilization, i;
+
+    for(utilization = 0; utilization <= 100; utilization++) {
+        size = reference_heartbeat(ctx->sound_buffer.samples, ctx->expected, utilization);
+        template = kunit_start_heartbeat(&ctx->sound_buffer, utilization);
+        KUNIT_EXPECT_NULL(test, template->segments[SEGMENT_HEADER].data);
+        KUNIT_EXPECT_EQ(test, template->segments[SEGMENT_HEADER].size, (size_t)0);
+
+        offset = 0;
+        for(i = 0; i < HEARTBEAT_SEGMENTS; i++) {
+            segment = &template->segments[i];
+            KUNIT_ASSERT_LE_MSG(test, offset + segment->size, size,
+                                "segment %d of the heartbeat at %d%% overruns it", i, utilization);
+            if(segment->data) {
+                KUNIT_EXPECT_EQ_MSG(test, memcmp(segment->data, ctx->expected + offset, segment->size), 0,
+                                    "segment %d of the heartbeat at %d%%", i, utilization);
+            } else {
+                KUNIT_EXPECT_NULL_MSG(test, memchr_inv(ctx->expected + offset, PAUSE_SOUND_BYTE, segment->size),
+                                      "silent segment %d of the heartbeat at %d%%", i, utilization);
+            }
+            offset += segment->size;
+        }
+        KUNIT_EXPECT_EQ_MSG(test, offset, size, "segments of the heartbeat at %d%%", utilization);
+    }
+}
+
+/*
+ * Reads the cached heartbeat of every utilization from 0 to 100 in
+ * chunks of varying size and compares it against the reference. The
+ * last read of every heartbeat straddles into the next one, which must
+ * start with the left ventricle beat again.
+ */
+static void devheart_chunked_reads(struct kunit *test) {
+    struct devheart_kunit_t *ctx = test->priv;
+    struct devheart_sound_buffer_t *sound_buffer = &ctx->sound_buffer;
+    const struct devheart_segment_t *next_beat = &sound_buffer->heartbeat.segments[SEGMENT_LEFT_BEAT];
+    size_t size, offset, chunk;
+    unsigned int chunk_index = 0;
+    int utilization;
+
+    for(utilization = 0; utilization <= 100; utilization++) {
+        size = reference_heartbeat(sound_buffer->samples, ctx->expected, utilization);
+        kunit_start_heartbeat(sound_buffer, utilization);
+
+        for(offset = 0; offset < size; offset += chunk) {
+            chunk = kunit_chunks[chunk_index++ % ARRAY_SIZE(kunit_chunks)];
+            if(offset + chunk >= size) {
+                chunk = size - offset + KUNIT_STRADDLE;
+            }
+
+            KUNIT_ASSERT_EQ_MSG(test, kunit_read(sound_buffer, ctx->actual + offset, chunk), chunk,
+                                "read at offset %zu of the heartbeat at %d%%", offset, utilization);
+        }
+
+        KUNIT_EXPECT_EQ_MSG(test, memcmp(ctx->actual, ctx->expected, size), 0,
+                            "heartbeat at %d%% differs from the reference", utilization);
+        KUNIT_EXPECT_MEMEQ_MSG(test, ctx->actual + size, next_beat->data,
+                               min_t(size_t, KUNIT_STRADDLE, next_beat->size),
+                               "read straddling the heartbeat at %d%%", utilization);
+
+        cond_resched();
+    }
+}
+
+// Logs the cost of generating a heartbeat and the throughput of reads of 64 bytes to 64 KiB.
+static void devheart_bench(struct kunit *test) {
+    struct devheart_kunit_t *ctx = test->priv;
+    struct devheart_sound_buffer_t *sound_buffer = &ctx->sound_buffer;
+    size_t read_size, copied;
+    ktime_t start;
+    u64 elapsed, reads;
+    int i;
+
+    start = ktime_get();
+    for(i = 0; i < KUNIT_BENCH_BEATS; i++) {
+        generate_heartbeat(sound_buffer);
+    }
+    elapsed = ktime_to_ns(ktime_sub(ktime_get(), start));
+    kunit_info(test, "generate_heartbeat: %llu ns per beat\n", div64_u64(elapsed, KUNIT_BENCH_BEATS));
+
+    for(read_size = 64; read_size <= KUNIT_BENCH_READ_MAX; read_size *= 4) {
+        copied = 0;
+        reads = 0;
+
+        start = ktime_get();
+        while(copied < KUNIT_BENCH_READ_BYTES) {
+            copied += kunit_read(sound_buffer, ctx->actual, read_size);
+            reads++;
+        }
+        elapsed = max_t(u64, ktime_to_ns(ktime_sub(ktime_get(), start)), 1);
+
+        KUNIT_EXPECT_EQ(test, (u64)copied, reads * read_size);
+        kunit_info(test, "read %zu bytes: %llu MB/s, %llu ns per read\n",
+                   read_size, div64_u64((u64)copied * 1000, elapsed), div64_u64(elapsed, reads));
+        cond_resched();
+    }
+}
+
+static int devheart_kunit_init(struct kunit *test) {
+    struct devheart_kunit_t *ctx;
+    size_t largest = 0;
+    int utilization;
+
+    ctx = kunit_kzalloc(test, sizeof(*ctx), GFP_KERNEL);
+    if(!ctx) {
+        return -ENOMEM;
+    }
+    mutex_init(&ctx->sound_buffer.lock);
+
+    // test the samples in use, which may have been loaded on insmod, and read silence from the module's page
+    generate_heartbeat(&ctx->sound_buffer);
+    for(utilization = 0; utilization <= 100; utilization++) {
+        largest = max(largest, reference_heartbeat_size(ctx->sound_buffer.samples, utilization));
+    }
+
+    ctx->expected = vmalloc(largest);
+    ctx->actual = vmalloc(max_t(size_t, largest + KUNIT_STRADDLE, KUNIT_BENCH_READ_MAX));
+    if(!ctx->expected || !ctx->actual) {
+        vfree(ctx->actual);
+        vfree(ctx->expected);
+        samples_put(ctx->sound_buffer.samples);
+        return -ENOMEM;
+    }
+
+    test->priv = ctx;
+    return 0;
+}
+
+static void devheart_kunit_exit(struct kunit *test) {
+    struct devheart_kunit_t *ctx = test->priv;
+
+    vfree(ctx->actual);
+    vfree(ctx->expected);
+    samples_put(ctx->sound_buffer.samples);
+}
+
+static struct kunit_case devheart_kunit_cases[] = {
+    KUNIT_CASE(devheart_template_sizes),
+    KUNIT_CASE(devheart_segment_walk),
+    KUNIT_CASE(devheart_chunked_reads),
+    KUNIT_CASE(devheart_bench),
+    {}
+};
+
+static struct kunit_suite devheart_kunit_suite = {
+    .name = "devheart",
+    .init = devheart_kunit_init,
+    .exit = devheart_kunit_exit,
+    .test_cases = devheart_kunit_cases,
+};
+
+kunit_test_suite(devheart_kunit_suite);
@@ -0,0 +1,90 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Tracepoints of the read, generate and sample hot paths.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM devheart
+
+#if !defined(_DEVHEART_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _DEVHEART_TRACE_H
+
+#include <linux/tracepoint.h>
+
+TRACE_EVENT(devheart_read,
+
+    TP_PROTO(size_t requested, ssize_t returned),
+
+    TP_ARGS(requested, returned),
+
+    TP_STRUCT__entry(
+        __field(size_t, requested)
+        __field(ssize_t, returned)
+    ),
+
+    TP_fast_assign(
+        __entry->requested = requested;
+        __entry->returned = returned;
+    ),
+
+    TP_printk("requested=%zu returned=%zd", __entry->requested, __entry->returned)
+);
+
+TRACE_EVENT(devheart_generate,
+
+    TP_PROTO(int utilization, unsigned int level, size_t short_pause, size_t long_pause, size_t size),
+
+    TP_ARGS(utilization, level, short_pause, long_pause, size),
+
+    TP_STRUCT__entry(
+        __field(int, utilization)
+        __field(unsigned int, level)
+        __field(size_t, short_pause)
+        __field(size_t, long_pause)
+        __field(size_t, size)
+    ),
+
+    TP_fast_assign(
+        __entry->utilization = utilization;
+        __entry->level = level;
+        __entry->short_pause = short_pause;
+        __entry->long_pause = long_pause;
+        __entry->size = size;
+    ),
+
+    TP_printk("utilization=%d%% level=%u short_pause=%zu long_pause=%zu size=%zu",
+              __entry->utilization, __entry->level, __entry->short_pause, __entry->long_pause, __entry->size)
+);
+
+TRACE_EVENT(devheart_sample,
+
+    TP_PROTO(int utilization, u64 duration_ns),
+
+    TP_ARGS(utilization, duration_ns),
+
+    TP_STRUCT__entry(
+        __field(int, utilization)
+        __field(u64, duration_ns)
+    ),
+
+    TP_fast_assign(
+        __entry->utilization = utilization;
+        __entry->duration_ns = duration_ns;
+    ),
+
+    TP_printk("utilization=%d%% duration_ns=%llu", __entry->utilization, __entry->duration_ns)
+);
+
+#endif /* _DEVHEART_TRACE_H */
+
+// the header lives next to the module sources, not in include/trace/events
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE devheart_trace
+#include <trace/define_trace.h>
@@ -0,0 +1,75 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Interface shared with userspace.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifndef DEVHEART_UAPI_H
+#define DEVHEART_UAPI_H
+
+#include <linux/types.h>
+#include <linux/ioctl.h>
+
+/*
+ * Layout of an mmap()ed /dev/heart: a metadata page followed by a ring
+ * of PCM bytes. Open /dev/heart O_RDWR, which everybody may, and map
+ * the whole length at offset 0, for example:
+ *
+ *     fd = open("/dev/heart", O_RDWR);
+ *     meta = mmap(NULL, 4096 + DEVHEART_RING_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+ *
+ * producer and consumer are free-running byte counters; the position in
+ * the ring is the counter modulo data_size. The kernel publishes new data
+ * by advancing producer, userspace hands space back by advancing consumer.
+ * Before sleeping in poll(), userspace sets DEVHEART_RING_NEED_WAKEUP in
+ * flags - without it the kernel never issues a wakeup.
+ */
+#define DEVHEART_RING_VERSION 1
+#define DEVHEART_RING_SIZE (64 * 1024)
+
+#define DEVHEART_RING_NEED_WAKEUP (1U << 0)
+
+struct devheart_ring_meta {
+    __u32 version;
+    __u32 data_offset; // offset of the ring in the mapping
+    __u32 data_size;   // size of the ring, a power of two
+    __u32 flags;       // DEVHEART_RING_* set by userspace
+
+    // written by the kernel only
+    __u64 producer __attribute__((aligned(64)));
+
+    // written by userspace only
+    __u64 consumer __attribute__((aligned(64)));
+};
+
+/*
+ * Output formats of /dev/heart, chosen per open file with
+ *
+ *     __u32 format = DEVHEART_FORMAT_S16_LE_48000;
+ *     ioctl(fd, DEVHEART_SET_FORMAT, &format);
+ *
+ * The stream continues with a new heartbeat in the new format. Every
+ * format is converted from the native s16_le mono 44100 Hz once per
+ * sample set, so reads cost the same in all of them. Not available on
+ * /dev/heart-live or while the ring is mapped.
+ */
+enum devheart_format {
+    DEVHEART_FORMAT_S16_LE_44100 = 0, // native, the default
+    DEVHEART_FORMAT_S16_LE_48000,
+    DEVHEART_FORMAT_U8_8000,
+    DEVHEART_FORMAT_FLOAT_LE_44100,
+    DEVHEART_FORMAT_MULAW_44100, // G.711 mu-law, half the bytes of s16_le
+    DEVHEART_FORMAT_ALAW_44100,  // G.711 A-law, half the bytes of s16_le
+    DEVHEART_NR_FORMATS
+};
+
+#define DEVHEART_IOCTL_MAGIC 0xDE
+
+#define DEVHEART_SET_FORMAT _IOW(DEVHEART_IOCTL_MAGIC, 1, __u32)
+#define DEVHEART_GET_FORMAT _IOR(DEVHEART_IOCTL_MAGIC, 2, __u32)
+
+#endif /* DEVHEART_UAPI_H */
@@ -0,0 +1,245 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Output formats, built into the module and into the userspace benchmarks.
+ *
+ * Beats are converted from the native s16_le mono 44100 Hz once per
+ * sample set and format, so this is nowhere near the read path. Rates
+ * are converted by linear interpolation, which is plenty for the few
+ * hundred Hz a heart sounds at.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifdef __KERNEL__
+#include <linux/math64.h> // div64_u64
+#include <linux/bitops.h> // fls
+#endif
+
+#include "heartbeat.h"
+
+const struct devheart_format_t devheart_formats[DEVHEART_NR_FORMATS] = {
+    [DEVHEART_FORMAT_S16_LE_44100] = { "s16_le 44100 Hz", 44100, 2, ENCODING_S16_LE },
+    [DEVHEART_FORMAT_S16_LE_48000] = { "s16_le 48000 Hz", 48000, 2, ENCODING_S16_LE },
+    [DEVHEART_FORMAT_U8_8000] = { "u8 8000 Hz", 8000, 1, ENCODING_U8 },
+    [DEVHEART_FORMAT_FLOAT_LE_44100] = { "float_le 44100 Hz", 44100, 4, ENCODING_FLOAT_LE },
+    [DEVHEART_FORMAT_MULAW_44100] = { "mu_law 44100 Hz", 44100, 1, ENCODING_MULAW },
+    [DEVHEART_FORMAT_ALAW_44100] = { "a_law 44100 Hz", 44100, 1, ENCODING_ALAW },
+};
+
+// G.711 clips magnitudes above this before companding
+#define G711_CLIP 32635
+
+// mu-law adds this bias so that all segments start at a power of two
+#define MULAW_BIAS 0x84
+
+// G.711 segment of a magnitude, looked up by magnitude >> 7
+static const u8 g711_segments[256] = {
+    0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+
+/*
+ * Like the G.711 reference coder, mu-law negates negative samples
+ * truncated to 14 bits and A-law takes their ones' complement.
+ */
+static u8 format_mulaw(s16 sample) {
+    u8 sign = sample < 0 ? 0x80 : 0;
+    s32 magnitude = min(sample < 0 ? -((s32)sample & ~3) : sample, G711_CLIP) + MULAW_BIAS;
+    u8 segment = g711_segments[magnitude >> 7];
+
+    return ~(sign | segment << 4 | ((magnitude >> (segment + 3)) & 0x0f));
+}
+
+static u8 format_alaw(s16 sample) {
+    u8 sign = sample < 0 ? 0 : 0x80;
+    s32 magnitude = min(sample < 0 ? ~(s32)sample : sample, G711_CLIP);
+    u8 segment = g711_segments[magnitude >> 7];
+
+    // the first two segments share the step size, so A-law merges them
+    if(magnitude < 256) {
+        return (sign | magnitude >> 4) ^ 0x55;
+    }
+    return (sign | segment << 4 | ((magnitude >> (segment + 3)) & 0x0f)) ^ 0x55;
+}
+
+static bool format_is_native(const struct devheart_format_t *format) {
+    return format->rate == SAMPLE_RATE && format->encoding == ENCODING_S16_LE;
+}
+
+// Returns the bytes size bytes of native PCM take in the format, in whole frames.
+size_t format_size(const struct devheart_format_t *format, size_t size) {
+    u64 frames = size / SAMPLE_SIZE;
+
+    if(format_is_native(format)) {
+        return size;
+    }
+    return div64_u64(frames * format->rate, SAMPLE_RATE) * format->frame_size;
+}
+
+/*
+ * Returns the bits of the IEEE 754 single precision float of sample /
+ * 32768, built from integers because there is no FPU in kernel context.
+ */
+static u32 format_float_bits(s16 sample) {
+    u32 sign = sample < 0 ? 1U << 31 : 0;
+    u32 magnitude = sample < 0 ? -(s32)sample : sample;
+    int exponent;
+
+    if(!magnitude) {
+        return 0;
+    }
+
+    // magnitude is 1.mantissa * 2^exponent, the float is that times 2^-15
+    exponent = fls(magnitude) - 1;
+    return sign | (u32)(exponent - 15 + 127) << 23 | ((magnitude << (23 - exponent)) & 0x7fffff);
+}
+
+static void format_encode(const struct devheart_format_t *format, char *out, s16 sample) {
+    u32 bits;
+
+    switch(format->encoding) {
+    case ENCODING_S16_LE:
+        out[0] = sample & 0xff;
+        out[1] = (sample >> 8) & 0xff;
+        break;
+    case ENCODING_U8:
+        out[0] = (sample >> 8) + 128;
+        break;
+    case ENCODING_FLOAT_LE:
+        bits = format_float_bits(sample);
+        out[0] = bits & 0xff;
+        out[1] = (bits >> 8) & 0xff;
+        out[2] = (bits >> 16) & 0xff;
+        out[3] = bits >> 24;
+        break;
+    case ENCODING_MULAW:
+        out[0] = format_mulaw(sample);
+        break;
+    case ENCODING_ALAW:
+        out[0] = format_alaw(sample);
+        break;
+    }
+}
+
+static s16 format_native_sample(const char *in, size_t frame) {
+    const u8 *bytes = (const u8 *)in + frame * SAMPLE_SIZE;
+
+    return (s16)(bytes[0] | bytes[1] << 8);
+}
+
+// Converts size bytes of native PCM into format_size() bytes of the format.
+void format_convert(const struct devheart_format_t *format, char *out, const char *in, size_t size) {
+    size_t frames = size / SAMPLE_SIZE;
+    size_t out_frames = format_size(format, size) / format->frame_size;
+    size_t frame, position;
+    u64 step;
+    s32 a, b, fraction;
+
+    if(format_is_native(format)) {
+        memcpy(out, in, size);
+        return;
+    }
+
+    // position in the native frames of every output frame, in Q16
+    step = div64_u64((u64)SAMPLE_RATE << 16, format->rate);
+
+    for(frame = 0; frame < out_frames; frame++, out += format->frame_size) {
+        position = (frame * step) >> 16;
+        fraction = (frame * step) & 0xffff;
+
+        a = format_native_sample(in, position);
+        b = format_native_sample(in, min(position + 1, frames - 1));
+        format_encode(format, out, a + (((b - a) * fraction) >> 16));
+    }
+}
+
+// Fills size bytes, a multiple of the frame size, with the sample in the format.
+void format_fill(const struct devheart_format_t *format, char *out, size_t size, s16 sample) {
+    size_t offset;
+
+    for(offset = 0; offset + format->frame_size <= size; offset += format->frame_size) {
+        format_encode(format, out + offset, sample);
+    }
+}
+
+// WAVE format tags of the encodings
+#define WAVE_FORMAT_PCM 0x0001
+#define WAVE_FORMAT_IEEE_FLOAT 0x0003
+#define WAVE_FORMAT_ALAW 0x0006
+#define WAVE_FORMAT_MULAW 0x0007
+
+// RIFF and data chunk size of a stream without an end
+#define WAV_STREAMING_SIZE 0xffffffff
+
+static u16 format_wav_tag(const struct devheart_format_t *format) {
+    switch(format->encoding) {
+    case ENCODING_FLOAT_LE:
+        return WAVE_FORMAT_IEEE_FLOAT;
+    case ENCODING_MULAW:
+        return WAVE_FORMAT_MULAW;
+    case ENCODING_ALAW:
+        return WAVE_FORMAT_ALAW;
+    default:
+        return WAVE_FORMAT_PCM;
+    }
+}
+
+static u8 *format_put_le16(u8 *out, u16 value) {
+    out[0] = value & 0xff;
+    out[1] = value >> 8;
+    return out + 2;
+}
+
+static u8 *format_put_le32(u8 *out, u32 value) {
+    out = format_put_le16(out, value & 0xffff);
+    return format_put_le16(out, value >> 16);
+}
+
+/*
+ * Writes the RIFF/WAVE header of an endless mono stream in the format
+ * and returns its size, at most WAV_HEADER_MAX bytes. Both chunk sizes
+ * are the streaming sentinel, players read until the stream ends.
+ * Formats other than integer PCM get the 18 byte fmt chunk with an
+ * empty extension and the fact chunk the WAVE specification asks for.
+ */
+size_t format_wav_header(const struct devheart_format_t *format, u8 *header) {
+    u16 tag = format_wav_tag(format);
+    u8 *out = header;
+
+    memcpy(out, "RIFF", 4);
+    out = format_put_le32(out + 4, WAV_STREAMING_SIZE);
+    memcpy(out, "WAVEfmt ", 8);
+    out = format_put_le32(out + 8, tag == WAVE_FORMAT_PCM ? 16 : 18);
+    out = format_put_le16(out, tag);
+    out = format_put_le16(out, 1);
+    out = format_put_le32(out, format->rate);
+    out = format_put_le32(out, format->rate * format->frame_size);
+    out = format_put_le16(out, format->frame_size);
+    out = format_put_le16(out, format->frame_size * 8);
+    if(tag != WAVE_FORMAT_PCM) {
+        out = format_put_le16(out, 0);
+        memcpy(out, "fact", 4);
+        out = format_put_le32(out + 4, 4);
+        out = format_put_le32(out, WAV_STREAMING_SIZE);
+    }
+    memcpy(out, "data", 4);
+    out = format_put_le32(out + 4, WAV_STREAMING_SIZE);
+    return out - header;
+}
@@ -0,0 +1,246 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Heartbeat engine core, built into the module and into the userspace benchmarks.
+ *
+ * Nothing in here may depend on kernel-only APIs: everything it needs is
+ * either in heartbeat.h or provided by bench/userspace.h.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifdef __KERNEL__
+#include <linux/math64.h> // div64_u64, div_u64
+#endif
+
+#include "heartbeat.h"
+
+// Maps a CPU utilization in percent to one of the TEMPO_LEVELS, the higher the slower.
+unsigned int heartbeat_tempo_level(int utilization) {
+    return (100 - clamp(utilization, 0, 100)) / TEMPO_LEVEL_WIDTH;
+}
+
+// Describes the heartbeat of a tempo level as segments, with beats and pauses in the given format.
+void heartbeat_render_template(struct devheart_beat_template_t *template, unsigned int level,
+                               const struct devheart_sound_t *left, const struct devheart_sound_t *right,
+                               const struct devheart_format_t *format) {
+    struct devheart_segment_t *segments = template->segments;
+    int short_pause_factor, long_pause_factor;
+
+    // TODO: experiment and improve!
+    short_pause_factor = level;
+    long_pause_factor = level * 60;
+
+    // only the first heartbeat of a WAV stream has a header
+    segments[SEGMENT_HEADER].data = NULL;
+    segments[SEGMENT_HEADER].size = 0;
+
+    // beats are served straight from the sample data, pauses from the silence page
+    segments[SEGMENT_LEFT_BEAT].data = left->data;
+    segments[SEGMENT_LEFT_BEAT].size = left->size;
+
+    segments[SEGMENT_SHORT_PAUSE].data = NULL;
+    segments[SEGMENT_SHORT_PAUSE].size = format_size(format, BASE_PAUSE_FACTOR * short_pause_factor);
+
+    segments[SEGMENT_RIGHT_BEAT].data = right->data;
+    segments[SEGMENT_RIGHT_BEAT].size = right->size;
+
+    segments[SEGMENT_LONG_PAUSE].data = NULL;
+    segments[SEGMENT_LONG_PAUSE].size = format_size(format, BASE_PAUSE_FACTOR * long_pause_factor);
+
+    template->size = segments[SEGMENT_LEFT_BEAT].size + segments[SEGMENT_SHORT_PAUSE].size
+        + segments[SEGMENT_RIGHT_BEAT].size + segments[SEGMENT_LONG_PAUSE].size;
+}
+
+// Starts reading a heartbeat made of the template, silence runs are served from the given page.
+void heartbeat_start(struct devheart_heartbeat_t *heartbeat, const struct devheart_beat_template_t *template,
+                     const char *silence, size_t silence_size) {
+    memcpy(heartbeat->segments, template->segments, sizeof(heartbeat->segments));
+    heartbeat->current_segment = 0;
+    heartbeat->current_offset = 0;
+    heartbeat->silence = silence;
+    heartbeat->silence_size = silence_size;
+}
+
+/*
+ * Returns the contiguous span of sound data at the given position in the
+ * heartbeat, skipping exhausted and empty segments. Silence runs are
+ * handed out in chunks of at most one silence page. Returns 0 once the
+ * heartbeat is exhausted.
+ */
+static size_t heartbeat_segment_span(const struct devheart_heartbeat_t *heartbeat, unsigned int *current_segment,
+                                     size_t *current_offset, const char **data) {
+    const struct devheart_segment_t *segment;
+    size_t remaining;
+
+    for(; *current_segment < HEARTBEAT_SEGMENTS; (*current_segment)++, *current_offset = 0) {
+        segment = &heartbeat->segments[*current_segment];
+        remaining = segment->size - *current_offset;
+        if(!remaining) {
+            continue;
+        }
+
+        if(!segment->data) {
+            *data = heartbeat->silence;
+            return min(remaining, heartbeat->silence_size);
+        }
+
+        *data = segment->data + *current_offset;
+        return remaining;
+    }
+
+    return 0;
+}
+
+/*
+ * Returns the contiguous span of sound data at the read position. Once
+ * the heartbeat is exhausted, next() puts the following one in place.
+ */
+size_t heartbeat_span_at(struct devheart_heartbeat_t *heartbeat, void (*next)(struct devheart_heartbeat_t *heartbeat),
+                         const char **data) {
+    size_t length;
+
+    while(!(length = heartbeat_segment_span(heartbeat, &heartbeat->current_segment, &heartbeat->current_offset,
+                                            data))) {
+        next(heartbeat);
+    }
+    return length;
+}
+
+/*
+ * Returns the contiguous span of sound data ahead bytes past the read
+ * position without moving it. Only looks within the current heartbeat,
+ * returns 0 if it ends before.
+ */
+size_t heartbeat_peek(const struct devheart_heartbeat_t *heartbeat, size_t ahead, const char **data) {
+    unsigned int segment = heartbeat->current_segment;
+    size_t offset = heartbeat->current_offset;
+    size_t length;
+
+    for(;;) {
+        length = heartbeat_segment_span(heartbeat, &segment, &offset, data);
+        if(!length) {
+            return 0;
+        }
+        if(ahead < length) {
+            *data += ahead;
+            return length - ahead;
+        }
+        ahead -= length;
+        offset += length;
+    }
+}
+
+/*
+ * Copies whole contiguous spans with copy() and keeps going across
+ * heartbeat boundaries until length bytes are copied, so one syscall
+ * serves a whole audio period. Stops early once copy() falls short and
+ * returns the bytes copied.
+ */
+size_t heartbeat_copy(struct devheart_heartbeat_t *heartbeat, size_t length,
+                      void (*next)(struct devheart_heartbeat_t *heartbeat),
+                      size_t (*copy)(void *to, const char *data, size_t length), void *to) {
+    size_t bytes_read = 0;
+    size_t chunk, copied;
+    const char *data;
+
+    while(length) {
+        chunk = min(length, heartbeat_span_at(heartbeat, next, &data));
+        copied = copy(to, data, chunk);
+
+        heartbeat->current_offset += copied;
+        bytes_read += copied;
+        length -= copied;
+
+        if(copied < chunk) {
+            break;
+        }
+    }
+    return bytes_read;
+}
+
+/*
+ * Adds the delta of a CPU's raw times since its baseline to the
+ * accumulated times and makes them the new baseline. Nothing is added
+ * the first time a CPU is seen or if its counters went backwards.
+ */
+void cpu_times_accumulate(struct devheart_cpu_baseline_t *baseline, u64 idle, u64 busy,
+                          u64 *accumulated_idle, u64 *accumulated_total) {
+    u64 delta_idle, delta_busy;
+
+    if(baseline->valid && idle >= baseline->idle && busy >= baseline->busy) {
+        delta_idle = idle - baseline->idle;
+        delta_busy = busy - baseline->busy;
+        *accumulated_idle += delta_idle;
+        *accumulated_total += delta_idle + delta_busy;
+        baseline->accumulated_idle += delta_idle;
+        baseline->accumulated_total += delta_idle + delta_busy;
+    }
+
+    baseline->idle = idle;
+    baseline->busy = busy;
+    baseline->valid = true;
+}
+
+// 2^(-i/16) in 16.16 fixed point
+static const u32 exp2_neg_table[17] = {
+    65536, 62757, 60097, 57549, 55109, 52773, 50535, 48393,
+    46341, 44376, 42495, 40693, 38968, 37316, 35734, 34219, 32768
+};
+
+/*
+ * Returns the weight 2^(-elapsed/half_life) the previous average keeps
+ * after the given time, in 16.16 fixed point and without any FPU.
+ */
+u32 ewma_decay(unsigned int elapsed_ms, unsigned int half_life) {
+    unsigned int halvings = elapsed_ms / half_life;
+    u32 fraction, index, remainder;
+    u32 decay;
+
+    if(halvings >= 16) {
+        return 0;
+    }
+
+    // linearly interpolate the fractional half-life in the table
+    fraction = (u32)div_u64((u64)(elapsed_ms % half_life) << 8, half_life); // 0..255
+    index = fraction >> 4;
+    remainder = fraction & 0xF;
+    decay = exp2_neg_table[index] - (((exp2_neg_table[index] - exp2_neg_table[index + 1]) * remainder) >> 4);
+
+    return decay >> halvings;
+}
+
+/*
+ * Derives the CPU utilization from the given current CPU times and the
+ * previous sample, which it replaces. Keeps the previous utilization if
+ * no time has passed.
+ */
+int cpu_sample_update(struct devheart_cpu_sample_t *sample, u64 idle_time, u64 total_time,
+                      unsigned long now_ms, unsigned int half_life) {
+    u64 delta_idle_time, delta_total_time;
+    u32 raw, decay;
+
+    // calculate CPU stat difference since last measurement
+    delta_idle_time = idle_time - sample->idle_time;
+    delta_total_time = total_time - sample->total_time;
+
+    // calculate CPU usage in percentage and blend it into the moving average
+    if(delta_total_time) {
+        raw = (u32)div64_u64(100 * (delta_total_time - delta_idle_time) << EWMA_SHIFT, delta_total_time);
+        if(half_life && sample->timestamp) {
+            decay = ewma_decay(now_ms - sample->timestamp, half_life);
+            sample->smoothed = (u32)(((u64)sample->smoothed * decay + (u64)raw * (65536 - decay)) >> 16);
+        }
+        else {
+            sample->smoothed = raw;
+        }
+        sample->utilization = (sample->smoothed + (1 << (EWMA_SHIFT - 1))) >> EWMA_SHIFT;
+    }
+
+    sample->idle_time = idle_time;
+    sample->total_time = total_time;
+    sample->timestamp = now_ms;
+    return sample->utilization;
+}
@@ -0,0 +1,190 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Heartbeat engine core, built into the module and into the userspace benchmarks.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifndef DEVHEART_HEARTBEAT_H
+#define DEVHEART_HEARTBEAT_H
+
+#ifdef __KERNEL__
+#include <linux/kernel.h> // size_t
+#include <linux/types.h>
+#else
+#include "userspace.h" // kernel types and helpers for the bench/ build
+#endif
+
+#include "devheart_uapi.h" // enum devheart_format
+
+// format of the stream: s16_le mono at 44100 Hz
+#define SAMPLE_RATE 44100
+#define SAMPLE_SIZE 2
+
+// base factor for pause length between heartbeats
+#define BASE_PAUSE_FACTOR 64
+
+// utilization percent per tempo level, 100% / 6 -> 17 levels
+#define TEMPO_LEVEL_WIDTH 6
+#define TEMPO_LEVELS (100 / TEMPO_LEVEL_WIDTH + 1)
+
+// fixed point shift of the smoothed CPU utilization
+#define EWMA_SHIFT 10
+
+// raw sound data
+struct devheart_sound_t {
+    size_t size;
+    char data[];
+};
+
+// a heartbeat is described by these segments, in this order
+enum devheart_segment_kind {
+    SEGMENT_HEADER = 0, // empty, except for the WAV header at the start of a WAV stream
+    SEGMENT_LEFT_BEAT,
+    SEGMENT_SHORT_PAUSE,
+    SEGMENT_RIGHT_BEAT,
+    SEGMENT_LONG_PAUSE,
+    HEARTBEAT_SEGMENTS
+};
+
+// format of a sound linked in by the asset stage, see sounds.S
+struct devheart_sound_format_t {
+    u32 sample_rate;
+    u16 channels;
+    u16 sample_size; // bytes of a signed little endian sample
+};
+
+// how the samples of an output format are encoded
+enum devheart_encoding {
+    ENCODING_S16_LE = 0,
+    ENCODING_U8,
+    ENCODING_FLOAT_LE,
+    ENCODING_MULAW, // G.711
+    ENCODING_ALAW,  // G.711
+};
+
+// an output format the native s16_le mono 44100 Hz stream is converted to
+struct devheart_format_t {
+    const char *name;
+    u32 rate;
+    u32 frame_size;
+    enum devheart_encoding encoding;
+};
+
+extern const struct devheart_format_t devheart_formats[DEVHEART_NR_FORMATS];
+
+// beat sample compressed as IMA ADPCM, see adpcm.c
+struct devheart_adpcm_sound_t {
+    size_t size;          // bytes of s16_le PCM it decodes to
+    size_t encoded_size;
+    u8 data[];
+};
+
+// a contiguous piece of a heartbeat: either sound data or a run of silence
+struct devheart_segment_t {
+    const char *data; // NULL for silence
+    size_t size;
+};
+
+// heartbeat of a tempo level described as segments
+struct devheart_beat_template_t {
+    struct devheart_segment_t segments[HEARTBEAT_SEGMENTS];
+    size_t size;
+    bool ready;
+};
+
+// heartbeat being read: its segments and the read position within them
+struct devheart_heartbeat_t {
+    struct devheart_segment_t segments[HEARTBEAT_SEGMENTS];
+    unsigned int current_segment;
+    size_t current_offset; // within the current segment
+    const char *silence; // silence runs are served from here, in the format of the heartbeat
+    size_t silence_size;
+};
+
+// CPU times of a measurement and the utilization derived from it
+struct devheart_cpu_sample_t {
+    u64 idle_time;
+    u64 total_time;
+    unsigned long timestamp; // milliseconds, 0 if never sampled
+    u32 smoothed; // moving average of the utilization, EWMA_SHIFT fixed point
+    int utilization;
+};
+
+// last raw CPU times of a CPU, so each sample only accounts the delta since then
+struct devheart_cpu_baseline_t {
+    u64 idle;
+    u64 busy;
+    bool valid;
+
+    // this CPU's share of the accumulated times, for per CPU group sampling
+    u64 accumulated_idle;
+    u64 accumulated_total;
+};
+
+// heart beat sound data, linked in from sounds/ by the asset stage
+extern const struct devheart_sound_t left_ventricle_beat_sound;
+extern const struct devheart_sound_format_t left_ventricle_beat_format;
+extern const struct devheart_sound_t right_ventricle_beat_sound;
+extern const struct devheart_sound_format_t right_ventricle_beat_format;
+
+// parameters of a synthesized beat: a damped sine with a linear attack
+struct devheart_synth_beat_t {
+    u32 frequency;   // base frequency in mHz
+    u32 attack_ms;   // rise of the envelope from silence to the peak
+    u32 damping_ms;  // time constant of the exponential decay after the peak
+    u32 duration_ms;
+    u16 amplitude;   // peak amplitude, of 32767
+};
+
+// heart beat sound data compressed as IMA ADPCM
+extern const struct devheart_adpcm_sound_t left_ventricle_beat_adpcm;
+extern const struct devheart_adpcm_sound_t right_ventricle_beat_adpcm;
+
+// decoding of IMA ADPCM compressed samples
+size_t adpcm_encoded_size(size_t size);
+void adpcm_decode(struct devheart_sound_t *sound, const struct devheart_adpcm_sound_t *adpcm);
+
+// synthesized left (lub) and right (dub) ventricle beats
+extern const struct devheart_synth_beat_t synth_lub;
+extern const struct devheart_synth_beat_t synth_dub;
+
+// waveform synthesis in fixed point, no FPU required
+void synth_beat_for_level(struct devheart_synth_beat_t *beat, const struct devheart_synth_beat_t *base, unsigned int level);
+size_t synth_beat_size(const struct devheart_synth_beat_t *beat);
+void synth_render_beat(struct devheart_sound_t *sound, const struct devheart_synth_beat_t *beat);
+
+// conversion of native PCM to the output formats
+size_t format_size(const struct devheart_format_t *format, size_t size);
+void format_convert(const struct devheart_format_t *format, char *out, const char *in, size_t size);
+void format_fill(const struct devheart_format_t *format, char *out, size_t size, s16 sample);
+
+// RIFF/WAVE header of an endless stream in an output format, 44 bytes for PCM and 58 with a fact chunk
+#define WAV_HEADER_MAX 58
+size_t format_wav_header(const struct devheart_format_t *format, u8 *header);
+
+// heartbeat templates and reading them span by span
+unsigned int heartbeat_tempo_level(int utilization);
+void heartbeat_render_template(struct devheart_beat_template_t *template, unsigned int level,
+                               const struct devheart_sound_t *left, const struct devheart_sound_t *right,
+                               const struct devheart_format_t *format);
+void heartbeat_start(struct devheart_heartbeat_t *heartbeat, const struct devheart_beat_template_t *template,
+                     const char *silence, size_t silence_size);
+size_t heartbeat_span_at(struct devheart_heartbeat_t *heartbeat, void (*next)(struct devheart_heartbeat_t *heartbeat),
+                         const char **data);
+size_t heartbeat_peek(const struct devheart_heartbeat_t *heartbeat, size_t ahead, const char **data);
+size_t heartbeat_copy(struct devheart_heartbeat_t *heartbeat, size_t length,
+                      void (*next)(struct devheart_heartbeat_t *heartbeat),
+                      size_t (*copy)(void *to, const char *data, size_t length), void *to);
+
+// CPU utilization math
+void cpu_times_accumulate(struct devheart_cpu_baseline_t *baseline, u64 idle, u64 busy,
+                          u64 *accumulated_idle, u64 *accumulated_total);
+u32 ewma_decay(unsigned int elapsed_ms, unsigned int half_life);
+int cpu_sample_update(struct devheart_cpu_sample_t *sample, u64 idle_time, u64 total_time,
+                      unsigned long now_ms, unsigned int half_life);
+
+#endif /* DEVHEART_HEARTBEAT_H */
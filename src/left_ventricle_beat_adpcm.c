@@ -6,13 +6,15 @@
  *
  */
 
-#include "devheart.h"
+#include "heartbeat.h"
 
 #define DEVHEART_LEFT_VENTRICLE_BEAT_SIZE 22112
+#define DEVHEART_LEFT_VENTRICLE_BEAT_ADPCM_SIZE 5605
 
-struct devheart_sound_t left_ventricle_beat_sound = {
+const struct devheart_adpcm_sound_t left_ventricle_beat_adpcm = {
     .size = DEVHEART_LEFT_VENTRICLE_BEAT_SIZE,
+    .encoded_size = DEVHEART_LEFT_VENTRICLE_BEAT_ADPCM_SIZE,
     .data = {
-#include "left_ventricle_beat_data.h"
+#include "left_ventricle_beat_adpcm_data.h"
     }
 };
@@ -0,0 +1,352 @@
+// 22112 bytes of s16_le PCM as 5605 bytes of IMA ADPCM
+0xea, 0xff, 0x0, 0x0, 0xba, 0xbb, 0x99, 0x10, 0x9, 0x91, 0xab, 0x3, 0xe9, 0x0, 0xa2, 0x91,
+0xa2, 0x91, 0xb3, 0x11, 0xb2, 0x13, 0xb1, 0xb1, 0x99, 0x9a, 0xba, 0xe1, 0xb0, 0xe1, 0xa1, 0x9,
+0x2a, 0xd, 0xa, 0x89, 0x88, 0xaa, 0xb2, 0x99, 0x3a, 0x91, 0x4, 0xa8, 0x30, 0x3a, 0x9, 0x99,
+0xb3, 0x39, 0x1d, 0xb1, 0xb2, 0xa4, 0x94, 0x12, 0x91, 0x31, 0x12, 0x11, 0x1a, 0xa6, 0xb3, 0xb3,
+0x93, 0x11, 0xa3, 0x85, 0x29, 0x4b, 0xaa, 0xab, 0xb2, 0xac, 0x2a, 0x9b, 0xb, 0x92, 0x32, 0x1a,
+0x39, 0x79, 0x20, 0x21, 0x30, 0x82, 0x33, 0x3, 0x19, 0x39, 0xb, 0x39, 0x90, 0x10, 0xf2, 0x91,
+0xa1, 0x94, 0x89, 0x91, 0x93, 0x91, 0x11, 0x31, 0x12, 0x19, 0x31, 0x3b, 0x1, 0xb3, 0x2, 0x91,
+0x10, 0x3, 0xa7, 0x93, 0x2, 0x2, 0x12, 0xb3, 0x0, 0x92, 0x92, 0x11, 0x93, 0x91, 0x12, 0xb1,
+0x10, 0xb4, 0x94, 0x3, 0x11, 0x91, 0xa, 0x4b, 0x88, 0x31, 0xa9, 0x97, 0xa0, 0x30, 0x49, 0x2b,
+0x29, 0x1c, 0x6a, 0x9, 0x80, 0x81, 0xa9, 0xf3, 0x91, 0xa0, 0x90, 0x9, 0xf, 0x2c, 0x1b, 0xa,
+0xb8, 0x99, 0x93, 0xac, 0x18, 0xb, 0x22, 0x92, 0x39, 0x4a, 0x60, 0x29, 0x19, 0x38, 0x1b, 0x29,
+0x91, 0xa4, 0x94, 0xb0, 0x13, 0x14, 0xa8, 0x2, 0x91, 0x1a, 0x3a, 0x43, 0x82, 0xa4, 0x4, 0x41,
+0x39, 0x13, 0x24, 0x71, 0x10, 0x93, 0x85, 0x3, 0x21, 0x21, 0x91, 0x91, 0x22, 0x11, 0x11, 0x1,
+0xa3, 0x97, 0x2, 0x29, 0x29, 0x1a, 0x1d, 0x5c, 0x3b, 0x1c, 0x9, 0x99, 0xa8, 0xb8, 0x91, 0xa0,
+0xbb, 0x99, 0x9b, 0xbb, 0x8f, 0x2b, 0xd, 0x9b, 0xab, 0xab, 0xcb, 0xbb, 0x9c, 0x9c, 0x9d, 0xb,
+0x1b, 0xbf, 0x99, 0xa0, 0xf8, 0xa0, 0xa9, 0x9a, 0x8c, 0xaa, 0xda, 0x8c, 0x9a, 0xbc, 0xaa, 0xba,
+0xb5, 0xfe, 0x4, 0x0, 0x9c, 0xba, 0xf9, 0xba, 0xb0, 0xca, 0xbb, 0xdb, 0xb9, 0xac, 0xba, 0xda,
+0xd8, 0xaa, 0x9a, 0xdb, 0xbc, 0x8b, 0x89, 0xbc, 0x9f, 0xa, 0x8a, 0xb9, 0xa9, 0xc9, 0x9a, 0x88,
+0xa0, 0x2c, 0x2b, 0x2b, 0x1a, 0x11, 0x87, 0xa2, 0x1, 0x14, 0x11, 0x2, 0x11, 0x20, 0x59, 0x50,
+0x2a, 0x31, 0x11, 0x52, 0x14, 0x12, 0x23, 0x34, 0x40, 0x42, 0x36, 0x31, 0x61, 0x40, 0x21, 0x32,
+0x53, 0x31, 0x12, 0x35, 0x34, 0x33, 0x34, 0x44, 0x32, 0x62, 0x22, 0x32, 0x23, 0x44, 0x63, 0x22,
+0x0, 0x30, 0x37, 0x13, 0x89, 0x53, 0x43, 0x11, 0x31, 0x33, 0x32, 0x63, 0x24, 0x12, 0x21, 0x34,
+0x42, 0x31, 0x34, 0x32, 0x22, 0x25, 0x52, 0x21, 0x22, 0x23, 0x32, 0x24, 0x43, 0x10, 0x30, 0x24,
+0x4, 0x3, 0x12, 0x20, 0x42, 0x22, 0x31, 0xb9, 0xb9, 0xf1, 0xb9, 0x9a, 0xbb, 0xcb, 0x9c, 0xb,
+0xe, 0xab, 0xb9, 0xdb, 0xc9, 0xbc, 0xbb, 0x9f, 0xa9, 0xb9, 0xbb, 0xac, 0xad, 0xac, 0xab, 0xbc,
+0xbb, 0xda, 0xcc, 0xa9, 0xc9, 0xab, 0xab, 0xbc, 0xbb, 0xae, 0xab, 0xdb, 0xba, 0xbb, 0xbd, 0x9c,
+0xac, 0xaa, 0xba, 0xdb, 0xaa, 0xda, 0xb9, 0xbb, 0xbb, 0xcb, 0xca, 0xdb, 0xbb, 0xbc, 0xbb, 0xbb,
+0x9a, 0xde, 0xad, 0x0, 0xa8, 0xac, 0xa, 0x98, 0xca, 0x9a, 0x9a, 0xbd, 0x9c, 0x89, 0xba, 0x9d,
+0x8b, 0xca, 0xa9, 0xb8, 0xca, 0xda, 0x9, 0x88, 0x90, 0x9c, 0x18, 0xdb, 0x2a, 0x1, 0x9c, 0x98,
+0xa8, 0x1, 0x8d, 0x8a, 0xc8, 0x12, 0x32, 0xb3, 0x20, 0x73, 0x13, 0x13, 0x13, 0x40, 0x33, 0x27,
+0x81, 0x1, 0x70, 0x48, 0x0, 0x22, 0x42, 0x21, 0x3b, 0x71, 0x12, 0x88, 0x21, 0x36, 0x12, 0x31,
+0x34, 0x42, 0x41, 0x35, 0x12, 0x20, 0x42, 0x23, 0x32, 0x43, 0x23, 0x31, 0x51, 0x2, 0x13, 0x6,
+0xc4, 0xfe, 0x7, 0x0, 0x4b, 0x39, 0x33, 0x23, 0x32, 0x43, 0x21, 0x16, 0x14, 0x5, 0x23, 0x3,
+0x14, 0x1, 0xa3, 0x8a, 0xab, 0xae, 0x99, 0x8d, 0x8, 0xa9, 0x19, 0x51, 0xba, 0x12, 0x11, 0x1d,
+0xea, 0x3a, 0x77, 0x91, 0x90, 0x9a, 0x41, 0xa2, 0xbf, 0x89, 0x24, 0xa9, 0x9, 0x1, 0xaa, 0x39,
+0x7, 0xa9, 0x99, 0x11, 0xa2, 0x8c, 0x21, 0xb8, 0x9f, 0x18, 0x82, 0xbb, 0x99, 0x8b, 0xba, 0x99,
+0x33, 0xab, 0x29, 0x31, 0x33, 0x27, 0x42, 0x41, 0x22, 0x12, 0x32, 0x23, 0x6, 0x10, 0x22, 0x31,
+0x70, 0x11, 0x28, 0x53, 0x23, 0x88, 0x41, 0x52, 0x13, 0x12, 0x63, 0x43, 0x24, 0x23, 0x43, 0x53,
+0x22, 0x31, 0x52, 0x11, 0x30, 0x32, 0x12, 0x31, 0x37, 0x10, 0x30, 0x58, 0x52, 0x22, 0x15, 0x22,
+0x40, 0x41, 0x32, 0x43, 0x1, 0x52, 0x33, 0x33, 0x31, 0x53, 0x11, 0x41, 0x53, 0x5, 0x11, 0x20,
+0x4, 0x13, 0x35, 0x44, 0x12, 0x12, 0x34, 0x15, 0x1, 0x22, 0x23, 0x42, 0x34, 0x33, 0x43, 0x21,
+0x44, 0x12, 0x43, 0x11, 0x20, 0x22, 0x90, 0x9, 0x25, 0xf3, 0xce, 0x9d, 0x26, 0x9a, 0x90, 0x3b,
+0x92, 0x8c, 0xba, 0x1a, 0xcc, 0x9a, 0xba, 0xcd, 0xcb, 0x89, 0xdb, 0xbb, 0xba, 0xca, 0xbc, 0xab,
+0xad, 0xcb, 0xcb, 0xba, 0xcb, 0xcb, 0xcb, 0xab, 0xcb, 0xca, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xbc,
+0xbc, 0xab, 0xac, 0xbb, 0xbd, 0xba, 0xcb, 0xab, 0xdb, 0xab, 0xcb, 0xba, 0xbc, 0xdb, 0xaa, 0xbb,
+0xac, 0xaa, 0xb9, 0xac, 0x9a, 0xbc, 0x9, 0xa8, 0xb9, 0x10, 0x33, 0x81, 0x44, 0x25, 0x54, 0x32,
+0x34, 0x34, 0x43, 0x44, 0x33, 0x34, 0x53, 0x33, 0x43, 0x24, 0x34, 0x43, 0x43, 0x24, 0x33, 0x34,
+0x34, 0x43, 0x33, 0x34, 0x43, 0x43, 0x32, 0x24, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x24, 0x33,
+0x7f, 0xf, 0x21, 0x0, 0x34, 0x43, 0x33, 0x53, 0x32, 0x43, 0x23, 0x34, 0x42, 0x33, 0x32, 0x24,
+0x33, 0x33, 0x43, 0x33, 0x43, 0x33, 0x33, 0x33, 0x23, 0x3, 0x1, 0x2, 0x12, 0xaa, 0x98, 0xf8,
+0xcf, 0xba, 0xeb, 0xcb, 0xbb, 0xca, 0xcb, 0xaa, 0xab, 0xaa, 0xba, 0xbc, 0xac, 0xab, 0xcb, 0xba,
+0xbc, 0xbc, 0xcc, 0xcb, 0xcc, 0xcb, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb,
+0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb, 0xac, 0xac, 0xbb, 0xab, 0xac, 0xab, 0xba, 0xbb,
+0xcb, 0xcb, 0xba, 0xba, 0xdb, 0xbb, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xba, 0xbc, 0xac, 0xac, 0xbb,
+0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xbc, 0xca, 0xaa, 0xbb, 0xcb, 0xaa, 0xbb,
+0xbb, 0xac, 0xaa, 0xaa, 0xab, 0x9a, 0x8, 0x90, 0x21, 0x35, 0x44, 0x33, 0x35, 0x44, 0x33, 0x45,
+0x43, 0x23, 0x34, 0x34, 0x25, 0x24, 0x43, 0x33, 0x34, 0x34, 0x24, 0x34, 0x43, 0x33, 0x35, 0x42,
+0x33, 0x53, 0x42, 0x32, 0x43, 0x43, 0x33, 0x34, 0x34, 0x24, 0x43, 0x33, 0x43, 0x34, 0x43, 0x32,
+0x34, 0x43, 0x24, 0x33, 0x34, 0x24, 0x33, 0x53, 0x32, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x33,
+0x34, 0x43, 0x32, 0x33, 0x33, 0x34, 0x24, 0x22, 0x23, 0x23, 0x21, 0x22, 0x1, 0x98, 0xaa, 0xeb,
+0xcd, 0xcb, 0xcb, 0xcc, 0xcb, 0xbb, 0xcc, 0xdb, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc,
+0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xac, 0xba, 0xab, 0xbb, 0xab, 0xaa, 0x9b, 0x8a, 0x8, 0x88,
+0x11, 0x33, 0x44, 0x34, 0x44, 0x44, 0x32, 0x34, 0x44, 0x33, 0x53, 0x43, 0x43, 0x43, 0x32, 0x34,
+0x43, 0x43, 0x33, 0x24, 0x24, 0x33, 0x43, 0x43, 0x32, 0x33, 0x34, 0x32, 0x24, 0x33, 0x33, 0x43,
+0xc9, 0x35, 0x20, 0x0, 0x22, 0x23, 0x23, 0x33, 0x32, 0x33, 0x23, 0x2, 0x21, 0x10, 0xba, 0xba,
+0xfb, 0xae, 0xcb, 0xbd, 0xcb, 0xcb, 0xac, 0xac, 0xac, 0xac, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xca,
+0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xcb, 0xca, 0xbb, 0xbc, 0xdb, 0xca, 0xba, 0xcb, 0xcb, 0xbb, 0xbc,
+0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb,
+0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0x80, 0x8, 0x88, 0x80,
+0x8, 0x88, 0x80, 0x80, 0x80, 0x8, 0x88, 0x80, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8,
+0x88, 0x80, 0xa2, 0xb3, 0x10, 0x19, 0x9, 0x0, 0x10, 0x29, 0x1a, 0x90, 0x91, 0x0, 0xa2, 0xb3,
+0x1, 0x9, 0x91, 0xa2, 0x91, 0x10, 0x9, 0x91, 0x10, 0x39, 0x3b, 0x3b, 0x2b, 0x1a, 0x9, 0x71,
+0x77, 0x77, 0x77, 0x6, 0x11, 0x11, 0x11, 0x22, 0x22, 0x33, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34,
+0x34, 0x43, 0x33, 0x43, 0x24, 0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43,
+0x33, 0x34, 0x43, 0x42, 0x32, 0x43, 0x32, 0x24, 0x33, 0x34, 0x33, 0x2, 0x8, 0x0, 0x80, 0x0,
+0x80, 0x0, 0x0, 0x80, 0x80, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x8, 0x8,
+0x0, 0x0, 0x19, 0x3b, 0x2a, 0x19, 0x0, 0xa0, 0xa2, 0x92, 0x1, 0x0, 0x19, 0x2a, 0x2a, 0x0,
+0x0, 0x19, 0x19, 0x0, 0x90, 0x1, 0x0, 0x0, 0x0, 0x19, 0x19, 0x90, 0x1, 0x19, 0x19, 0x0,
+0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xbf, 0x99, 0xaa,
+0xaa, 0xba, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+0x18, 0x19, 0x2e, 0x0, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+0xcb, 0xba, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb,
+0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xba,
+0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x9a, 0x89, 0x20, 0x41, 0x63, 0x53, 0x43, 0x34, 0x34, 0x44, 0x43,
+0x43, 0x43, 0x43, 0x33, 0x25, 0x24, 0x43, 0x33, 0x34, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24,
+0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x34, 0x43, 0x33, 0x34,
+0x33, 0x25, 0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x33, 0x33, 0x25, 0x33, 0x34, 0x33, 0x34, 0x43,
+0x42, 0x32, 0x43, 0x32, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x24, 0x33, 0x24, 0x33, 0x43, 0x32,
+0x43, 0x42, 0x22, 0x23, 0x33, 0x33, 0x42, 0x32, 0x22, 0x33, 0x23, 0x13, 0x13, 0x11, 0x2, 0x99,
+0xcc, 0xcc, 0xbc, 0xeb, 0xbb, 0xbc, 0xbd, 0xbc, 0xcb, 0xcb, 0xcb, 0xac, 0xcb, 0xbb, 0xbc, 0xbc,
+0xdb, 0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbd, 0xca, 0xbb, 0xcb, 0xbb,
+0xbc, 0xac, 0xcb, 0xbb, 0xbb, 0xbd, 0xbb, 0xbc, 0xbb, 0xcc, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb,
+0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xcb, 0xaa,
+0xbb, 0xcb, 0xba, 0xaa, 0xba, 0xc9, 0xb9, 0xa8, 0x88, 0x10, 0x30, 0x50, 0x72, 0x32, 0x62, 0x33,
+0x34, 0x34, 0x34, 0x43, 0x44, 0x32, 0x34, 0x34, 0x43, 0x43, 0x24, 0x24, 0x43, 0x32, 0x34, 0x43,
+0x33, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34, 0x24, 0x24, 0x43, 0x32, 0x34, 0x33, 0x34, 0x34, 0x43,
+0x15, 0xfc, 0x25, 0x0, 0x33, 0x34, 0x24, 0x43, 0x33, 0x53, 0x32, 0x43, 0x33, 0x34, 0x33, 0x25,
+0x33, 0x34, 0x43, 0x33, 0x34, 0x33, 0x44, 0x32, 0x43, 0x42, 0x32, 0x33, 0x34, 0x43, 0x42, 0x32,
+0x24, 0x33, 0x43, 0x33, 0x34, 0x33, 0x53, 0x32, 0x43, 0x33, 0x33, 0x25, 0x33, 0x33, 0x53, 0x32,
+0x43, 0x23, 0x33, 0x34, 0x33, 0x43, 0x33, 0x43, 0x42, 0x22, 0x23, 0x33, 0x24, 0x23, 0x22, 0x23,
+0x22, 0x12, 0x20, 0x28, 0x18, 0xba, 0x9d, 0xbf, 0xbc, 0xcb, 0xcc, 0xcb, 0xac, 0xac, 0xcb, 0xbb,
+0xcc, 0xba, 0xbc, 0xbc, 0xdb, 0xca, 0xba, 0xcb, 0xcb, 0xba, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb,
+0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb,
+0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc,
+0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xca, 0xbb, 0xbb,
+0xbc, 0xbc, 0xca, 0xba, 0xbb, 0xad, 0xbb, 0xcb, 0xbb, 0xcb, 0xca, 0xba, 0xbb, 0xcb, 0xac, 0xbb,
+0xcb, 0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xca, 0xaa, 0xbb, 0xac, 0xab, 0x9c, 0xac, 0xba, 0xaa,
+0x9d, 0xaa, 0xba, 0xab, 0xcb, 0xbb, 0x8e, 0x9a, 0xba, 0xb8, 0xea, 0xb9, 0xb9, 0xdb, 0xba, 0xab,
+0xbc, 0xcb, 0xab, 0xb8, 0xb8, 0xba, 0x10, 0x99, 0xbb, 0x9c, 0x99, 0xbf, 0xb9, 0xe0, 0xd9, 0x99,
+0xac, 0xbb, 0xa9, 0xbd, 0xbb, 0xbc, 0xeb, 0x9b, 0xac, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xcb, 0xbb,
+0xac, 0xbc, 0xcb, 0xba, 0xdb, 0xcb, 0x9c, 0xbb, 0xad, 0xab, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xbb,
+0xbc, 0xbc, 0xbc, 0xbb, 0xad, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xac, 0xac, 0xba, 0xbb,
+0x9b, 0xe5, 0x17, 0x0, 0xac, 0xdb, 0xba, 0xca, 0xba, 0xac, 0xbb, 0xcc, 0xba, 0xca, 0xba, 0xcb,
+0xbb, 0xbc, 0xcb, 0xcb, 0xab, 0xbc, 0xca, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xbd, 0xcb, 0xbb,
+0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xbc, 0xca, 0xaa, 0xcb, 0xbb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb,
+0xca, 0xca, 0xba, 0xba, 0xca, 0xab, 0xbb, 0xeb, 0xaa, 0xbb, 0xbc, 0xbb, 0xdb, 0xba, 0xcb, 0x9b,
+0xac, 0x9b, 0x9c, 0xaa, 0xaa, 0xbc, 0xc9, 0xc8, 0xb8, 0xa8, 0xb9, 0xab, 0x99, 0xa8, 0xb8, 0xa3,
+0x1, 0x69, 0x40, 0x21, 0x32, 0x73, 0x12, 0x32, 0x35, 0x14, 0x44, 0x42, 0x33, 0x44, 0x23, 0x35,
+0x43, 0x33, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x43, 0x33, 0x43, 0x24, 0x24, 0x33,
+0x53, 0x32, 0x24, 0x33, 0x34, 0x34, 0x43, 0x33, 0x25, 0x43, 0x32, 0x34, 0x43, 0x43, 0x33, 0x43,
+0x24, 0x33, 0x24, 0x34, 0x42, 0x32, 0x34, 0x42, 0x32, 0x34, 0x33, 0x35, 0x42, 0x32, 0x34, 0x33,
+0x34, 0x43, 0x24, 0x33, 0x24, 0x24, 0x24, 0x32, 0x43, 0x33, 0x34, 0x33, 0x44, 0x32, 0x24, 0x33,
+0x34, 0x33, 0x34, 0x34, 0x43, 0x42, 0x32, 0x43, 0x33, 0x43, 0x43, 0x32, 0x34, 0x33, 0x34, 0x24,
+0x24, 0x33, 0x43, 0x43, 0x23, 0x24, 0x33, 0x34, 0x43, 0x33, 0x43, 0x43, 0x32, 0x43, 0x33, 0x53,
+0x32, 0x43, 0x42, 0x32, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33,
+0x43, 0x33, 0x34, 0x43, 0x23, 0x34, 0x42, 0x32, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43,
+0x23, 0x43, 0x42, 0x22, 0x43, 0x32, 0x32, 0x42, 0x33, 0x24, 0x22, 0x24, 0x23, 0x23, 0x43, 0x32,
+0x43, 0x43, 0x21, 0x33, 0x43, 0x30, 0x22, 0x11, 0x91, 0x80, 0x99, 0x11, 0xbb, 0xdb, 0xc9, 0xab,
+0x2d, 0x25, 0x3, 0x0, 0xbd, 0xcc, 0xcb, 0xbb, 0xad, 0xbb, 0xbe, 0xca, 0xba, 0xbb, 0xad, 0xab,
+0x9e, 0xab, 0xcb, 0xbb, 0xcb, 0xbc, 0xab, 0xbc, 0xac, 0xbb, 0xad, 0xac, 0xaa, 0xac, 0xbb, 0xcb,
+0xbb, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xcc, 0xba, 0xca, 0xba, 0xda, 0xaa, 0xac, 0xba, 0xcb, 0x9c,
+0xbb, 0xbb, 0xeb, 0xaa, 0xb9, 0xca, 0xaa, 0xbb, 0xac, 0xac, 0xaa, 0xbb, 0xcb, 0xca, 0xbb, 0xcb,
+0xcb, 0xbc, 0x9b, 0xbb, 0x9e, 0xbb, 0xab, 0x9c, 0xab, 0xbb, 0xcc, 0xba, 0xd9, 0x99, 0x9b, 0xac,
+0xda, 0xc9, 0xa9, 0x9c, 0xac, 0x9d, 0xaa, 0xbb, 0xbc, 0xea, 0xaa, 0xa9, 0xbb, 0xbc, 0xcb, 0xcb,
+0xba, 0xac, 0xcc, 0xaa, 0xbb, 0xbc, 0xab, 0x9e, 0x9b, 0xac, 0xac, 0xba, 0xca, 0xbb, 0xbc, 0xcc,
+0xba, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xdb, 0xca, 0xba, 0xcb, 0xca, 0xaa, 0xcb, 0xca, 0xca, 0xba,
+0xca, 0xba, 0xcb, 0xcb, 0xaa, 0xcb, 0xca, 0xab, 0xcb, 0xcb, 0xba, 0xbc, 0xca, 0xba, 0xbb, 0xcc,
+0xba, 0xcb, 0xca, 0xc9, 0xaa, 0xbb, 0xdb, 0xba, 0xbb, 0xbc, 0xdb, 0xbb, 0xcb, 0xcb, 0xba, 0xcb,
+0xbb, 0xac, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xac, 0xbb, 0xbc, 0xcb, 0xca, 0xc9, 0xaa, 0xac,
+0xba, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xdb, 0xba, 0xca, 0xbb, 0xcb, 0xbc, 0xbb, 0xbc,
+0xcb, 0xbb, 0xac, 0xac, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xdb, 0xba, 0xbc, 0xbb, 0xcc, 0xba, 0xbb,
+0xad, 0xbb, 0xbc, 0xca, 0xba, 0xdb, 0xba, 0xbb, 0xbc, 0xbb, 0xac, 0xbc, 0xbb, 0xbc, 0xcb, 0xba,
+0xbc, 0xbb, 0xbc, 0xcb, 0xcb, 0xab, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xdb, 0xba, 0xca, 0xaa, 0xac,
+0xab, 0xcb, 0xba, 0xcb, 0xba, 0xca, 0xab, 0xba, 0xda, 0xbb, 0x8b, 0xbd, 0xaa, 0xaa, 0x9c, 0xcb,
+0x68, 0xe6, 0xc, 0x0, 0xab, 0xb9, 0xdb, 0xab, 0xab, 0x9c, 0xab, 0xb8, 0xeb, 0xb9, 0xa8, 0xe9,
+0xa, 0x99, 0x99, 0xa9, 0x2a, 0xb9, 0x92, 0x95, 0xa3, 0x12, 0x21, 0x11, 0x23, 0x99, 0x15, 0x2a,
+0x39, 0x33, 0x33, 0x31, 0x13, 0x3, 0x17, 0x43, 0x38, 0x63, 0x31, 0x33, 0x25, 0x23, 0x13, 0x25,
+0x11, 0x31, 0x45, 0x20, 0x31, 0x44, 0x41, 0x31, 0x22, 0x35, 0x24, 0x23, 0x34, 0x34, 0x33, 0x44,
+0x43, 0x32, 0x63, 0x31, 0x23, 0x35, 0x32, 0x44, 0x33, 0x42, 0x43, 0x42, 0x23, 0x24, 0x24, 0x33,
+0x34, 0x33, 0x35, 0x33, 0x25, 0x33, 0x34, 0x24, 0x43, 0x23, 0x24, 0x43, 0x23, 0x34, 0x33, 0x25,
+0x33, 0x25, 0x23, 0x24, 0x43, 0x33, 0x43, 0x33, 0x35, 0x33, 0x34, 0x33, 0x25, 0x33, 0x43, 0x43,
+0x33, 0x53, 0x32, 0x42, 0x22, 0x24, 0x23, 0x43, 0x33, 0x24, 0x33, 0x34, 0x43, 0x42, 0x23, 0x24,
+0x24, 0x32, 0x33, 0x43, 0x43, 0x42, 0x42, 0x22, 0x33, 0x43, 0x42, 0x23, 0x23, 0x25, 0x32, 0x42,
+0x13, 0x24, 0x23, 0x43, 0x32, 0x42, 0x22, 0x14, 0x43, 0x32, 0x32, 0x43, 0x34, 0x33, 0x63, 0x13,
+0x43, 0x32, 0x53, 0x23, 0x33, 0x34, 0x43, 0x43, 0x33, 0x42, 0x31, 0x63, 0x31, 0x32, 0x32, 0x34,
+0x34, 0x24, 0x53, 0x32, 0x33, 0x34, 0x34, 0x35, 0x32, 0x43, 0x33, 0x53, 0x13, 0x25, 0x22, 0x33,
+0x24, 0x53, 0x32, 0x42, 0x23, 0x42, 0x33, 0x34, 0x33, 0x52, 0x33, 0x43, 0x43, 0x23, 0x24, 0x43,
+0x32, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x44, 0x31, 0x52, 0x31, 0x32, 0x33, 0x33, 0x24,
+0x62, 0x22, 0x21, 0x32, 0x43, 0x41, 0x12, 0x23, 0x31, 0x42, 0x50, 0x0, 0x3, 0x3, 0x34, 0x10,
+0x48, 0x59, 0xb, 0x10, 0x9, 0x8f, 0xb0, 0xb0, 0xe0, 0xc9, 0xa0, 0xea, 0xc8, 0xb0, 0xcb, 0xba,
+0x92, 0x11, 0xa, 0x0, 0xbb, 0xda, 0xb9, 0x9c, 0xab, 0xba, 0xeb, 0xb9, 0xb8, 0xba, 0x9e, 0xbb,
+0xda, 0xd9, 0x99, 0xab, 0xab, 0xbc, 0xac, 0xbb, 0xad, 0xab, 0xaa, 0xdb, 0xb9, 0xca, 0xbb, 0xcb,
+0xac, 0xbc, 0xab, 0xbb, 0xeb, 0x9b, 0xac, 0xa9, 0xba, 0xba, 0xd8, 0xa8, 0xac, 0x8f, 0x9b, 0xba,
+0xab, 0xad, 0xba, 0xea, 0x9a, 0x8b, 0xac, 0x9a, 0xbc, 0xdb, 0xb9, 0xba, 0xeb, 0xd9, 0x99, 0xca,
+0xaa, 0xab, 0xac, 0xcb, 0xcb, 0xba, 0xdb, 0xba, 0xbb, 0xbc, 0xbb, 0xad, 0xba, 0xcc, 0xba, 0xda,
+0xb9, 0xcb, 0xaa, 0xbb, 0xbc, 0xac, 0xda, 0xba, 0xca, 0xba, 0xbc, 0xbb, 0xac, 0xad, 0xba, 0xcb,
+0xab, 0xac, 0x9c, 0x9c, 0xab, 0xac, 0xab, 0xad, 0x9a, 0xac, 0xbb, 0xbb, 0xad, 0xab, 0xbc, 0xcb,
+0xab, 0xab, 0xcb, 0xbb, 0xcb, 0xdb, 0x9a, 0xbb, 0xda, 0xaa, 0xbb, 0xd9, 0xa9, 0xba, 0x9b, 0x9c,
+0x8b, 0xbb, 0xaa, 0xfa, 0xa9, 0x90, 0x99, 0xa0, 0x1f, 0x1c, 0x19, 0x9, 0x2b, 0x88, 0x91, 0xb9,
+0x3, 0x99, 0x9a, 0xab, 0xa4, 0x20, 0x11, 0x30, 0x33, 0x21, 0x40, 0x20, 0x23, 0x5, 0x14, 0x13,
+0x12, 0x53, 0x23, 0x42, 0x53, 0x30, 0x41, 0x38, 0x94, 0x93, 0x2, 0x32, 0x39, 0x39, 0x63, 0x29,
+0xa2, 0x7, 0x11, 0x48, 0x41, 0x21, 0x11, 0x5, 0x3, 0x25, 0x21, 0x31, 0x30, 0x21, 0x59, 0x30,
+0x39, 0x31, 0x5b, 0x39, 0x8, 0x33, 0x39, 0x5a, 0x1, 0x1, 0x86, 0x11, 0x0, 0xb1, 0x3, 0x33,
+0xb1, 0x93, 0x1, 0xac, 0x9a, 0xb3, 0xeb, 0x19, 0x9b, 0x9b, 0x9e, 0x9a, 0xba, 0xd, 0x1c, 0xab,
+0xc0, 0x90, 0xab, 0xb9, 0x1e, 0xb, 0xc, 0x1d, 0xd, 0x9b, 0xa9, 0x8c, 0x9d, 0xb9, 0xd9, 0xaa,
+0xab, 0xbb, 0xdc, 0xb9, 0xcb, 0xca, 0xb9, 0xb9, 0xdb, 0xb9, 0xcb, 0xca, 0xcb, 0xcb, 0xca, 0xb9,
+0xee, 0xff, 0xb, 0x0, 0xdb, 0xca, 0xba, 0xcb, 0xba, 0xad, 0xbb, 0xbc, 0xac, 0xbb, 0xbc, 0xeb,
+0xb9, 0xb9, 0xcb, 0xab, 0xbc, 0xdb, 0xba, 0xba, 0xcb, 0xbb, 0xad, 0xcb, 0xca, 0xba, 0xcb, 0xbb,
+0xbb, 0xad, 0xbb, 0xcb, 0xcb, 0xda, 0xb9, 0xb9, 0xbb, 0xac, 0x9d, 0xab, 0xbb, 0x9c, 0xab, 0xcb,
+0xab, 0xbc, 0xbb, 0xbd, 0xbb, 0xcb, 0xab, 0x9d, 0xab, 0xbb, 0xdb, 0xa9, 0x9c, 0x8c, 0x9b, 0xab,
+0xcb, 0xc0, 0xa8, 0xa9, 0xbb, 0x9a, 0xa9, 0x9b, 0xb1, 0x39, 0x2b, 0x3a, 0xab, 0xb9, 0x91, 0x19,
+0xbb, 0x90, 0x7, 0x12, 0x5a, 0x59, 0x28, 0x28, 0x31, 0x11, 0x24, 0x22, 0x23, 0x16, 0x51, 0x49,
+0x21, 0x33, 0x22, 0x70, 0x19, 0x0, 0x82, 0x85, 0x2, 0x15, 0x23, 0x41, 0x41, 0x31, 0x42, 0x21,
+0x43, 0x5, 0x83, 0x51, 0x39, 0x50, 0x50, 0x18, 0x11, 0x22, 0x31, 0x52, 0x31, 0x32, 0x17, 0x21,
+0x93, 0x85, 0x4, 0x3, 0x23, 0x15, 0x32, 0x53, 0x21, 0x42, 0x23, 0x33, 0x53, 0x24, 0x32, 0x53,
+0x32, 0x33, 0x35, 0x34, 0x43, 0x23, 0x34, 0x33, 0x34, 0x15, 0x23, 0x53, 0x32, 0x33, 0x53, 0x51,
+0x21, 0x23, 0x33, 0x24, 0x15, 0x12, 0x33, 0x23, 0x61, 0x21, 0x21, 0x33, 0x13, 0x25, 0x24, 0x33,
+0x32, 0x43, 0x15, 0x23, 0x22, 0x13, 0x15, 0x32, 0x3, 0x4, 0x3, 0xb3, 0x95, 0x50, 0x29, 0x19,
+0x1b, 0x85, 0x91, 0xc4, 0xa1, 0x31, 0x1e, 0x29, 0x89, 0xac, 0xb2, 0xb1, 0x9d, 0x9, 0x1b, 0xb9,
+0xaa, 0x2b, 0x9d, 0x8b, 0xc, 0x9c, 0x8c, 0xc, 0x9c, 0x8c, 0xd9, 0xb8, 0xd0, 0xa8, 0x99, 0xba,
+0x99, 0x2c, 0x1d, 0x2d, 0x8b, 0xa, 0xb, 0x19, 0x9c, 0x89, 0x9a, 0xd, 0x99, 0xab, 0xeb, 0x89,
+0xb8, 0xf0, 0xb8, 0xb9, 0xa1, 0x99, 0x19, 0xe, 0xa1, 0xb1, 0xb1, 0xc9, 0x90, 0x12, 0x90, 0x5c,
+0x52, 0xfc, 0x6, 0x0, 0xc3, 0xc3, 0x90, 0x80, 0xb3, 0xd1, 0xb2, 0xd2, 0xb1, 0x91, 0xa, 0x1d,
+0x9b, 0x19, 0xca, 0xd9, 0xba, 0xe9, 0xa9, 0x80, 0xb9, 0x19, 0x1f, 0x9, 0x9a, 0xd, 0x88, 0x8c,
+0x99, 0x19, 0xa, 0xab, 0x13, 0x1, 0xbb, 0xda, 0x10, 0x8b, 0xb0, 0x10, 0xb9, 0xcb, 0x10, 0xb0,
+0xba, 0xa, 0x91, 0x99, 0x3, 0x3, 0x39, 0x33, 0x53, 0x2, 0x83, 0x13, 0x94, 0xa3, 0x86, 0x91,
+0x11, 0x24, 0x40, 0x40, 0x10, 0x23, 0x27, 0x0, 0x32, 0x33, 0x16, 0x6, 0x22, 0x13, 0x14, 0x53,
+0x41, 0x31, 0x32, 0x30, 0x53, 0x32, 0x44, 0x32, 0x25, 0x33, 0x43, 0x24, 0x23, 0x25, 0x43, 0x23,
+0x33, 0x14, 0x15, 0x33, 0x42, 0x43, 0x32, 0x33, 0x25, 0x24, 0x52, 0x31, 0x33, 0x43, 0x33, 0x25,
+0x23, 0x34, 0x42, 0x32, 0x33, 0x25, 0x32, 0x24, 0x33, 0x32, 0x27, 0x22, 0x42, 0x42, 0x31, 0x51,
+0x30, 0x30, 0x23, 0x13, 0x34, 0x43, 0x32, 0x30, 0x33, 0x4, 0x26, 0x11, 0x15, 0x1, 0x33, 0x38,
+0x31, 0x12, 0x43, 0x43, 0x12, 0x93, 0x17, 0x95, 0x3, 0x20, 0x31, 0x21, 0x2, 0x7a, 0x38, 0x28,
+0xa, 0x31, 0x4b, 0xa, 0x2b, 0x2d, 0x1a, 0xd, 0xb, 0xb0, 0xd3, 0x99, 0x1a, 0x99, 0x9d, 0x2a,
+0xc, 0xbc, 0xc0, 0xc1, 0xb0, 0xb1, 0xd2, 0xa2, 0x29, 0xf, 0x88, 0xb1, 0x2, 0x20, 0x9a, 0x90,
+0x13, 0x13, 0x31, 0x22, 0x61, 0x29, 0x9, 0x11, 0x11, 0xb2, 0xb3, 0x13, 0x97, 0x90, 0xa4, 0x93,
+0x13, 0x59, 0x30, 0x21, 0x49, 0x3b, 0x5a, 0x1, 0x40, 0x40, 0x2, 0x90, 0x5, 0x4, 0x19, 0x93,
+0x31, 0x13, 0x96, 0x20, 0x10, 0x28, 0xb0, 0x3a, 0x12, 0x19, 0x1c, 0xa0, 0x9a, 0x9a, 0xab, 0x3,
+0xa3, 0xab, 0x10, 0x9, 0x8e, 0x99, 0x18, 0x2a, 0x1b, 0x99, 0x12, 0x5b, 0x1a, 0x92, 0xa3, 0x5,
+0x3a, 0x6, 0x3, 0x0, 0x12, 0x30, 0xb, 0x91, 0x92, 0xb3, 0xa3, 0x2, 0xa1, 0x93, 0x9a, 0xd,
+0xa9, 0x90, 0x2b, 0x8c, 0x9b, 0xa9, 0x11, 0xd0, 0x29, 0x39, 0x1b, 0xa9, 0xb2, 0xb5, 0x94, 0x93,
+0x10, 0x12, 0x97, 0x94, 0x2, 0x41, 0x10, 0x11, 0x22, 0x25, 0x10, 0x85, 0x32, 0x4, 0x12, 0x51,
+0x40, 0x39, 0x41, 0x40, 0x20, 0x22, 0x2, 0x4, 0x33, 0x35, 0x13, 0x51, 0x1, 0x22, 0x16, 0x31,
+0x61, 0x21, 0x12, 0x2, 0x42, 0x11, 0x32, 0x5a, 0x23, 0x4, 0x31, 0x72, 0x30, 0x40, 0x20, 0x21,
+0x23, 0x61, 0x38, 0x10, 0x1, 0x11, 0x10, 0x33, 0xb4, 0x12, 0x51, 0xb, 0x69, 0x89, 0x10, 0xa0,
+0xd1, 0xc3, 0x80, 0x9a, 0x9b, 0x9d, 0xb8, 0xaa, 0xb9, 0x8f, 0xaa, 0xaa, 0xb, 0x9e, 0x8c, 0xbb,
+0xbb, 0xbd, 0xcc, 0xbb, 0xcb, 0xf9, 0xa9, 0xa9, 0xbb, 0xab, 0xeb, 0xb9, 0xbb, 0xcb, 0xca, 0xb9,
+0xbc, 0xba, 0xdb, 0xcb, 0xba, 0xad, 0xaa, 0xac, 0x9c, 0xba, 0xd9, 0xa9, 0xcb, 0xb9, 0xb9, 0xbc,
+0xac, 0xbb, 0xdb, 0xcb, 0xbb, 0xbc, 0xac, 0x9d, 0xab, 0xab, 0x9d, 0xbb, 0xca, 0xab, 0xcb, 0xcb,
+0xca, 0xaa, 0xda, 0xaa, 0xca, 0xab, 0xbb, 0xdb, 0xca, 0xab, 0xca, 0xda, 0xb9, 0xba, 0xcb, 0xba,
+0xbc, 0xba, 0xbc, 0xcb, 0xcb, 0xba, 0xbc, 0xac, 0xbb, 0xcb, 0xca, 0xab, 0xbc, 0xca, 0xd9, 0x9a,
+0xab, 0xac, 0xab, 0xad, 0xba, 0xda, 0xaa, 0xbb, 0x9d, 0xab, 0xca, 0xaa, 0xc9, 0xc9, 0xaa, 0x9a,
+0xca, 0xbb, 0xea, 0xb9, 0xc9, 0xba, 0xbb, 0xcb, 0x9c, 0xab, 0xbc, 0xcb, 0xca, 0xaa, 0xbb, 0xdb,
+0xb9, 0xb9, 0xea, 0xa0, 0xca, 0xb8, 0xc9, 0xb9, 0x9a, 0xba, 0xbb, 0xac, 0xbb, 0x9c, 0xcb, 0xea,
+0xb9, 0xb9, 0xbd, 0xcb, 0xba, 0xab, 0x9f, 0xa9, 0x98, 0xbb, 0x9, 0xa, 0x9d, 0xbb, 0x80, 0xf9,
+0x89, 0xf5, 0x8, 0x0, 0x98, 0xb1, 0xa0, 0x89, 0xe, 0xa, 0x1b, 0xcb, 0xb0, 0x3b, 0xf, 0x9,
+0x49, 0xb, 0x2b, 0x3d, 0x20, 0x2a, 0x49, 0xa, 0x12, 0xb4, 0xb2, 0x7, 0x1, 0x32, 0x23, 0x19,
+0x35, 0x5, 0x3, 0x53, 0x31, 0x43, 0x10, 0x82, 0x96, 0x5, 0x12, 0x52, 0x31, 0x31, 0x30, 0x32,
+0x41, 0x33, 0x15, 0x14, 0x23, 0x61, 0x48, 0x20, 0x43, 0x22, 0x22, 0x24, 0x63, 0x21, 0x23, 0x52,
+0x38, 0x31, 0x14, 0x33, 0x35, 0x22, 0x25, 0x42, 0x32, 0x31, 0x43, 0x32, 0x23, 0x35, 0x22, 0x14,
+0x31, 0x35, 0x14, 0x82, 0x35, 0x42, 0x42, 0x30, 0x32, 0x34, 0x13, 0x63, 0x21, 0x13, 0x6, 0x14,
+0x12, 0x32, 0x33, 0x43, 0x72, 0x20, 0x12, 0x41, 0x22, 0x32, 0x13, 0x24, 0x43, 0x23, 0x17, 0x32,
+0x51, 0x31, 0x22, 0x15, 0x12, 0x33, 0x21, 0x34, 0x14, 0x23, 0x24, 0x21, 0x24, 0x24, 0x3, 0x23,
+0x33, 0x36, 0x51, 0x41, 0x11, 0x33, 0x24, 0x33, 0x34, 0x25, 0x23, 0x24, 0x32, 0x31, 0x15, 0x42,
+0x20, 0x30, 0x5a, 0x21, 0x30, 0x52, 0x31, 0x33, 0x54, 0x23, 0x31, 0x43, 0x41, 0x43, 0x21, 0x32,
+0x3, 0x6, 0x31, 0x13, 0x22, 0x26, 0x14, 0x2, 0x24, 0x21, 0x32, 0x34, 0x53, 0x33, 0x46, 0x11,
+0x21, 0x31, 0x82, 0x85, 0x84, 0x5, 0x21, 0x11, 0x33, 0x33, 0x71, 0x50, 0x20, 0x1, 0x2, 0x32,
+0x15, 0x23, 0x42, 0x33, 0x34, 0x43, 0x40, 0x30, 0x31, 0x13, 0x15, 0x85, 0x12, 0x31, 0x43, 0x10,
+0x25, 0x25, 0x40, 0x2, 0x15, 0x32, 0x40, 0x11, 0x32, 0x23, 0x13, 0x53, 0x95, 0x4, 0x82, 0x2,
+0x53, 0x0, 0x12, 0x21, 0x11, 0x39, 0x73, 0x19, 0x1, 0x3, 0x92, 0x4, 0x42, 0x21, 0x61, 0x40,
+0x1a, 0x8, 0xa4, 0xc3, 0x80, 0x9, 0x10, 0x3, 0x90, 0xb0, 0x19, 0x2e, 0x1a, 0x2b, 0x1d, 0xa9,
+0x86, 0x3, 0x2, 0x0, 0x21, 0x1d, 0xb, 0x99, 0xdb, 0xa0, 0x80, 0xf, 0xa, 0x98, 0xc0, 0x91,
+0xa0, 0xa3, 0x13, 0xb3, 0x12, 0x31, 0x4a, 0x3a, 0x93, 0x31, 0xb9, 0xb4, 0x95, 0x91, 0xc9, 0xb3,
+0x94, 0xa1, 0xa, 0x91, 0xbc, 0xf2, 0x91, 0x88, 0x29, 0x19, 0x11, 0x9, 0x39, 0x2b, 0x0, 0x93,
+0x33, 0x5b, 0x3b, 0x2a, 0x1, 0x12, 0xb, 0x1f, 0x89, 0x1a, 0xd, 0x1, 0xc8, 0x90, 0x94, 0x10,
+0x2, 0x23, 0x33, 0x53, 0x4b, 0x20, 0x10, 0xb3, 0x16, 0x90, 0x3, 0x32, 0x71, 0x21, 0x2, 0x2,
+0x24, 0x30, 0x22, 0x15, 0xb2, 0x85, 0xa3, 0xa2, 0x91, 0x51, 0x48, 0x5b, 0x2a, 0x4b, 0x29, 0x0,
+0x0, 0x90, 0x2b, 0x91, 0xb5, 0xa5, 0xa2, 0x93, 0xa3, 0xb6, 0xb2, 0x8, 0x3b, 0x9f, 0xa9, 0x9b,
+0xaa, 0xbb, 0xfb, 0x99, 0x9c, 0x8a, 0x9b, 0xbc, 0x92, 0xc9, 0xb3, 0xb8, 0xe, 0xba, 0xc1, 0x9b,
+0x98, 0xdb, 0xb9, 0xa9, 0x8c, 0xf, 0x8c, 0x9b, 0x9c, 0xaa, 0xba, 0xdb, 0xb9, 0xac, 0xdb, 0xa9,
+0xaa, 0xdb, 0xd9, 0xb9, 0xa9, 0xbb, 0xda, 0x99, 0xb9, 0xac, 0xba, 0xc9, 0xe9, 0x98, 0xb9, 0xf9,
+0xa9, 0x9a, 0xaa, 0xdb, 0x9a, 0xba, 0xbb, 0xfb, 0xa9, 0x9c, 0xaa, 0xba, 0xe9, 0xb9, 0x89, 0x9a,
+0xcb, 0xba, 0xeb, 0xa9, 0x9b, 0x9d, 0x9b, 0x9c, 0xc9, 0xa8, 0xbc, 0x9a, 0xeb, 0xba, 0x9b, 0xba,
+0xfb, 0xaa, 0xaa, 0x8a, 0xeb, 0xba, 0xa9, 0xab, 0xba, 0x98, 0xd, 0x8e, 0x99, 0x9b, 0x19, 0x8b,
+0xda, 0xa, 0xb9, 0xf, 0xaa, 0x98, 0x9, 0xbb, 0xda, 0xa0, 0x9b, 0xa9, 0xf, 0x9b, 0xd8, 0xb1,
+0x80, 0x8a, 0x2a, 0x1b, 0x1b, 0x1b, 0x39, 0x3b, 0x1d, 0xb9, 0xf0, 0x90, 0xa9, 0xc1, 0xb8, 0xe3,
+0x91, 0x88, 0x99, 0xd9, 0x90, 0xb1, 0xb3, 0x19, 0x99, 0xb, 0xd3, 0x91, 0x99, 0x3b, 0x5a, 0x1b,
+0x2e, 0xfd, 0x2, 0x0, 0x19, 0xb9, 0x9d, 0xd, 0x9, 0xba, 0xc1, 0x10, 0x39, 0x11, 0x21, 0x1b,
+0x91, 0x3, 0x0, 0x14, 0x31, 0x12, 0x11, 0x33, 0x87, 0x1, 0x4, 0x43, 0x10, 0x2, 0x99, 0x8,
+0x2a, 0x93, 0x0, 0x1b, 0x31, 0x99, 0x1b, 0x12, 0x43, 0x23, 0x13, 0x13, 0x13, 0x31, 0x51, 0x59,
+0x48, 0x18, 0x12, 0x18, 0x28, 0x5a, 0x21, 0x93, 0x7, 0x12, 0x12, 0x26, 0x21, 0x3, 0x13, 0x7,
+0x13, 0x32, 0x31, 0x42, 0x4, 0x21, 0x14, 0x20, 0x41, 0x1, 0x30, 0x61, 0x38, 0x31, 0x59, 0x30,
+0x11, 0x72, 0x20, 0x30, 0x40, 0x12, 0x43, 0x51, 0x23, 0x12, 0x32, 0x24, 0x12, 0x17, 0x21, 0x41,
+0x20, 0x53, 0x22, 0x2, 0x5, 0x31, 0x39, 0x20, 0x44, 0x34, 0x21, 0x44, 0x42, 0x31, 0x60, 0x31,
+0x2, 0x13, 0x43, 0x1, 0x21, 0x13, 0x33, 0x73, 0x2, 0x12, 0x21, 0xb1, 0x7, 0x94, 0x33, 0x21,
+0x11, 0x23, 0x23, 0x85, 0x91, 0x5, 0x3, 0x82, 0x3, 0x94, 0x94, 0x82, 0x30, 0x0, 0x23, 0x10,
+0x12, 0x1, 0xa1, 0xb0, 0xd5, 0xa2, 0x0, 0xa9, 0x9c, 0xa8, 0xf1, 0x19, 0x89, 0x89, 0xb, 0x1a,
+0x90, 0xa9, 0xba, 0xb2, 0x31, 0x99, 0x11, 0x2b, 0x19, 0x2b, 0x5c, 0x19, 0x91, 0x89, 0x33, 0x13,
+0x33, 0x19, 0x92, 0x87, 0x10, 0x6a, 0x90, 0x1, 0x91, 0x11, 0x20, 0x3c, 0x13, 0x24, 0x7, 0x13,
+0x30, 0x32, 0x42, 0x11, 0x2, 0x25, 0x30, 0x41, 0x38, 0x33, 0x92, 0x14, 0x14, 0x14, 0xa3, 0x10,
+0x43, 0xa0, 0x5, 0x21, 0x71, 0x49, 0x28, 0x21, 0x22, 0x42, 0x22, 0x11, 0x63, 0x0, 0x10, 0xa2,
+0x93, 0xb3, 0xb, 0x1d, 0x4b, 0x1d, 0x9b, 0x9, 0x9c, 0x9a, 0x3c, 0xb, 0x9d, 0xb8, 0xb1, 0xda,
+0xb0, 0xaa, 0x8f, 0x9b, 0xba, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xf, 0xab, 0xab, 0x9b, 0x8c, 0xb,
+0xd3, 0x1, 0x0, 0x0, 0xd9, 0x9c, 0x8c, 0xb, 0x9b, 0x8d, 0xab, 0xcb, 0xba, 0xbd, 0xba, 0xc9,
+0xaa, 0xa0, 0xf2, 0xc0, 0xa1, 0xa1, 0xb9, 0x8a, 0xab, 0xbb, 0xd2, 0x9a, 0x8b, 0x5b, 0xb, 0x3c,
+0x3b, 0x1a, 0xbc, 0x91, 0xd0, 0xc8, 0x98, 0xab, 0x2c, 0x1d, 0x1d, 0x9a, 0xa0, 0x1b, 0xaa, 0xd9,
+0xa9, 0x88, 0xd1, 0x91, 0x20, 0x11, 0xa, 0xb2, 0xb5, 0xa3, 0x29, 0x1e, 0xa9, 0xc1, 0xc0, 0xa2,
+0x1d, 0x9b, 0x99, 0xc8, 0xa, 0xaa, 0xd9, 0xb, 0x2b, 0x9f, 0xb0, 0xa9, 0xa0, 0x18, 0x50, 0xa,
+0xa, 0xab, 0x91, 0x9b, 0xbb, 0x1d, 0xb, 0xad, 0x99, 0xab, 0xba, 0xbd, 0xb1, 0xfb, 0xb0, 0xa9,
+0xdb, 0xaa, 0x9b, 0xbd, 0x8d, 0x8c, 0xaa, 0xa8, 0xbb, 0xdb, 0xaa, 0xb9, 0xac, 0xca, 0xc9, 0xa8,
+0xd9, 0x89, 0x9c, 0xab, 0xc9, 0xb8, 0x9b, 0xe, 0x8a, 0x8f, 0x1b, 0x19, 0xb9, 0xaa, 0xe1, 0x80,
+0xb, 0x9b, 0xb9, 0xe9, 0xc9, 0xa1, 0xa, 0xa, 0xe0, 0x98, 0x10, 0xa0, 0xbb, 0x1b, 0xd2, 0x0,
+0x39, 0x29, 0x1b, 0x93, 0xb, 0xb2, 0x90, 0x21, 0x22, 0x10, 0x22, 0x3, 0xb3, 0x3, 0x15, 0x3,
+0x5, 0x11, 0x19, 0x50, 0x11, 0x42, 0x49, 0x34, 0x32, 0x34, 0x51, 0x2, 0x86, 0x3, 0x11, 0x83,
+0x33, 0x13, 0x85, 0x11, 0x51, 0x4b, 0x1a, 0x11, 0x11, 0xb9, 0x53, 0x11, 0x52, 0x28, 0x30, 0x51,
+0x31, 0x4a, 0x39, 0x5a, 0x4b, 0x4b, 0xa, 0x92, 0x88, 0x90, 0x6, 0x20, 0x98, 0x12, 0x13, 0x33,
+0x43, 0x32, 0x91, 0x13, 0x43, 0x12, 0x22, 0x92, 0x92, 0xb9, 0x9, 0x99, 0x91, 0x1, 0x63, 0x19,
+0x3b, 0x50, 0x3a, 0x2b, 0x39, 0xd9, 0x19, 0x90, 0x39, 0xaa, 0xb0, 0xb5, 0xd1, 0x2, 0x98, 0x82,
+0x11, 0x20, 0x31, 0x6, 0x2, 0x13, 0x50, 0x0, 0x39, 0x21, 0x9b, 0x9b, 0xad, 0x8b, 0x8c, 0xd,
+0xc5, 0xfe, 0x5, 0x0, 0xaa, 0x8c, 0xc, 0x9b, 0xba, 0xb1, 0xd1, 0xd2, 0x91, 0x18, 0xa0, 0x95,
+0xa3, 0x10, 0x33, 0xb3, 0x3, 0x4, 0x3b, 0x7, 0x81, 0x92, 0x9, 0x31, 0xd0, 0xa2, 0x30, 0x19,
+0xa9, 0x1, 0xba, 0xd1, 0x92, 0xa1, 0x97, 0xa4, 0x1, 0x12, 0x19, 0x13, 0x70, 0x1, 0x3, 0x33,
+0x42, 0x30, 0x31, 0x60, 0x40, 0x49, 0x39, 0x31, 0x23, 0x42, 0x61, 0x21, 0x41, 0x31, 0x32, 0x15,
+0x23, 0x15, 0x23, 0x42, 0x30, 0x42, 0x33, 0x5, 0x23, 0x15, 0x3, 0x4, 0x23, 0x32, 0x94, 0x96,
+0x32, 0x21, 0x4, 0x3, 0x33, 0x93, 0x27, 0x82, 0x4, 0x32, 0x1, 0x0, 0x43, 0x52, 0x28, 0x1,
+0x19, 0x33, 0x95, 0x82, 0x10, 0x9, 0x3, 0x95, 0xa0, 0x22, 0x1e, 0x1b, 0x3b, 0xc9, 0x90, 0xc3,
+0xb0, 0x13, 0xb9, 0x9, 0x3b, 0x1c, 0x2b, 0xb1, 0x99, 0xa9, 0x9b, 0x3b, 0x0, 0xba, 0x1b, 0xb9,
+0x2, 0xa1, 0xb9, 0xc2, 0x99, 0xb4, 0xab, 0xb3, 0xba, 0xf9, 0x91, 0x0, 0xa9, 0xa9, 0xb0, 0x1a,
+0x2b, 0x3b, 0x9a, 0x99, 0x3, 0xb1, 0x51, 0x6a, 0x1a, 0x29, 0x10, 0x89, 0xb1, 0x9a, 0x91, 0x2b,
+0x5b, 0x3b, 0x4a, 0x9a, 0x10, 0x9, 0x2a, 0x99, 0x15, 0x11, 0x21, 0x7, 0x13, 0x13, 0x33, 0x6,
+0x3, 0x5, 0x12, 0x32, 0x83, 0x86, 0x13, 0x32, 0x62, 0x10, 0x82, 0x21, 0x42, 0x22, 0x3d, 0x28,
+0x90, 0x91, 0x93, 0x39, 0x2, 0x50, 0x19, 0x18, 0x33, 0x13, 0x11, 0x31, 0x43, 0x4a, 0x1a, 0x1a,
+0x2b, 0xb0, 0x0, 0x9d, 0xd, 0xa0, 0xb2, 0xeb, 0xa0, 0x9a, 0x9b, 0xba, 0xd9, 0xd9, 0x99, 0xc8,
+0xb8, 0xb0, 0x8a, 0xeb, 0x9, 0x9b, 0xa, 0xaf, 0xaa, 0xdb, 0x99, 0xca, 0xb9, 0x9a, 0x9d, 0xb8,
+0xc0, 0xb1, 0xf0, 0x80, 0xa, 0x98, 0xd1, 0x90, 0xb2, 0xa1, 0x1a, 0x92, 0x3a, 0x4b, 0x8, 0xb9,
+0x9d, 0x0, 0x0, 0x0, 0xa2, 0x13, 0x2b, 0x39, 0x1, 0xb0, 0x4a, 0x48, 0x2a, 0xa1, 0x97, 0xa3,
+0x93, 0x1, 0x12, 0x1a, 0xa2, 0x21, 0x96, 0xb2, 0xa2, 0x13, 0xa9, 0x91, 0x13, 0x92, 0x31, 0x71,
+0x28, 0x10, 0x92, 0x3, 0x2, 0xc0, 0x0, 0x8f, 0x1b, 0x8c, 0xb1, 0xb1, 0x88, 0x90, 0xb9, 0x1,
+0xa9, 0xab, 0x1b, 0x9b, 0xab, 0xfa, 0xc0, 0xa1, 0xa0, 0xb1, 0xd2, 0xb1, 0xb1, 0xa1, 0xb3, 0x0,
+0x1b, 0x20, 0x1d, 0x10, 0x1d, 0x89, 0x8, 0xb9, 0xb9, 0x1b, 0x9e, 0xa9, 0xc1, 0xe8, 0xa0, 0x9,
+0x19, 0x1b, 0xfa, 0x9, 0xa0, 0x91, 0x9c, 0x29, 0x1c, 0x8b, 0x9b, 0x9b, 0xf9, 0xa, 0x1, 0x99,
+0xd1, 0x0, 0xa0, 0xc0, 0xc2, 0xb3, 0xb2, 0x10, 0x19, 0xa1, 0xb3, 0xa9, 0x2b, 0xb9, 0xbb, 0x90,
+0x9b, 0x9f, 0x99, 0xaa, 0xb9, 0xf0, 0x90, 0xb0, 0x1b, 0x9, 0xaa, 0xab, 0x2b, 0x2b, 0x9c, 0xf2,
+0xb2, 0x20, 0x49, 0x2b, 0x1a, 0x28, 0x3b, 0x3b, 0x19, 0x94, 0x84, 0x93, 0x3, 0x23, 0x9b, 0xa2,
+0xa3, 0x13, 0x91, 0xa3, 0xa9, 0x41, 0x1, 0x86, 0x30, 0x3, 0x79, 0x18, 0x10, 0x3a, 0x1, 0x13,
+0x0, 0x30, 0x31, 0x50, 0x20, 0x39, 0x1, 0x31, 0x20, 0x1f, 0x9, 0xb2, 0xb3, 0x33, 0x93, 0xb4,
+0xb3, 0xb5, 0x91, 0x12, 0x1a, 0x59, 0x89, 0x90, 0xd3, 0xa1, 0x11, 0x1a, 0x2b, 0x11, 0x30, 0x9c,
+0x93, 0xb9, 0xb2, 0x93, 0xb2, 0x21, 0x1e, 0x3a, 0x99, 0xd3, 0x91, 0x19, 0x19, 0x29, 0x1c, 0x9b,
+0x90, 0x19, 0x8c, 0x99, 0xa0, 0x9c, 0x5b, 0x1a, 0x8, 0xa9, 0x91, 0xc, 0xab, 0xc0, 0xb8, 0xb2,
+0xb9, 0x9b, 0xad, 0xbb, 0xa0, 0xf1, 0x99, 0x89, 0x1b, 0x8b, 0xbb, 0x99, 0x3b, 0x9b, 0x9c, 0xa9,
+0xd1, 0xb8, 0x99, 0x1b, 0x8f, 0x2b, 0xa9, 0xdb, 0x8a, 0xab, 0xb9, 0xb1, 0x9d, 0x19, 0x1, 0xb2,
+0x8d, 0xfe, 0x0, 0x0, 0x8e, 0x18, 0xa1, 0xa2, 0x19, 0xb1, 0x10, 0xb5, 0xc2, 0x28, 0x3a, 0x5a,
+0x19, 0x1a, 0xbb, 0x99, 0x9d, 0x19, 0x99, 0xba, 0x11, 0x50, 0x5a, 0x29, 0x12, 0x13, 0x3, 0x25,
+0x20, 0x73, 0x12, 0x2, 0x14, 0x14, 0x3, 0x5, 0x2, 0x4, 0x33, 0x30, 0x20, 0x31, 0x23, 0x93,
+0x11, 0x23, 0x22, 0x11, 0x23, 0x41, 0x29, 0x40, 0x38, 0x43, 0x95, 0xa3, 0xa5, 0x0, 0x4a, 0x1a,
+0x10, 0x31, 0xbb, 0x13, 0x93, 0xc2, 0x94, 0xb5, 0xb1, 0x5, 0x90, 0x10, 0x30, 0x0, 0x59, 0x23,
+0x21, 0xb4, 0x40, 0x13, 0x23, 0x73, 0x31, 0x19, 0x21, 0x3b, 0x49, 0x39, 0x4d, 0x29, 0x0, 0x10,
+0x31, 0x5, 0x3, 0x32, 0x43, 0x69, 0x30, 0x38, 0x33, 0x94, 0x85, 0x12, 0x21, 0x40, 0x30, 0x31,
+0x71, 0x11, 0x31, 0x31, 0x32, 0x73, 0x10, 0x4, 0x84, 0x85, 0x3, 0x11, 0x12, 0x11, 0x31, 0x50,
+0x31, 0x69, 0x30, 0x14, 0x22, 0x23, 0x25, 0x22, 0x25, 0x53, 0x30, 0x42, 0x38, 0x3, 0x7, 0x3,
+0x93, 0x13, 0x40, 0x10, 0x1, 0x92, 0x5, 0x22, 0x99, 0x2a, 0x1b, 0xa, 0x5b, 0xa0, 0xb2, 0xa1,
+0xa3, 0xba, 0x20, 0x9b, 0x1e, 0x8a, 0xa, 0x2a, 0xcb, 0x9d, 0xb8, 0xb0, 0x99, 0xbb, 0x9b, 0xa9,
+0xfb, 0xa8, 0x9a, 0x99, 0xc, 0xe, 0xb, 0x8b, 0xcb, 0xb0, 0xc9, 0x9b, 0x8d, 0xa, 0x8e, 0x99,
+0x9b, 0xbb, 0xf1, 0xa8, 0xa0, 0x9a, 0xbb, 0xfa, 0x99, 0x9b, 0x9d, 0xba, 0xda, 0xbb, 0xab, 0xad,
+0xc, 0x9d, 0x9a, 0x9a, 0xcb, 0xba, 0xc9, 0xa8, 0xb8, 0xc8, 0xca, 0xb0, 0x9d, 0xaa, 0xa9, 0xda,
+0xa9, 0xb1, 0xb9, 0x8f, 0xb, 0x1c, 0x8e, 0xa9, 0x98, 0xb9, 0x9c, 0xaa, 0xf9, 0xa0, 0xa0, 0xb9,
+0xb9, 0xb8, 0xb9, 0xe, 0xaa, 0xb9, 0xf8, 0x90, 0xe8, 0xb0, 0xa0, 0x98, 0x8a, 0xa8, 0xd1, 0x98,
+0x6d, 0xfe, 0x2, 0x0, 0x89, 0x19, 0x2a, 0x29, 0x2b, 0x1a, 0xf, 0x9, 0xc, 0x1b, 0xb8, 0xb8,
+0xb9, 0xe2, 0xa0, 0xd2, 0x1, 0x10, 0xa1, 0x32, 0x4a, 0x3b, 0x99, 0x9a, 0x1, 0xb3, 0xa5, 0xb1,
+0xc6, 0x82, 0x80, 0x9, 0x91, 0xb2, 0x13, 0x13, 0x1c, 0x59, 0x99, 0x92, 0x2, 0x99, 0x39, 0x69,
+0x10, 0x29, 0x19, 0x21, 0x33, 0x43, 0x30, 0x11, 0x4, 0x31, 0x53, 0x28, 0x21, 0x33, 0x26, 0x90,
+0x41, 0x30, 0x32, 0x4b, 0x21, 0x51, 0x3a, 0x31, 0xa6, 0xa4, 0x2, 0x90, 0x92, 0x6, 0x30, 0x58,
+0x59, 0x0, 0x0, 0x23, 0x59, 0x18, 0x31, 0x9, 0x11, 0x86, 0xa0, 0x92, 0xb2, 0x0, 0x5a, 0x18,
+0x6a, 0x89, 0x80, 0x83, 0xa4, 0x94, 0xa4, 0x13, 0x82, 0x13, 0xb5, 0xa4, 0xa2, 0xa4, 0x91, 0x30,
+0x30, 0x10, 0x11, 0x95, 0xa4, 0x3, 0x93, 0x17, 0x20, 0x38, 0x91, 0x13, 0x25, 0x30, 0x50, 0x49,
+0x59, 0x19, 0x1, 0x92, 0x93, 0x15, 0x88, 0x93, 0x44, 0x51, 0x48, 0x59, 0x38, 0x11, 0x23, 0x4,
+0x4, 0x40, 0x10, 0x1, 0x4, 0x32, 0x23, 0xa2, 0x63, 0x31, 0x40, 0x21, 0x84, 0x3, 0x43, 0x33,
+0x15, 0x93, 0x24, 0x31, 0x33, 0x34, 0x4, 0x13, 0x23, 0x11, 0x79, 0x28, 0x29, 0x3b, 0x3a, 0x90,
+0x9, 0xb, 0xb9, 0x2, 0xa, 0x99, 0xd9, 0x81, 0xc0, 0x82, 0x9b, 0x19, 0xc9, 0xb0, 0x91, 0xe9,
+0xa8, 0x9b, 0x9d, 0xbb, 0xbb, 0xba, 0xdc, 0xc0, 0xd0, 0xa1, 0x99, 0x9b, 0xb, 0xba, 0x8c, 0x1b,
+0xb0, 0xab, 0x9c, 0x9a, 0x1b, 0x9, 0xba, 0xd9, 0xb8, 0xd2, 0xd8, 0xa0, 0x98, 0xa, 0xb, 0x9b,
+0x9b, 0x19, 0xf0, 0xa8, 0x81
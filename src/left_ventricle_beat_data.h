@@ -1,22112 +0,0 @@
-0xea,
-0xff,
-0xe7,
-0xff,
-0xe1,
-0xff,
-0xdf,
-0xff,
-0xda,
-0xff,
-0xd9,
-0xff,
-0xd8,
-0xff,
-0xd9,
-0xff,
-0xdb,
-0xff,
-0xd9,
-0xff,
-0xd9,
-0xff,
-0xdb,
-0xff,
-0xd8,
-0xff,
-0xd5,
-0xff,
-0xd2,
-0xff,
-0xd6,
-0xff,
-0xd6,
-0xff,
-0xd5,
-0xff,
-0xcb,
-0xff,
-0xcb,
-0xff,
-0xcd,
-0xff,
-0xd2,
-0xff,
-0xcd,
-0xff,
-0xd0,
-0xff,
-0xce,
-0xff,
-0xd0,
-0xff,
-0xcd,
-0xff,
-0xcf,
-0xff,
-0xcc,
-0xff,
-0xd1,
-0xff,
-0xcc,
-0xff,
-0xce,
-0xff,
-0xcf,
-0xff,
-0xd2,
-0xff,
-0xce,
-0xff,
-0xd2,
-0xff,
-0xd4,
-0xff,
-0xd4,
-0xff,
-0xcf,
-0xff,
-0xd1,
-0xff,
-0xcd,
-0xff,
-0xcb,
-0xff,
-0xca,
-0xff,
-0xc8,
-0xff,
-0xc7,
-0xff,
-0xc4,
-0xff,
-0xbf,
-0xff,
-0xc1,
-0xff,
-0xb7,
-0xff,
-0xb8,
-0xff,
-0xaf,
-0xff,
-0xb1,
-0xff,
-0xa2,
-0xff,
-0xa5,
-0xff,
-0x9c,
-0xff,
-0x9a,
-0xff,
-0x99,
-0xff,
-0x92,
-0xff,
-0x99,
-0xff,
-0x8b,
-0xff,
-0x8e,
-0xff,
-0x85,
-0xff,
-0x86,
-0xff,
-0x83,
-0xff,
-0x83,
-0xff,
-0x82,
-0xff,
-0x81,
-0xff,
-0x7e,
-0xff,
-0x7b,
-0xff,
-0x7e,
-0xff,
-0x78,
-0xff,
-0x79,
-0xff,
-0x78,
-0xff,
-0x75,
-0xff,
-0x7b,
-0xff,
-0x7a,
-0xff,
-0x79,
-0xff,
-0x80,
-0xff,
-0x80,
-0xff,
-0x80,
-0xff,
-0x7d,
-0xff,
-0x7d,
-0xff,
-0x82,
-0xff,
-0x7e,
-0xff,
-0x83,
-0xff,
-0x80,
-0xff,
-0x81,
-0xff,
-0x80,
-0xff,
-0x7e,
-0xff,
-0x83,
-0xff,
-0x7d,
-0xff,
-0x7d,
-0xff,
-0x82,
-0xff,
-0x79,
-0xff,
-0x7e,
-0xff,
-0x7f,
-0xff,
-0x78,
-0xff,
-0x7e,
-0xff,
-0x78,
-0xff,
-0x81,
-0xff,
-0x7c,
-0xff,
-0x85,
-0xff,
-0x83,
-0xff,
-0x86,
-0xff,
-0x89,
-0xff,
-0x8b,
-0xff,
-0x89,
-0xff,
-0x8b,
-0xff,
-0x90,
-0xff,
-0x92,
-0xff,
-0x93,
-0xff,
-0x95,
-0xff,
-0x96,
-0xff,
-0x92,
-0xff,
-0x94,
-0xff,
-0x9d,
-0xff,
-0x96,
-0xff,
-0xa0,
-0xff,
-0x99,
-0xff,
-0xa1,
-0xff,
-0x9a,
-0xff,
-0xa0,
-0xff,
-0x9f,
-0xff,
-0xa1,
-0xff,
-0xa2,
-0xff,
-0xa6,
-0xff,
-0xa2,
-0xff,
-0xaa,
-0xff,
-0xa9,
-0xff,
-0xa7,
-0xff,
-0xab,
-0xff,
-0xa5,
-0xff,
-0xab,
-0xff,
-0xa7,
-0xff,
-0xa1,
-0xff,
-0x9d,
-0xff,
-0x9a,
-0xff,
-0x9d,
-0xff,
-0x97,
-0xff,
-0x92,
-0xff,
-0x8d,
-0xff,
-0x89,
-0xff,
-0x8b,
-0xff,
-0x87,
-0xff,
-0x85,
-0xff,
-0x82,
-0xff,
-0x82,
-0xff,
-0x85,
-0xff,
-0x84,
-0xff,
-0x87,
-0xff,
-0x8c,
-0xff,
-0x88,
-0xff,
-0x89,
-0xff,
-0x88,
-0xff,
-0x8d,
-0xff,
-0x8b,
-0xff,
-0x96,
-0xff,
-0x98,
-0xff,
-0xa0,
-0xff,
-0xa3,
-0xff,
-0xaa,
-0xff,
-0xab,
-0xff,
-0xb5,
-0xff,
-0xb8,
-0xff,
-0xb8,
-0xff,
-0xbd,
-0xff,
-0xc2,
-0xff,
-0xc5,
-0xff,
-0xc4,
-0xff,
-0xc3,
-0xff,
-0xc5,
-0xff,
-0xc2,
-0xff,
-0xc8,
-0xff,
-0xc2,
-0xff,
-0xc3,
-0xff,
-0xc2,
-0xff,
-0xc6,
-0xff,
-0xc6,
-0xff,
-0xc5,
-0xff,
-0xc5,
-0xff,
-0xc6,
-0xff,
-0xc9,
-0xff,
-0xbc,
-0xff,
-0xc4,
-0xff,
-0xbf,
-0xff,
-0xc4,
-0xff,
-0xbe,
-0xff,
-0xc9,
-0xff,
-0xc5,
-0xff,
-0xc0,
-0xff,
-0xc0,
-0xff,
-0xc4,
-0xff,
-0xc0,
-0xff,
-0xc7,
-0xff,
-0xc5,
-0xff,
-0xc8,
-0xff,
-0xc6,
-0xff,
-0xc8,
-0xff,
-0xc8,
-0xff,
-0xc9,
-0xff,
-0xcf,
-0xff,
-0xd0,
-0xff,
-0xd1,
-0xff,
-0xd0,
-0xff,
-0xd1,
-0xff,
-0xd3,
-0xff,
-0xd8,
-0xff,
-0xd0,
-0xff,
-0xd6,
-0xff,
-0xd7,
-0xff,
-0xd7,
-0xff,
-0xdb,
-0xff,
-0xd6,
-0xff,
-0xda,
-0xff,
-0xda,
-0xff,
-0xdb,
-0xff,
-0xd9,
-0xff,
-0xda,
-0xff,
-0xdc,
-0xff,
-0xe1,
-0xff,
-0xdf,
-0xff,
-0xed,
-0xff,
-0xe2,
-0xff,
-0xea,
-0xff,
-0xe8,
-0xff,
-0xef,
-0xff,
-0xef,
-0xff,
-0xf4,
-0xff,
-0xf5,
-0xff,
-0xfa,
-0xff,
-0xfc,
-0xff,
-0x0,
-0x0,
-0xfa,
-0xff,
-0xfc,
-0xff,
-0xfc,
-0xff,
-0xff,
-0xff,
-0xfd,
-0xff,
-0x1,
-0x0,
-0x0,
-0x0,
-0x2,
-0x0,
-0x3,
-0x0,
-0x6,
-0x0,
-0x5,
-0x0,
-0x7,
-0x0,
-0x5,
-0x0,
-0x8,
-0x0,
-0x9,
-0x0,
-0xa,
-0x0,
-0x4,
-0x0,
-0x6,
-0x0,
-0x7,
-0x0,
-0xe,
-0x0,
-0x8,
-0x0,
-0x10,
-0x0,
-0xe,
-0x0,
-0x14,
-0x0,
-0x14,
-0x0,
-0x17,
-0x0,
-0x17,
-0x0,
-0x18,
-0x0,
-0x16,
-0x0,
-0x14,
-0x0,
-0x14,
-0x0,
-0x10,
-0x0,
-0x17,
-0x0,
-0x16,
-0x0,
-0x15,
-0x0,
-0x17,
-0x0,
-0x1a,
-0x0,
-0x18,
-0x0,
-0x16,
-0x0,
-0x21,
-0x0,
-0x1a,
-0x0,
-0x1b,
-0x0,
-0x16,
-0x0,
-0x17,
-0x0,
-0x1d,
-0x0,
-0x1b,
-0x0,
-0x25,
-0x0,
-0x1b,
-0x0,
-0x22,
-0x0,
-0x21,
-0x0,
-0x25,
-0x0,
-0x1e,
-0x0,
-0x20,
-0x0,
-0x1c,
-0x0,
-0x26,
-0x0,
-0x21,
-0x0,
-0x23,
-0x0,
-0x23,
-0x0,
-0x23,
-0x0,
-0x25,
-0x0,
-0x25,
-0x0,
-0x24,
-0x0,
-0x21,
-0x0,
-0x27,
-0x0,
-0x1a,
-0x0,
-0x21,
-0x0,
-0x1d,
-0x0,
-0x1d,
-0x0,
-0x16,
-0x0,
-0x16,
-0x0,
-0x13,
-0x0,
-0x11,
-0x0,
-0x11,
-0x0,
-0x6,
-0x0,
-0xa,
-0x0,
-0xf9,
-0xff,
-0x2,
-0x0,
-0xf6,
-0xff,
-0xfb,
-0xff,
-0xf4,
-0xff,
-0xf4,
-0xff,
-0xf3,
-0xff,
-0xec,
-0xff,
-0xe9,
-0xff,
-0xe6,
-0xff,
-0xeb,
-0xff,
-0xe7,
-0xff,
-0xe1,
-0xff,
-0xdc,
-0xff,
-0xdb,
-0xff,
-0xdd,
-0xff,
-0xd6,
-0xff,
-0xd8,
-0xff,
-0xdb,
-0xff,
-0xde,
-0xff,
-0xe1,
-0xff,
-0xdf,
-0xff,
-0xdf,
-0xff,
-0xe4,
-0xff,
-0xe0,
-0xff,
-0xe7,
-0xff,
-0xe7,
-0xff,
-0xf4,
-0xff,
-0xf0,
-0xff,
-0xf7,
-0xff,
-0xf4,
-0xff,
-0xf6,
-0xff,
-0xf6,
-0xff,
-0xfd,
-0xff,
-0xf6,
-0xff,
-0xf8,
-0xff,
-0xf5,
-0xff,
-0xf9,
-0xff,
-0xfa,
-0xff,
-0xf8,
-0xff,
-0x0,
-0x0,
-0xfc,
-0xff,
-0x3,
-0x0,
-0x0,
-0x0,
-0x2,
-0x0,
-0xfb,
-0xff,
-0x1,
-0x0,
-0x1,
-0x0,
-0x7,
-0x0,
-0x9,
-0x0,
-0x9,
-0x0,
-0x6,
-0x0,
-0x9,
-0x0,
-0x9,
-0x0,
-0xb,
-0x0,
-0x9,
-0x0,
-0x6,
-0x0,
-0x8,
-0x0,
-0x4,
-0x0,
-0x8,
-0x0,
-0xd,
-0x0,
-0x13,
-0x0,
-0x18,
-0x0,
-0x17,
-0x0,
-0x1e,
-0x0,
-0x1a,
-0x0,
-0x21,
-0x0,
-0x22,
-0x0,
-0x26,
-0x0,
-0x2e,
-0x0,
-0x2d,
-0x0,
-0x34,
-0x0,
-0x3a,
-0x0,
-0x3b,
-0x0,
-0x42,
-0x0,
-0x46,
-0x0,
-0x4a,
-0x0,
-0x58,
-0x0,
-0x58,
-0x0,
-0x5d,
-0x0,
-0x66,
-0x0,
-0x62,
-0x0,
-0x6e,
-0x0,
-0x6d,
-0x0,
-0x77,
-0x0,
-0x7a,
-0x0,
-0x7c,
-0x0,
-0x83,
-0x0,
-0x87,
-0x0,
-0x8a,
-0x0,
-0x8d,
-0x0,
-0x8d,
-0x0,
-0x8e,
-0x0,
-0x8d,
-0x0,
-0x90,
-0x0,
-0x93,
-0x0,
-0x95,
-0x0,
-0x95,
-0x0,
-0x97,
-0x0,
-0x98,
-0x0,
-0x99,
-0x0,
-0x98,
-0x0,
-0x9d,
-0x0,
-0x99,
-0x0,
-0xa5,
-0x0,
-0x9f,
-0x0,
-0xa5,
-0x0,
-0xa6,
-0x0,
-0xa4,
-0x0,
-0xa8,
-0x0,
-0xa6,
-0x0,
-0xaa,
-0x0,
-0xa7,
-0x0,
-0xa7,
-0x0,
-0x9e,
-0x0,
-0xa3,
-0x0,
-0x98,
-0x0,
-0xa7,
-0x0,
-0x9b,
-0x0,
-0xa6,
-0x0,
-0x99,
-0x0,
-0x9c,
-0x0,
-0x97,
-0x0,
-0x98,
-0x0,
-0x96,
-0x0,
-0x92,
-0x0,
-0x90,
-0x0,
-0x8a,
-0x0,
-0x89,
-0x0,
-0x82,
-0x0,
-0x83,
-0x0,
-0x81,
-0x0,
-0x82,
-0x0,
-0x7f,
-0x0,
-0x7b,
-0x0,
-0x77,
-0x0,
-0x75,
-0x0,
-0x74,
-0x0,
-0x70,
-0x0,
-0x6f,
-0x0,
-0x6c,
-0x0,
-0x66,
-0x0,
-0x5c,
-0x0,
-0x5c,
-0x0,
-0x50,
-0x0,
-0x57,
-0x0,
-0x46,
-0x0,
-0x48,
-0x0,
-0x3b,
-0x0,
-0x37,
-0x0,
-0x2c,
-0x0,
-0x27,
-0x0,
-0x1c,
-0x0,
-0x18,
-0x0,
-0x10,
-0x0,
-0x9,
-0x0,
-0xff,
-0xff,
-0xf9,
-0xff,
-0xf0,
-0xff,
-0xee,
-0xff,
-0xe3,
-0xff,
-0xe0,
-0xff,
-0xd3,
-0xff,
-0xcf,
-0xff,
-0xc4,
-0xff,
-0xc6,
-0xff,
-0xbf,
-0xff,
-0xc0,
-0xff,
-0xae,
-0xff,
-0xa4,
-0xff,
-0x9d,
-0xff,
-0x98,
-0xff,
-0x98,
-0xff,
-0x91,
-0xff,
-0x8e,
-0xff,
-0x7c,
-0xff,
-0x7c,
-0xff,
-0x70,
-0xff,
-0x6d,
-0xff,
-0x63,
-0xff,
-0x59,
-0xff,
-0x55,
-0xff,
-0x45,
-0xff,
-0x43,
-0xff,
-0x3c,
-0xff,
-0x34,
-0xff,
-0x2d,
-0xff,
-0x21,
-0xff,
-0xf,
-0xff,
-0xc,
-0xff,
-0x2,
-0xff,
-0xfb,
-0xfe,
-0xee,
-0xfe,
-0xdf,
-0xfe,
-0xd5,
-0xfe,
-0xce,
-0xfe,
-0xc6,
-0xfe,
-0xbb,
-0xfe,
-0xb5,
-0xfe,
-0xa9,
-0xfe,
-0xa5,
-0xfe,
-0x9f,
-0xfe,
-0x97,
-0xfe,
-0x94,
-0xfe,
-0x83,
-0xfe,
-0x77,
-0xfe,
-0x6a,
-0xfe,
-0x6a,
-0xfe,
-0x60,
-0xfe,
-0x59,
-0xfe,
-0x4d,
-0xfe,
-0x40,
-0xfe,
-0x37,
-0xfe,
-0x2d,
-0xfe,
-0x1f,
-0xfe,
-0x19,
-0xfe,
-0xe,
-0xfe,
-0x0,
-0xfe,
-0xf9,
-0xfd,
-0xf0,
-0xfd,
-0xe5,
-0xfd,
-0xdf,
-0xfd,
-0xd1,
-0xfd,
-0xcf,
-0xfd,
-0xba,
-0xfd,
-0xb1,
-0xfd,
-0xa4,
-0xfd,
-0x9c,
-0xfd,
-0x94,
-0xfd,
-0x8b,
-0xfd,
-0x7a,
-0xfd,
-0x63,
-0xfd,
-0x51,
-0xfd,
-0x40,
-0xfd,
-0x3f,
-0xfd,
-0x38,
-0xfd,
-0x38,
-0xfd,
-0x28,
-0xfd,
-0x19,
-0xfd,
-0xfb,
-0xfc,
-0xf1,
-0xfc,
-0xde,
-0xfc,
-0xdf,
-0xfc,
-0xd5,
-0xfc,
-0xd0,
-0xfc,
-0xc9,
-0xfc,
-0xb9,
-0xfc,
-0xb5,
-0xfc,
-0xac,
-0xfc,
-0xa4,
-0xfc,
-0x98,
-0xfc,
-0x8f,
-0xfc,
-0x8a,
-0xfc,
-0x88,
-0xfc,
-0x87,
-0xfc,
-0x89,
-0xfc,
-0x84,
-0xfc,
-0x7a,
-0xfc,
-0x7e,
-0xfc,
-0x78,
-0xfc,
-0x7c,
-0xfc,
-0x76,
-0xfc,
-0x78,
-0xfc,
-0x75,
-0xfc,
-0x76,
-0xfc,
-0x78,
-0xfc,
-0x78,
-0xfc,
-0x84,
-0xfc,
-0x81,
-0xfc,
-0x88,
-0xfc,
-0x81,
-0xfc,
-0x86,
-0xfc,
-0x87,
-0xfc,
-0x91,
-0xfc,
-0x95,
-0xfc,
-0x99,
-0xfc,
-0x9d,
-0xfc,
-0xa0,
-0xfc,
-0xa1,
-0xfc,
-0xa4,
-0xfc,
-0xa5,
-0xfc,
-0xa4,
-0xfc,
-0xa7,
-0xfc,
-0xa6,
-0xfc,
-0xae,
-0xfc,
-0xaf,
-0xfc,
-0xbb,
-0xfc,
-0xb4,
-0xfc,
-0xbb,
-0xfc,
-0xc0,
-0xfc,
-0xc8,
-0xfc,
-0xc9,
-0xfc,
-0xcc,
-0xfc,
-0xd1,
-0xfc,
-0xda,
-0xfc,
-0xe6,
-0xfc,
-0xeb,
-0xfc,
-0xf0,
-0xfc,
-0xf3,
-0xfc,
-0xfb,
-0xfc,
-0x0,
-0xfd,
-0x9,
-0xfd,
-0x11,
-0xfd,
-0x13,
-0xfd,
-0x1b,
-0xfd,
-0x22,
-0xfd,
-0x2c,
-0xfd,
-0x3c,
-0xfd,
-0x4a,
-0xfd,
-0x50,
-0xfd,
-0x61,
-0xfd,
-0x64,
-0xfd,
-0x78,
-0xfd,
-0x7a,
-0xfd,
-0x8f,
-0xfd,
-0x97,
-0xfd,
-0xa8,
-0xfd,
-0xb2,
-0xfd,
-0xc5,
-0xfd,
-0xd0,
-0xfd,
-0xe5,
-0xfd,
-0xee,
-0xfd,
-0xfe,
-0xfd,
-0x7,
-0xfe,
-0xe,
-0xfe,
-0x24,
-0xfe,
-0x38,
-0xfe,
-0x4d,
-0xfe,
-0x63,
-0xfe,
-0x77,
-0xfe,
-0x84,
-0xfe,
-0x9b,
-0xfe,
-0xb1,
-0xfe,
-0xc4,
-0xfe,
-0xde,
-0xfe,
-0xf0,
-0xfe,
-0xc,
-0xff,
-0x1a,
-0xff,
-0x3c,
-0xff,
-0x51,
-0xff,
-0x70,
-0xff,
-0x81,
-0xff,
-0x9f,
-0xff,
-0xb0,
-0xff,
-0xc2,
-0xff,
-0xda,
-0xff,
-0xf8,
-0xff,
-0x15,
-0x0,
-0x44,
-0x0,
-0x62,
-0x0,
-0x84,
-0x0,
-0x90,
-0x0,
-0x92,
-0x0,
-0x96,
-0x0,
-0xb1,
-0x0,
-0xeb,
-0x0,
-0x29,
-0x1,
-0x57,
-0x1,
-0x64,
-0x1,
-0x59,
-0x1,
-0x52,
-0x1,
-0x74,
-0x1,
-0xa5,
-0x1,
-0xdc,
-0x1,
-0x9,
-0x2,
-0x22,
-0x2,
-0x36,
-0x2,
-0x4c,
-0x2,
-0x6f,
-0x2,
-0x95,
-0x2,
-0xb1,
-0x2,
-0xc7,
-0x2,
-0xdc,
-0x2,
-0xf9,
-0x2,
-0x1f,
-0x3,
-0x4f,
-0x3,
-0x70,
-0x3,
-0x8f,
-0x3,
-0x9e,
-0x3,
-0xb2,
-0x3,
-0xca,
-0x3,
-0xea,
-0x3,
-0x11,
-0x4,
-0x29,
-0x4,
-0x49,
-0x4,
-0x59,
-0x4,
-0x7a,
-0x4,
-0x9b,
-0x4,
-0xbe,
-0x4,
-0xdc,
-0x4,
-0xf2,
-0x4,
-0x9,
-0x5,
-0x1b,
-0x5,
-0x38,
-0x5,
-0x53,
-0x5,
-0x67,
-0x5,
-0x8b,
-0x5,
-0x9d,
-0x5,
-0xb9,
-0x5,
-0xce,
-0x5,
-0xe3,
-0x5,
-0xfd,
-0x5,
-0xb,
-0x6,
-0x1b,
-0x6,
-0x30,
-0x6,
-0x46,
-0x6,
-0x54,
-0x6,
-0x69,
-0x6,
-0x7a,
-0x6,
-0x81,
-0x6,
-0x87,
-0x6,
-0x89,
-0x6,
-0x98,
-0x6,
-0xa9,
-0x6,
-0xb7,
-0x6,
-0xca,
-0x6,
-0xcf,
-0x6,
-0xdd,
-0x6,
-0xe1,
-0x6,
-0xe8,
-0x6,
-0xee,
-0x6,
-0xf1,
-0x6,
-0xf9,
-0x6,
-0x0,
-0x7,
-0xb,
-0x7,
-0x12,
-0x7,
-0x18,
-0x7,
-0x1d,
-0x7,
-0x23,
-0x7,
-0x22,
-0x7,
-0x1b,
-0x7,
-0x19,
-0x7,
-0x14,
-0x7,
-0x17,
-0x7,
-0xa,
-0x7,
-0x7,
-0x7,
-0xfb,
-0x6,
-0xf3,
-0x6,
-0xef,
-0x6,
-0xe7,
-0x6,
-0xe0,
-0x6,
-0xd9,
-0x6,
-0xd0,
-0x6,
-0xc4,
-0x6,
-0xc0,
-0x6,
-0xb9,
-0x6,
-0xb9,
-0x6,
-0xac,
-0x6,
-0xae,
-0x6,
-0xa3,
-0x6,
-0x9c,
-0x6,
-0x96,
-0x6,
-0x8e,
-0x6,
-0x86,
-0x6,
-0x7b,
-0x6,
-0x76,
-0x6,
-0x69,
-0x6,
-0x5b,
-0x6,
-0x4c,
-0x6,
-0x3e,
-0x6,
-0x33,
-0x6,
-0x1d,
-0x6,
-0x14,
-0x6,
-0xb,
-0x6,
-0xfd,
-0x5,
-0xf8,
-0x5,
-0xe7,
-0x5,
-0xdb,
-0x5,
-0xcd,
-0x5,
-0xbd,
-0x5,
-0xb1,
-0x5,
-0x9e,
-0x5,
-0x90,
-0x5,
-0x7a,
-0x5,
-0x6c,
-0x5,
-0x56,
-0x5,
-0x4b,
-0x5,
-0x37,
-0x5,
-0x24,
-0x5,
-0x11,
-0x5,
-0x5,
-0x5,
-0xfa,
-0x4,
-0xe5,
-0x4,
-0xcd,
-0x4,
-0xad,
-0x4,
-0x9f,
-0x4,
-0x91,
-0x4,
-0x81,
-0x4,
-0x67,
-0x4,
-0x4c,
-0x4,
-0x3c,
-0x4,
-0x28,
-0x4,
-0x1e,
-0x4,
-0x6,
-0x4,
-0xf2,
-0x3,
-0xda,
-0x3,
-0xca,
-0x3,
-0xae,
-0x3,
-0x9b,
-0x3,
-0x84,
-0x3,
-0x72,
-0x3,
-0x59,
-0x3,
-0x3f,
-0x3,
-0x26,
-0x3,
-0xf,
-0x3,
-0xfa,
-0x2,
-0xe3,
-0x2,
-0xc5,
-0x2,
-0xab,
-0x2,
-0x85,
-0x2,
-0x76,
-0x2,
-0x53,
-0x2,
-0x3d,
-0x2,
-0x23,
-0x2,
-0xf,
-0x2,
-0xfb,
-0x1,
-0xe4,
-0x1,
-0xce,
-0x1,
-0xb3,
-0x1,
-0x9f,
-0x1,
-0x8b,
-0x1,
-0x76,
-0x1,
-0x59,
-0x1,
-0x48,
-0x1,
-0x2d,
-0x1,
-0x14,
-0x1,
-0xfd,
-0x0,
-0xe9,
-0x0,
-0xd3,
-0x0,
-0xc3,
-0x0,
-0xae,
-0x0,
-0xa3,
-0x0,
-0x89,
-0x0,
-0x74,
-0x0,
-0x58,
-0x0,
-0x39,
-0x0,
-0x21,
-0x0,
-0x1,
-0x0,
-0xe9,
-0xff,
-0xd0,
-0xff,
-0xb2,
-0xff,
-0x9d,
-0xff,
-0x8b,
-0xff,
-0x82,
-0xff,
-0x7b,
-0xff,
-0x63,
-0xff,
-0x34,
-0xff,
-0xf9,
-0xfe,
-0xd8,
-0xfe,
-0xd7,
-0xfe,
-0xe5,
-0xfe,
-0xdc,
-0xfe,
-0xbf,
-0xfe,
-0x92,
-0xfe,
-0x6e,
-0xfe,
-0x58,
-0xfe,
-0x57,
-0xfe,
-0x55,
-0xfe,
-0x4d,
-0xfe,
-0x39,
-0xfe,
-0x1b,
-0xfe,
-0x4,
-0xfe,
-0xf7,
-0xfd,
-0xe9,
-0xfd,
-0xe0,
-0xfd,
-0xc0,
-0xfd,
-0xa2,
-0xfd,
-0x84,
-0xfd,
-0x74,
-0xfd,
-0x6c,
-0xfd,
-0x69,
-0xfd,
-0x57,
-0xfd,
-0x41,
-0xfd,
-0x22,
-0xfd,
-0x14,
-0xfd,
-0xfe,
-0xfc,
-0xf9,
-0xfc,
-0xeb,
-0xfc,
-0xd3,
-0xfc,
-0xcd,
-0xfc,
-0xbd,
-0xfc,
-0xb7,
-0xfc,
-0xa5,
-0xfc,
-0x9f,
-0xfc,
-0x8a,
-0xfc,
-0x7c,
-0xfc,
-0x67,
-0xfc,
-0x5c,
-0xfc,
-0x5d,
-0xfc,
-0x5d,
-0xfc,
-0x58,
-0xfc,
-0x5c,
-0xfc,
-0x55,
-0xfc,
-0x43,
-0xfc,
-0x3f,
-0xfc,
-0x3b,
-0xfc,
-0x40,
-0xfc,
-0x37,
-0xfc,
-0x27,
-0xfc,
-0x1b,
-0xfc,
-0x24,
-0xfc,
-0x2b,
-0xfc,
-0x2c,
-0xfc,
-0x1f,
-0xfc,
-0x19,
-0xfc,
-0x17,
-0xfc,
-0x14,
-0xfc,
-0x12,
-0xfc,
-0xd,
-0xfc,
-0x10,
-0xfc,
-0xf,
-0xfc,
-0x6,
-0xfc,
-0x3,
-0xfc,
-0xff,
-0xfb,
-0xfd,
-0xfb,
-0xfc,
-0xfb,
-0xf4,
-0xfb,
-0xf9,
-0xfb,
-0xfb,
-0xfb,
-0x1,
-0xfc,
-0x6,
-0xfc,
-0x9,
-0xfc,
-0x4,
-0xfc,
-0x5,
-0xfc,
-0x8,
-0xfc,
-0xe,
-0xfc,
-0x17,
-0xfc,
-0x23,
-0xfc,
-0x28,
-0xfc,
-0x33,
-0xfc,
-0x36,
-0xfc,
-0x40,
-0xfc,
-0x43,
-0xfc,
-0x42,
-0xfc,
-0x4c,
-0xfc,
-0x53,
-0xfc,
-0x5b,
-0xfc,
-0x69,
-0xfc,
-0x73,
-0xfc,
-0x7b,
-0xfc,
-0x78,
-0xfc,
-0x7c,
-0xfc,
-0x7e,
-0xfc,
-0x7e,
-0xfc,
-0x93,
-0xfc,
-0x90,
-0xfc,
-0xa3,
-0xfc,
-0xa4,
-0xfc,
-0xa9,
-0xfc,
-0xb4,
-0xfc,
-0xbc,
-0xfc,
-0xc7,
-0xfc,
-0xd7,
-0xfc,
-0xdc,
-0xfc,
-0xe4,
-0xfc,
-0xdb,
-0xfc,
-0xe4,
-0xfc,
-0xea,
-0xfc,
-0xff,
-0xfc,
-0x7,
-0xfd,
-0xf,
-0xfd,
-0xd,
-0xfd,
-0xb,
-0xfd,
-0x13,
-0xfd,
-0x1a,
-0xfd,
-0x2d,
-0xfd,
-0x41,
-0xfd,
-0x4a,
-0xfd,
-0x51,
-0xfd,
-0x57,
-0xfd,
-0x64,
-0xfd,
-0x75,
-0xfd,
-0x85,
-0xfd,
-0x8e,
-0xfd,
-0x9d,
-0xfd,
-0xa2,
-0xfd,
-0xb5,
-0xfd,
-0xcb,
-0xfd,
-0xe8,
-0xfd,
-0xf4,
-0xfd,
-0xfd,
-0xfd,
-0xfc,
-0xfd,
-0x7,
-0xfe,
-0x12,
-0xfe,
-0x23,
-0xfe,
-0x33,
-0xfe,
-0x3e,
-0xfe,
-0x45,
-0xfe,
-0x52,
-0xfe,
-0x5d,
-0xfe,
-0x69,
-0xfe,
-0x74,
-0xfe,
-0x7c,
-0xfe,
-0x7f,
-0xfe,
-0x87,
-0xfe,
-0x8b,
-0xfe,
-0x95,
-0xfe,
-0x9d,
-0xfe,
-0x9f,
-0xfe,
-0xa8,
-0xfe,
-0xa9,
-0xfe,
-0xb6,
-0xfe,
-0xb7,
-0xfe,
-0xc4,
-0xfe,
-0xba,
-0xfe,
-0xc8,
-0xfe,
-0xc3,
-0xfe,
-0xcd,
-0xfe,
-0xd5,
-0xfe,
-0xe0,
-0xfe,
-0xe8,
-0xfe,
-0xed,
-0xfe,
-0xf2,
-0xfe,
-0xfa,
-0xfe,
-0xff,
-0xfe,
-0x5,
-0xff,
-0x8,
-0xff,
-0xd,
-0xff,
-0x17,
-0xff,
-0x1b,
-0xff,
-0x27,
-0xff,
-0x2e,
-0xff,
-0x3e,
-0xff,
-0x3e,
-0xff,
-0x4e,
-0xff,
-0x55,
-0xff,
-0x64,
-0xff,
-0x62,
-0xff,
-0x70,
-0xff,
-0x73,
-0xff,
-0x78,
-0xff,
-0x7a,
-0xff,
-0x81,
-0xff,
-0x7c,
-0xff,
-0x77,
-0xff,
-0x75,
-0xff,
-0x70,
-0xff,
-0x6e,
-0xff,
-0x64,
-0xff,
-0x5c,
-0xff,
-0x59,
-0xff,
-0x55,
-0xff,
-0x4a,
-0xff,
-0x48,
-0xff,
-0x46,
-0xff,
-0x47,
-0xff,
-0x44,
-0xff,
-0x3f,
-0xff,
-0x3c,
-0xff,
-0x3f,
-0xff,
-0x40,
-0xff,
-0x48,
-0xff,
-0x43,
-0xff,
-0x3b,
-0xff,
-0x3e,
-0xff,
-0x42,
-0xff,
-0x44,
-0xff,
-0x44,
-0xff,
-0x3b,
-0xff,
-0x3e,
-0xff,
-0x39,
-0xff,
-0x2b,
-0xff,
-0x21,
-0xff,
-0x2d,
-0xff,
-0x62,
-0xff,
-0x87,
-0xff,
-0x86,
-0xff,
-0x7d,
-0xff,
-0x7f,
-0xff,
-0x6f,
-0xff,
-0x5b,
-0xff,
-0x47,
-0xff,
-0x53,
-0xff,
-0x75,
-0xff,
-0x8b,
-0xff,
-0x7c,
-0xff,
-0x44,
-0xff,
-0xf,
-0xff,
-0xeb,
-0xfe,
-0xed,
-0xfe,
-0x23,
-0xff,
-0x43,
-0xff,
-0x37,
-0xff,
-0x1d,
-0xff,
-0x8,
-0xff,
-0x9,
-0xff,
-0x17,
-0xff,
-0x1e,
-0xff,
-0xd,
-0xff,
-0xfa,
-0xfe,
-0xf3,
-0xfe,
-0x5,
-0xff,
-0x28,
-0xff,
-0x33,
-0xff,
-0x22,
-0xff,
-0x6,
-0xff,
-0xfc,
-0xfe,
-0xf0,
-0xfe,
-0x0,
-0xff,
-0x8,
-0xff,
-0x15,
-0xff,
-0x6,
-0xff,
-0xf2,
-0xfe,
-0xee,
-0xfe,
-0xf8,
-0xfe,
-0x0,
-0xff,
-0x0,
-0xff,
-0xf2,
-0xfe,
-0xd9,
-0xfe,
-0xce,
-0xfe,
-0xca,
-0xfe,
-0xd3,
-0xfe,
-0xe4,
-0xfe,
-0xdf,
-0xfe,
-0xd1,
-0xfe,
-0xc1,
-0xfe,
-0xbc,
-0xfe,
-0xb9,
-0xfe,
-0xaf,
-0xfe,
-0xae,
-0xfe,
-0xa9,
-0xfe,
-0x9f,
-0xfe,
-0x9d,
-0xfe,
-0x9b,
-0xfe,
-0xa0,
-0xfe,
-0xa2,
-0xfe,
-0x9d,
-0xfe,
-0x9b,
-0xfe,
-0x9a,
-0xfe,
-0x9d,
-0xfe,
-0x9e,
-0xfe,
-0xa2,
-0xfe,
-0xa6,
-0xfe,
-0xac,
-0xfe,
-0xb6,
-0xfe,
-0xbf,
-0xfe,
-0xc7,
-0xfe,
-0xd4,
-0xfe,
-0xdc,
-0xfe,
-0xe9,
-0xfe,
-0xf4,
-0xfe,
-0xfd,
-0xfe,
-0x5,
-0xff,
-0xa,
-0xff,
-0x12,
-0xff,
-0x1b,
-0xff,
-0x20,
-0xff,
-0x25,
-0xff,
-0x32,
-0xff,
-0x33,
-0xff,
-0x36,
-0xff,
-0x39,
-0xff,
-0x3f,
-0xff,
-0x45,
-0xff,
-0x47,
-0xff,
-0x4f,
-0xff,
-0x4f,
-0xff,
-0x5b,
-0xff,
-0x5e,
-0xff,
-0x64,
-0xff,
-0x63,
-0xff,
-0x6b,
-0xff,
-0x72,
-0xff,
-0x7e,
-0xff,
-0x8a,
-0xff,
-0x90,
-0xff,
-0x8f,
-0xff,
-0x8f,
-0xff,
-0x93,
-0xff,
-0x9b,
-0xff,
-0xa2,
-0xff,
-0xaf,
-0xff,
-0xbc,
-0xff,
-0xbe,
-0xff,
-0xc6,
-0xff,
-0xc7,
-0xff,
-0xd1,
-0xff,
-0xdd,
-0xff,
-0xea,
-0xff,
-0xfb,
-0xff,
-0xe,
-0x0,
-0x1c,
-0x0,
-0x29,
-0x0,
-0x34,
-0x0,
-0x40,
-0x0,
-0x50,
-0x0,
-0x5d,
-0x0,
-0x75,
-0x0,
-0x80,
-0x0,
-0x8b,
-0x0,
-0x92,
-0x0,
-0x9f,
-0x0,
-0xaa,
-0x0,
-0xbc,
-0x0,
-0xc6,
-0x0,
-0xca,
-0x0,
-0xcc,
-0x0,
-0xd9,
-0x0,
-0xe3,
-0x0,
-0xed,
-0x0,
-0xf3,
-0x0,
-0xf7,
-0x0,
-0xf8,
-0x0,
-0x0,
-0x1,
-0xf,
-0x1,
-0x1d,
-0x1,
-0x1f,
-0x1,
-0x25,
-0x1,
-0x23,
-0x1,
-0x2e,
-0x1,
-0x2d,
-0x1,
-0x39,
-0x1,
-0x43,
-0x1,
-0x52,
-0x1,
-0x5c,
-0x1,
-0x67,
-0x1,
-0x7d,
-0x1,
-0x85,
-0x1,
-0x90,
-0x1,
-0x9c,
-0x1,
-0x9c,
-0x1,
-0xb0,
-0x1,
-0xb4,
-0x1,
-0xca,
-0x1,
-0xd5,
-0x1,
-0xe6,
-0x1,
-0xf1,
-0x1,
-0x2,
-0x2,
-0x8,
-0x2,
-0xd,
-0x2,
-0x17,
-0x2,
-0x2a,
-0x2,
-0x39,
-0x2,
-0x48,
-0x2,
-0x54,
-0x2,
-0x64,
-0x2,
-0x68,
-0x2,
-0x72,
-0x2,
-0x7c,
-0x2,
-0x8a,
-0x2,
-0x90,
-0x2,
-0x94,
-0x2,
-0x99,
-0x2,
-0xa6,
-0x2,
-0xb2,
-0x2,
-0xc1,
-0x2,
-0xd8,
-0x2,
-0xdd,
-0x2,
-0xe4,
-0x2,
-0xee,
-0x2,
-0xf0,
-0x2,
-0xfa,
-0x2,
-0xb,
-0x3,
-0x11,
-0x3,
-0x21,
-0x3,
-0x25,
-0x3,
-0x38,
-0x3,
-0x4d,
-0x3,
-0x62,
-0x3,
-0x7c,
-0x3,
-0x8e,
-0x3,
-0x9c,
-0x3,
-0xa8,
-0x3,
-0xb3,
-0x3,
-0xca,
-0x3,
-0xdf,
-0x3,
-0xfc,
-0x3,
-0x5,
-0x4,
-0x11,
-0x4,
-0x15,
-0x4,
-0x24,
-0x4,
-0x32,
-0x4,
-0x44,
-0x4,
-0x4b,
-0x4,
-0x57,
-0x4,
-0x67,
-0x4,
-0x7b,
-0x4,
-0x8d,
-0x4,
-0xa0,
-0x4,
-0xb2,
-0x4,
-0xbb,
-0x4,
-0xce,
-0x4,
-0xd5,
-0x4,
-0xe0,
-0x4,
-0xf0,
-0x4,
-0x5,
-0x5,
-0x11,
-0x5,
-0x1c,
-0x5,
-0x28,
-0x5,
-0x3a,
-0x5,
-0x43,
-0x5,
-0x4b,
-0x5,
-0x4c,
-0x5,
-0x54,
-0x5,
-0x5c,
-0x5,
-0x63,
-0x5,
-0x64,
-0x5,
-0x61,
-0x5,
-0x5e,
-0x5,
-0x60,
-0x5,
-0x6a,
-0x5,
-0x72,
-0x5,
-0x7a,
-0x5,
-0x68,
-0x5,
-0x45,
-0x5,
-0x22,
-0x5,
-0xe6,
-0x4,
-0xcc,
-0x4,
-0x29,
-0x5,
-0x69,
-0x5,
-0x3c,
-0x5,
-0x8,
-0x5,
-0x11,
-0x5,
-0xf6,
-0x4,
-0xcd,
-0x4,
-0xfb,
-0x4,
-0x1b,
-0x5,
-0x4,
-0x5,
-0xd2,
-0x4,
-0xce,
-0x4,
-0xb5,
-0x4,
-0x87,
-0x4,
-0x75,
-0x4,
-0x81,
-0x4,
-0x59,
-0x4,
-0x30,
-0x4,
-0xe,
-0x4,
-0xfc,
-0x3,
-0xe1,
-0x3,
-0xbf,
-0x3,
-0x92,
-0x3,
-0x60,
-0x3,
-0x31,
-0x3,
-0xf3,
-0x2,
-0xd7,
-0x2,
-0xce,
-0x2,
-0x9d,
-0x2,
-0x59,
-0x2,
-0x17,
-0x2,
-0xec,
-0x1,
-0xc1,
-0x1,
-0x94,
-0x1,
-0x6d,
-0x1,
-0x40,
-0x1,
-0x1,
-0x1,
-0xcb,
-0x0,
-0x99,
-0x0,
-0x6f,
-0x0,
-0x36,
-0x0,
-0xfe,
-0xff,
-0xc9,
-0xff,
-0x8a,
-0xff,
-0x4b,
-0xff,
-0xff,
-0xfe,
-0xcd,
-0xfe,
-0x95,
-0xfe,
-0x5c,
-0xfe,
-0x18,
-0xfe,
-0xd5,
-0xfd,
-0x8b,
-0xfd,
-0x44,
-0xfd,
-0xf2,
-0xfc,
-0xac,
-0xfc,
-0x6d,
-0xfc,
-0x31,
-0xfc,
-0xee,
-0xfb,
-0xaf,
-0xfb,
-0x65,
-0xfb,
-0xe,
-0xfb,
-0xb5,
-0xfa,
-0x66,
-0xfa,
-0x22,
-0xfa,
-0xd8,
-0xf9,
-0x85,
-0xf9,
-0x31,
-0xf9,
-0xe7,
-0xf8,
-0xa9,
-0xf8,
-0x4c,
-0xf8,
-0xfd,
-0xf7,
-0xa9,
-0xf7,
-0x4f,
-0xf7,
-0xf0,
-0xf6,
-0x9b,
-0xf6,
-0x53,
-0xf6,
-0xd,
-0xf6,
-0xc3,
-0xf5,
-0x77,
-0xf5,
-0x2e,
-0xf5,
-0xca,
-0xf4,
-0x7e,
-0xf4,
-0x33,
-0xf4,
-0xf6,
-0xf3,
-0xad,
-0xf3,
-0x52,
-0xf3,
-0xd,
-0xf3,
-0xce,
-0xf2,
-0x90,
-0xf2,
-0x3d,
-0xf2,
-0xf2,
-0xf1,
-0xa7,
-0xf1,
-0x62,
-0xf1,
-0x1e,
-0xf1,
-0xdd,
-0xf0,
-0x94,
-0xf0,
-0x51,
-0xf0,
-0x2,
-0xf0,
-0xb4,
-0xef,
-0x58,
-0xef,
-0xd,
-0xef,
-0xca,
-0xee,
-0x83,
-0xee,
-0x3a,
-0xee,
-0xf3,
-0xed,
-0xb9,
-0xed,
-0x81,
-0xed,
-0x5e,
-0xed,
-0x39,
-0xed,
-0xf,
-0xed,
-0xcb,
-0xec,
-0xa2,
-0xec,
-0x87,
-0xec,
-0x6a,
-0xec,
-0x38,
-0xec,
-0x8,
-0xec,
-0xf1,
-0xeb,
-0xf0,
-0xeb,
-0xee,
-0xeb,
-0xd8,
-0xeb,
-0xc8,
-0xeb,
-0xb1,
-0xeb,
-0xb0,
-0xeb,
-0xb9,
-0xeb,
-0xd3,
-0xeb,
-0xe5,
-0xeb,
-0xeb,
-0xeb,
-0xe6,
-0xeb,
-0xf9,
-0xeb,
-0xf,
-0xec,
-0x32,
-0xec,
-0x4d,
-0xec,
-0x70,
-0xec,
-0xa5,
-0xec,
-0xcc,
-0xec,
-0x2,
-0xed,
-0x2c,
-0xed,
-0x61,
-0xed,
-0x9d,
-0xed,
-0xde,
-0xed,
-0xe,
-0xee,
-0x50,
-0xee,
-0x9d,
-0xee,
-0xef,
-0xee,
-0x43,
-0xef,
-0x8e,
-0xef,
-0xe5,
-0xef,
-0x34,
-0xf0,
-0x8d,
-0xf0,
-0xf4,
-0xf0,
-0x53,
-0xf1,
-0xb1,
-0xf1,
-0xf,
-0xf2,
-0x6f,
-0xf2,
-0xdf,
-0xf2,
-0x49,
-0xf3,
-0xbe,
-0xf3,
-0x2b,
-0xf4,
-0xad,
-0xf4,
-0x33,
-0xf5,
-0xbb,
-0xf5,
-0x45,
-0xf6,
-0xdb,
-0xf6,
-0x6a,
-0xf7,
-0xfb,
-0xf7,
-0x7f,
-0xf8,
-0x1b,
-0xf9,
-0xb5,
-0xf9,
-0x62,
-0xfa,
-0x4,
-0xfb,
-0xae,
-0xfb,
-0x56,
-0xfc,
-0xfa,
-0xfc,
-0x9d,
-0xfd,
-0x38,
-0xfe,
-0xd3,
-0xfe,
-0x7c,
-0xff,
-0x32,
-0x0,
-0xd7,
-0x0,
-0x80,
-0x1,
-0x26,
-0x2,
-0xc6,
-0x2,
-0x65,
-0x3,
-0xf3,
-0x3,
-0x9a,
-0x4,
-0x3a,
-0x5,
-0xe3,
-0x5,
-0x8d,
-0x6,
-0x45,
-0x7,
-0xf4,
-0x7,
-0x9a,
-0x8,
-0x48,
-0x9,
-0xf7,
-0x9,
-0xa6,
-0xa,
-0x58,
-0xb,
-0x14,
-0xc,
-0xd2,
-0xc,
-0x83,
-0xd,
-0x29,
-0xe,
-0xc0,
-0xe,
-0x7f,
-0xf,
-0x40,
-0x10,
-0x1,
-0x11,
-0xb0,
-0x11,
-0x61,
-0x12,
-0x6,
-0x13,
-0xb5,
-0x13,
-0x5e,
-0x14,
-0x1b,
-0x15,
-0xcd,
-0x15,
-0x7a,
-0x16,
-0x20,
-0x17,
-0xc1,
-0x17,
-0x70,
-0x18,
-0x15,
-0x19,
-0xb9,
-0x19,
-0x5e,
-0x1a,
-0x0,
-0x1b,
-0xb2,
-0x1b,
-0x59,
-0x1c,
-0xf4,
-0x1c,
-0x7a,
-0x1d,
-0x0,
-0x1e,
-0x8c,
-0x1e,
-0x16,
-0x1f,
-0x93,
-0x1f,
-0xff,
-0x1f,
-0x76,
-0x20,
-0xda,
-0x20,
-0x41,
-0x21,
-0xa5,
-0x21,
-0x6,
-0x22,
-0x6a,
-0x22,
-0xc7,
-0x22,
-0x21,
-0x23,
-0x80,
-0x23,
-0xda,
-0x23,
-0x27,
-0x24,
-0x68,
-0x24,
-0xa5,
-0x24,
-0xe1,
-0x24,
-0x15,
-0x25,
-0x37,
-0x25,
-0x5d,
-0x25,
-0x63,
-0x25,
-0x75,
-0x25,
-0x7a,
-0x25,
-0x88,
-0x25,
-0x90,
-0x25,
-0xa1,
-0x25,
-0xa5,
-0x25,
-0x9c,
-0x25,
-0x91,
-0x25,
-0x8c,
-0x25,
-0x89,
-0x25,
-0x85,
-0x25,
-0x63,
-0x25,
-0x36,
-0x25,
-0xf2,
-0x24,
-0xb5,
-0x24,
-0x7a,
-0x24,
-0x3a,
-0x24,
-0xe0,
-0x23,
-0x81,
-0x23,
-0x1a,
-0x23,
-0xbd,
-0x22,
-0x5d,
-0x22,
-0x11,
-0x22,
-0xb3,
-0x21,
-0x55,
-0x21,
-0xf7,
-0x20,
-0xa5,
-0x20,
-0x5a,
-0x20,
-0x16,
-0x20,
-0xd7,
-0x1f,
-0xa2,
-0x1f,
-0x74,
-0x1f,
-0x4e,
-0x1f,
-0x1d,
-0x1f,
-0xdf,
-0x1e,
-0xa3,
-0x1e,
-0x64,
-0x1e,
-0x2f,
-0x1e,
-0xfd,
-0x1d,
-0xcf,
-0x1d,
-0xa0,
-0x1d,
-0x70,
-0x1d,
-0x45,
-0x1d,
-0x17,
-0x1d,
-0xe9,
-0x1c,
-0xad,
-0x1c,
-0x77,
-0x1c,
-0x3a,
-0x1c,
-0xf9,
-0x1b,
-0xae,
-0x1b,
-0x59,
-0x1b,
-0xfd,
-0x1a,
-0x95,
-0x1a,
-0x16,
-0x1a,
-0x8e,
-0x19,
-0x2,
-0x19,
-0x6e,
-0x18,
-0xce,
-0x17,
-0x22,
-0x17,
-0x72,
-0x16,
-0xb4,
-0x15,
-0xf3,
-0x14,
-0x1e,
-0x14,
-0x46,
-0x13,
-0x59,
-0x12,
-0x6b,
-0x11,
-0x68,
-0x10,
-0x5f,
-0xf,
-0x50,
-0xe,
-0x43,
-0xd,
-0x39,
-0xc,
-0x25,
-0xb,
-0x6,
-0xa,
-0xec,
-0x8,
-0xdb,
-0x7,
-0xd3,
-0x6,
-0xc0,
-0x5,
-0xa1,
-0x4,
-0x7c,
-0x3,
-0x60,
-0x2,
-0x4f,
-0x1,
-0x3d,
-0x0,
-0x21,
-0xff,
-0x6,
-0xfe,
-0xfc,
-0xfc,
-0xf4,
-0xfb,
-0xf4,
-0xfa,
-0x5,
-0xfa,
-0x11,
-0xf9,
-0x1f,
-0xf8,
-0x33,
-0xf7,
-0x62,
-0xf6,
-0x94,
-0xf5,
-0xc9,
-0xf4,
-0xe7,
-0xf3,
-0x11,
-0xf3,
-0x39,
-0xf2,
-0x99,
-0xf1,
-0xf0,
-0xf0,
-0x56,
-0xf0,
-0xb2,
-0xef,
-0x17,
-0xef,
-0x8d,
-0xee,
-0x1f,
-0xee,
-0xae,
-0xed,
-0x44,
-0xed,
-0xc7,
-0xec,
-0x5c,
-0xec,
-0xfa,
-0xeb,
-0x96,
-0xeb,
-0x2a,
-0xeb,
-0xbc,
-0xea,
-0x55,
-0xea,
-0x0,
-0xea,
-0xb4,
-0xe9,
-0x6a,
-0xe9,
-0x12,
-0xe9,
-0xa7,
-0xe8,
-0x42,
-0xe8,
-0xe0,
-0xe7,
-0x8e,
-0xe7,
-0x2b,
-0xe7,
-0xc3,
-0xe6,
-0x4a,
-0xe6,
-0xd7,
-0xe5,
-0x66,
-0xe5,
-0xf9,
-0xe4,
-0x85,
-0xe4,
-0x5,
-0xe4,
-0x7b,
-0xe3,
-0x2,
-0xe3,
-0x85,
-0xe2,
-0x0,
-0xe2,
-0x7d,
-0xe1,
-0xe6,
-0xe0,
-0x61,
-0xe0,
-0xcd,
-0xdf,
-0x3d,
-0xdf,
-0xac,
-0xde,
-0x20,
-0xde,
-0x8c,
-0xdd,
-0xf4,
-0xdc,
-0x59,
-0xdc,
-0xc8,
-0xdb,
-0x29,
-0xdb,
-0x9e,
-0xda,
-0xf9,
-0xd9,
-0x63,
-0xd9,
-0xcd,
-0xd8,
-0x41,
-0xd8,
-0xaf,
-0xd7,
-0x15,
-0xd7,
-0x7c,
-0xd6,
-0xe7,
-0xd5,
-0x63,
-0xd5,
-0xd8,
-0xd4,
-0x55,
-0xd4,
-0xcf,
-0xd3,
-0x46,
-0xd3,
-0xb8,
-0xd2,
-0x3b,
-0xd2,
-0xbb,
-0xd1,
-0x53,
-0xd1,
-0xe0,
-0xd0,
-0x70,
-0xd0,
-0xef,
-0xcf,
-0x89,
-0xcf,
-0x1f,
-0xcf,
-0xc5,
-0xce,
-0x6c,
-0xce,
-0x18,
-0xce,
-0xc2,
-0xcd,
-0x7c,
-0xcd,
-0x2f,
-0xcd,
-0xee,
-0xcc,
-0xb4,
-0xcc,
-0x7a,
-0xcc,
-0x4d,
-0xcc,
-0x27,
-0xcc,
-0xfe,
-0xcb,
-0xd9,
-0xcb,
-0xb5,
-0xcb,
-0x9a,
-0xcb,
-0x8c,
-0xcb,
-0x87,
-0xcb,
-0x8a,
-0xcb,
-0x8a,
-0xcb,
-0x86,
-0xcb,
-0x8c,
-0xcb,
-0x98,
-0xcb,
-0xb5,
-0xcb,
-0xcd,
-0xcb,
-0xea,
-0xcb,
-0x14,
-0xcc,
-0x35,
-0xcc,
-0x5a,
-0xcc,
-0x83,
-0xcc,
-0xaf,
-0xcc,
-0xdc,
-0xcc,
-0x18,
-0xcd,
-0x50,
-0xcd,
-0x8b,
-0xcd,
-0xd4,
-0xcd,
-0x2b,
-0xce,
-0x89,
-0xce,
-0xdf,
-0xce,
-0x3c,
-0xcf,
-0x88,
-0xcf,
-0xe3,
-0xcf,
-0x49,
-0xd0,
-0xaf,
-0xd0,
-0x1e,
-0xd1,
-0x9c,
-0xd1,
-0x15,
-0xd2,
-0x93,
-0xd2,
-0x1b,
-0xd3,
-0xa1,
-0xd3,
-0x30,
-0xd4,
-0xc0,
-0xd4,
-0x5f,
-0xd5,
-0xef,
-0xd5,
-0x97,
-0xd6,
-0x39,
-0xd7,
-0xe5,
-0xd7,
-0x8d,
-0xd8,
-0x2b,
-0xd9,
-0xe2,
-0xd9,
-0xa3,
-0xda,
-0x6b,
-0xdb,
-0x36,
-0xdc,
-0xff,
-0xdc,
-0xde,
-0xdd,
-0xc1,
-0xde,
-0x9e,
-0xdf,
-0x6e,
-0xe0,
-0x48,
-0xe1,
-0x34,
-0xe2,
-0x1e,
-0xe3,
-0xd,
-0xe4,
-0xf8,
-0xe4,
-0xf5,
-0xe5,
-0xf9,
-0xe6,
-0xf9,
-0xe7,
-0xf5,
-0xe8,
-0xfa,
-0xe9,
-0x8,
-0xeb,
-0x9,
-0xec,
-0x23,
-0xed,
-0x3d,
-0xee,
-0x76,
-0xef,
-0xab,
-0xf0,
-0xf0,
-0xf1,
-0x2a,
-0xf3,
-0x72,
-0xf4,
-0xbc,
-0xf5,
-0x1,
-0xf7,
-0x47,
-0xf8,
-0x9b,
-0xf9,
-0xf7,
-0xfa,
-0x48,
-0xfc,
-0x8d,
-0xfd,
-0xe0,
-0xfe,
-0x52,
-0x0,
-0xd3,
-0x1,
-0x50,
-0x3,
-0xc7,
-0x4,
-0x2e,
-0x6,
-0xa0,
-0x7,
-0x15,
-0x9,
-0x8c,
-0xa,
-0x1b,
-0xc,
-0xc3,
-0xd,
-0x72,
-0xf,
-0x18,
-0x11,
-0xad,
-0x12,
-0x38,
-0x14,
-0xe9,
-0x15,
-0xb4,
-0x17,
-0x69,
-0x19,
-0x6,
-0x1b,
-0x8a,
-0x1c,
-0x1e,
-0x1e,
-0xb7,
-0x1f,
-0x6d,
-0x21,
-0x15,
-0x23,
-0xbb,
-0x24,
-0x3e,
-0x26,
-0xaf,
-0x27,
-0x35,
-0x29,
-0xb8,
-0x2a,
-0x42,
-0x2c,
-0xc3,
-0x2d,
-0x2f,
-0x2f,
-0x8c,
-0x30,
-0xd2,
-0x31,
-0x2,
-0x33,
-0x3f,
-0x34,
-0x7b,
-0x35,
-0xb5,
-0x36,
-0xda,
-0x37,
-0xf3,
-0x38,
-0x17,
-0x3a,
-0x35,
-0x3b,
-0x45,
-0x3c,
-0x41,
-0x3d,
-0x33,
-0x3e,
-0x20,
-0x3f,
-0xf7,
-0x3f,
-0xc0,
-0x40,
-0x87,
-0x41,
-0x5b,
-0x42,
-0x39,
-0x43,
-0xc,
-0x44,
-0xb0,
-0x44,
-0x33,
-0x45,
-0xb2,
-0x45,
-0x49,
-0x46,
-0xcb,
-0x46,
-0x46,
-0x47,
-0xa1,
-0x47,
-0xe8,
-0x47,
-0x21,
-0x48,
-0x62,
-0x48,
-0x9c,
-0x48,
-0xc1,
-0x48,
-0xcb,
-0x48,
-0xc4,
-0x48,
-0xa6,
-0x48,
-0x86,
-0x48,
-0x60,
-0x48,
-0x3a,
-0x48,
-0xf4,
-0x47,
-0x8c,
-0x47,
-0x9,
-0x47,
-0x7b,
-0x46,
-0xea,
-0x45,
-0x62,
-0x45,
-0xc4,
-0x44,
-0xc,
-0x44,
-0x2a,
-0x43,
-0x39,
-0x42,
-0x3e,
-0x41,
-0x4b,
-0x40,
-0x59,
-0x3f,
-0x5e,
-0x3e,
-0x39,
-0x3d,
-0xec,
-0x3b,
-0x87,
-0x3a,
-0x3a,
-0x39,
-0xe9,
-0x37,
-0xa7,
-0x36,
-0x54,
-0x35,
-0xf6,
-0x33,
-0x87,
-0x32,
-0x13,
-0x31,
-0xc2,
-0x2f,
-0x70,
-0x2e,
-0xc,
-0x2d,
-0x92,
-0x2b,
-0x8,
-0x2a,
-0x75,
-0x28,
-0xeb,
-0x26,
-0x5c,
-0x25,
-0xd6,
-0x23,
-0x40,
-0x22,
-0xb5,
-0x20,
-0x35,
-0x1f,
-0xbf,
-0x1d,
-0x51,
-0x1c,
-0xd8,
-0x1a,
-0x69,
-0x19,
-0x4,
-0x18,
-0xc4,
-0x16,
-0x7f,
-0x15,
-0x3d,
-0x14,
-0x7,
-0x13,
-0xe2,
-0x11,
-0xe1,
-0x10,
-0xe8,
-0xf,
-0x6,
-0xf,
-0x2e,
-0xe,
-0x65,
-0xd,
-0xa1,
-0xc,
-0xf4,
-0xb,
-0x62,
-0xb,
-0xf2,
-0xa,
-0x7e,
-0xa,
-0x26,
-0xa,
-0xc7,
-0x9,
-0x8a,
-0x9,
-0x5a,
-0x9,
-0x47,
-0x9,
-0x44,
-0x9,
-0x3b,
-0x9,
-0x39,
-0x9,
-0x38,
-0x9,
-0x4a,
-0x9,
-0x62,
-0x9,
-0x88,
-0x9,
-0xb0,
-0x9,
-0xdf,
-0x9,
-0x16,
-0xa,
-0x50,
-0xa,
-0x90,
-0xa,
-0xe0,
-0xa,
-0x39,
-0xb,
-0xb0,
-0xb,
-0x1d,
-0xc,
-0x8f,
-0xc,
-0xff,
-0xc,
-0x78,
-0xd,
-0xf5,
-0xd,
-0x8c,
-0xe,
-0x24,
-0xf,
-0xc6,
-0xf,
-0x67,
-0x10,
-0x2,
-0x11,
-0xc1,
-0x11,
-0x80,
-0x12,
-0x57,
-0x13,
-0x2a,
-0x14,
-0x4,
-0x15,
-0xdd,
-0x15,
-0xc0,
-0x16,
-0xa1,
-0x17,
-0x79,
-0x18,
-0x61,
-0x19,
-0x51,
-0x1a,
-0x41,
-0x1b,
-0x38,
-0x1c,
-0x34,
-0x1d,
-0x29,
-0x1e,
-0x34,
-0x1f,
-0x2f,
-0x20,
-0x40,
-0x21,
-0x3c,
-0x22,
-0x36,
-0x23,
-0x34,
-0x24,
-0x1d,
-0x25,
-0x20,
-0x26,
-0x15,
-0x27,
-0x19,
-0x28,
-0xe,
-0x29,
-0xf9,
-0x29,
-0xd9,
-0x2a,
-0xb9,
-0x2b,
-0x94,
-0x2c,
-0x71,
-0x2d,
-0x42,
-0x2e,
-0x8,
-0x2f,
-0xcf,
-0x2f,
-0x85,
-0x30,
-0x33,
-0x31,
-0xe5,
-0x31,
-0x90,
-0x32,
-0x2b,
-0x33,
-0xc1,
-0x33,
-0x53,
-0x34,
-0xd7,
-0x34,
-0x50,
-0x35,
-0xc9,
-0x35,
-0x2d,
-0x36,
-0x91,
-0x36,
-0xe9,
-0x36,
-0x49,
-0x37,
-0x9a,
-0x37,
-0xdd,
-0x37,
-0x23,
-0x38,
-0x63,
-0x38,
-0x9b,
-0x38,
-0xc9,
-0x38,
-0xfc,
-0x38,
-0x2c,
-0x39,
-0x5a,
-0x39,
-0x76,
-0x39,
-0x8e,
-0x39,
-0x96,
-0x39,
-0x9d,
-0x39,
-0xae,
-0x39,
-0xb5,
-0x39,
-0xba,
-0x39,
-0xae,
-0x39,
-0x9e,
-0x39,
-0x93,
-0x39,
-0x85,
-0x39,
-0x78,
-0x39,
-0x57,
-0x39,
-0x2d,
-0x39,
-0x9,
-0x39,
-0xe1,
-0x38,
-0xb0,
-0x38,
-0x63,
-0x38,
-0x21,
-0x38,
-0xe1,
-0x37,
-0x9a,
-0x37,
-0x49,
-0x37,
-0xf9,
-0x36,
-0xa0,
-0x36,
-0x52,
-0x36,
-0xf5,
-0x35,
-0x9c,
-0x35,
-0x37,
-0x35,
-0xd2,
-0x34,
-0x62,
-0x34,
-0xf3,
-0x33,
-0x83,
-0x33,
-0xb,
-0x33,
-0x8f,
-0x32,
-0x5,
-0x32,
-0x74,
-0x31,
-0xdd,
-0x30,
-0x3b,
-0x30,
-0x93,
-0x2f,
-0xe8,
-0x2e,
-0x3a,
-0x2e,
-0x8d,
-0x2d,
-0xd1,
-0x2c,
-0x13,
-0x2c,
-0x50,
-0x2b,
-0x8c,
-0x2a,
-0xbb,
-0x29,
-0xe1,
-0x28,
-0x3,
-0x28,
-0x22,
-0x27,
-0x3c,
-0x26,
-0x4b,
-0x25,
-0x5b,
-0x24,
-0x63,
-0x23,
-0x63,
-0x22,
-0x6d,
-0x21,
-0x65,
-0x20,
-0x52,
-0x1f,
-0x26,
-0x1e,
-0x1,
-0x1d,
-0xd2,
-0x1b,
-0x9f,
-0x1a,
-0x5f,
-0x19,
-0x18,
-0x18,
-0xbf,
-0x16,
-0x6f,
-0x15,
-0x1c,
-0x14,
-0xb5,
-0x12,
-0x43,
-0x11,
-0xd3,
-0xf,
-0x52,
-0xe,
-0xce,
-0xc,
-0x45,
-0xb,
-0xb6,
-0x9,
-0x21,
-0x8,
-0x7e,
-0x6,
-0xd3,
-0x4,
-0x12,
-0x3,
-0x57,
-0x1,
-0x93,
-0xff,
-0xcc,
-0xfd,
-0xf8,
-0xfb,
-0xf,
-0xfa,
-0x30,
-0xf8,
-0x41,
-0xf6,
-0x4a,
-0xf4,
-0x46,
-0xf2,
-0x38,
-0xf0,
-0x1e,
-0xee,
-0xfa,
-0xeb,
-0xcd,
-0xe9,
-0x95,
-0xe7,
-0x5d,
-0xe5,
-0x14,
-0xe3,
-0xbb,
-0xe0,
-0x59,
-0xde,
-0xf0,
-0xdb,
-0x80,
-0xd9,
-0xa,
-0xd7,
-0x86,
-0xd4,
-0x5,
-0xd2,
-0x73,
-0xcf,
-0xe0,
-0xcc,
-0x45,
-0xca,
-0xa6,
-0xc7,
-0xf2,
-0xc4,
-0x41,
-0xc2,
-0x89,
-0xbf,
-0xcc,
-0xbc,
-0x2,
-0xba,
-0x3b,
-0xb7,
-0x78,
-0xb4,
-0xad,
-0xb1,
-0xdd,
-0xae,
-0x4,
-0xac,
-0x30,
-0xa9,
-0x5c,
-0xa6,
-0x85,
-0xa3,
-0xb4,
-0xa0,
-0xdf,
-0x9d,
-0x7,
-0x9b,
-0x32,
-0x98,
-0x58,
-0x95,
-0x92,
-0x92,
-0xc8,
-0x8f,
-0x0,
-0x8d,
-0x3d,
-0x8a,
-0x76,
-0x87,
-0xb9,
-0x84,
-0xfe,
-0x81,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x35,
-0x81,
-0xc8,
-0x83,
-0x62,
-0x86,
-0xf2,
-0x88,
-0x88,
-0x8b,
-0x28,
-0x8e,
-0xd9,
-0x90,
-0x92,
-0x93,
-0x53,
-0x96,
-0x25,
-0x99,
-0xf0,
-0x9b,
-0xae,
-0x9e,
-0x7e,
-0xa1,
-0x53,
-0xa4,
-0x3b,
-0xa7,
-0x21,
-0xaa,
-0xb,
-0xad,
-0xf5,
-0xaf,
-0xe4,
-0xb2,
-0xd3,
-0xb5,
-0xc6,
-0xb8,
-0xc8,
-0xbb,
-0xcb,
-0xbe,
-0xce,
-0xc1,
-0xdb,
-0xc4,
-0xea,
-0xc7,
-0xf8,
-0xca,
-0xc,
-0xce,
-0x27,
-0xd1,
-0x44,
-0xd4,
-0x63,
-0xd7,
-0x81,
-0xda,
-0xa7,
-0xdd,
-0xcc,
-0xe0,
-0xf7,
-0xe3,
-0x19,
-0xe7,
-0x3e,
-0xea,
-0x61,
-0xed,
-0x8f,
-0xf0,
-0xc1,
-0xf3,
-0xf7,
-0xf6,
-0x24,
-0xfa,
-0x50,
-0xfd,
-0x71,
-0x0,
-0x99,
-0x3,
-0xc6,
-0x6,
-0xf7,
-0x9,
-0x29,
-0xd,
-0x4e,
-0x10,
-0x78,
-0x13,
-0xa1,
-0x16,
-0xd2,
-0x19,
-0xf9,
-0x1c,
-0x1c,
-0x20,
-0x35,
-0x23,
-0x56,
-0x26,
-0x6b,
-0x29,
-0x85,
-0x2c,
-0xa1,
-0x2f,
-0xab,
-0x32,
-0xbe,
-0x35,
-0xd1,
-0x38,
-0xd8,
-0x3b,
-0xdc,
-0x3e,
-0xd8,
-0x41,
-0xd2,
-0x44,
-0xcb,
-0x47,
-0xbf,
-0x4a,
-0xab,
-0x4d,
-0x92,
-0x50,
-0x7f,
-0x53,
-0x5c,
-0x56,
-0x42,
-0x59,
-0x6,
-0x5c,
-0xdf,
-0x5e,
-0xa0,
-0x61,
-0x6a,
-0x64,
-0x21,
-0x67,
-0xdc,
-0x69,
-0x84,
-0x6c,
-0x26,
-0x6f,
-0xc5,
-0x71,
-0x5e,
-0x74,
-0xf3,
-0x76,
-0x81,
-0x79,
-0x3,
-0x7c,
-0x84,
-0x7e,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfb,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xd6,
-0x7f,
-0xc0,
-0x7d,
-0x9f,
-0x7b,
-0x6d,
-0x79,
-0x4c,
-0x77,
-0x22,
-0x75,
-0xe5,
-0x72,
-0xb3,
-0x70,
-0x78,
-0x6e,
-0x4c,
-0x6c,
-0xb,
-0x6a,
-0xce,
-0x67,
-0x87,
-0x65,
-0x41,
-0x63,
-0xfb,
-0x60,
-0xa7,
-0x5e,
-0x44,
-0x5c,
-0xea,
-0x59,
-0x8d,
-0x57,
-0x3d,
-0x55,
-0xdf,
-0x52,
-0x7d,
-0x50,
-0x2a,
-0x4e,
-0xca,
-0x4b,
-0x6d,
-0x49,
-0x6,
-0x47,
-0xa2,
-0x44,
-0x33,
-0x42,
-0xd1,
-0x3f,
-0x6b,
-0x3d,
-0x2,
-0x3b,
-0x9b,
-0x38,
-0x31,
-0x36,
-0xcc,
-0x33,
-0x62,
-0x31,
-0xef,
-0x2e,
-0x80,
-0x2c,
-0x16,
-0x2a,
-0xae,
-0x27,
-0x3a,
-0x25,
-0xc4,
-0x22,
-0x57,
-0x20,
-0xe4,
-0x1d,
-0x8b,
-0x1b,
-0x18,
-0x19,
-0xb5,
-0x16,
-0x4b,
-0x14,
-0xe7,
-0x11,
-0x88,
-0xf,
-0x30,
-0xd,
-0xd4,
-0xa,
-0x6d,
-0x8,
-0x16,
-0x6,
-0xbf,
-0x3,
-0x70,
-0x1,
-0x1c,
-0xff,
-0xd0,
-0xfc,
-0x7a,
-0xfa,
-0x22,
-0xf8,
-0xd4,
-0xf5,
-0x8c,
-0xf3,
-0x4b,
-0xf1,
-0x9,
-0xef,
-0xbf,
-0xec,
-0x83,
-0xea,
-0x46,
-0xe8,
-0x1d,
-0xe6,
-0xe6,
-0xe3,
-0xb8,
-0xe1,
-0x92,
-0xdf,
-0x7f,
-0xdd,
-0x66,
-0xdb,
-0x54,
-0xd9,
-0x41,
-0xd7,
-0x32,
-0xd5,
-0x21,
-0xd3,
-0x1a,
-0xd1,
-0x24,
-0xcf,
-0x28,
-0xcd,
-0x31,
-0xcb,
-0x3b,
-0xc9,
-0x50,
-0xc7,
-0x65,
-0xc5,
-0x86,
-0xc3,
-0xa7,
-0xc1,
-0xce,
-0xbf,
-0xff,
-0xbd,
-0x32,
-0xbc,
-0x79,
-0xba,
-0xc8,
-0xb8,
-0x1d,
-0xb7,
-0x67,
-0xb5,
-0xc7,
-0xb3,
-0x27,
-0xb2,
-0x83,
-0xb0,
-0xf2,
-0xae,
-0x6a,
-0xad,
-0xe8,
-0xab,
-0x68,
-0xaa,
-0xef,
-0xa8,
-0x8b,
-0xa7,
-0x19,
-0xa6,
-0xb8,
-0xa4,
-0x5d,
-0xa3,
-0xc,
-0xa2,
-0xc5,
-0xa0,
-0x86,
-0x9f,
-0x4a,
-0x9e,
-0x17,
-0x9d,
-0xf2,
-0x9b,
-0xcb,
-0x9a,
-0xb6,
-0x99,
-0x99,
-0x98,
-0x8d,
-0x97,
-0x88,
-0x96,
-0x8b,
-0x95,
-0x8f,
-0x94,
-0xad,
-0x93,
-0xbe,
-0x92,
-0xe9,
-0x91,
-0x9,
-0x91,
-0x43,
-0x90,
-0x7b,
-0x8f,
-0xc2,
-0x8e,
-0x5,
-0x8e,
-0x5a,
-0x8d,
-0xaf,
-0x8c,
-0x16,
-0x8c,
-0x78,
-0x8b,
-0xee,
-0x8a,
-0x73,
-0x8a,
-0xf5,
-0x89,
-0x84,
-0x89,
-0x14,
-0x89,
-0xb0,
-0x88,
-0x5a,
-0x88,
-0x3,
-0x88,
-0xb1,
-0x87,
-0x6d,
-0x87,
-0x2a,
-0x87,
-0xf4,
-0x86,
-0xc5,
-0x86,
-0xa2,
-0x86,
-0x83,
-0x86,
-0x6f,
-0x86,
-0x5e,
-0x86,
-0x57,
-0x86,
-0x62,
-0x86,
-0x6f,
-0x86,
-0x7c,
-0x86,
-0x98,
-0x86,
-0xb4,
-0x86,
-0xde,
-0x86,
-0xb,
-0x87,
-0x41,
-0x87,
-0x7f,
-0x87,
-0xc2,
-0x87,
-0x14,
-0x88,
-0x58,
-0x88,
-0xb2,
-0x88,
-0xe,
-0x89,
-0x76,
-0x89,
-0xe1,
-0x89,
-0x59,
-0x8a,
-0xd7,
-0x8a,
-0x5e,
-0x8b,
-0xf2,
-0x8b,
-0x7e,
-0x8c,
-0xe,
-0x8d,
-0xa7,
-0x8d,
-0x4f,
-0x8e,
-0xf5,
-0x8e,
-0xa1,
-0x8f,
-0x59,
-0x90,
-0x10,
-0x91,
-0xd0,
-0x91,
-0x94,
-0x92,
-0x61,
-0x93,
-0x36,
-0x94,
-0xf,
-0x95,
-0xf3,
-0x95,
-0xd3,
-0x96,
-0xb6,
-0x97,
-0x96,
-0x98,
-0x81,
-0x99,
-0x76,
-0x9a,
-0x74,
-0x9b,
-0x70,
-0x9c,
-0x67,
-0x9d,
-0x73,
-0x9e,
-0x72,
-0x9f,
-0x8d,
-0xa0,
-0x9d,
-0xa1,
-0xbe,
-0xa2,
-0xd2,
-0xa3,
-0xff,
-0xa4,
-0x19,
-0xa6,
-0x3f,
-0xa7,
-0x6a,
-0xa8,
-0x92,
-0xa9,
-0xcc,
-0xaa,
-0x17,
-0xac,
-0x69,
-0xad,
-0xb2,
-0xae,
-0xeb,
-0xaf,
-0x1f,
-0xb1,
-0x5d,
-0xb2,
-0xa2,
-0xb3,
-0xe0,
-0xb4,
-0x27,
-0xb6,
-0x64,
-0xb7,
-0xa6,
-0xb8,
-0xec,
-0xb9,
-0x3f,
-0xbb,
-0x84,
-0xbc,
-0xd3,
-0xbd,
-0x21,
-0xbf,
-0x72,
-0xc0,
-0xc8,
-0xc1,
-0x1b,
-0xc3,
-0x70,
-0xc4,
-0xc1,
-0xc5,
-0x27,
-0xc7,
-0x81,
-0xc8,
-0xe0,
-0xc9,
-0x46,
-0xcb,
-0x9b,
-0xcc,
-0xf4,
-0xcd,
-0x4a,
-0xcf,
-0xa9,
-0xd0,
-0xa,
-0xd2,
-0x6e,
-0xd3,
-0xc0,
-0xd4,
-0x13,
-0xd6,
-0x6a,
-0xd7,
-0xc3,
-0xd8,
-0x24,
-0xda,
-0x7f,
-0xdb,
-0xd1,
-0xdc,
-0x27,
-0xde,
-0x80,
-0xdf,
-0xd8,
-0xe0,
-0x26,
-0xe2,
-0x71,
-0xe3,
-0xbb,
-0xe4,
-0x7,
-0xe6,
-0x4c,
-0xe7,
-0x87,
-0xe8,
-0xc5,
-0xe9,
-0xa,
-0xeb,
-0x3f,
-0xec,
-0x72,
-0xed,
-0xa4,
-0xee,
-0xcc,
-0xef,
-0x0,
-0xf1,
-0x31,
-0xf2,
-0x59,
-0xf3,
-0x80,
-0xf4,
-0xa7,
-0xf5,
-0xc3,
-0xf6,
-0xe7,
-0xf7,
-0xf6,
-0xf8,
-0x17,
-0xfa,
-0x28,
-0xfb,
-0x45,
-0xfc,
-0x53,
-0xfd,
-0x5f,
-0xfe,
-0x62,
-0xff,
-0x6a,
-0x0,
-0x64,
-0x1,
-0x65,
-0x2,
-0x59,
-0x3,
-0x53,
-0x4,
-0x3d,
-0x5,
-0x34,
-0x6,
-0x11,
-0x7,
-0xfa,
-0x7,
-0xd2,
-0x8,
-0xa9,
-0x9,
-0x76,
-0xa,
-0x3e,
-0xb,
-0x6,
-0xc,
-0xc8,
-0xc,
-0x86,
-0xd,
-0x39,
-0xe,
-0xe8,
-0xe,
-0x9b,
-0xf,
-0x43,
-0x10,
-0xe5,
-0x10,
-0x80,
-0x11,
-0x21,
-0x12,
-0xb2,
-0x12,
-0x48,
-0x13,
-0xd3,
-0x13,
-0x63,
-0x14,
-0xe3,
-0x14,
-0x6f,
-0x15,
-0xed,
-0x15,
-0x6a,
-0x16,
-0xdb,
-0x16,
-0x42,
-0x17,
-0xac,
-0x17,
-0xd,
-0x18,
-0x66,
-0x18,
-0xbc,
-0x18,
-0x7,
-0x19,
-0x50,
-0x19,
-0x97,
-0x19,
-0xd7,
-0x19,
-0x10,
-0x1a,
-0x47,
-0x1a,
-0x7b,
-0x1a,
-0xaa,
-0x1a,
-0xd4,
-0x1a,
-0xf7,
-0x1a,
-0x1c,
-0x1b,
-0x32,
-0x1b,
-0x4b,
-0x1b,
-0x56,
-0x1b,
-0x62,
-0x1b,
-0x6e,
-0x1b,
-0x79,
-0x1b,
-0x7e,
-0x1b,
-0x75,
-0x1b,
-0x6f,
-0x1b,
-0x5d,
-0x1b,
-0x48,
-0x1b,
-0x2a,
-0x1b,
-0x6,
-0x1b,
-0xe3,
-0x1a,
-0xbb,
-0x1a,
-0x92,
-0x1a,
-0x5e,
-0x1a,
-0x25,
-0x1a,
-0xea,
-0x19,
-0xac,
-0x19,
-0x72,
-0x19,
-0x26,
-0x19,
-0xe1,
-0x18,
-0x85,
-0x18,
-0x34,
-0x18,
-0xd8,
-0x17,
-0x86,
-0x17,
-0x2a,
-0x17,
-0xca,
-0x16,
-0x6b,
-0x16,
-0xfd,
-0x15,
-0x8d,
-0x15,
-0x1d,
-0x15,
-0xb1,
-0x14,
-0x38,
-0x14,
-0xbc,
-0x13,
-0x43,
-0x13,
-0xc4,
-0x12,
-0x3d,
-0x12,
-0xbf,
-0x11,
-0x2d,
-0x11,
-0xa1,
-0x10,
-0x11,
-0x10,
-0x8e,
-0xf,
-0xf9,
-0xe,
-0x6c,
-0xe,
-0xd0,
-0xd,
-0x3e,
-0xd,
-0xa1,
-0xc,
-0x2,
-0xc,
-0x64,
-0xb,
-0xca,
-0xa,
-0x25,
-0xa,
-0x83,
-0x9,
-0xe0,
-0x8,
-0x2c,
-0x8,
-0x7e,
-0x7,
-0xcc,
-0x6,
-0x1b,
-0x6,
-0x6c,
-0x5,
-0xb9,
-0x4,
-0x8,
-0x4,
-0x54,
-0x3,
-0x9b,
-0x2,
-0xe7,
-0x1,
-0x31,
-0x1,
-0x7c,
-0x0,
-0xbf,
-0xff,
-0x8,
-0xff,
-0x4b,
-0xfe,
-0x96,
-0xfd,
-0xd7,
-0xfc,
-0x20,
-0xfc,
-0x67,
-0xfb,
-0xaa,
-0xfa,
-0xfd,
-0xf9,
-0x42,
-0xf9,
-0x91,
-0xf8,
-0xd3,
-0xf7,
-0x17,
-0xf7,
-0x65,
-0xf6,
-0xb4,
-0xf5,
-0x0,
-0xf5,
-0x49,
-0xf4,
-0x8a,
-0xf3,
-0xd0,
-0xf2,
-0x18,
-0xf2,
-0x67,
-0xf1,
-0xb9,
-0xf0,
-0x6,
-0xf0,
-0x52,
-0xef,
-0xa4,
-0xee,
-0xf6,
-0xed,
-0x4c,
-0xed,
-0x9f,
-0xec,
-0xfb,
-0xeb,
-0x58,
-0xeb,
-0xb4,
-0xea,
-0x19,
-0xea,
-0x76,
-0xe9,
-0xd0,
-0xe8,
-0x38,
-0xe8,
-0x94,
-0xe7,
-0xfd,
-0xe6,
-0x6c,
-0xe6,
-0xd5,
-0xe5,
-0x43,
-0xe5,
-0xaa,
-0xe4,
-0x19,
-0xe4,
-0x8b,
-0xe3,
-0x0,
-0xe3,
-0x76,
-0xe2,
-0xeb,
-0xe1,
-0x64,
-0xe1,
-0xd9,
-0xe0,
-0x57,
-0xe0,
-0xd0,
-0xdf,
-0x4f,
-0xdf,
-0xd4,
-0xde,
-0x5a,
-0xde,
-0xe1,
-0xdd,
-0x70,
-0xdd,
-0xfc,
-0xdc,
-0x8f,
-0xdc,
-0x24,
-0xdc,
-0xb0,
-0xdb,
-0x4b,
-0xdb,
-0xe5,
-0xda,
-0x7f,
-0xda,
-0x24,
-0xda,
-0xd0,
-0xd9,
-0x7c,
-0xd9,
-0x34,
-0xd9,
-0xdf,
-0xd8,
-0x97,
-0xd8,
-0x4e,
-0xd8,
-0x12,
-0xd8,
-0xd3,
-0xd7,
-0x94,
-0xd7,
-0x56,
-0xd7,
-0x1b,
-0xd7,
-0xeb,
-0xd6,
-0xba,
-0xd6,
-0x8f,
-0xd6,
-0x71,
-0xd6,
-0x50,
-0xd6,
-0x2d,
-0xd6,
-0x16,
-0xd6,
-0xf0,
-0xd5,
-0xdb,
-0xd5,
-0xc2,
-0xd5,
-0xbc,
-0xd5,
-0xa8,
-0xd5,
-0xa3,
-0xd5,
-0xa0,
-0xd5,
-0xa0,
-0xd5,
-0xa7,
-0xd5,
-0xa9,
-0xd5,
-0xbc,
-0xd5,
-0xbc,
-0xd5,
-0xd2,
-0xd5,
-0xdf,
-0xd5,
-0x4,
-0xd6,
-0x1f,
-0xd6,
-0x41,
-0xd6,
-0x5a,
-0xd6,
-0x8e,
-0xd6,
-0xc0,
-0xd6,
-0xf5,
-0xd6,
-0x28,
-0xd7,
-0x5b,
-0xd7,
-0x9a,
-0xd7,
-0xcc,
-0xd7,
-0x11,
-0xd8,
-0x51,
-0xd8,
-0x92,
-0xd8,
-0xd7,
-0xd8,
-0x28,
-0xd9,
-0x7c,
-0xd9,
-0xd2,
-0xd9,
-0x28,
-0xda,
-0x7d,
-0xda,
-0xdb,
-0xda,
-0x3c,
-0xdb,
-0xaa,
-0xdb,
-0xf,
-0xdc,
-0x7c,
-0xdc,
-0xeb,
-0xdc,
-0x5f,
-0xdd,
-0xe4,
-0xdd,
-0x5a,
-0xde,
-0xdb,
-0xde,
-0x55,
-0xdf,
-0xe9,
-0xdf,
-0x73,
-0xe0,
-0xfb,
-0xe0,
-0x80,
-0xe1,
-0x15,
-0xe2,
-0xa5,
-0xe2,
-0x3c,
-0xe3,
-0xcd,
-0xe3,
-0x66,
-0xe4,
-0xf1,
-0xe4,
-0x98,
-0xe5,
-0x33,
-0xe6,
-0xdc,
-0xe6,
-0x7f,
-0xe7,
-0x2c,
-0xe8,
-0xd6,
-0xe8,
-0x7c,
-0xe9,
-0x27,
-0xea,
-0xd6,
-0xea,
-0x8b,
-0xeb,
-0x46,
-0xec,
-0xfd,
-0xec,
-0xb9,
-0xed,
-0x74,
-0xee,
-0x33,
-0xef,
-0xf2,
-0xef,
-0xbc,
-0xf0,
-0x7f,
-0xf1,
-0x49,
-0xf2,
-0x13,
-0xf3,
-0xdd,
-0xf3,
-0xa5,
-0xf4,
-0x73,
-0xf5,
-0x42,
-0xf6,
-0x14,
-0xf7,
-0xe5,
-0xf7,
-0xb3,
-0xf8,
-0x8c,
-0xf9,
-0x64,
-0xfa,
-0x3f,
-0xfb,
-0x15,
-0xfc,
-0xf1,
-0xfc,
-0xcc,
-0xfd,
-0xa4,
-0xfe,
-0x83,
-0xff,
-0x69,
-0x0,
-0x4c,
-0x1,
-0x29,
-0x2,
-0xa,
-0x3,
-0xe6,
-0x3,
-0xd2,
-0x4,
-0xbf,
-0x5,
-0xa9,
-0x6,
-0x98,
-0x7,
-0x84,
-0x8,
-0x66,
-0x9,
-0x47,
-0xa,
-0x34,
-0xb,
-0x1e,
-0xc,
-0x12,
-0xd,
-0xfe,
-0xd,
-0xec,
-0xe,
-0xd2,
-0xf,
-0xbe,
-0x10,
-0xa7,
-0x11,
-0x91,
-0x12,
-0x7a,
-0x13,
-0x69,
-0x14,
-0x57,
-0x15,
-0x41,
-0x16,
-0x2a,
-0x17,
-0x1c,
-0x18,
-0xf,
-0x19,
-0xf6,
-0x19,
-0xe4,
-0x1a,
-0xc9,
-0x1b,
-0xb6,
-0x1c,
-0x98,
-0x1d,
-0x83,
-0x1e,
-0x68,
-0x1f,
-0x4d,
-0x20,
-0x33,
-0x21,
-0x1b,
-0x22,
-0xfb,
-0x22,
-0xe1,
-0x23,
-0xbf,
-0x24,
-0xa0,
-0x25,
-0x80,
-0x26,
-0x57,
-0x27,
-0x33,
-0x28,
-0xa,
-0x29,
-0xe2,
-0x29,
-0xb7,
-0x2a,
-0x85,
-0x2b,
-0x5e,
-0x2c,
-0x36,
-0x2d,
-0x7,
-0x2e,
-0xd9,
-0x2e,
-0xa8,
-0x2f,
-0x71,
-0x30,
-0x38,
-0x31,
-0x5,
-0x32,
-0xc4,
-0x32,
-0x8d,
-0x33,
-0x52,
-0x34,
-0x12,
-0x35,
-0xcf,
-0x35,
-0x8a,
-0x36,
-0x42,
-0x37,
-0xf0,
-0x37,
-0xa5,
-0x38,
-0x51,
-0x39,
-0x8,
-0x3a,
-0xb3,
-0x3a,
-0x5f,
-0x3b,
-0x6,
-0x3c,
-0xab,
-0x3c,
-0x4d,
-0x3d,
-0xe7,
-0x3d,
-0x89,
-0x3e,
-0x1d,
-0x3f,
-0xb7,
-0x3f,
-0x45,
-0x40,
-0xcd,
-0x40,
-0x58,
-0x41,
-0xd7,
-0x41,
-0x64,
-0x42,
-0xea,
-0x42,
-0x6b,
-0x43,
-0xea,
-0x43,
-0x66,
-0x44,
-0xe4,
-0x44,
-0x4d,
-0x45,
-0xc8,
-0x45,
-0x2d,
-0x46,
-0x9d,
-0x46,
-0x5,
-0x47,
-0x70,
-0x47,
-0xcc,
-0x47,
-0x2c,
-0x48,
-0x8b,
-0x48,
-0xe0,
-0x48,
-0x3f,
-0x49,
-0x8b,
-0x49,
-0xe3,
-0x49,
-0x23,
-0x4a,
-0x74,
-0x4a,
-0xbb,
-0x4a,
-0xfe,
-0x4a,
-0x40,
-0x4b,
-0x7d,
-0x4b,
-0xbd,
-0x4b,
-0xf8,
-0x4b,
-0x35,
-0x4c,
-0x65,
-0x4c,
-0x93,
-0x4c,
-0xb7,
-0x4c,
-0xde,
-0x4c,
-0x1,
-0x4d,
-0x22,
-0x4d,
-0x3a,
-0x4d,
-0x50,
-0x4d,
-0x64,
-0x4d,
-0x79,
-0x4d,
-0x85,
-0x4d,
-0x88,
-0x4d,
-0x93,
-0x4d,
-0x93,
-0x4d,
-0x9e,
-0x4d,
-0x9a,
-0x4d,
-0x9f,
-0x4d,
-0x98,
-0x4d,
-0x8e,
-0x4d,
-0x7f,
-0x4d,
-0x78,
-0x4d,
-0x5a,
-0x4d,
-0x3e,
-0x4d,
-0x1c,
-0x4d,
-0xfd,
-0x4c,
-0xe0,
-0x4c,
-0xc1,
-0x4c,
-0x92,
-0x4c,
-0x65,
-0x4c,
-0x32,
-0x4c,
-0xff,
-0x4b,
-0xc1,
-0x4b,
-0x8c,
-0x4b,
-0x4b,
-0x4b,
-0xf,
-0x4b,
-0xc9,
-0x4a,
-0x8d,
-0x4a,
-0x44,
-0x4a,
-0x4,
-0x4a,
-0xb5,
-0x49,
-0x67,
-0x49,
-0x1d,
-0x49,
-0xcf,
-0x48,
-0x73,
-0x48,
-0x20,
-0x48,
-0xc8,
-0x47,
-0x6c,
-0x47,
-0xb,
-0x47,
-0x9f,
-0x46,
-0x3e,
-0x46,
-0xd1,
-0x45,
-0x6e,
-0x45,
-0x4,
-0x45,
-0x95,
-0x44,
-0x25,
-0x44,
-0xb2,
-0x43,
-0x37,
-0x43,
-0xc9,
-0x42,
-0x54,
-0x42,
-0xdd,
-0x41,
-0x5d,
-0x41,
-0xe8,
-0x40,
-0x67,
-0x40,
-0xf2,
-0x3f,
-0x6c,
-0x3f,
-0xe9,
-0x3e,
-0x6b,
-0x3e,
-0xec,
-0x3d,
-0x65,
-0x3d,
-0xe3,
-0x3c,
-0x57,
-0x3c,
-0xd5,
-0x3b,
-0x4a,
-0x3b,
-0xc2,
-0x3a,
-0x2e,
-0x3a,
-0x9b,
-0x39,
-0x10,
-0x39,
-0x81,
-0x38,
-0xf0,
-0x37,
-0x5c,
-0x37,
-0xaf,
-0x36,
-0x13,
-0x36,
-0x82,
-0x35,
-0xf0,
-0x34,
-0x59,
-0x34,
-0xcb,
-0x33,
-0x2e,
-0x33,
-0x8e,
-0x32,
-0xee,
-0x31,
-0x56,
-0x31,
-0xc2,
-0x30,
-0x2a,
-0x30,
-0x8f,
-0x2f,
-0x1,
-0x2f,
-0x63,
-0x2e,
-0xd3,
-0x2d,
-0x3b,
-0x2d,
-0xa0,
-0x2c,
-0x6,
-0x2c,
-0x6b,
-0x2b,
-0xd1,
-0x2a,
-0x3c,
-0x2a,
-0xa3,
-0x29,
-0x8,
-0x29,
-0x77,
-0x28,
-0xe2,
-0x27,
-0x4c,
-0x27,
-0xb2,
-0x26,
-0x1a,
-0x26,
-0x8a,
-0x25,
-0xef,
-0x24,
-0x5b,
-0x24,
-0xc5,
-0x23,
-0x32,
-0x23,
-0xa3,
-0x22,
-0x7,
-0x22,
-0x77,
-0x21,
-0xda,
-0x20,
-0x52,
-0x20,
-0xbb,
-0x1f,
-0x29,
-0x1f,
-0x9a,
-0x1e,
-0x8,
-0x1e,
-0x81,
-0x1d,
-0xec,
-0x1c,
-0x67,
-0x1c,
-0xd2,
-0x1b,
-0x49,
-0x1b,
-0xbb,
-0x1a,
-0x33,
-0x1a,
-0xac,
-0x19,
-0x2a,
-0x19,
-0xa0,
-0x18,
-0x20,
-0x18,
-0x8f,
-0x17,
-0xf,
-0x17,
-0x85,
-0x16,
-0xff,
-0x15,
-0x82,
-0x15,
-0x2,
-0x15,
-0x7b,
-0x14,
-0x7,
-0x14,
-0x88,
-0x13,
-0x8,
-0x13,
-0x91,
-0x12,
-0x15,
-0x12,
-0x98,
-0x11,
-0x1e,
-0x11,
-0xa9,
-0x10,
-0x29,
-0x10,
-0xb2,
-0xf,
-0x35,
-0xf,
-0xbf,
-0xe,
-0x4a,
-0xe,
-0xd1,
-0xd,
-0x66,
-0xd,
-0xf0,
-0xc,
-0x7c,
-0xc,
-0xc,
-0xc,
-0x9f,
-0xb,
-0x2e,
-0xb,
-0xcf,
-0xa,
-0x67,
-0xa,
-0xfd,
-0x9,
-0x95,
-0x9,
-0x2e,
-0x9,
-0xdb,
-0x8,
-0x7c,
-0x8,
-0x1a,
-0x8,
-0xba,
-0x7,
-0x54,
-0x7,
-0x5,
-0x7,
-0x9d,
-0x6,
-0x4b,
-0x6,
-0xef,
-0x5,
-0x98,
-0x5,
-0x49,
-0x5,
-0xe6,
-0x4,
-0x90,
-0x4,
-0x3a,
-0x4,
-0xe4,
-0x3,
-0xa1,
-0x3,
-0x48,
-0x3,
-0xf8,
-0x2,
-0xa8,
-0x2,
-0x60,
-0x2,
-0x10,
-0x2,
-0xcb,
-0x1,
-0x7e,
-0x1,
-0x3a,
-0x1,
-0xf4,
-0x0,
-0xb2,
-0x0,
-0x71,
-0x0,
-0x33,
-0x0,
-0xf3,
-0xff,
-0xa7,
-0xff,
-0x69,
-0xff,
-0x22,
-0xff,
-0xe6,
-0xfe,
-0xa3,
-0xfe,
-0x6e,
-0xfe,
-0x29,
-0xfe,
-0xf0,
-0xfd,
-0xb2,
-0xfd,
-0x81,
-0xfd,
-0x47,
-0xfd,
-0xf,
-0xfd,
-0xe1,
-0xfc,
-0xaa,
-0xfc,
-0x7c,
-0xfc,
-0x46,
-0xfc,
-0x15,
-0xfc,
-0xdf,
-0xfb,
-0xb8,
-0xfb,
-0x89,
-0xfb,
-0x62,
-0xfb,
-0x3d,
-0xfb,
-0x14,
-0xfb,
-0xea,
-0xfa,
-0xc1,
-0xfa,
-0xa3,
-0xfa,
-0x7b,
-0xfa,
-0x5e,
-0xfa,
-0x3b,
-0xfa,
-0x26,
-0xfa,
-0xff,
-0xf9,
-0xde,
-0xf9,
-0xbe,
-0xf9,
-0xa1,
-0xf9,
-0x86,
-0xf9,
-0x72,
-0xf9,
-0x4b,
-0xf9,
-0x3a,
-0xf9,
-0x1d,
-0xf9,
-0xd,
-0xf9,
-0xfa,
-0xf8,
-0xdc,
-0xf8,
-0xc8,
-0xf8,
-0xb4,
-0xf8,
-0xa1,
-0xf8,
-0x8e,
-0xf8,
-0x76,
-0xf8,
-0x68,
-0xf8,
-0x47,
-0xf8,
-0x3d,
-0xf8,
-0x30,
-0xf8,
-0x20,
-0xf8,
-0x13,
-0xf8,
-0xfb,
-0xf7,
-0xfa,
-0xf7,
-0xe7,
-0xf7,
-0xe0,
-0xf7,
-0xc4,
-0xf7,
-0xb5,
-0xf7,
-0xa0,
-0xf7,
-0x96,
-0xf7,
-0x85,
-0xf7,
-0x73,
-0xf7,
-0x5c,
-0xf7,
-0x48,
-0xf7,
-0x39,
-0xf7,
-0x23,
-0xf7,
-0x19,
-0xf7,
-0x5,
-0xf7,
-0xf1,
-0xf6,
-0xe0,
-0xf6,
-0xca,
-0xf6,
-0xbb,
-0xf6,
-0xad,
-0xf6,
-0xaa,
-0xf6,
-0x9f,
-0xf6,
-0x9b,
-0xf6,
-0x8e,
-0xf6,
-0x89,
-0xf6,
-0x80,
-0xf6,
-0x80,
-0xf6,
-0x82,
-0xf6,
-0x81,
-0xf6,
-0x7e,
-0xf6,
-0x79,
-0xf6,
-0x74,
-0xf6,
-0x6e,
-0xf6,
-0x6b,
-0xf6,
-0x69,
-0xf6,
-0x66,
-0xf6,
-0x56,
-0xf6,
-0x4e,
-0xf6,
-0x4a,
-0xf6,
-0x40,
-0xf6,
-0x41,
-0xf6,
-0x30,
-0xf6,
-0x28,
-0xf6,
-0x13,
-0xf6,
-0x9,
-0xf6,
-0x2,
-0xf6,
-0xed,
-0xf5,
-0xdb,
-0xf5,
-0xcb,
-0xf5,
-0xbb,
-0xf5,
-0xb2,
-0xf5,
-0xa9,
-0xf5,
-0x94,
-0xf5,
-0x81,
-0xf5,
-0x71,
-0xf5,
-0x63,
-0xf5,
-0x4f,
-0xf5,
-0x40,
-0xf5,
-0x2c,
-0xf5,
-0x15,
-0xf5,
-0xfe,
-0xf4,
-0xef,
-0xf4,
-0xd8,
-0xf4,
-0xc3,
-0xf4,
-0xac,
-0xf4,
-0x93,
-0xf4,
-0x7d,
-0xf4,
-0x65,
-0xf4,
-0x4e,
-0xf4,
-0x39,
-0xf4,
-0x22,
-0xf4,
-0x2,
-0xf4,
-0xee,
-0xf3,
-0xd1,
-0xf3,
-0xb9,
-0xf3,
-0x94,
-0xf3,
-0x74,
-0xf3,
-0x53,
-0xf3,
-0x37,
-0xf3,
-0x1b,
-0xf3,
-0xfc,
-0xf2,
-0xd6,
-0xf2,
-0xb6,
-0xf2,
-0x8e,
-0xf2,
-0x78,
-0xf2,
-0x5a,
-0xf2,
-0x3a,
-0xf2,
-0x15,
-0xf2,
-0xe7,
-0xf1,
-0xbc,
-0xf1,
-0x8a,
-0xf1,
-0x6d,
-0xf1,
-0x3e,
-0xf1,
-0x17,
-0xf1,
-0xdc,
-0xf0,
-0xb2,
-0xf0,
-0x7f,
-0xf0,
-0x59,
-0xf0,
-0x22,
-0xf0,
-0xfe,
-0xef,
-0xc6,
-0xef,
-0x9a,
-0xef,
-0x68,
-0xef,
-0x39,
-0xef,
-0x0,
-0xef,
-0xd1,
-0xee,
-0xa3,
-0xee,
-0x66,
-0xee,
-0x32,
-0xee,
-0xff,
-0xed,
-0xcc,
-0xed,
-0x93,
-0xed,
-0x56,
-0xed,
-0x1b,
-0xed,
-0xe2,
-0xec,
-0xa8,
-0xec,
-0x6c,
-0xec,
-0x31,
-0xec,
-0xed,
-0xeb,
-0xb2,
-0xeb,
-0x76,
-0xeb,
-0x3a,
-0xeb,
-0x3,
-0xeb,
-0xc1,
-0xea,
-0x84,
-0xea,
-0x44,
-0xea,
-0xfd,
-0xe9,
-0xbd,
-0xe9,
-0x73,
-0xe9,
-0x33,
-0xe9,
-0xe9,
-0xe8,
-0xaf,
-0xe8,
-0x5e,
-0xe8,
-0x26,
-0xe8,
-0xd7,
-0xe7,
-0x95,
-0xe7,
-0x40,
-0xe7,
-0xfd,
-0xe6,
-0xb1,
-0xe6,
-0x71,
-0xe6,
-0x27,
-0xe6,
-0xe0,
-0xe5,
-0x9b,
-0xe5,
-0x56,
-0xe5,
-0x18,
-0xe5,
-0xd9,
-0xe4,
-0x8e,
-0xe4,
-0x50,
-0xe4,
-0x5,
-0xe4,
-0xc8,
-0xe3,
-0x81,
-0xe3,
-0x3f,
-0xe3,
-0xf5,
-0xe2,
-0xb1,
-0xe2,
-0x6d,
-0xe2,
-0x29,
-0xe2,
-0xe6,
-0xe1,
-0xa1,
-0xe1,
-0x54,
-0xe1,
-0x11,
-0xe1,
-0xc7,
-0xe0,
-0x8a,
-0xe0,
-0x3f,
-0xe0,
-0xfd,
-0xdf,
-0xba,
-0xdf,
-0x78,
-0xdf,
-0x38,
-0xdf,
-0xf1,
-0xde,
-0xac,
-0xde,
-0x67,
-0xde,
-0x21,
-0xde,
-0xdd,
-0xdd,
-0x95,
-0xdd,
-0x4d,
-0xdd,
-0x3,
-0xdd,
-0xbb,
-0xdc,
-0x79,
-0xdc,
-0x33,
-0xdc,
-0xe9,
-0xdb,
-0xa8,
-0xdb,
-0x60,
-0xdb,
-0x21,
-0xdb,
-0xda,
-0xda,
-0x98,
-0xda,
-0x50,
-0xda,
-0x16,
-0xda,
-0xd8,
-0xd9,
-0x98,
-0xd9,
-0x5d,
-0xd9,
-0x1d,
-0xd9,
-0xe8,
-0xd8,
-0xa6,
-0xd8,
-0x79,
-0xd8,
-0x37,
-0xd8,
-0xfd,
-0xd7,
-0xbb,
-0xd7,
-0x85,
-0xd7,
-0x46,
-0xd7,
-0x7,
-0xd7,
-0xce,
-0xd6,
-0x92,
-0xd6,
-0x60,
-0xd6,
-0x24,
-0xd6,
-0xec,
-0xd5,
-0xb5,
-0xd5,
-0x7a,
-0xd5,
-0x41,
-0xd5,
-0x5,
-0xd5,
-0xd3,
-0xd4,
-0x9c,
-0xd4,
-0x68,
-0xd4,
-0x2e,
-0xd4,
-0xf5,
-0xd3,
-0xbd,
-0xd3,
-0x88,
-0xd3,
-0x58,
-0xd3,
-0x24,
-0xd3,
-0xf4,
-0xd2,
-0xbe,
-0xd2,
-0x85,
-0xd2,
-0x51,
-0xd2,
-0x22,
-0xd2,
-0xf6,
-0xd1,
-0xcb,
-0xd1,
-0x9f,
-0xd1,
-0x71,
-0xd1,
-0x4b,
-0xd1,
-0x22,
-0xd1,
-0xf5,
-0xd0,
-0xce,
-0xd0,
-0xa5,
-0xd0,
-0x83,
-0xd0,
-0x50,
-0xd0,
-0x2e,
-0xd0,
-0xfa,
-0xcf,
-0xcd,
-0xcf,
-0xa6,
-0xcf,
-0x88,
-0xcf,
-0x65,
-0xcf,
-0x47,
-0xcf,
-0x1f,
-0xcf,
-0xfd,
-0xce,
-0xdb,
-0xce,
-0xc3,
-0xce,
-0xa2,
-0xce,
-0x88,
-0xce,
-0x5a,
-0xce,
-0x3d,
-0xce,
-0x20,
-0xce,
-0x4,
-0xce,
-0xdf,
-0xcd,
-0xbd,
-0xcd,
-0x95,
-0xcd,
-0x7b,
-0xcd,
-0x5e,
-0xcd,
-0x42,
-0xcd,
-0x1d,
-0xcd,
-0x1,
-0xcd,
-0xe4,
-0xcc,
-0xc9,
-0xcc,
-0xa9,
-0xcc,
-0x8b,
-0xcc,
-0x78,
-0xcc,
-0x5b,
-0xcc,
-0x47,
-0xcc,
-0x25,
-0xcc,
-0x1c,
-0xcc,
-0xfb,
-0xcb,
-0xf5,
-0xcb,
-0xdc,
-0xcb,
-0xd0,
-0xcb,
-0xc2,
-0xcb,
-0xb0,
-0xcb,
-0x9c,
-0xcb,
-0x88,
-0xcb,
-0x81,
-0xcb,
-0x6a,
-0xcb,
-0x65,
-0xcb,
-0x4d,
-0xcb,
-0x49,
-0xcb,
-0x33,
-0xcb,
-0x31,
-0xcb,
-0x27,
-0xcb,
-0x1e,
-0xcb,
-0x10,
-0xcb,
-0x5,
-0xcb,
-0xfb,
-0xca,
-0xf9,
-0xca,
-0xf5,
-0xca,
-0xf3,
-0xca,
-0xed,
-0xca,
-0xec,
-0xca,
-0xe5,
-0xca,
-0xeb,
-0xca,
-0xe6,
-0xca,
-0xe8,
-0xca,
-0xe7,
-0xca,
-0xe6,
-0xca,
-0xf0,
-0xca,
-0xf2,
-0xca,
-0xff,
-0xca,
-0x1,
-0xcb,
-0x9,
-0xcb,
-0x10,
-0xcb,
-0x18,
-0xcb,
-0x20,
-0xcb,
-0x32,
-0xcb,
-0x3b,
-0xcb,
-0x41,
-0xcb,
-0x4c,
-0xcb,
-0x57,
-0xcb,
-0x66,
-0xcb,
-0x76,
-0xcb,
-0x8a,
-0xcb,
-0x92,
-0xcb,
-0xa3,
-0xcb,
-0xbc,
-0xcb,
-0xd1,
-0xcb,
-0xed,
-0xcb,
-0x4,
-0xcc,
-0x1c,
-0xcc,
-0x39,
-0xcc,
-0x59,
-0xcc,
-0x76,
-0xcc,
-0x91,
-0xcc,
-0xb8,
-0xcc,
-0xdd,
-0xcc,
-0xfc,
-0xcc,
-0x26,
-0xcd,
-0x4f,
-0xcd,
-0x74,
-0xcd,
-0x9a,
-0xcd,
-0xbc,
-0xcd,
-0xe2,
-0xcd,
-0xc,
-0xce,
-0x32,
-0xce,
-0x5d,
-0xce,
-0x86,
-0xce,
-0xbd,
-0xce,
-0xe6,
-0xce,
-0x14,
-0xcf,
-0x44,
-0xcf,
-0x7a,
-0xcf,
-0xaa,
-0xcf,
-0xda,
-0xcf,
-0xc,
-0xd0,
-0x3d,
-0xd0,
-0x6f,
-0xd0,
-0xa7,
-0xd0,
-0xe1,
-0xd0,
-0x13,
-0xd1,
-0x49,
-0xd1,
-0x7f,
-0xd1,
-0xbb,
-0xd1,
-0xf1,
-0xd1,
-0x31,
-0xd2,
-0x69,
-0xd2,
-0xa4,
-0xd2,
-0xe2,
-0xd2,
-0x1c,
-0xd3,
-0x5e,
-0xd3,
-0x93,
-0xd3,
-0xda,
-0xd3,
-0x18,
-0xd4,
-0x4e,
-0xd4,
-0x8a,
-0xd4,
-0xca,
-0xd4,
-0xa,
-0xd5,
-0x4d,
-0xd5,
-0x94,
-0xd5,
-0xdc,
-0xd5,
-0x1b,
-0xd6,
-0x61,
-0xd6,
-0xa9,
-0xd6,
-0xec,
-0xd6,
-0x38,
-0xd7,
-0x82,
-0xd7,
-0xcc,
-0xd7,
-0x1a,
-0xd8,
-0x67,
-0xd8,
-0xb2,
-0xd8,
-0xfe,
-0xd8,
-0x5d,
-0xd9,
-0xa6,
-0xd9,
-0x4,
-0xda,
-0x55,
-0xda,
-0xb6,
-0xda,
-0x7,
-0xdb,
-0x61,
-0xdb,
-0xbb,
-0xdb,
-0x17,
-0xdc,
-0x6f,
-0xdc,
-0xc1,
-0xdc,
-0x26,
-0xdd,
-0x73,
-0xdd,
-0xd3,
-0xdd,
-0x25,
-0xde,
-0x80,
-0xde,
-0xe0,
-0xde,
-0x3a,
-0xdf,
-0x9d,
-0xdf,
-0xf0,
-0xdf,
-0x4d,
-0xe0,
-0xa7,
-0xe0,
-0x7,
-0xe1,
-0x5f,
-0xe1,
-0xb6,
-0xe1,
-0x14,
-0xe2,
-0x71,
-0xe2,
-0xda,
-0xe2,
-0x36,
-0xe3,
-0x97,
-0xe3,
-0xf6,
-0xe3,
-0x5c,
-0xe4,
-0xc5,
-0xe4,
-0x29,
-0xe5,
-0x8f,
-0xe5,
-0xf3,
-0xe5,
-0x58,
-0xe6,
-0xc8,
-0xe6,
-0x2b,
-0xe7,
-0x90,
-0xe7,
-0xf3,
-0xe7,
-0x5a,
-0xe8,
-0xc6,
-0xe8,
-0x32,
-0xe9,
-0x9e,
-0xe9,
-0xb,
-0xea,
-0x75,
-0xea,
-0xe3,
-0xea,
-0x53,
-0xeb,
-0xb5,
-0xeb,
-0x1e,
-0xec,
-0x8d,
-0xec,
-0xf4,
-0xec,
-0x6e,
-0xed,
-0xe0,
-0xed,
-0x47,
-0xee,
-0xb3,
-0xee,
-0x17,
-0xef,
-0x8a,
-0xef,
-0xf4,
-0xef,
-0x68,
-0xf0,
-0xcd,
-0xf0,
-0x3d,
-0xf1,
-0xa9,
-0xf1,
-0x12,
-0xf2,
-0x7e,
-0xf2,
-0xef,
-0xf2,
-0x5a,
-0xf3,
-0xca,
-0xf3,
-0x39,
-0xf4,
-0x9f,
-0xf4,
-0x11,
-0xf5,
-0x7b,
-0xf5,
-0xec,
-0xf5,
-0x55,
-0xf6,
-0xc0,
-0xf6,
-0x25,
-0xf7,
-0x8d,
-0xf7,
-0xfe,
-0xf7,
-0x67,
-0xf8,
-0xd8,
-0xf8,
-0x42,
-0xf9,
-0xac,
-0xf9,
-0x14,
-0xfa,
-0x89,
-0xfa,
-0xec,
-0xfa,
-0x56,
-0xfb,
-0xbe,
-0xfb,
-0x2d,
-0xfc,
-0x99,
-0xfc,
-0xff,
-0xfc,
-0x6a,
-0xfd,
-0xd6,
-0xfd,
-0x42,
-0xfe,
-0xa9,
-0xfe,
-0xd,
-0xff,
-0x79,
-0xff,
-0xe2,
-0xff,
-0x52,
-0x0,
-0xae,
-0x0,
-0x1f,
-0x1,
-0x83,
-0x1,
-0xee,
-0x1,
-0x57,
-0x2,
-0xbc,
-0x2,
-0x2a,
-0x3,
-0x8d,
-0x3,
-0x0,
-0x4,
-0x5f,
-0x4,
-0xcd,
-0x4,
-0x32,
-0x5,
-0x98,
-0x5,
-0x1,
-0x6,
-0x6e,
-0x6,
-0xd0,
-0x6,
-0x3a,
-0x7,
-0x97,
-0x7,
-0xf4,
-0x7,
-0x57,
-0x8,
-0xc2,
-0x8,
-0x21,
-0x9,
-0x8c,
-0x9,
-0xe5,
-0x9,
-0x48,
-0xa,
-0xa4,
-0xa,
-0x5,
-0xb,
-0x63,
-0xb,
-0xc4,
-0xb,
-0x22,
-0xc,
-0x7d,
-0xc,
-0xd0,
-0xc,
-0x2f,
-0xd,
-0x84,
-0xd,
-0xe1,
-0xd,
-0x38,
-0xe,
-0x91,
-0xe,
-0xee,
-0xe,
-0x47,
-0xf,
-0xa2,
-0xf,
-0xef,
-0xf,
-0x46,
-0x10,
-0x97,
-0x10,
-0xf4,
-0x10,
-0x47,
-0x11,
-0xa4,
-0x11,
-0xf7,
-0x11,
-0x4f,
-0x12,
-0xa4,
-0x12,
-0xfc,
-0x12,
-0x57,
-0x13,
-0xab,
-0x13,
-0xfc,
-0x13,
-0x54,
-0x14,
-0xa8,
-0x14,
-0xfc,
-0x14,
-0x50,
-0x15,
-0xa0,
-0x15,
-0xf4,
-0x15,
-0x42,
-0x16,
-0x8d,
-0x16,
-0xde,
-0x16,
-0x2c,
-0x17,
-0x78,
-0x17,
-0xca,
-0x17,
-0xd,
-0x18,
-0x62,
-0x18,
-0xa9,
-0x18,
-0xfa,
-0x18,
-0x44,
-0x19,
-0x86,
-0x19,
-0xcf,
-0x19,
-0x14,
-0x1a,
-0x55,
-0x1a,
-0x99,
-0x1a,
-0xd7,
-0x1a,
-0x21,
-0x1b,
-0x5e,
-0x1b,
-0xa5,
-0x1b,
-0xe1,
-0x1b,
-0x1c,
-0x1c,
-0x61,
-0x1c,
-0x99,
-0x1c,
-0xdc,
-0x1c,
-0x11,
-0x1d,
-0x4c,
-0x1d,
-0x84,
-0x1d,
-0xbf,
-0x1d,
-0xf5,
-0x1d,
-0x2d,
-0x1e,
-0x6a,
-0x1e,
-0x9f,
-0x1e,
-0xda,
-0x1e,
-0x11,
-0x1f,
-0x48,
-0x1f,
-0x7a,
-0x1f,
-0xaa,
-0x1f,
-0xd9,
-0x1f,
-0xd,
-0x20,
-0x44,
-0x20,
-0x75,
-0x20,
-0xab,
-0x20,
-0xdc,
-0x20,
-0x7,
-0x21,
-0x32,
-0x21,
-0x60,
-0x21,
-0x84,
-0x21,
-0xb2,
-0x21,
-0xd6,
-0x21,
-0x3,
-0x22,
-0x2a,
-0x22,
-0x55,
-0x22,
-0x79,
-0x22,
-0xa0,
-0x22,
-0xbc,
-0x22,
-0xe7,
-0x22,
-0xfe,
-0x22,
-0x23,
-0x23,
-0x40,
-0x23,
-0x63,
-0x23,
-0x88,
-0x23,
-0xa0,
-0x23,
-0xb8,
-0x23,
-0xcc,
-0x23,
-0xf0,
-0x23,
-0x4,
-0x24,
-0x20,
-0x24,
-0x36,
-0x24,
-0x4b,
-0x24,
-0x5a,
-0x24,
-0x6f,
-0x24,
-0x81,
-0x24,
-0x90,
-0x24,
-0xa8,
-0x24,
-0xb5,
-0x24,
-0xca,
-0x24,
-0xdd,
-0x24,
-0xf1,
-0x24,
-0xfd,
-0x24,
-0xb,
-0x25,
-0x18,
-0x25,
-0x2a,
-0x25,
-0x38,
-0x25,
-0x47,
-0x25,
-0x4c,
-0x25,
-0x58,
-0x25,
-0x64,
-0x25,
-0x6b,
-0x25,
-0x6f,
-0x25,
-0x73,
-0x25,
-0x75,
-0x25,
-0x73,
-0x25,
-0x73,
-0x25,
-0x73,
-0x25,
-0x72,
-0x25,
-0x70,
-0x25,
-0x73,
-0x25,
-0x73,
-0x25,
-0x6d,
-0x25,
-0x6a,
-0x25,
-0x67,
-0x25,
-0x5f,
-0x25,
-0x5b,
-0x25,
-0x52,
-0x25,
-0x47,
-0x25,
-0x42,
-0x25,
-0x2d,
-0x25,
-0x20,
-0x25,
-0x16,
-0x25,
-0x8,
-0x25,
-0xf6,
-0x24,
-0xe5,
-0x24,
-0xd4,
-0x24,
-0xc4,
-0x24,
-0xb1,
-0x24,
-0x9e,
-0x24,
-0x8e,
-0x24,
-0x7b,
-0x24,
-0x67,
-0x24,
-0x4b,
-0x24,
-0x32,
-0x24,
-0x1d,
-0x24,
-0xfd,
-0x23,
-0xec,
-0x23,
-0xcf,
-0x23,
-0xba,
-0x23,
-0xa2,
-0x23,
-0x87,
-0x23,
-0x72,
-0x23,
-0x56,
-0x23,
-0x43,
-0x23,
-0x1f,
-0x23,
-0xe,
-0x23,
-0xef,
-0x22,
-0xd8,
-0x22,
-0xb6,
-0x22,
-0x99,
-0x22,
-0x79,
-0x22,
-0x5b,
-0x22,
-0x42,
-0x22,
-0x20,
-0x22,
-0x0,
-0x22,
-0xd8,
-0x21,
-0xbd,
-0x21,
-0xa2,
-0x21,
-0x81,
-0x21,
-0x61,
-0x21,
-0x3d,
-0x21,
-0x2a,
-0x21,
-0x5,
-0x21,
-0xe8,
-0x20,
-0xc2,
-0x20,
-0xa0,
-0x20,
-0x7c,
-0x20,
-0x5e,
-0x20,
-0x40,
-0x20,
-0x22,
-0x20,
-0xfb,
-0x1f,
-0xde,
-0x1f,
-0xbd,
-0x1f,
-0x9e,
-0x1f,
-0x84,
-0x1f,
-0x5e,
-0x1f,
-0x44,
-0x1f,
-0x27,
-0x1f,
-0xc,
-0x1f,
-0xe9,
-0x1e,
-0xce,
-0x1e,
-0xb6,
-0x1e,
-0x97,
-0x1e,
-0x7a,
-0x1e,
-0x5a,
-0x1e,
-0x42,
-0x1e,
-0x26,
-0x1e,
-0x8,
-0x1e,
-0xea,
-0x1d,
-0xc6,
-0x1d,
-0xb1,
-0x1d,
-0x8f,
-0x1d,
-0x77,
-0x1d,
-0x56,
-0x1d,
-0x45,
-0x1d,
-0x28,
-0x1d,
-0x11,
-0x1d,
-0xef,
-0x1c,
-0xd3,
-0x1c,
-0xb9,
-0x1c,
-0x99,
-0x1c,
-0x83,
-0x1c,
-0x66,
-0x1c,
-0x4e,
-0x1c,
-0x30,
-0x1c,
-0x15,
-0x1c,
-0xf1,
-0x1b,
-0xda,
-0x1b,
-0xc2,
-0x1b,
-0xa3,
-0x1b,
-0x8a,
-0x1b,
-0x6e,
-0x1b,
-0x5e,
-0x1b,
-0x38,
-0x1b,
-0x23,
-0x1b,
-0xb,
-0x1b,
-0xfa,
-0x1a,
-0xe4,
-0x1a,
-0xd0,
-0x1a,
-0xb8,
-0x1a,
-0xa4,
-0x1a,
-0x95,
-0x1a,
-0x7e,
-0x1a,
-0x6f,
-0x1a,
-0x56,
-0x1a,
-0x48,
-0x1a,
-0x30,
-0x1a,
-0x1f,
-0x1a,
-0xf,
-0x1a,
-0x1,
-0x1a,
-0xf0,
-0x19,
-0xe1,
-0x19,
-0xd2,
-0x19,
-0xc2,
-0x19,
-0xb6,
-0x19,
-0xa5,
-0x19,
-0x8f,
-0x19,
-0x81,
-0x19,
-0x76,
-0x19,
-0x62,
-0x19,
-0x53,
-0x19,
-0x43,
-0x19,
-0x29,
-0x19,
-0x15,
-0x19,
-0x4,
-0x19,
-0xfd,
-0x18,
-0xef,
-0x18,
-0xe0,
-0x18,
-0xc7,
-0x18,
-0xb8,
-0x18,
-0xa7,
-0x18,
-0x95,
-0x18,
-0x83,
-0x18,
-0x77,
-0x18,
-0x65,
-0x18,
-0x5d,
-0x18,
-0x51,
-0x18,
-0x45,
-0x18,
-0x36,
-0x18,
-0x2a,
-0x18,
-0x1d,
-0x18,
-0xd,
-0x18,
-0x0,
-0x18,
-0xf2,
-0x17,
-0xed,
-0x17,
-0xdb,
-0x17,
-0xd4,
-0x17,
-0xcf,
-0x17,
-0xbe,
-0x17,
-0xbc,
-0x17,
-0xab,
-0x17,
-0xa1,
-0x17,
-0x99,
-0x17,
-0x85,
-0x17,
-0x7c,
-0x17,
-0x6b,
-0x17,
-0x62,
-0x17,
-0x58,
-0x17,
-0x43,
-0x17,
-0x3b,
-0x17,
-0x21,
-0x17,
-0x14,
-0x17,
-0xf5,
-0x16,
-0xeb,
-0x16,
-0xd6,
-0x16,
-0xc6,
-0x16,
-0xb2,
-0x16,
-0x9c,
-0x16,
-0x88,
-0x16,
-0x72,
-0x16,
-0x65,
-0x16,
-0x48,
-0x16,
-0x30,
-0x16,
-0x1d,
-0x16,
-0xe,
-0x16,
-0xff,
-0x15,
-0xe8,
-0x15,
-0xd7,
-0x15,
-0xc4,
-0x15,
-0xae,
-0x15,
-0x99,
-0x15,
-0x85,
-0x15,
-0x6d,
-0x15,
-0x56,
-0x15,
-0x43,
-0x15,
-0x2e,
-0x15,
-0x16,
-0x15,
-0x5,
-0x15,
-0xe8,
-0x14,
-0xca,
-0x14,
-0xb3,
-0x14,
-0x9b,
-0x14,
-0x84,
-0x14,
-0x6c,
-0x14,
-0x4e,
-0x14,
-0x37,
-0x14,
-0x1d,
-0x14,
-0xf,
-0x14,
-0xed,
-0x13,
-0xda,
-0x13,
-0xbc,
-0x13,
-0xb4,
-0x13,
-0x8e,
-0x13,
-0x78,
-0x13,
-0x55,
-0x13,
-0x37,
-0x13,
-0x21,
-0x13,
-0xc,
-0x13,
-0xf4,
-0x12,
-0xd5,
-0x12,
-0xba,
-0x12,
-0x9e,
-0x12,
-0x83,
-0x12,
-0x67,
-0x12,
-0x43,
-0x12,
-0x1d,
-0x12,
-0xfb,
-0x11,
-0xda,
-0x11,
-0xbf,
-0x11,
-0x98,
-0x11,
-0x79,
-0x11,
-0x52,
-0x11,
-0x2f,
-0x11,
-0x12,
-0x11,
-0xf0,
-0x10,
-0xd5,
-0x10,
-0xaf,
-0x10,
-0x8f,
-0x10,
-0x72,
-0x10,
-0x4b,
-0x10,
-0x2c,
-0x10,
-0x0,
-0x10,
-0xe1,
-0xf,
-0xb7,
-0xf,
-0x95,
-0xf,
-0x72,
-0xf,
-0x50,
-0xf,
-0x2b,
-0xf,
-0x7,
-0xf,
-0xe8,
-0xe,
-0xca,
-0xe,
-0xa0,
-0xe,
-0x81,
-0xe,
-0x56,
-0xe,
-0x34,
-0xe,
-0xb,
-0xe,
-0xe7,
-0xd,
-0xbd,
-0xd,
-0x9e,
-0xd,
-0x75,
-0xd,
-0x53,
-0xd,
-0x2e,
-0xd,
-0xe,
-0xd,
-0xe0,
-0xc,
-0xb8,
-0xc,
-0x91,
-0xc,
-0x72,
-0xc,
-0x4e,
-0xc,
-0x33,
-0xc,
-0xa,
-0xc,
-0xea,
-0xb,
-0xbd,
-0xb,
-0x98,
-0xb,
-0x7b,
-0xb,
-0x54,
-0xb,
-0x2d,
-0xb,
-0x5,
-0xb,
-0xd9,
-0xa,
-0xbc,
-0xa,
-0x93,
-0xa,
-0x68,
-0xa,
-0x40,
-0xa,
-0x1b,
-0xa,
-0xef,
-0x9,
-0xd0,
-0x9,
-0xad,
-0x9,
-0x88,
-0x9,
-0x66,
-0x9,
-0x43,
-0x9,
-0x1b,
-0x9,
-0xf2,
-0x8,
-0xd1,
-0x8,
-0xaf,
-0x8,
-0x89,
-0x8,
-0x67,
-0x8,
-0x3f,
-0x8,
-0x25,
-0x8,
-0xfc,
-0x7,
-0xdb,
-0x7,
-0xbe,
-0x7,
-0x96,
-0x7,
-0x71,
-0x7,
-0x4f,
-0x7,
-0x26,
-0x7,
-0x7,
-0x7,
-0xdf,
-0x6,
-0xbd,
-0x6,
-0x98,
-0x6,
-0x79,
-0x6,
-0x4f,
-0x6,
-0x2f,
-0x6,
-0x4,
-0x6,
-0xde,
-0x5,
-0xb4,
-0x5,
-0x92,
-0x5,
-0x69,
-0x5,
-0x42,
-0x5,
-0x17,
-0x5,
-0xf4,
-0x4,
-0xc9,
-0x4,
-0xad,
-0x4,
-0x81,
-0x4,
-0x5e,
-0x4,
-0x37,
-0x4,
-0x11,
-0x4,
-0xf2,
-0x3,
-0xd2,
-0x3,
-0xad,
-0x3,
-0x83,
-0x3,
-0x5f,
-0x3,
-0x3f,
-0x3,
-0x1c,
-0x3,
-0xfa,
-0x2,
-0xda,
-0x2,
-0xb7,
-0x2,
-0x8d,
-0x2,
-0x68,
-0x2,
-0x40,
-0x2,
-0x18,
-0x2,
-0xf5,
-0x1,
-0xd0,
-0x1,
-0xab,
-0x1,
-0x84,
-0x1,
-0x5c,
-0x1,
-0x3c,
-0x1,
-0x14,
-0x1,
-0xfa,
-0x0,
-0xcd,
-0x0,
-0xb0,
-0x0,
-0x86,
-0x0,
-0x65,
-0x0,
-0x42,
-0x0,
-0x16,
-0x0,
-0xf5,
-0xff,
-0xd1,
-0xff,
-0xab,
-0xff,
-0x84,
-0xff,
-0x62,
-0xff,
-0x41,
-0xff,
-0x1b,
-0xff,
-0xf7,
-0xfe,
-0xd6,
-0xfe,
-0xae,
-0xfe,
-0x82,
-0xfe,
-0x5f,
-0xfe,
-0x3b,
-0xfe,
-0x13,
-0xfe,
-0xe9,
-0xfd,
-0xc3,
-0xfd,
-0x97,
-0xfd,
-0x6d,
-0xfd,
-0x3b,
-0xfd,
-0x18,
-0xfd,
-0xea,
-0xfc,
-0xc6,
-0xfc,
-0x93,
-0xfc,
-0x6a,
-0xfc,
-0x3d,
-0xfc,
-0xe,
-0xfc,
-0xe2,
-0xfb,
-0xb1,
-0xfb,
-0x81,
-0xfb,
-0x4f,
-0xfb,
-0x1c,
-0xfb,
-0xf2,
-0xfa,
-0xc5,
-0xfa,
-0x95,
-0xfa,
-0x66,
-0xfa,
-0x38,
-0xfa,
-0xa,
-0xfa,
-0xde,
-0xf9,
-0xb5,
-0xf9,
-0x81,
-0xf9,
-0x56,
-0xf9,
-0x26,
-0xf9,
-0xf6,
-0xf8,
-0xc6,
-0xf8,
-0x94,
-0xf8,
-0x6a,
-0xf8,
-0x36,
-0xf8,
-0x5,
-0xf8,
-0xd6,
-0xf7,
-0xa1,
-0xf7,
-0x6e,
-0xf7,
-0x40,
-0xf7,
-0xa,
-0xf7,
-0xda,
-0xf6,
-0xa7,
-0xf6,
-0x6d,
-0xf6,
-0x36,
-0xf6,
-0x1,
-0xf6,
-0xcd,
-0xf5,
-0x96,
-0xf5,
-0x5c,
-0xf5,
-0x2e,
-0xf5,
-0xf2,
-0xf4,
-0xbd,
-0xf4,
-0x88,
-0xf4,
-0x4d,
-0xf4,
-0x19,
-0xf4,
-0xdf,
-0xf3,
-0xb0,
-0xf3,
-0x79,
-0xf3,
-0x41,
-0xf3,
-0x11,
-0xf3,
-0xde,
-0xf2,
-0xaf,
-0xf2,
-0x75,
-0xf2,
-0x46,
-0xf2,
-0xf,
-0xf2,
-0xd9,
-0xf1,
-0xa8,
-0xf1,
-0x74,
-0xf1,
-0x3c,
-0xf1,
-0xe,
-0xf1,
-0xdc,
-0xf0,
-0xa8,
-0xf0,
-0x7c,
-0xf0,
-0x4c,
-0xf0,
-0x23,
-0xf0,
-0xf0,
-0xef,
-0xc0,
-0xef,
-0x8c,
-0xef,
-0x66,
-0xef,
-0x2f,
-0xef,
-0xa,
-0xef,
-0xd8,
-0xee,
-0xac,
-0xee,
-0x80,
-0xee,
-0x55,
-0xee,
-0x2c,
-0xee,
-0xff,
-0xed,
-0xd3,
-0xed,
-0xa7,
-0xed,
-0x7c,
-0xed,
-0x54,
-0xed,
-0x26,
-0xed,
-0xfe,
-0xec,
-0xd4,
-0xec,
-0xa4,
-0xec,
-0x78,
-0xec,
-0x53,
-0xec,
-0x28,
-0xec,
-0xfe,
-0xeb,
-0xd3,
-0xeb,
-0xaa,
-0xeb,
-0x83,
-0xeb,
-0x5b,
-0xeb,
-0x30,
-0xeb,
-0xb,
-0xeb,
-0xe2,
-0xea,
-0xc2,
-0xea,
-0x95,
-0xea,
-0x6b,
-0xea,
-0x47,
-0xea,
-0x1d,
-0xea,
-0xfd,
-0xe9,
-0xd7,
-0xe9,
-0xb3,
-0xe9,
-0x94,
-0xe9,
-0x6e,
-0xe9,
-0x4f,
-0xe9,
-0x2b,
-0xe9,
-0xa,
-0xe9,
-0xea,
-0xe8,
-0xcc,
-0xe8,
-0xb0,
-0xe8,
-0x8d,
-0xe8,
-0x77,
-0xe8,
-0x53,
-0xe8,
-0x3e,
-0xe8,
-0x1f,
-0xe8,
-0x9,
-0xe8,
-0xea,
-0xe7,
-0xd2,
-0xe7,
-0xbb,
-0xe7,
-0xab,
-0xe7,
-0x98,
-0xe7,
-0x89,
-0xe7,
-0x70,
-0xe7,
-0x52,
-0xe7,
-0x41,
-0xe7,
-0x2b,
-0xe7,
-0x25,
-0xe7,
-0xc,
-0xe7,
-0xf4,
-0xe6,
-0xe1,
-0xe6,
-0xd3,
-0xe6,
-0xc6,
-0xe6,
-0xb7,
-0xe6,
-0xa6,
-0xe6,
-0x9a,
-0xe6,
-0x8a,
-0xe6,
-0x76,
-0xe6,
-0x68,
-0xe6,
-0x57,
-0xe6,
-0x4b,
-0xe6,
-0x42,
-0xe6,
-0x35,
-0xe6,
-0x28,
-0xe6,
-0x15,
-0xe6,
-0x3,
-0xe6,
-0xfc,
-0xe5,
-0xed,
-0xe5,
-0xe2,
-0xe5,
-0xd3,
-0xe5,
-0xcc,
-0xe5,
-0xc0,
-0xe5,
-0xb7,
-0xe5,
-0xb5,
-0xe5,
-0xac,
-0xe5,
-0xa3,
-0xe5,
-0x95,
-0xe5,
-0x8f,
-0xe5,
-0x80,
-0xe5,
-0x7f,
-0xe5,
-0x77,
-0xe5,
-0x75,
-0xe5,
-0x64,
-0xe5,
-0x59,
-0xe5,
-0x59,
-0xe5,
-0x54,
-0xe5,
-0x4e,
-0xe5,
-0x4c,
-0xe5,
-0x49,
-0xe5,
-0x45,
-0xe5,
-0x3f,
-0xe5,
-0x3b,
-0xe5,
-0x3f,
-0xe5,
-0x3e,
-0xe5,
-0x3a,
-0xe5,
-0x3d,
-0xe5,
-0x3b,
-0xe5,
-0x44,
-0xe5,
-0x42,
-0xe5,
-0x4a,
-0xe5,
-0x45,
-0xe5,
-0x49,
-0xe5,
-0x4b,
-0xe5,
-0x4c,
-0xe5,
-0x4e,
-0xe5,
-0x50,
-0xe5,
-0x51,
-0xe5,
-0x56,
-0xe5,
-0x57,
-0xe5,
-0x56,
-0xe5,
-0x54,
-0xe5,
-0x5d,
-0xe5,
-0x60,
-0xe5,
-0x5a,
-0xe5,
-0x5e,
-0xe5,
-0x5d,
-0xe5,
-0x62,
-0xe5,
-0x66,
-0xe5,
-0x6a,
-0xe5,
-0x6c,
-0xe5,
-0x71,
-0xe5,
-0x71,
-0xe5,
-0x75,
-0xe5,
-0x79,
-0xe5,
-0x7a,
-0xe5,
-0x80,
-0xe5,
-0x7e,
-0xe5,
-0x8a,
-0xe5,
-0x8f,
-0xe5,
-0x99,
-0xe5,
-0xa7,
-0xe5,
-0xa7,
-0xe5,
-0xb1,
-0xe5,
-0xbb,
-0xe5,
-0xcd,
-0xe5,
-0xd7,
-0xe5,
-0xe4,
-0xe5,
-0xf0,
-0xe5,
-0x1,
-0xe6,
-0x11,
-0xe6,
-0x20,
-0xe6,
-0x2f,
-0xe6,
-0x37,
-0xe6,
-0x45,
-0xe6,
-0x49,
-0xe6,
-0x59,
-0xe6,
-0x66,
-0xe6,
-0x69,
-0xe6,
-0x72,
-0xe6,
-0x76,
-0xe6,
-0x81,
-0xe6,
-0x8e,
-0xe6,
-0xa0,
-0xe6,
-0xa4,
-0xe6,
-0xb0,
-0xe6,
-0xb5,
-0xe6,
-0xc4,
-0xe6,
-0xd2,
-0xe6,
-0xe5,
-0xe6,
-0xec,
-0xe6,
-0xff,
-0xe6,
-0xb,
-0xe7,
-0x19,
-0xe7,
-0x22,
-0xe7,
-0x2f,
-0xe7,
-0x42,
-0xe7,
-0x57,
-0xe7,
-0x6d,
-0xe7,
-0x7b,
-0xe7,
-0x90,
-0xe7,
-0x9b,
-0xe7,
-0xae,
-0xe7,
-0xc4,
-0xe7,
-0xd9,
-0xe7,
-0xec,
-0xe7,
-0xfe,
-0xe7,
-0x12,
-0xe8,
-0x26,
-0xe8,
-0x3f,
-0xe8,
-0x56,
-0xe8,
-0x6f,
-0xe8,
-0x84,
-0xe8,
-0x9e,
-0xe8,
-0xb4,
-0xe8,
-0xd3,
-0xe8,
-0xe8,
-0xe8,
-0x2,
-0xe9,
-0x1c,
-0xe9,
-0x34,
-0xe9,
-0x57,
-0xe9,
-0x78,
-0xe9,
-0x92,
-0xe9,
-0xb1,
-0xe9,
-0xd1,
-0xe9,
-0xfb,
-0xe9,
-0x1a,
-0xea,
-0x41,
-0xea,
-0x5b,
-0xea,
-0x81,
-0xea,
-0x9f,
-0xea,
-0xc8,
-0xea,
-0xe8,
-0xea,
-0x15,
-0xeb,
-0x38,
-0xeb,
-0x5e,
-0xeb,
-0x88,
-0xeb,
-0xa9,
-0xeb,
-0xd8,
-0xeb,
-0xfd,
-0xeb,
-0x2a,
-0xec,
-0x4a,
-0xec,
-0x78,
-0xec,
-0x9d,
-0xec,
-0xcb,
-0xec,
-0xf1,
-0xec,
-0x22,
-0xed,
-0x4c,
-0xed,
-0x79,
-0xed,
-0xa2,
-0xed,
-0xd3,
-0xed,
-0xfd,
-0xed,
-0x2e,
-0xee,
-0x52,
-0xee,
-0x86,
-0xee,
-0xb2,
-0xee,
-0xe6,
-0xee,
-0x11,
-0xef,
-0x45,
-0xef,
-0x71,
-0xef,
-0xa7,
-0xef,
-0xce,
-0xef,
-0x1,
-0xf0,
-0x28,
-0xf0,
-0x5d,
-0xf0,
-0x8a,
-0xf0,
-0xbb,
-0xf0,
-0xe7,
-0xf0,
-0x1b,
-0xf1,
-0x4b,
-0xf1,
-0x7f,
-0xf1,
-0xad,
-0xf1,
-0xe3,
-0xf1,
-0xc,
-0xf2,
-0x42,
-0xf2,
-0x6f,
-0xf2,
-0xae,
-0xf2,
-0xe0,
-0xf2,
-0x15,
-0xf3,
-0x46,
-0xf3,
-0x79,
-0xf3,
-0xaa,
-0xf3,
-0xdb,
-0xf3,
-0x17,
-0xf4,
-0x4d,
-0xf4,
-0x7d,
-0xf4,
-0xb5,
-0xf4,
-0xe6,
-0xf4,
-0x19,
-0xf5,
-0x53,
-0xf5,
-0x90,
-0xf5,
-0xc6,
-0xf5,
-0xff,
-0xf5,
-0x35,
-0xf6,
-0x73,
-0xf6,
-0xaa,
-0xf6,
-0xe2,
-0xf6,
-0x17,
-0xf7,
-0x51,
-0xf7,
-0x82,
-0xf7,
-0xb9,
-0xf7,
-0xf4,
-0xf7,
-0x25,
-0xf8,
-0x5b,
-0xf8,
-0x91,
-0xf8,
-0xcb,
-0xf8,
-0x4,
-0xf9,
-0x37,
-0xf9,
-0x69,
-0xf9,
-0xa2,
-0xf9,
-0xd2,
-0xf9,
-0x9,
-0xfa,
-0x37,
-0xfa,
-0x6a,
-0xfa,
-0x99,
-0xfa,
-0xc3,
-0xfa,
-0xf7,
-0xfa,
-0x20,
-0xfb,
-0x54,
-0xfb,
-0x7c,
-0xfb,
-0xa9,
-0xfb,
-0xd3,
-0xfb,
-0xff,
-0xfb,
-0x28,
-0xfc,
-0x5d,
-0xfc,
-0x7e,
-0xfc,
-0xaa,
-0xfc,
-0xd2,
-0xfc,
-0x1,
-0xfd,
-0x2d,
-0xfd,
-0x52,
-0xfd,
-0x83,
-0xfd,
-0xa1,
-0xfd,
-0xd1,
-0xfd,
-0xf8,
-0xfd,
-0x20,
-0xfe,
-0x52,
-0xfe,
-0x73,
-0xfe,
-0xa3,
-0xfe,
-0xc8,
-0xfe,
-0xf4,
-0xfe,
-0x1b,
-0xff,
-0x3d,
-0xff,
-0x63,
-0xff,
-0x7e,
-0xff,
-0xaa,
-0xff,
-0xc5,
-0xff,
-0xf1,
-0xff,
-0xc,
-0x0,
-0x3a,
-0x0,
-0x5c,
-0x0,
-0x88,
-0x0,
-0xaf,
-0x0,
-0xcd,
-0x0,
-0xf1,
-0x0,
-0x14,
-0x1,
-0x36,
-0x1,
-0x58,
-0x1,
-0x78,
-0x1,
-0x9c,
-0x1,
-0xbf,
-0x1,
-0xd9,
-0x1,
-0xf7,
-0x1,
-0x13,
-0x2,
-0x36,
-0x2,
-0x4f,
-0x2,
-0x6e,
-0x2,
-0x8a,
-0x2,
-0xa2,
-0x2,
-0xc5,
-0x2,
-0xe1,
-0x2,
-0xf2,
-0x2,
-0x12,
-0x3,
-0x26,
-0x3,
-0x40,
-0x3,
-0x53,
-0x3,
-0x6d,
-0x3,
-0x89,
-0x3,
-0x99,
-0x3,
-0xb0,
-0x3,
-0xc0,
-0x3,
-0xdc,
-0x3,
-0xef,
-0x3,
-0xfd,
-0x3,
-0x14,
-0x4,
-0x1f,
-0x4,
-0x36,
-0x4,
-0x4b,
-0x4,
-0x5f,
-0x4,
-0x6f,
-0x4,
-0x80,
-0x4,
-0x91,
-0x4,
-0x9e,
-0x4,
-0xb1,
-0x4,
-0xc8,
-0x4,
-0xdb,
-0x4,
-0xee,
-0x4,
-0x3,
-0x5,
-0x13,
-0x5,
-0x2c,
-0x5,
-0x42,
-0x5,
-0x50,
-0x5,
-0x64,
-0x5,
-0x7d,
-0x5,
-0x8c,
-0x5,
-0xa5,
-0x5,
-0xb7,
-0x5,
-0xd0,
-0x5,
-0xe7,
-0x5,
-0xf9,
-0x5,
-0xc,
-0x6,
-0x22,
-0x6,
-0x38,
-0x6,
-0x4c,
-0x6,
-0x60,
-0x6,
-0x74,
-0x6,
-0x8b,
-0x6,
-0xa3,
-0x6,
-0xb9,
-0x6,
-0xd0,
-0x6,
-0xdf,
-0x6,
-0xf3,
-0x6,
-0xfd,
-0x6,
-0x13,
-0x7,
-0x20,
-0x7,
-0x3d,
-0x7,
-0x4a,
-0x7,
-0x61,
-0x7,
-0x72,
-0x7,
-0x88,
-0x7,
-0x98,
-0x7,
-0xab,
-0x7,
-0xbc,
-0x7,
-0xd1,
-0x7,
-0xe5,
-0x7,
-0xf9,
-0x7,
-0x14,
-0x8,
-0x26,
-0x8,
-0x3c,
-0x8,
-0x59,
-0x8,
-0x6f,
-0x8,
-0x85,
-0x8,
-0x9c,
-0x8,
-0xb5,
-0x8,
-0xce,
-0x8,
-0xe5,
-0x8,
-0x1,
-0x9,
-0x18,
-0x9,
-0x3f,
-0x9,
-0x5f,
-0x9,
-0x74,
-0x9,
-0x93,
-0x9,
-0xac,
-0x9,
-0xca,
-0x9,
-0xe8,
-0x9,
-0x6,
-0xa,
-0x1e,
-0xa,
-0x3a,
-0xa,
-0x58,
-0xa,
-0x6c,
-0xa,
-0x91,
-0xa,
-0xa7,
-0xa,
-0xc0,
-0xa,
-0xdb,
-0xa,
-0xf7,
-0xa,
-0x12,
-0xb,
-0x2d,
-0xb,
-0x45,
-0xb,
-0x63,
-0xb,
-0x81,
-0xb,
-0x9a,
-0xb,
-0xb8,
-0xb,
-0xd2,
-0xb,
-0xf2,
-0xb,
-0xe,
-0xc,
-0x27,
-0xc,
-0x37,
-0xc,
-0x55,
-0xc,
-0x72,
-0xc,
-0x8c,
-0xc,
-0xaf,
-0xc,
-0xca,
-0xc,
-0xe3,
-0xc,
-0xfa,
-0xc,
-0xa,
-0xd,
-0x2a,
-0xd,
-0x42,
-0xd,
-0x5f,
-0xd,
-0x79,
-0xd,
-0x93,
-0xd,
-0xb0,
-0xd,
-0xc7,
-0xd,
-0xea,
-0xd,
-0xf9,
-0xd,
-0x18,
-0xe,
-0x2e,
-0xe,
-0x47,
-0xe,
-0x62,
-0xe,
-0x76,
-0xe,
-0x90,
-0xe,
-0xa8,
-0xe,
-0xc1,
-0xe,
-0xd8,
-0xe,
-0xf1,
-0xe,
-0x6,
-0xf,
-0x21,
-0xf,
-0x37,
-0xf,
-0x4f,
-0xf,
-0x66,
-0xf,
-0x7c,
-0xf,
-0x93,
-0xf,
-0xa9,
-0xf,
-0xc3,
-0xf,
-0xdb,
-0xf,
-0xf3,
-0xf,
-0xf,
-0x10,
-0x1a,
-0x10,
-0x35,
-0x10,
-0x47,
-0x10,
-0x65,
-0x10,
-0x78,
-0x10,
-0x8f,
-0x10,
-0xa3,
-0x10,
-0xbb,
-0x10,
-0xce,
-0x10,
-0xe3,
-0x10,
-0xf5,
-0x10,
-0x4,
-0x11,
-0x16,
-0x11,
-0x23,
-0x11,
-0x2e,
-0x11,
-0x47,
-0x11,
-0x58,
-0x11,
-0x6c,
-0x11,
-0x74,
-0x11,
-0x81,
-0x11,
-0x8e,
-0x11,
-0x9d,
-0x11,
-0xab,
-0x11,
-0xbc,
-0x11,
-0xc3,
-0x11,
-0xd4,
-0x11,
-0xdf,
-0x11,
-0xe9,
-0x11,
-0xf4,
-0x11,
-0xff,
-0x11,
-0x5,
-0x12,
-0xf,
-0x12,
-0x15,
-0x12,
-0x20,
-0x12,
-0x22,
-0x12,
-0x30,
-0x12,
-0x32,
-0x12,
-0x36,
-0x12,
-0x3f,
-0x12,
-0x42,
-0x12,
-0x4c,
-0x12,
-0x4b,
-0x12,
-0x56,
-0x12,
-0x62,
-0x12,
-0x61,
-0x12,
-0x65,
-0x12,
-0x64,
-0x12,
-0x6d,
-0x12,
-0x69,
-0x12,
-0x75,
-0x12,
-0x6d,
-0x12,
-0x6e,
-0x12,
-0x6d,
-0x12,
-0x72,
-0x12,
-0x6f,
-0x12,
-0x6f,
-0x12,
-0x64,
-0x12,
-0x63,
-0x12,
-0x62,
-0x12,
-0x5a,
-0x12,
-0x59,
-0x12,
-0x51,
-0x12,
-0x53,
-0x12,
-0x45,
-0x12,
-0x3f,
-0x12,
-0x30,
-0x12,
-0x32,
-0x12,
-0x27,
-0x12,
-0x1f,
-0x12,
-0xb,
-0x12,
-0x9,
-0x12,
-0xf4,
-0x11,
-0xf3,
-0x11,
-0xe2,
-0x11,
-0xd4,
-0x11,
-0xc0,
-0x11,
-0xb0,
-0x11,
-0x9d,
-0x11,
-0x92,
-0x11,
-0x85,
-0x11,
-0x74,
-0x11,
-0x6b,
-0x11,
-0x5a,
-0x11,
-0x51,
-0x11,
-0x43,
-0x11,
-0x32,
-0x11,
-0x28,
-0x11,
-0x1b,
-0x11,
-0x11,
-0x11,
-0x8,
-0x11,
-0xfa,
-0x10,
-0xf0,
-0x10,
-0xdf,
-0x10,
-0xd9,
-0x10,
-0xca,
-0x10,
-0xc5,
-0x10,
-0xb9,
-0x10,
-0xb0,
-0x10,
-0xa4,
-0x10,
-0x93,
-0x10,
-0x8d,
-0x10,
-0x7d,
-0x10,
-0x6e,
-0x10,
-0x66,
-0x10,
-0x52,
-0x10,
-0x4d,
-0x10,
-0x35,
-0x10,
-0x28,
-0x10,
-0x21,
-0x10,
-0xd,
-0x10,
-0x4,
-0x10,
-0xf2,
-0xf,
-0xeb,
-0xf,
-0xd7,
-0xf,
-0xc8,
-0xf,
-0xb6,
-0xf,
-0xab,
-0xf,
-0x99,
-0xf,
-0x8e,
-0xf,
-0x78,
-0xf,
-0x67,
-0xf,
-0x59,
-0xf,
-0x4f,
-0xf,
-0x43,
-0xf,
-0x39,
-0xf,
-0x2c,
-0xf,
-0x1c,
-0xf,
-0x18,
-0xf,
-0x8,
-0xf,
-0xfe,
-0xe,
-0xf0,
-0xe,
-0xe4,
-0xe,
-0xd3,
-0xe,
-0xc9,
-0xe,
-0xbc,
-0xe,
-0xaa,
-0xe,
-0x9e,
-0xe,
-0x8b,
-0xe,
-0x79,
-0xe,
-0x6a,
-0xe,
-0x60,
-0xe,
-0x53,
-0xe,
-0x47,
-0xe,
-0x3d,
-0xe,
-0x2c,
-0xe,
-0x1b,
-0xe,
-0x16,
-0xe,
-0x2,
-0xe,
-0xf6,
-0xd,
-0xee,
-0xd,
-0xe6,
-0xd,
-0xdc,
-0xd,
-0xd0,
-0xd,
-0xca,
-0xd,
-0xc0,
-0xd,
-0xbe,
-0xd,
-0xb0,
-0xd,
-0xb0,
-0xd,
-0xa9,
-0xd,
-0x9b,
-0xd,
-0x93,
-0xd,
-0x7e,
-0xd,
-0x79,
-0xd,
-0x67,
-0xd,
-0x5f,
-0xd,
-0x53,
-0xd,
-0x41,
-0xd,
-0x36,
-0xd,
-0x2a,
-0xd,
-0x17,
-0xd,
-0xe,
-0xd,
-0x1,
-0xd,
-0xf6,
-0xc,
-0xe9,
-0xc,
-0xd4,
-0xc,
-0xc7,
-0xc,
-0xbe,
-0xc,
-0xaf,
-0xc,
-0xac,
-0xc,
-0x99,
-0xc,
-0x8e,
-0xc,
-0x83,
-0xc,
-0x7a,
-0xc,
-0x69,
-0xc,
-0x5a,
-0xc,
-0x4a,
-0xc,
-0x38,
-0xc,
-0x2f,
-0xc,
-0x20,
-0xc,
-0x14,
-0xc,
-0x5,
-0xc,
-0xf8,
-0xb,
-0xe2,
-0xb,
-0xd7,
-0xb,
-0xba,
-0xb,
-0xaf,
-0xb,
-0xa4,
-0xb,
-0x93,
-0xb,
-0x7a,
-0xb,
-0x64,
-0xb,
-0x53,
-0xb,
-0x41,
-0xb,
-0x32,
-0xb,
-0x1d,
-0xb,
-0xc,
-0xb,
-0xfa,
-0xa,
-0xe1,
-0xa,
-0xcd,
-0xa,
-0xb5,
-0xa,
-0xa4,
-0xa,
-0x8d,
-0xa,
-0x7b,
-0xa,
-0x63,
-0xa,
-0x4e,
-0xa,
-0x37,
-0xa,
-0x21,
-0xa,
-0xf,
-0xa,
-0xfa,
-0x9,
-0xe2,
-0x9,
-0xd2,
-0x9,
-0xbe,
-0x9,
-0xa8,
-0x9,
-0x99,
-0x9,
-0x86,
-0x9,
-0x74,
-0x9,
-0x5d,
-0x9,
-0x45,
-0x9,
-0x2f,
-0x9,
-0x19,
-0x9,
-0x8,
-0x9,
-0xed,
-0x8,
-0xdc,
-0x8,
-0xc3,
-0x8,
-0xb0,
-0x8,
-0x94,
-0x8,
-0x82,
-0x8,
-0x6d,
-0x8,
-0x5a,
-0x8,
-0x49,
-0x8,
-0x32,
-0x8,
-0x1d,
-0x8,
-0x4,
-0x8,
-0xf5,
-0x7,
-0xe3,
-0x7,
-0xc4,
-0x7,
-0xb4,
-0x7,
-0x98,
-0x7,
-0x85,
-0x7,
-0x6d,
-0x7,
-0x56,
-0x7,
-0x3f,
-0x7,
-0x25,
-0x7,
-0xe,
-0x7,
-0xf6,
-0x6,
-0xdd,
-0x6,
-0xc5,
-0x6,
-0xb4,
-0x6,
-0x94,
-0x6,
-0x7d,
-0x6,
-0x65,
-0x6,
-0x4d,
-0x6,
-0x39,
-0x6,
-0x1c,
-0x6,
-0x4,
-0x6,
-0xee,
-0x5,
-0xd7,
-0x5,
-0xc2,
-0x5,
-0xa2,
-0x5,
-0x94,
-0x5,
-0x79,
-0x5,
-0x6b,
-0x5,
-0x4b,
-0x5,
-0x38,
-0x5,
-0x1d,
-0x5,
-0xa,
-0x5,
-0xed,
-0x4,
-0xd9,
-0x4,
-0xb9,
-0x4,
-0xa6,
-0x4,
-0x8d,
-0x4,
-0x84,
-0x4,
-0x64,
-0x4,
-0x54,
-0x4,
-0x35,
-0x4,
-0x23,
-0x4,
-0x9,
-0x4,
-0xf5,
-0x3,
-0xdb,
-0x3,
-0xc8,
-0x3,
-0xb1,
-0x3,
-0xa3,
-0x3,
-0x8b,
-0x3,
-0x71,
-0x3,
-0x5c,
-0x3,
-0x44,
-0x3,
-0x2c,
-0x3,
-0x1c,
-0x3,
-0xc,
-0x3,
-0xfe,
-0x2,
-0xef,
-0x2,
-0xde,
-0x2,
-0xcb,
-0x2,
-0xbc,
-0x2,
-0xae,
-0x2,
-0x9f,
-0x2,
-0x91,
-0x2,
-0x7a,
-0x2,
-0x6c,
-0x2,
-0x60,
-0x2,
-0x4f,
-0x2,
-0x42,
-0x2,
-0x38,
-0x2,
-0x24,
-0x2,
-0x15,
-0x2,
-0x8,
-0x2,
-0xfb,
-0x1,
-0xee,
-0x1,
-0xe5,
-0x1,
-0xd2,
-0x1,
-0xcf,
-0x1,
-0xc1,
-0x1,
-0xb8,
-0x1,
-0xaa,
-0x1,
-0x9e,
-0x1,
-0x9a,
-0x1,
-0x8f,
-0x1,
-0x89,
-0x1,
-0x81,
-0x1,
-0x7f,
-0x1,
-0x75,
-0x1,
-0x6f,
-0x1,
-0x6b,
-0x1,
-0x66,
-0x1,
-0x62,
-0x1,
-0x53,
-0x1,
-0x51,
-0x1,
-0x48,
-0x1,
-0x4a,
-0x1,
-0x47,
-0x1,
-0x42,
-0x1,
-0x41,
-0x1,
-0x41,
-0x1,
-0x3c,
-0x1,
-0x31,
-0x1,
-0x35,
-0x1,
-0x28,
-0x1,
-0x2c,
-0x1,
-0x29,
-0x1,
-0x2b,
-0x1,
-0x27,
-0x1,
-0x28,
-0x1,
-0x21,
-0x1,
-0x27,
-0x1,
-0x26,
-0x1,
-0x25,
-0x1,
-0x27,
-0x1,
-0x24,
-0x1,
-0x23,
-0x1,
-0x20,
-0x1,
-0x25,
-0x1,
-0x24,
-0x1,
-0x23,
-0x1,
-0x22,
-0x1,
-0x1f,
-0x1,
-0x1d,
-0x1,
-0x18,
-0x1,
-0x17,
-0x1,
-0x1e,
-0x1,
-0x19,
-0x1,
-0x1a,
-0x1,
-0x1d,
-0x1,
-0x1e,
-0x1,
-0x1f,
-0x1,
-0x1f,
-0x1,
-0x24,
-0x1,
-0x28,
-0x1,
-0x2b,
-0x1,
-0x2c,
-0x1,
-0x2f,
-0x1,
-0x2f,
-0x1,
-0x36,
-0x1,
-0x36,
-0x1,
-0x3b,
-0x1,
-0x41,
-0x1,
-0x43,
-0x1,
-0x4c,
-0x1,
-0x4c,
-0x1,
-0x56,
-0x1,
-0x5a,
-0x1,
-0x63,
-0x1,
-0x65,
-0x1,
-0x6a,
-0x1,
-0x6d,
-0x1,
-0x74,
-0x1,
-0x7b,
-0x1,
-0x82,
-0x1,
-0x88,
-0x1,
-0x8c,
-0x1,
-0x96,
-0x1,
-0x9e,
-0x1,
-0xa9,
-0x1,
-0xac,
-0x1,
-0xb6,
-0x1,
-0xb8,
-0x1,
-0xc3,
-0x1,
-0xc2,
-0x1,
-0xcc,
-0x1,
-0xd4,
-0x1,
-0xd2,
-0x1,
-0xdb,
-0x1,
-0xd5,
-0x1,
-0xdb,
-0x1,
-0xdb,
-0x1,
-0xdf,
-0x1,
-0xe4,
-0x1,
-0xe1,
-0x1,
-0xe8,
-0x1,
-0xe4,
-0x1,
-0xea,
-0x1,
-0xee,
-0x1,
-0xf7,
-0x1,
-0xf4,
-0x1,
-0xfb,
-0x1,
-0x0,
-0x2,
-0xfb,
-0x1,
-0x9,
-0x2,
-0xc,
-0x2,
-0x12,
-0x2,
-0x18,
-0x2,
-0x17,
-0x2,
-0x25,
-0x2,
-0x2b,
-0x2,
-0x3b,
-0x2,
-0x41,
-0x2,
-0x48,
-0x2,
-0x4f,
-0x2,
-0x51,
-0x2,
-0x63,
-0x2,
-0x64,
-0x2,
-0x71,
-0x2,
-0x74,
-0x2,
-0x83,
-0x2,
-0x8e,
-0x2,
-0x94,
-0x2,
-0x9f,
-0x2,
-0xa3,
-0x2,
-0xac,
-0x2,
-0xae,
-0x2,
-0xb6,
-0x2,
-0xb9,
-0x2,
-0xbe,
-0x2,
-0xbc,
-0x2,
-0xc4,
-0x2,
-0xc4,
-0x2,
-0xcb,
-0x2,
-0xc9,
-0x2,
-0xd0,
-0x2,
-0xd1,
-0x2,
-0xd7,
-0x2,
-0xd1,
-0x2,
-0xd9,
-0x2,
-0xd5,
-0x2,
-0xdd,
-0x2,
-0xdd,
-0x2,
-0xde,
-0x2,
-0xe2,
-0x2,
-0xe7,
-0x2,
-0xe5,
-0x2,
-0xeb,
-0x2,
-0xe6,
-0x2,
-0xef,
-0x2,
-0xf0,
-0x2,
-0xf1,
-0x2,
-0xf5,
-0x2,
-0xf6,
-0x2,
-0x0,
-0x3,
-0xff,
-0x2,
-0x4,
-0x3,
-0x7,
-0x3,
-0x6,
-0x3,
-0x7,
-0x3,
-0xa,
-0x3,
-0x6,
-0x3,
-0xc,
-0x3,
-0xb,
-0x3,
-0x11,
-0x3,
-0x14,
-0x3,
-0x14,
-0x3,
-0xf,
-0x3,
-0x15,
-0x3,
-0x13,
-0x3,
-0x14,
-0x3,
-0x14,
-0x3,
-0xd,
-0x3,
-0x9,
-0x3,
-0x4,
-0x3,
-0x2,
-0x3,
-0x6,
-0x3,
-0x0,
-0x3,
-0xfc,
-0x2,
-0xf4,
-0x2,
-0xf0,
-0x2,
-0xf4,
-0x2,
-0xec,
-0x2,
-0xe8,
-0x2,
-0xe2,
-0x2,
-0xe0,
-0x2,
-0xd5,
-0x2,
-0xd2,
-0x2,
-0xca,
-0x2,
-0xc8,
-0x2,
-0xc2,
-0x2,
-0xba,
-0x2,
-0xaf,
-0x2,
-0xaf,
-0x2,
-0xa5,
-0x2,
-0xa7,
-0x2,
-0x9e,
-0x2,
-0x98,
-0x2,
-0x99,
-0x2,
-0x8f,
-0x2,
-0x90,
-0x2,
-0x8c,
-0x2,
-0x86,
-0x2,
-0x82,
-0x2,
-0x80,
-0x2,
-0x7c,
-0x2,
-0x72,
-0x2,
-0x75,
-0x2,
-0x6c,
-0x2,
-0x6c,
-0x2,
-0x62,
-0x2,
-0x64,
-0x2,
-0x56,
-0x2,
-0x5b,
-0x2,
-0x4a,
-0x2,
-0x4a,
-0x2,
-0x3a,
-0x2,
-0x38,
-0x2,
-0x30,
-0x2,
-0x28,
-0x2,
-0x1b,
-0x2,
-0x17,
-0x2,
-0x7,
-0x2,
-0x1,
-0x2,
-0xfa,
-0x1,
-0xeb,
-0x1,
-0xe6,
-0x1,
-0xd4,
-0x1,
-0xc8,
-0x1,
-0xbd,
-0x1,
-0xaf,
-0x1,
-0xa3,
-0x1,
-0x98,
-0x1,
-0x8e,
-0x1,
-0x81,
-0x1,
-0x6e,
-0x1,
-0x67,
-0x1,
-0x5b,
-0x1,
-0x4d,
-0x1,
-0x3b,
-0x1,
-0x2f,
-0x1,
-0x1e,
-0x1,
-0x16,
-0x1,
-0x6,
-0x1,
-0x0,
-0x1,
-0xf4,
-0x0,
-0xe8,
-0x0,
-0xd7,
-0x0,
-0xcf,
-0x0,
-0xc0,
-0x0,
-0xb6,
-0x0,
-0xa4,
-0x0,
-0x9b,
-0x0,
-0x8a,
-0x0,
-0x7a,
-0x0,
-0x69,
-0x0,
-0x56,
-0x0,
-0x41,
-0x0,
-0x34,
-0x0,
-0x1e,
-0x0,
-0x12,
-0x0,
-0x2,
-0x0,
-0xee,
-0xff,
-0xdc,
-0xff,
-0xc4,
-0xff,
-0xb3,
-0xff,
-0x9a,
-0xff,
-0x87,
-0xff,
-0x6f,
-0xff,
-0x5a,
-0xff,
-0x3f,
-0xff,
-0x2e,
-0xff,
-0x17,
-0xff,
-0xfc,
-0xfe,
-0xe3,
-0xfe,
-0xcf,
-0xfe,
-0xb3,
-0xfe,
-0x99,
-0xfe,
-0x83,
-0xfe,
-0x64,
-0xfe,
-0x4f,
-0xfe,
-0x31,
-0xfe,
-0x1c,
-0xfe,
-0x0,
-0xfe,
-0xe5,
-0xfd,
-0xcc,
-0xfd,
-0xa8,
-0xfd,
-0x94,
-0xfd,
-0x75,
-0xfd,
-0x63,
-0xfd,
-0x48,
-0xfd,
-0x2b,
-0xfd,
-0x10,
-0xfd,
-0xf3,
-0xfc,
-0xe1,
-0xfc,
-0xc2,
-0xfc,
-0xa5,
-0xfc,
-0x8a,
-0xfc,
-0x69,
-0xfc,
-0x4e,
-0xfc,
-0x2d,
-0xfc,
-0x1c,
-0xfc,
-0xff,
-0xfb,
-0xe7,
-0xfb,
-0xce,
-0xfb,
-0xb2,
-0xfb,
-0x9b,
-0xfb,
-0x7b,
-0xfb,
-0x61,
-0xfb,
-0x49,
-0xfb,
-0x24,
-0xfb,
-0xd,
-0xfb,
-0xeb,
-0xfa,
-0xcd,
-0xfa,
-0xb4,
-0xfa,
-0x94,
-0xfa,
-0x75,
-0xfa,
-0x55,
-0xfa,
-0x3a,
-0xfa,
-0x1a,
-0xfa,
-0x2,
-0xfa,
-0xe3,
-0xf9,
-0xcb,
-0xf9,
-0xaf,
-0xf9,
-0x9a,
-0xf9,
-0x7e,
-0xf9,
-0x61,
-0xf9,
-0x48,
-0xf9,
-0x2c,
-0xf9,
-0x17,
-0xf9,
-0xef,
-0xf8,
-0xdc,
-0xf8,
-0xbe,
-0xf8,
-0xac,
-0xf8,
-0x90,
-0xf8,
-0x77,
-0xf8,
-0x5c,
-0xf8,
-0x45,
-0xf8,
-0x34,
-0xf8,
-0xe,
-0xf8,
-0xfa,
-0xf7,
-0xdd,
-0xf7,
-0xca,
-0xf7,
-0xae,
-0xf7,
-0x9a,
-0xf7,
-0x7e,
-0xf7,
-0x73,
-0xf7,
-0x58,
-0xf7,
-0x4a,
-0xf7,
-0x35,
-0xf7,
-0x21,
-0xf7,
-0xf,
-0xf7,
-0x0,
-0xf7,
-0xe7,
-0xf6,
-0xd5,
-0xf6,
-0xc3,
-0xf6,
-0xae,
-0xf6,
-0x99,
-0xf6,
-0x81,
-0xf6,
-0x6c,
-0xf6,
-0x5a,
-0xf6,
-0x48,
-0xf6,
-0x34,
-0xf6,
-0x22,
-0xf6,
-0x16,
-0xf6,
-0xfc,
-0xf5,
-0xf1,
-0xf5,
-0xdc,
-0xf5,
-0xd0,
-0xf5,
-0xbe,
-0xf5,
-0xae,
-0xf5,
-0xa1,
-0xf5,
-0x8d,
-0xf5,
-0x83,
-0xf5,
-0x77,
-0xf5,
-0x65,
-0xf5,
-0x5a,
-0xf5,
-0x47,
-0xf5,
-0x41,
-0xf5,
-0x2e,
-0xf5,
-0x2a,
-0xf5,
-0x1c,
-0xf5,
-0xf,
-0xf5,
-0x4,
-0xf5,
-0xf4,
-0xf4,
-0xf4,
-0xf4,
-0xe2,
-0xf4,
-0xe1,
-0xf4,
-0xd8,
-0xf4,
-0xd0,
-0xf4,
-0xc9,
-0xf4,
-0xbe,
-0xf4,
-0xb5,
-0xf4,
-0xb0,
-0xf4,
-0xab,
-0xf4,
-0xaa,
-0xf4,
-0xa5,
-0xf4,
-0xa0,
-0xf4,
-0x9e,
-0xf4,
-0xa1,
-0xf4,
-0x9a,
-0xf4,
-0x9a,
-0xf4,
-0x9f,
-0xf4,
-0x99,
-0xf4,
-0x9e,
-0xf4,
-0x9b,
-0xf4,
-0xa0,
-0xf4,
-0x99,
-0xf4,
-0x98,
-0xf4,
-0x97,
-0xf4,
-0x93,
-0xf4,
-0x94,
-0xf4,
-0x93,
-0xf4,
-0x91,
-0xf4,
-0x93,
-0xf4,
-0x8f,
-0xf4,
-0x8b,
-0xf4,
-0x8b,
-0xf4,
-0x8a,
-0xf4,
-0x95,
-0xf4,
-0x96,
-0xf4,
-0x9f,
-0xf4,
-0xa2,
-0xf4,
-0x9c,
-0xf4,
-0xa9,
-0xf4,
-0xa4,
-0xf4,
-0xb5,
-0xf4,
-0xb2,
-0xf4,
-0xbf,
-0xf4,
-0xbd,
-0xf4,
-0xc6,
-0xf4,
-0xca,
-0xf4,
-0xd5,
-0xf4,
-0xd8,
-0xf4,
-0xdc,
-0xf4,
-0xe6,
-0xf4,
-0xed,
-0xf4,
-0xf3,
-0xf4,
-0xfa,
-0xf4,
-0x2,
-0xf5,
-0x5,
-0xf5,
-0x10,
-0xf5,
-0x15,
-0xf5,
-0x18,
-0xf5,
-0x25,
-0xf5,
-0x22,
-0xf5,
-0x30,
-0xf5,
-0x36,
-0xf5,
-0x3f,
-0xf5,
-0x4c,
-0xf5,
-0x53,
-0xf5,
-0x5a,
-0xf5,
-0x61,
-0xf5,
-0x61,
-0xf5,
-0x71,
-0xf5,
-0x6a,
-0xf5,
-0x71,
-0xf5,
-0x75,
-0xf5,
-0x75,
-0xf5,
-0x7d,
-0xf5,
-0x7a,
-0xf5,
-0x88,
-0xf5,
-0x86,
-0xf5,
-0x90,
-0xf5,
-0x90,
-0xf5,
-0xa1,
-0xf5,
-0xa6,
-0xf5,
-0xb5,
-0xf5,
-0xbb,
-0xf5,
-0xc1,
-0xf5,
-0xcc,
-0xf5,
-0xd3,
-0xf5,
-0xdf,
-0xf5,
-0xe6,
-0xf5,
-0xf2,
-0xf5,
-0xf7,
-0xf5,
-0x3,
-0xf6,
-0xa,
-0xf6,
-0x10,
-0xf6,
-0x19,
-0xf6,
-0x24,
-0xf6,
-0x35,
-0xf6,
-0x37,
-0xf6,
-0x45,
-0xf6,
-0x45,
-0xf6,
-0x48,
-0xf6,
-0x58,
-0xf6,
-0x55,
-0xf6,
-0x61,
-0xf6,
-0x62,
-0xf6,
-0x75,
-0xf6,
-0x77,
-0xf6,
-0x8e,
-0xf6,
-0x8c,
-0xf6,
-0x98,
-0xf6,
-0x9b,
-0xf6,
-0xa4,
-0xf6,
-0xad,
-0xf6,
-0xb9,
-0xf6,
-0xbe,
-0xf6,
-0xc9,
-0xf6,
-0xd1,
-0xf6,
-0xe1,
-0xf6,
-0xe8,
-0xf6,
-0xf3,
-0xf6,
-0xfd,
-0xf6,
-0x8,
-0xf7,
-0x1c,
-0xf7,
-0x25,
-0xf7,
-0x30,
-0xf7,
-0x37,
-0xf7,
-0x46,
-0xf7,
-0x43,
-0xf7,
-0x58,
-0xf7,
-0x57,
-0xf7,
-0x6c,
-0xf7,
-0x6f,
-0xf7,
-0x81,
-0xf7,
-0x84,
-0xf7,
-0x91,
-0xf7,
-0x9e,
-0xf7,
-0xb4,
-0xf7,
-0xb8,
-0xf7,
-0xc7,
-0xf7,
-0xd6,
-0xf7,
-0xe3,
-0xf7,
-0xf7,
-0xf7,
-0xfe,
-0xf7,
-0xe,
-0xf8,
-0x18,
-0xf8,
-0x28,
-0xf8,
-0x3b,
-0xf8,
-0x46,
-0xf8,
-0x53,
-0xf8,
-0x62,
-0xf8,
-0x6e,
-0xf8,
-0x7f,
-0xf8,
-0x93,
-0xf8,
-0x9e,
-0xf8,
-0xab,
-0xf8,
-0xb9,
-0xf8,
-0xc9,
-0xf8,
-0xdd,
-0xf8,
-0xeb,
-0xf8,
-0xfc,
-0xf8,
-0xb,
-0xf9,
-0x1b,
-0xf9,
-0x2e,
-0xf9,
-0x44,
-0xf9,
-0x5b,
-0xf9,
-0x6b,
-0xf9,
-0x83,
-0xf9,
-0x99,
-0xf9,
-0xab,
-0xf9,
-0xb8,
-0xf9,
-0xd1,
-0xf9,
-0xe2,
-0xf9,
-0xf9,
-0xf9,
-0x8,
-0xfa,
-0x1e,
-0xfa,
-0x2d,
-0xfa,
-0x4b,
-0xfa,
-0x57,
-0xfa,
-0x6f,
-0xfa,
-0x7a,
-0xfa,
-0x92,
-0xfa,
-0xa9,
-0xfa,
-0xbc,
-0xfa,
-0xd2,
-0xfa,
-0xe6,
-0xfa,
-0xfe,
-0xfa,
-0xc,
-0xfb,
-0x24,
-0xfb,
-0x31,
-0xfb,
-0x4f,
-0xfb,
-0x62,
-0xfb,
-0x75,
-0xfb,
-0x90,
-0xfb,
-0x9e,
-0xfb,
-0xb4,
-0xfb,
-0xc5,
-0xfb,
-0xdd,
-0xfb,
-0xec,
-0xfb,
-0x8,
-0xfc,
-0x13,
-0xfc,
-0x29,
-0xfc,
-0x2f,
-0xfc,
-0x45,
-0xfc,
-0x55,
-0xfc,
-0x68,
-0xfc,
-0x73,
-0xfc,
-0x7a,
-0xfc,
-0x94,
-0xfc,
-0x9b,
-0xfc,
-0xab,
-0xfc,
-0xb3,
-0xfc,
-0xbd,
-0xfc,
-0xd1,
-0xfc,
-0xdc,
-0xfc,
-0xea,
-0xfc,
-0xf0,
-0xfc,
-0x0,
-0xfd,
-0xa,
-0xfd,
-0x1d,
-0xfd,
-0x2a,
-0xfd,
-0x3b,
-0xfd,
-0x44,
-0xfd,
-0x4e,
-0xfd,
-0x5a,
-0xfd,
-0x65,
-0xfd,
-0x72,
-0xfd,
-0x84,
-0xfd,
-0x8d,
-0xfd,
-0x98,
-0xfd,
-0xa5,
-0xfd,
-0xaf,
-0xfd,
-0xb6,
-0xfd,
-0xc2,
-0xfd,
-0xc5,
-0xfd,
-0xd3,
-0xfd,
-0xd7,
-0xfd,
-0xe1,
-0xfd,
-0xea,
-0xfd,
-0xf4,
-0xfd,
-0xf5,
-0xfd,
-0xff,
-0xfd,
-0x2,
-0xfe,
-0xb,
-0xfe,
-0xa,
-0xfe,
-0x12,
-0xfe,
-0xb,
-0xfe,
-0x13,
-0xfe,
-0x10,
-0xfe,
-0x10,
-0xfe,
-0x1c,
-0xfe,
-0x19,
-0xfe,
-0x20,
-0xfe,
-0x1c,
-0xfe,
-0x1f,
-0xfe,
-0x19,
-0xfe,
-0x1a,
-0xfe,
-0x23,
-0xfe,
-0x22,
-0xfe,
-0x26,
-0xfe,
-0x23,
-0xfe,
-0x2a,
-0xfe,
-0x21,
-0xfe,
-0x25,
-0xfe,
-0x1f,
-0xfe,
-0x21,
-0xfe,
-0x27,
-0xfe,
-0x1b,
-0xfe,
-0x20,
-0xfe,
-0x1b,
-0xfe,
-0x22,
-0xfe,
-0x1e,
-0xfe,
-0x1e,
-0xfe,
-0x15,
-0xfe,
-0xf,
-0xfe,
-0x14,
-0xfe,
-0xd,
-0xfe,
-0xf,
-0xfe,
-0xa,
-0xfe,
-0x3,
-0xfe,
-0x1,
-0xfe,
-0xfd,
-0xfd,
-0xfe,
-0xfd,
-0xf8,
-0xfd,
-0xf9,
-0xfd,
-0xf7,
-0xfd,
-0xf3,
-0xfd,
-0xf1,
-0xfd,
-0xee,
-0xfd,
-0xe9,
-0xfd,
-0xed,
-0xfd,
-0xe4,
-0xfd,
-0xe2,
-0xfd,
-0xda,
-0xfd,
-0xd9,
-0xfd,
-0xd1,
-0xfd,
-0xd1,
-0xfd,
-0xc7,
-0xfd,
-0xc3,
-0xfd,
-0xba,
-0xfd,
-0xb7,
-0xfd,
-0xad,
-0xfd,
-0xae,
-0xfd,
-0xa0,
-0xfd,
-0x9b,
-0xfd,
-0x8f,
-0xfd,
-0x8b,
-0xfd,
-0x88,
-0xfd,
-0x77,
-0xfd,
-0x76,
-0xfd,
-0x66,
-0xfd,
-0x6a,
-0xfd,
-0x58,
-0xfd,
-0x55,
-0xfd,
-0x4b,
-0xfd,
-0x44,
-0xfd,
-0x3e,
-0xfd,
-0x36,
-0xfd,
-0x2d,
-0xfd,
-0x28,
-0xfd,
-0x24,
-0xfd,
-0x1b,
-0xfd,
-0x21,
-0xfd,
-0x14,
-0xfd,
-0x19,
-0xfd,
-0x8,
-0xfd,
-0x11,
-0xfd,
-0x3,
-0xfd,
-0x1,
-0xfd,
-0xf8,
-0xfc,
-0xf8,
-0xfc,
-0xee,
-0xfc,
-0xf0,
-0xfc,
-0xec,
-0xfc,
-0xef,
-0xfc,
-0xe6,
-0xfc,
-0xe2,
-0xfc,
-0xe1,
-0xfc,
-0xdf,
-0xfc,
-0xda,
-0xfc,
-0xd8,
-0xfc,
-0xd1,
-0xfc,
-0xd2,
-0xfc,
-0xce,
-0xfc,
-0xcc,
-0xfc,
-0xc6,
-0xfc,
-0xc2,
-0xfc,
-0xbe,
-0xfc,
-0xb4,
-0xfc,
-0xb1,
-0xfc,
-0xae,
-0xfc,
-0xae,
-0xfc,
-0xa5,
-0xfc,
-0xa6,
-0xfc,
-0x96,
-0xfc,
-0x96,
-0xfc,
-0x88,
-0xfc,
-0x83,
-0xfc,
-0x7a,
-0xfc,
-0x7d,
-0xfc,
-0x79,
-0xfc,
-0x74,
-0xfc,
-0x72,
-0xfc,
-0x6f,
-0xfc,
-0x70,
-0xfc,
-0x66,
-0xfc,
-0x67,
-0xfc,
-0x6c,
-0xfc,
-0x65,
-0xfc,
-0x68,
-0xfc,
-0x61,
-0xfc,
-0x64,
-0xfc,
-0x5e,
-0xfc,
-0x5e,
-0xfc,
-0x58,
-0xfc,
-0x58,
-0xfc,
-0x57,
-0xfc,
-0x59,
-0xfc,
-0x5a,
-0xfc,
-0x5a,
-0xfc,
-0x59,
-0xfc,
-0x52,
-0xfc,
-0x5d,
-0xfc,
-0x52,
-0xfc,
-0x5b,
-0xfc,
-0x4e,
-0xfc,
-0x59,
-0xfc,
-0x4c,
-0xfc,
-0x4f,
-0xfc,
-0x49,
-0xfc,
-0x4b,
-0xfc,
-0x49,
-0xfc,
-0x51,
-0xfc,
-0x49,
-0xfc,
-0x4d,
-0xfc,
-0x43,
-0xfc,
-0x48,
-0xfc,
-0x41,
-0xfc,
-0x47,
-0xfc,
-0x3b,
-0xfc,
-0x40,
-0xfc,
-0x34,
-0xfc,
-0x39,
-0xfc,
-0x35,
-0xfc,
-0x30,
-0xfc,
-0x30,
-0xfc,
-0x29,
-0xfc,
-0x2b,
-0xfc,
-0x24,
-0xfc,
-0x22,
-0xfc,
-0x1f,
-0xfc,
-0x20,
-0xfc,
-0x1c,
-0xfc,
-0x15,
-0xfc,
-0x12,
-0xfc,
-0x8,
-0xfc,
-0x0,
-0xfc,
-0xf9,
-0xfb,
-0xf6,
-0xfb,
-0xe8,
-0xfb,
-0xe1,
-0xfb,
-0xda,
-0xfb,
-0xda,
-0xfb,
-0xd9,
-0xfb,
-0xd6,
-0xfb,
-0xcf,
-0xfb,
-0xcb,
-0xfb,
-0xce,
-0xfb,
-0xc0,
-0xfb,
-0xca,
-0xfb,
-0xc6,
-0xfb,
-0xc7,
-0xfb,
-0xbf,
-0xfb,
-0xbb,
-0xfb,
-0xb0,
-0xfb,
-0xb0,
-0xfb,
-0xae,
-0xfb,
-0xae,
-0xfb,
-0xa3,
-0xfb,
-0xa1,
-0xfb,
-0x9d,
-0xfb,
-0x9a,
-0xfb,
-0x96,
-0xfb,
-0x99,
-0xfb,
-0x96,
-0xfb,
-0x95,
-0xfb,
-0x8f,
-0xfb,
-0x8e,
-0xfb,
-0x92,
-0xfb,
-0x94,
-0xfb,
-0x95,
-0xfb,
-0x94,
-0xfb,
-0x90,
-0xfb,
-0x8c,
-0xfb,
-0x89,
-0xfb,
-0x80,
-0xfb,
-0x81,
-0xfb,
-0x85,
-0xfb,
-0x7f,
-0xfb,
-0x7d,
-0xfb,
-0x7d,
-0xfb,
-0x79,
-0xfb,
-0x79,
-0xfb,
-0x7a,
-0xfb,
-0x78,
-0xfb,
-0x73,
-0xfb,
-0x71,
-0xfb,
-0x6a,
-0xfb,
-0x6b,
-0xfb,
-0x6d,
-0xfb,
-0x6e,
-0xfb,
-0x6a,
-0xfb,
-0x67,
-0xfb,
-0x61,
-0xfb,
-0x60,
-0xfb,
-0x60,
-0xfb,
-0x62,
-0xfb,
-0x60,
-0xfb,
-0x5f,
-0xfb,
-0x5d,
-0xfb,
-0x63,
-0xfb,
-0x62,
-0xfb,
-0x67,
-0xfb,
-0x66,
-0xfb,
-0x64,
-0xfb,
-0x6a,
-0xfb,
-0x6d,
-0xfb,
-0x72,
-0xfb,
-0x75,
-0xfb,
-0x7d,
-0xfb,
-0x82,
-0xfb,
-0x83,
-0xfb,
-0x8b,
-0xfb,
-0x8a,
-0xfb,
-0x8f,
-0xfb,
-0x8f,
-0xfb,
-0x96,
-0xfb,
-0x94,
-0xfb,
-0x9a,
-0xfb,
-0x97,
-0xfb,
-0xa1,
-0xfb,
-0xa0,
-0xfb,
-0xa5,
-0xfb,
-0xa1,
-0xfb,
-0xa5,
-0xfb,
-0xa7,
-0xfb,
-0xaf,
-0xfb,
-0xb6,
-0xfb,
-0xb6,
-0xfb,
-0xc0,
-0xfb,
-0xc1,
-0xfb,
-0xcb,
-0xfb,
-0xcb,
-0xfb,
-0xd0,
-0xfb,
-0xd6,
-0xfb,
-0xdb,
-0xfb,
-0xe8,
-0xfb,
-0xef,
-0xfb,
-0xf1,
-0xfb,
-0xf1,
-0xfb,
-0xf8,
-0xfb,
-0x3,
-0xfc,
-0xa,
-0xfc,
-0x10,
-0xfc,
-0x1c,
-0xfc,
-0x20,
-0xfc,
-0x36,
-0xfc,
-0x37,
-0xfc,
-0x45,
-0xfc,
-0x4e,
-0xfc,
-0x5a,
-0xfc,
-0x63,
-0xfc,
-0x71,
-0xfc,
-0x78,
-0xfc,
-0x85,
-0xfc,
-0x96,
-0xfc,
-0xa0,
-0xfc,
-0xb1,
-0xfc,
-0xb8,
-0xfc,
-0xcc,
-0xfc,
-0xd5,
-0xfc,
-0xe3,
-0xfc,
-0xe5,
-0xfc,
-0xf3,
-0xfc,
-0xfb,
-0xfc,
-0xc,
-0xfd,
-0x16,
-0xfd,
-0x23,
-0xfd,
-0x33,
-0xfd,
-0x45,
-0xfd,
-0x52,
-0xfd,
-0x62,
-0xfd,
-0x75,
-0xfd,
-0x87,
-0xfd,
-0x98,
-0xfd,
-0xaa,
-0xfd,
-0xb8,
-0xfd,
-0xcc,
-0xfd,
-0xe0,
-0xfd,
-0xf0,
-0xfd,
-0x7,
-0xfe,
-0x11,
-0xfe,
-0x2a,
-0xfe,
-0x3a,
-0xfe,
-0x50,
-0xfe,
-0x65,
-0xfe,
-0x7c,
-0xfe,
-0x8e,
-0xfe,
-0xa4,
-0xfe,
-0xaf,
-0xfe,
-0xc6,
-0xfe,
-0xce,
-0xfe,
-0xe9,
-0xfe,
-0xf4,
-0xfe,
-0x8,
-0xff,
-0x1e,
-0xff,
-0x2b,
-0xff,
-0x46,
-0xff,
-0x56,
-0xff,
-0x71,
-0xff,
-0x83,
-0xff,
-0x99,
-0xff,
-0xa9,
-0xff,
-0xbb,
-0xff,
-0xd5,
-0xff,
-0xe8,
-0xff,
-0xfe,
-0xff,
-0x12,
-0x0,
-0x27,
-0x0,
-0x43,
-0x0,
-0x57,
-0x0,
-0x72,
-0x0,
-0x89,
-0x0,
-0xa1,
-0x0,
-0xb9,
-0x0,
-0xcd,
-0x0,
-0xe7,
-0x0,
-0xfd,
-0x0,
-0x1b,
-0x1,
-0x2c,
-0x1,
-0x48,
-0x1,
-0x58,
-0x1,
-0x74,
-0x1,
-0x8d,
-0x1,
-0xa2,
-0x1,
-0xbc,
-0x1,
-0xce,
-0x1,
-0xe6,
-0x1,
-0xfa,
-0x1,
-0x10,
-0x2,
-0x28,
-0x2,
-0x3a,
-0x2,
-0x4e,
-0x2,
-0x60,
-0x2,
-0x78,
-0x2,
-0x88,
-0x2,
-0x9d,
-0x2,
-0xaf,
-0x2,
-0xbd,
-0x2,
-0xcd,
-0x2,
-0xea,
-0x2,
-0xff,
-0x2,
-0x13,
-0x3,
-0x29,
-0x3,
-0x3a,
-0x3,
-0x56,
-0x3,
-0x6a,
-0x3,
-0x84,
-0x3,
-0x95,
-0x3,
-0xaa,
-0x3,
-0xb5,
-0x3,
-0xd5,
-0x3,
-0xde,
-0x3,
-0xf5,
-0x3,
-0xfe,
-0x3,
-0x12,
-0x4,
-0x26,
-0x4,
-0x37,
-0x4,
-0x44,
-0x4,
-0x4d,
-0x4,
-0x60,
-0x4,
-0x72,
-0x4,
-0x7f,
-0x4,
-0x93,
-0x4,
-0x9d,
-0x4,
-0xab,
-0x4,
-0xb0,
-0x4,
-0xbc,
-0x4,
-0xc7,
-0x4,
-0xd1,
-0x4,
-0xdf,
-0x4,
-0xe0,
-0x4,
-0xf5,
-0x4,
-0xff,
-0x4,
-0x9,
-0x5,
-0x10,
-0x5,
-0x23,
-0x5,
-0x2b,
-0x5,
-0x37,
-0x5,
-0x39,
-0x5,
-0x46,
-0x5,
-0x52,
-0x5,
-0x53,
-0x5,
-0x5e,
-0x5,
-0x60,
-0x5,
-0x6b,
-0x5,
-0x71,
-0x5,
-0x75,
-0x5,
-0x7c,
-0x5,
-0x83,
-0x5,
-0x8c,
-0x5,
-0x96,
-0x5,
-0x9c,
-0x5,
-0x9f,
-0x5,
-0xa6,
-0x5,
-0xa3,
-0x5,
-0xb8,
-0x5,
-0xb5,
-0x5,
-0xc6,
-0x5,
-0xbd,
-0x5,
-0xcc,
-0x5,
-0xcf,
-0x5,
-0xd1,
-0x5,
-0xdb,
-0x5,
-0xdf,
-0x5,
-0xe8,
-0x5,
-0xec,
-0x5,
-0xf1,
-0x5,
-0xf6,
-0x5,
-0xf6,
-0x5,
-0xf4,
-0x5,
-0xff,
-0x5,
-0xfe,
-0x5,
-0x9,
-0x6,
-0x6,
-0x6,
-0xf,
-0x6,
-0x9,
-0x6,
-0x8,
-0x6,
-0xb,
-0x6,
-0x13,
-0x6,
-0xf,
-0x6,
-0x16,
-0x6,
-0x11,
-0x6,
-0x11,
-0x6,
-0xe,
-0x6,
-0x11,
-0x6,
-0x9,
-0x6,
-0xe,
-0x6,
-0xa,
-0x6,
-0xc,
-0x6,
-0x1,
-0x6,
-0x2,
-0x6,
-0xfa,
-0x5,
-0xfb,
-0x5,
-0xfc,
-0x5,
-0xf5,
-0x5,
-0xf9,
-0x5,
-0xf0,
-0x5,
-0xef,
-0x5,
-0xec,
-0x5,
-0xe6,
-0x5,
-0xe9,
-0x5,
-0xe8,
-0x5,
-0xe7,
-0x5,
-0xdf,
-0x5,
-0xdd,
-0x5,
-0xd6,
-0x5,
-0xdb,
-0x5,
-0xd2,
-0x5,
-0xd2,
-0x5,
-0xc9,
-0x5,
-0xc2,
-0x5,
-0xc2,
-0x5,
-0xb9,
-0x5,
-0xba,
-0x5,
-0xb1,
-0x5,
-0xb1,
-0x5,
-0xa8,
-0x5,
-0xab,
-0x5,
-0xa5,
-0x5,
-0xaa,
-0x5,
-0xa2,
-0x5,
-0xa7,
-0x5,
-0xa2,
-0x5,
-0xa0,
-0x5,
-0xa3,
-0x5,
-0x99,
-0x5,
-0x9a,
-0x5,
-0x9a,
-0x5,
-0x98,
-0x5,
-0x9d,
-0x5,
-0x94,
-0x5,
-0x9a,
-0x5,
-0x9c,
-0x5,
-0x9d,
-0x5,
-0xa0,
-0x5,
-0x9d,
-0x5,
-0x9b,
-0x5,
-0x9c,
-0x5,
-0x9a,
-0x5,
-0xa1,
-0x5,
-0xa1,
-0x5,
-0xa4,
-0x5,
-0xa5,
-0x5,
-0xa6,
-0x5,
-0xab,
-0x5,
-0xad,
-0x5,
-0xb0,
-0x5,
-0xb1,
-0x5,
-0xbb,
-0x5,
-0xb6,
-0x5,
-0xbd,
-0x5,
-0xba,
-0x5,
-0xbc,
-0x5,
-0xbf,
-0x5,
-0xc2,
-0x5,
-0xc4,
-0x5,
-0xc4,
-0x5,
-0xc7,
-0x5,
-0xc3,
-0x5,
-0xc8,
-0x5,
-0xc3,
-0x5,
-0xc8,
-0x5,
-0xc8,
-0x5,
-0xd3,
-0x5,
-0xce,
-0x5,
-0xcf,
-0x5,
-0xca,
-0x5,
-0xd7,
-0x5,
-0xd0,
-0x5,
-0xda,
-0x5,
-0xd6,
-0x5,
-0xdc,
-0x5,
-0xe0,
-0x5,
-0xde,
-0x5,
-0xe8,
-0x5,
-0xea,
-0x5,
-0xf3,
-0x5,
-0xf3,
-0x5,
-0xf8,
-0x5,
-0xf7,
-0x5,
-0xfd,
-0x5,
-0xf6,
-0x5,
-0xfd,
-0x5,
-0xfa,
-0x5,
-0x2,
-0x6,
-0x4,
-0x6,
-0x6,
-0x6,
-0x6,
-0x6,
-0xf,
-0x6,
-0x11,
-0x6,
-0x1a,
-0x6,
-0x20,
-0x6,
-0x21,
-0x6,
-0x22,
-0x6,
-0x21,
-0x6,
-0x28,
-0x6,
-0x28,
-0x6,
-0x33,
-0x6,
-0x36,
-0x6,
-0x31,
-0x6,
-0x34,
-0x6,
-0x3b,
-0x6,
-0x3a,
-0x6,
-0x3b,
-0x6,
-0x40,
-0x6,
-0x43,
-0x6,
-0x44,
-0x6,
-0x4d,
-0x6,
-0x49,
-0x6,
-0x4a,
-0x6,
-0x4f,
-0x6,
-0x51,
-0x6,
-0x53,
-0x6,
-0x53,
-0x6,
-0x56,
-0x6,
-0x56,
-0x6,
-0x52,
-0x6,
-0x4f,
-0x6,
-0x53,
-0x6,
-0x56,
-0x6,
-0x57,
-0x6,
-0x56,
-0x6,
-0x57,
-0x6,
-0x50,
-0x6,
-0x52,
-0x6,
-0x54,
-0x6,
-0x51,
-0x6,
-0x4e,
-0x6,
-0x4d,
-0x6,
-0x4a,
-0x6,
-0x48,
-0x6,
-0x44,
-0x6,
-0x42,
-0x6,
-0x46,
-0x6,
-0x46,
-0x6,
-0x4b,
-0x6,
-0x47,
-0x6,
-0x41,
-0x6,
-0x40,
-0x6,
-0x40,
-0x6,
-0x41,
-0x6,
-0x3f,
-0x6,
-0x40,
-0x6,
-0x36,
-0x6,
-0x35,
-0x6,
-0x30,
-0x6,
-0x2e,
-0x6,
-0x2d,
-0x6,
-0x2f,
-0x6,
-0x2c,
-0x6,
-0x2e,
-0x6,
-0x29,
-0x6,
-0x2c,
-0x6,
-0x2a,
-0x6,
-0x29,
-0x6,
-0x2c,
-0x6,
-0x2e,
-0x6,
-0x29,
-0x6,
-0x31,
-0x6,
-0x2c,
-0x6,
-0x2f,
-0x6,
-0x32,
-0x6,
-0x31,
-0x6,
-0x34,
-0x6,
-0x31,
-0x6,
-0x39,
-0x6,
-0x39,
-0x6,
-0x3a,
-0x6,
-0x3f,
-0x6,
-0x43,
-0x6,
-0x43,
-0x6,
-0x4a,
-0x6,
-0x43,
-0x6,
-0x44,
-0x6,
-0x45,
-0x6,
-0x44,
-0x6,
-0x47,
-0x6,
-0x46,
-0x6,
-0x4a,
-0x6,
-0x46,
-0x6,
-0x4c,
-0x6,
-0x47,
-0x6,
-0x4a,
-0x6,
-0x4a,
-0x6,
-0x4b,
-0x6,
-0x48,
-0x6,
-0x4d,
-0x6,
-0x4a,
-0x6,
-0x48,
-0x6,
-0x47,
-0x6,
-0x3f,
-0x6,
-0x40,
-0x6,
-0x3d,
-0x6,
-0x38,
-0x6,
-0x39,
-0x6,
-0x38,
-0x6,
-0x33,
-0x6,
-0x37,
-0x6,
-0x30,
-0x6,
-0x2f,
-0x6,
-0x29,
-0x6,
-0x26,
-0x6,
-0x26,
-0x6,
-0x23,
-0x6,
-0x24,
-0x6,
-0x25,
-0x6,
-0x25,
-0x6,
-0x1d,
-0x6,
-0x19,
-0x6,
-0x1f,
-0x6,
-0x1e,
-0x6,
-0x23,
-0x6,
-0x1e,
-0x6,
-0x21,
-0x6,
-0x20,
-0x6,
-0x1d,
-0x6,
-0x20,
-0x6,
-0x1a,
-0x6,
-0x24,
-0x6,
-0x1a,
-0x6,
-0x26,
-0x6,
-0x24,
-0x6,
-0x2b,
-0x6,
-0x29,
-0x6,
-0x28,
-0x6,
-0x2c,
-0x6,
-0x2f,
-0x6,
-0x30,
-0x6,
-0x3c,
-0x6,
-0x34,
-0x6,
-0x44,
-0x6,
-0x3d,
-0x6,
-0x48,
-0x6,
-0x4a,
-0x6,
-0x4d,
-0x6,
-0x5b,
-0x6,
-0x5a,
-0x6,
-0x60,
-0x6,
-0x62,
-0x6,
-0x65,
-0x6,
-0x6c,
-0x6,
-0x70,
-0x6,
-0x7b,
-0x6,
-0x83,
-0x6,
-0x84,
-0x6,
-0x87,
-0x6,
-0x93,
-0x6,
-0x91,
-0x6,
-0x99,
-0x6,
-0xa0,
-0x6,
-0xab,
-0x6,
-0xac,
-0x6,
-0xb3,
-0x6,
-0xb6,
-0x6,
-0xb8,
-0x6,
-0xc4,
-0x6,
-0xc4,
-0x6,
-0xd1,
-0x6,
-0xcc,
-0x6,
-0xd6,
-0x6,
-0xda,
-0x6,
-0xe4,
-0x6,
-0xe7,
-0x6,
-0xf1,
-0x6,
-0xf4,
-0x6,
-0xfb,
-0x6,
-0xff,
-0x6,
-0x5,
-0x7,
-0xa,
-0x7,
-0xc,
-0x7,
-0x13,
-0x7,
-0x13,
-0x7,
-0x1b,
-0x7,
-0x1f,
-0x7,
-0x27,
-0x7,
-0x30,
-0x7,
-0x36,
-0x7,
-0x3a,
-0x7,
-0x3c,
-0x7,
-0x46,
-0x7,
-0x48,
-0x7,
-0x49,
-0x7,
-0x4e,
-0x7,
-0x52,
-0x7,
-0x5d,
-0x7,
-0x62,
-0x7,
-0x65,
-0x7,
-0x6c,
-0x7,
-0x6f,
-0x7,
-0x7d,
-0x7,
-0x82,
-0x7,
-0x8b,
-0x7,
-0x92,
-0x7,
-0x96,
-0x7,
-0x9d,
-0x7,
-0x9e,
-0x7,
-0xa3,
-0x7,
-0xab,
-0x7,
-0xae,
-0x7,
-0xb2,
-0x7,
-0xb6,
-0x7,
-0xbb,
-0x7,
-0xb8,
-0x7,
-0xc1,
-0x7,
-0xc9,
-0x7,
-0xce,
-0x7,
-0xd7,
-0x7,
-0xd8,
-0x7,
-0xdd,
-0x7,
-0xe3,
-0x7,
-0xe8,
-0x7,
-0xf5,
-0x7,
-0xf6,
-0x7,
-0x0,
-0x8,
-0x2,
-0x8,
-0xd,
-0x8,
-0x10,
-0x8,
-0x15,
-0x8,
-0x1a,
-0x8,
-0x1f,
-0x8,
-0x27,
-0x8,
-0x2d,
-0x8,
-0x2f,
-0x8,
-0x3a,
-0x8,
-0x39,
-0x8,
-0x42,
-0x8,
-0x43,
-0x8,
-0x47,
-0x8,
-0x4a,
-0x8,
-0x4a,
-0x8,
-0x4d,
-0x8,
-0x4d,
-0x8,
-0x4d,
-0x8,
-0x4e,
-0x8,
-0x52,
-0x8,
-0x56,
-0x8,
-0x5d,
-0x8,
-0x57,
-0x8,
-0x5a,
-0x8,
-0x5c,
-0x8,
-0x5e,
-0x8,
-0x65,
-0x8,
-0x5e,
-0x8,
-0x5e,
-0x8,
-0x5c,
-0x8,
-0x67,
-0x8,
-0x62,
-0x8,
-0x63,
-0x8,
-0x65,
-0x8,
-0x68,
-0x8,
-0x67,
-0x8,
-0x64,
-0x8,
-0x66,
-0x8,
-0x5d,
-0x8,
-0x65,
-0x8,
-0x5c,
-0x8,
-0x5c,
-0x8,
-0x5b,
-0x8,
-0x56,
-0x8,
-0x52,
-0x8,
-0x4c,
-0x8,
-0x49,
-0x8,
-0x42,
-0x8,
-0x40,
-0x8,
-0x3e,
-0x8,
-0x37,
-0x8,
-0x32,
-0x8,
-0x2f,
-0x8,
-0x2e,
-0x8,
-0x29,
-0x8,
-0x1e,
-0x8,
-0x1e,
-0x8,
-0x14,
-0x8,
-0xf,
-0x8,
-0x7,
-0x8,
-0x1,
-0x8,
-0xfa,
-0x7,
-0xfa,
-0x7,
-0xee,
-0x7,
-0xe8,
-0x7,
-0xdc,
-0x7,
-0xd8,
-0x7,
-0xcd,
-0x7,
-0xc2,
-0x7,
-0xba,
-0x7,
-0xb2,
-0x7,
-0xa4,
-0x7,
-0x9a,
-0x7,
-0x8b,
-0x7,
-0x7a,
-0x7,
-0x6d,
-0x7,
-0x5e,
-0x7,
-0x51,
-0x7,
-0x40,
-0x7,
-0x39,
-0x7,
-0x1d,
-0x7,
-0x10,
-0x7,
-0xfe,
-0x6,
-0xf3,
-0x6,
-0xe8,
-0x6,
-0xd0,
-0x6,
-0xc4,
-0x6,
-0xb5,
-0x6,
-0xa9,
-0x6,
-0x9a,
-0x6,
-0x84,
-0x6,
-0x7e,
-0x6,
-0x68,
-0x6,
-0x5b,
-0x6,
-0x4c,
-0x6,
-0x3a,
-0x6,
-0x2a,
-0x6,
-0x21,
-0x6,
-0xd,
-0x6,
-0x6,
-0x6,
-0xf3,
-0x5,
-0xe2,
-0x5,
-0xd0,
-0x5,
-0xc7,
-0x5,
-0xb9,
-0x5,
-0xaa,
-0x5,
-0x99,
-0x5,
-0x86,
-0x5,
-0x73,
-0x5,
-0x64,
-0x5,
-0x54,
-0x5,
-0x3d,
-0x5,
-0x29,
-0x5,
-0x1e,
-0x5,
-0xf,
-0x5,
-0xf9,
-0x4,
-0xe9,
-0x4,
-0xd2,
-0x4,
-0xc3,
-0x4,
-0xb6,
-0x4,
-0xa1,
-0x4,
-0x9e,
-0x4,
-0x87,
-0x4,
-0x79,
-0x4,
-0x6b,
-0x4,
-0x5a,
-0x4,
-0x43,
-0x4,
-0x38,
-0x4,
-0x27,
-0x4,
-0x1f,
-0x4,
-0x10,
-0x4,
-0xfe,
-0x3,
-0xec,
-0x3,
-0xd9,
-0x3,
-0xca,
-0x3,
-0xbb,
-0x3,
-0xaa,
-0x3,
-0x9d,
-0x3,
-0x87,
-0x3,
-0x78,
-0x3,
-0x5f,
-0x3,
-0x4a,
-0x3,
-0x35,
-0x3,
-0x20,
-0x3,
-0xc,
-0x3,
-0xf1,
-0x2,
-0xe2,
-0x2,
-0xc0,
-0x2,
-0xaf,
-0x2,
-0x97,
-0x2,
-0x86,
-0x2,
-0x6c,
-0x2,
-0x5b,
-0x2,
-0x3f,
-0x2,
-0x2f,
-0x2,
-0x15,
-0x2,
-0x4,
-0x2,
-0xf3,
-0x1,
-0xdc,
-0x1,
-0xc1,
-0x1,
-0xb1,
-0x1,
-0x9d,
-0x1,
-0x8b,
-0x1,
-0x74,
-0x1,
-0x5e,
-0x1,
-0x4a,
-0x1,
-0x2f,
-0x1,
-0x20,
-0x1,
-0x9,
-0x1,
-0xfc,
-0x0,
-0xe0,
-0x0,
-0xcd,
-0x0,
-0xb7,
-0x0,
-0xa6,
-0x0,
-0x8e,
-0x0,
-0x75,
-0x0,
-0x5e,
-0x0,
-0x4d,
-0x0,
-0x38,
-0x0,
-0x27,
-0x0,
-0x10,
-0x0,
-0xfd,
-0xff,
-0xe5,
-0xff,
-0xcd,
-0xff,
-0xba,
-0xff,
-0xaa,
-0xff,
-0x91,
-0xff,
-0x7f,
-0xff,
-0x5e,
-0xff,
-0x52,
-0xff,
-0x36,
-0xff,
-0x20,
-0xff,
-0xd,
-0xff,
-0xf6,
-0xfe,
-0xde,
-0xfe,
-0xca,
-0xfe,
-0xb4,
-0xfe,
-0x9c,
-0xfe,
-0x87,
-0xfe,
-0x77,
-0xfe,
-0x63,
-0xfe,
-0x4c,
-0xfe,
-0x35,
-0xfe,
-0x22,
-0xfe,
-0x10,
-0xfe,
-0xfc,
-0xfd,
-0xe2,
-0xfd,
-0xd3,
-0xfd,
-0xbb,
-0xfd,
-0xa3,
-0xfd,
-0x8d,
-0xfd,
-0x71,
-0xfd,
-0x5c,
-0xfd,
-0x43,
-0xfd,
-0x2e,
-0xfd,
-0x1c,
-0xfd,
-0x5,
-0xfd,
-0xf5,
-0xfc,
-0xdd,
-0xfc,
-0xc8,
-0xfc,
-0xb6,
-0xfc,
-0x9c,
-0xfc,
-0x88,
-0xfc,
-0x79,
-0xfc,
-0x60,
-0xfc,
-0x52,
-0xfc,
-0x33,
-0xfc,
-0x20,
-0xfc,
-0xc,
-0xfc,
-0xf9,
-0xfb,
-0xe3,
-0xfb,
-0xcc,
-0xfb,
-0xbb,
-0xfb,
-0x9f,
-0xfb,
-0x8f,
-0xfb,
-0x75,
-0xfb,
-0x62,
-0xfb,
-0x4b,
-0xfb,
-0x35,
-0xfb,
-0x23,
-0xfb,
-0x8,
-0xfb,
-0xf4,
-0xfa,
-0xde,
-0xfa,
-0xc9,
-0xfa,
-0xb1,
-0xfa,
-0x96,
-0xfa,
-0x8b,
-0xfa,
-0x73,
-0xfa,
-0x5e,
-0xfa,
-0x4e,
-0xfa,
-0x36,
-0xfa,
-0x29,
-0xfa,
-0x18,
-0xfa,
-0xd,
-0xfa,
-0xfa,
-0xf9,
-0xee,
-0xf9,
-0xd8,
-0xf9,
-0xc8,
-0xf9,
-0xba,
-0xf9,
-0xab,
-0xf9,
-0xa5,
-0xf9,
-0x98,
-0xf9,
-0x87,
-0xf9,
-0x72,
-0xf9,
-0x62,
-0xf9,
-0x5b,
-0xf9,
-0x43,
-0xf9,
-0x39,
-0xf9,
-0x25,
-0xf9,
-0x1a,
-0xf9,
-0x6,
-0xf9,
-0xf7,
-0xf8,
-0xdf,
-0xf8,
-0xd3,
-0xf8,
-0xc4,
-0xf8,
-0xb4,
-0xf8,
-0xa2,
-0xf8,
-0x90,
-0xf8,
-0x84,
-0xf8,
-0x76,
-0xf8,
-0x6a,
-0xf8,
-0x57,
-0xf8,
-0x45,
-0xf8,
-0x35,
-0xf8,
-0x26,
-0xf8,
-0x1a,
-0xf8,
-0x6,
-0xf8,
-0xf5,
-0xf7,
-0xea,
-0xf7,
-0xde,
-0xf7,
-0xcf,
-0xf7,
-0xc0,
-0xf7,
-0xae,
-0xf7,
-0xa5,
-0xf7,
-0x98,
-0xf7,
-0x93,
-0xf7,
-0x83,
-0xf7,
-0x7d,
-0xf7,
-0x68,
-0xf7,
-0x6c,
-0xf7,
-0x5c,
-0xf7,
-0x55,
-0xf7,
-0x42,
-0xf7,
-0x3f,
-0xf7,
-0x2f,
-0xf7,
-0x29,
-0xf7,
-0x16,
-0xf7,
-0x11,
-0xf7,
-0x4,
-0xf7,
-0xfb,
-0xf6,
-0xf4,
-0xf6,
-0xef,
-0xf6,
-0xe5,
-0xf6,
-0xdb,
-0xf6,
-0xd4,
-0xf6,
-0xcb,
-0xf6,
-0xc4,
-0xf6,
-0xbd,
-0xf6,
-0xb5,
-0xf6,
-0xac,
-0xf6,
-0xa9,
-0xf6,
-0xa2,
-0xf6,
-0x9a,
-0xf6,
-0x93,
-0xf6,
-0x85,
-0xf6,
-0x80,
-0xf6,
-0x74,
-0xf6,
-0x71,
-0xf6,
-0x66,
-0xf6,
-0x57,
-0xf6,
-0x4b,
-0xf6,
-0x3d,
-0xf6,
-0x30,
-0xf6,
-0x26,
-0xf6,
-0x1a,
-0xf6,
-0x11,
-0xf6,
-0xb,
-0xf6,
-0xf8,
-0xf5,
-0xf2,
-0xf5,
-0xeb,
-0xf5,
-0xe0,
-0xf5,
-0xdc,
-0xf5,
-0xd7,
-0xf5,
-0xcd,
-0xf5,
-0xc1,
-0xf5,
-0xbf,
-0xf5,
-0xbe,
-0xf5,
-0xba,
-0xf5,
-0xba,
-0xf5,
-0xb0,
-0xf5,
-0xab,
-0xf5,
-0xa1,
-0xf5,
-0x9b,
-0xf5,
-0x9c,
-0xf5,
-0x9b,
-0xf5,
-0x9a,
-0xf5,
-0x8e,
-0xf5,
-0x89,
-0xf5,
-0x86,
-0xf5,
-0x81,
-0xf5,
-0x87,
-0xf5,
-0x7c,
-0xf5,
-0x7d,
-0xf5,
-0x79,
-0xf5,
-0x75,
-0xf5,
-0x74,
-0xf5,
-0x6a,
-0xf5,
-0x6a,
-0xf5,
-0x65,
-0xf5,
-0x64,
-0xf5,
-0x5e,
-0xf5,
-0x5f,
-0xf5,
-0x59,
-0xf5,
-0x52,
-0xf5,
-0x52,
-0xf5,
-0x4d,
-0xf5,
-0x48,
-0xf5,
-0x4c,
-0xf5,
-0x40,
-0xf5,
-0x44,
-0xf5,
-0x40,
-0xf5,
-0x3f,
-0xf5,
-0x3d,
-0xf5,
-0x48,
-0xf5,
-0x3f,
-0xf5,
-0x3f,
-0xf5,
-0x36,
-0xf5,
-0x3d,
-0xf5,
-0x32,
-0xf5,
-0x3d,
-0xf5,
-0x3c,
-0xf5,
-0x41,
-0xf5,
-0x3c,
-0xf5,
-0x41,
-0xf5,
-0x3e,
-0xf5,
-0x45,
-0xf5,
-0x40,
-0xf5,
-0x40,
-0xf5,
-0x44,
-0xf5,
-0x46,
-0xf5,
-0x4c,
-0xf5,
-0x45,
-0xf5,
-0x49,
-0xf5,
-0x44,
-0xf5,
-0x53,
-0xf5,
-0x51,
-0xf5,
-0x57,
-0xf5,
-0x58,
-0xf5,
-0x60,
-0xf5,
-0x67,
-0xf5,
-0x6e,
-0xf5,
-0x74,
-0xf5,
-0x72,
-0xf5,
-0x73,
-0xf5,
-0x7a,
-0xf5,
-0x82,
-0xf5,
-0x90,
-0xf5,
-0x91,
-0xf5,
-0x99,
-0xf5,
-0x9c,
-0xf5,
-0xa4,
-0xf5,
-0xb0,
-0xf5,
-0xb5,
-0xf5,
-0xc0,
-0xf5,
-0xc7,
-0xf5,
-0xd3,
-0xf5,
-0xd4,
-0xf5,
-0xda,
-0xf5,
-0xde,
-0xf5,
-0xde,
-0xf5,
-0xeb,
-0xf5,
-0xe8,
-0xf5,
-0xf8,
-0xf5,
-0xf8,
-0xf5,
-0x5,
-0xf6,
-0xa,
-0xf6,
-0x13,
-0xf6,
-0x26,
-0xf6,
-0x2c,
-0xf6,
-0x3b,
-0xf6,
-0x43,
-0xf6,
-0x52,
-0xf6,
-0x53,
-0xf6,
-0x5e,
-0xf6,
-0x64,
-0xf6,
-0x6b,
-0xf6,
-0x6e,
-0xf6,
-0x78,
-0xf6,
-0x80,
-0xf6,
-0x88,
-0xf6,
-0x93,
-0xf6,
-0x99,
-0xf6,
-0xa4,
-0xf6,
-0xa8,
-0xf6,
-0xb4,
-0xf6,
-0xb9,
-0xf6,
-0xbc,
-0xf6,
-0xcc,
-0xf6,
-0xcc,
-0xf6,
-0xdc,
-0xf6,
-0xdd,
-0xf6,
-0xe9,
-0xf6,
-0xf8,
-0xf6,
-0x5,
-0xf7,
-0x10,
-0xf7,
-0x18,
-0xf7,
-0x23,
-0xf7,
-0x29,
-0xf7,
-0x35,
-0xf7,
-0x3d,
-0xf7,
-0x4a,
-0xf7,
-0x5b,
-0xf7,
-0x60,
-0xf7,
-0x6b,
-0xf7,
-0x7a,
-0xf7,
-0x86,
-0xf7,
-0x8c,
-0xf7,
-0x9f,
-0xf7,
-0x9d,
-0xf7,
-0xaa,
-0xf7,
-0xb1,
-0xf7,
-0xbd,
-0xf7,
-0xc8,
-0xf7,
-0xcf,
-0xf7,
-0xdb,
-0xf7,
-0xe5,
-0xf7,
-0xf3,
-0xf7,
-0x1,
-0xf8,
-0xd,
-0xf8,
-0x15,
-0xf8,
-0x24,
-0xf8,
-0x2f,
-0xf8,
-0x38,
-0xf8,
-0x4b,
-0xf8,
-0x56,
-0xf8,
-0x64,
-0xf8,
-0x69,
-0xf8,
-0x76,
-0xf8,
-0x7f,
-0xf8,
-0x8c,
-0xf8,
-0x94,
-0xf8,
-0xa0,
-0xf8,
-0xaa,
-0xf8,
-0xaf,
-0xf8,
-0xbb,
-0xf8,
-0xc8,
-0xf8,
-0xce,
-0xf8,
-0xd6,
-0xf8,
-0xe0,
-0xf8,
-0xe6,
-0xf8,
-0xe9,
-0xf8,
-0xf1,
-0xf8,
-0xfe,
-0xf8,
-0x9,
-0xf9,
-0x16,
-0xf9,
-0x1b,
-0xf9,
-0x26,
-0xf9,
-0x24,
-0xf9,
-0x33,
-0xf9,
-0x41,
-0xf9,
-0x4c,
-0xf9,
-0x5b,
-0xf9,
-0x66,
-0xf9,
-0x77,
-0xf9,
-0x7a,
-0xf9,
-0x88,
-0xf9,
-0x92,
-0xf9,
-0x9d,
-0xf9,
-0xab,
-0xf9,
-0xb8,
-0xf9,
-0xc5,
-0xf9,
-0xc7,
-0xf9,
-0xd1,
-0xf9,
-0xe1,
-0xf9,
-0xe9,
-0xf9,
-0xf3,
-0xf9,
-0x0,
-0xfa,
-0x6,
-0xfa,
-0x18,
-0xfa,
-0x1a,
-0xfa,
-0x2f,
-0xfa,
-0x38,
-0xfa,
-0x49,
-0xfa,
-0x4f,
-0xfa,
-0x58,
-0xfa,
-0x68,
-0xfa,
-0x73,
-0xfa,
-0x80,
-0xfa,
-0x89,
-0xfa,
-0x96,
-0xfa,
-0xa0,
-0xfa,
-0xb7,
-0xfa,
-0xbc,
-0xfa,
-0xc8,
-0xfa,
-0xd5,
-0xfa,
-0xdb,
-0xfa,
-0xe3,
-0xfa,
-0xf3,
-0xfa,
-0x1,
-0xfb,
-0xc,
-0xfb,
-0x17,
-0xfb,
-0x22,
-0xfb,
-0x2f,
-0xfb,
-0x33,
-0xfb,
-0x3f,
-0xfb,
-0x49,
-0xfb,
-0x53,
-0xfb,
-0x5e,
-0xfb,
-0x69,
-0xfb,
-0x72,
-0xfb,
-0x86,
-0xfb,
-0x90,
-0xfb,
-0x9c,
-0xfb,
-0xad,
-0xfb,
-0xb6,
-0xfb,
-0xca,
-0xfb,
-0xd4,
-0xfb,
-0xe4,
-0xfb,
-0xf4,
-0xfb,
-0xfe,
-0xfb,
-0x14,
-0xfc,
-0x1a,
-0xfc,
-0x2b,
-0xfc,
-0x30,
-0xfc,
-0x41,
-0xfc,
-0x4d,
-0xfc,
-0x54,
-0xfc,
-0x5d,
-0xfc,
-0x6b,
-0xfc,
-0x76,
-0xfc,
-0x87,
-0xfc,
-0x8d,
-0xfc,
-0x9b,
-0xfc,
-0xa4,
-0xfc,
-0xb0,
-0xfc,
-0xbc,
-0xfc,
-0xc0,
-0xfc,
-0xc7,
-0xfc,
-0xd3,
-0xfc,
-0xdc,
-0xfc,
-0xea,
-0xfc,
-0xf3,
-0xfc,
-0xfd,
-0xfc,
-0xff,
-0xfc,
-0xa,
-0xfd,
-0xe,
-0xfd,
-0x16,
-0xfd,
-0x1f,
-0xfd,
-0x2b,
-0xfd,
-0x37,
-0xfd,
-0x3b,
-0xfd,
-0x4b,
-0xfd,
-0x51,
-0xfd,
-0x61,
-0xfd,
-0x69,
-0xfd,
-0x6e,
-0xfd,
-0x7a,
-0xfd,
-0x86,
-0xfd,
-0x95,
-0xfd,
-0x9e,
-0xfd,
-0xac,
-0xfd,
-0xb6,
-0xfd,
-0xc1,
-0xfd,
-0xce,
-0xfd,
-0xde,
-0xfd,
-0xe7,
-0xfd,
-0xf7,
-0xfd,
-0xfe,
-0xfd,
-0xe,
-0xfe,
-0x1a,
-0xfe,
-0x21,
-0xfe,
-0x2f,
-0xfe,
-0x33,
-0xfe,
-0x3d,
-0xfe,
-0x4a,
-0xfe,
-0x51,
-0xfe,
-0x58,
-0xfe,
-0x66,
-0xfe,
-0x66,
-0xfe,
-0x70,
-0xfe,
-0x70,
-0xfe,
-0x7a,
-0xfe,
-0x76,
-0xfe,
-0x83,
-0xfe,
-0x87,
-0xfe,
-0x8c,
-0xfe,
-0x8e,
-0xfe,
-0x96,
-0xfe,
-0x9b,
-0xfe,
-0xa8,
-0xfe,
-0xad,
-0xfe,
-0xb7,
-0xfe,
-0xbe,
-0xfe,
-0xc7,
-0xfe,
-0xcf,
-0xfe,
-0xde,
-0xfe,
-0xeb,
-0xfe,
-0xf4,
-0xfe,
-0xf9,
-0xfe,
-0x1,
-0xff,
-0xa,
-0xff,
-0x14,
-0xff,
-0x1a,
-0xff,
-0x25,
-0xff,
-0x2f,
-0xff,
-0x3b,
-0xff,
-0x40,
-0xff,
-0x47,
-0xff,
-0x4f,
-0xff,
-0x58,
-0xff,
-0x5e,
-0xff,
-0x5e,
-0xff,
-0x6b,
-0xff,
-0x6e,
-0xff,
-0x71,
-0xff,
-0x7b,
-0xff,
-0x82,
-0xff,
-0x86,
-0xff,
-0x8a,
-0xff,
-0x90,
-0xff,
-0x9a,
-0xff,
-0xa1,
-0xff,
-0xaf,
-0xff,
-0xb1,
-0xff,
-0xba,
-0xff,
-0xba,
-0xff,
-0xc5,
-0xff,
-0xcd,
-0xff,
-0xd2,
-0xff,
-0xd6,
-0xff,
-0xdc,
-0xff,
-0xe5,
-0xff,
-0xec,
-0xff,
-0xf6,
-0xff,
-0xfd,
-0xff,
-0x7,
-0x0,
-0x10,
-0x0,
-0x19,
-0x0,
-0x29,
-0x0,
-0x3b,
-0x0,
-0x41,
-0x0,
-0x4a,
-0x0,
-0x4d,
-0x0,
-0x59,
-0x0,
-0x5d,
-0x0,
-0x67,
-0x0,
-0x6e,
-0x0,
-0x6d,
-0x0,
-0x7a,
-0x0,
-0x78,
-0x0,
-0x86,
-0x0,
-0x85,
-0x0,
-0x96,
-0x0,
-0x99,
-0x0,
-0xa1,
-0x0,
-0xa7,
-0x0,
-0xae,
-0x0,
-0xb4,
-0x0,
-0xbc,
-0x0,
-0xc7,
-0x0,
-0xce,
-0x0,
-0xd8,
-0x0,
-0xda,
-0x0,
-0xeb,
-0x0,
-0xec,
-0x0,
-0xff,
-0x0,
-0x1,
-0x1,
-0xd,
-0x1,
-0x14,
-0x1,
-0x18,
-0x1,
-0x22,
-0x1,
-0x23,
-0x1,
-0x2a,
-0x1,
-0x33,
-0x1,
-0x42,
-0x1,
-0x48,
-0x1,
-0x51,
-0x1,
-0x58,
-0x1,
-0x5f,
-0x1,
-0x6c,
-0x1,
-0x75,
-0x1,
-0x81,
-0x1,
-0x8b,
-0x1,
-0x98,
-0x1,
-0x9f,
-0x1,
-0xab,
-0x1,
-0xac,
-0x1,
-0xb9,
-0x1,
-0xba,
-0x1,
-0xc5,
-0x1,
-0xc9,
-0x1,
-0xd0,
-0x1,
-0xd8,
-0x1,
-0xdc,
-0x1,
-0xe6,
-0x1,
-0xea,
-0x1,
-0xf8,
-0x1,
-0xf6,
-0x1,
-0xff,
-0x1,
-0x3,
-0x2,
-0x7,
-0x2,
-0xf,
-0x2,
-0x18,
-0x2,
-0x20,
-0x2,
-0x22,
-0x2,
-0x25,
-0x2,
-0x30,
-0x2,
-0x39,
-0x2,
-0x48,
-0x2,
-0x53,
-0x2,
-0x54,
-0x2,
-0x64,
-0x2,
-0x6b,
-0x2,
-0x70,
-0x2,
-0x80,
-0x2,
-0x86,
-0x2,
-0x92,
-0x2,
-0x9f,
-0x2,
-0xa1,
-0x2,
-0xb1,
-0x2,
-0xb6,
-0x2,
-0xbc,
-0x2,
-0xc6,
-0x2,
-0xd0,
-0x2,
-0xda,
-0x2,
-0xe0,
-0x2,
-0xe7,
-0x2,
-0xea,
-0x2,
-0xf2,
-0x2,
-0xfa,
-0x2,
-0x9,
-0x3,
-0x4,
-0x3,
-0x12,
-0x3,
-0x12,
-0x3,
-0x1b,
-0x3,
-0x1b,
-0x3,
-0x23,
-0x3,
-0x25,
-0x3,
-0x2e,
-0x3,
-0x3a,
-0x3,
-0x3a,
-0x3,
-0x3a,
-0x3,
-0x41,
-0x3,
-0x44,
-0x3,
-0x49,
-0x3,
-0x4d,
-0x3,
-0x50,
-0x3,
-0x51,
-0x3,
-0x50,
-0x3,
-0x55,
-0x3,
-0x59,
-0x3,
-0x63,
-0x3,
-0x5f,
-0x3,
-0x60,
-0x3,
-0x64,
-0x3,
-0x66,
-0x3,
-0x6e,
-0x3,
-0x6e,
-0x3,
-0x73,
-0x3,
-0x72,
-0x3,
-0x78,
-0x3,
-0x79,
-0x3,
-0x7e,
-0x3,
-0x85,
-0x3,
-0x87,
-0x3,
-0x8d,
-0x3,
-0x8f,
-0x3,
-0x98,
-0x3,
-0x9a,
-0x3,
-0xa5,
-0x3,
-0x9e,
-0x3,
-0xa1,
-0x3,
-0xa0,
-0x3,
-0xa2,
-0x3,
-0xad,
-0x3,
-0xa5,
-0x3,
-0xad,
-0x3,
-0xa3,
-0x3,
-0xa4,
-0x3,
-0xa3,
-0x3,
-0xa1,
-0x3,
-0xa1,
-0x3,
-0xa2,
-0x3,
-0xa4,
-0x3,
-0xa8,
-0x3,
-0xa7,
-0x3,
-0xa7,
-0x3,
-0xa5,
-0x3,
-0xa6,
-0x3,
-0xa1,
-0x3,
-0xa0,
-0x3,
-0xa2,
-0x3,
-0x98,
-0x3,
-0x9e,
-0x3,
-0x99,
-0x3,
-0x9b,
-0x3,
-0x93,
-0x3,
-0x97,
-0x3,
-0x8d,
-0x3,
-0x90,
-0x3,
-0x8e,
-0x3,
-0x88,
-0x3,
-0x86,
-0x3,
-0x88,
-0x3,
-0x8d,
-0x3,
-0x85,
-0x3,
-0x89,
-0x3,
-0x82,
-0x3,
-0x81,
-0x3,
-0x80,
-0x3,
-0x7d,
-0x3,
-0x7a,
-0x3,
-0x72,
-0x3,
-0x73,
-0x3,
-0x6d,
-0x3,
-0x6d,
-0x3,
-0x6d,
-0x3,
-0x5e,
-0x3,
-0x65,
-0x3,
-0x5d,
-0x3,
-0x5e,
-0x3,
-0x5c,
-0x3,
-0x5a,
-0x3,
-0x59,
-0x3,
-0x51,
-0x3,
-0x53,
-0x3,
-0x4f,
-0x3,
-0x51,
-0x3,
-0x4d,
-0x3,
-0x52,
-0x3,
-0x4d,
-0x3,
-0x53,
-0x3,
-0x53,
-0x3,
-0x57,
-0x3,
-0x50,
-0x3,
-0x55,
-0x3,
-0x56,
-0x3,
-0x58,
-0x3,
-0x5d,
-0x3,
-0x58,
-0x3,
-0x5f,
-0x3,
-0x5b,
-0x3,
-0x60,
-0x3,
-0x66,
-0x3,
-0x63,
-0x3,
-0x65,
-0x3,
-0x6a,
-0x3,
-0x67,
-0x3,
-0x63,
-0x3,
-0x6b,
-0x3,
-0x64,
-0x3,
-0x6f,
-0x3,
-0x6b,
-0x3,
-0x6e,
-0x3,
-0x6b,
-0x3,
-0x68,
-0x3,
-0x60,
-0x3,
-0x67,
-0x3,
-0x5f,
-0x3,
-0x69,
-0x3,
-0x66,
-0x3,
-0x69,
-0x3,
-0x64,
-0x3,
-0x61,
-0x3,
-0x61,
-0x3,
-0x62,
-0x3,
-0x61,
-0x3,
-0x5a,
-0x3,
-0x53,
-0x3,
-0x58,
-0x3,
-0x48,
-0x3,
-0x51,
-0x3,
-0x4e,
-0x3,
-0x4e,
-0x3,
-0x4c,
-0x3,
-0x4b,
-0x3,
-0x4f,
-0x3,
-0x4e,
-0x3,
-0x4f,
-0x3,
-0x52,
-0x3,
-0x53,
-0x3,
-0x50,
-0x3,
-0x51,
-0x3,
-0x50,
-0x3,
-0x54,
-0x3,
-0x4f,
-0x3,
-0x53,
-0x3,
-0x53,
-0x3,
-0x53,
-0x3,
-0x57,
-0x3,
-0x55,
-0x3,
-0x5c,
-0x3,
-0x60,
-0x3,
-0x5a,
-0x3,
-0x63,
-0x3,
-0x59,
-0x3,
-0x62,
-0x3,
-0x5e,
-0x3,
-0x62,
-0x3,
-0x64,
-0x3,
-0x63,
-0x3,
-0x66,
-0x3,
-0x68,
-0x3,
-0x63,
-0x3,
-0x63,
-0x3,
-0x58,
-0x3,
-0x5d,
-0x3,
-0x58,
-0x3,
-0x59,
-0x3,
-0x53,
-0x3,
-0x54,
-0x3,
-0x49,
-0x3,
-0x4a,
-0x3,
-0x4d,
-0x3,
-0x4d,
-0x3,
-0x4d,
-0x3,
-0x42,
-0x3,
-0x44,
-0x3,
-0x3f,
-0x3,
-0x4a,
-0x3,
-0x46,
-0x3,
-0x48,
-0x3,
-0x4b,
-0x3,
-0x50,
-0x3,
-0x51,
-0x3,
-0x57,
-0x3,
-0x58,
-0x3,
-0x5e,
-0x3,
-0x62,
-0x3,
-0x64,
-0x3,
-0x6c,
-0x3,
-0x64,
-0x3,
-0x6e,
-0x3,
-0x6f,
-0x3,
-0x76,
-0x3,
-0x77,
-0x3,
-0x79,
-0x3,
-0x80,
-0x3,
-0x7d,
-0x3,
-0x87,
-0x3,
-0x8a,
-0x3,
-0x8b,
-0x3,
-0x8a,
-0x3,
-0x92,
-0x3,
-0x92,
-0x3,
-0x97,
-0x3,
-0x9d,
-0x3,
-0x9c,
-0x3,
-0xa7,
-0x3,
-0xae,
-0x3,
-0xb5,
-0x3,
-0xbc,
-0x3,
-0xbd,
-0x3,
-0xc3,
-0x3,
-0xc4,
-0x3,
-0xce,
-0x3,
-0xd3,
-0x3,
-0xd4,
-0x3,
-0xdd,
-0x3,
-0xe0,
-0x3,
-0xe4,
-0x3,
-0xec,
-0x3,
-0xee,
-0x3,
-0xf5,
-0x3,
-0xef,
-0x3,
-0xf8,
-0x3,
-0xf8,
-0x3,
-0xff,
-0x3,
-0xfa,
-0x3,
-0xff,
-0x3,
-0xfb,
-0x3,
-0xfc,
-0x3,
-0xfa,
-0x3,
-0xfb,
-0x3,
-0x3,
-0x4,
-0x2,
-0x4,
-0xc,
-0x4,
-0x2,
-0x4,
-0x12,
-0x4,
-0x8,
-0x4,
-0x10,
-0x4,
-0x6,
-0x4,
-0x12,
-0x4,
-0xd,
-0x4,
-0x16,
-0x4,
-0x15,
-0x4,
-0x16,
-0x4,
-0x18,
-0x4,
-0x19,
-0x4,
-0x1a,
-0x4,
-0x19,
-0x4,
-0x15,
-0x4,
-0x18,
-0x4,
-0x19,
-0x4,
-0x17,
-0x4,
-0x21,
-0x4,
-0x18,
-0x4,
-0x24,
-0x4,
-0x1c,
-0x4,
-0x25,
-0x4,
-0x1d,
-0x4,
-0x25,
-0x4,
-0x22,
-0x4,
-0x2a,
-0x4,
-0x25,
-0x4,
-0x2e,
-0x4,
-0x25,
-0x4,
-0x2c,
-0x4,
-0x22,
-0x4,
-0x22,
-0x4,
-0x23,
-0x4,
-0x1c,
-0x4,
-0x20,
-0x4,
-0x14,
-0x4,
-0xf,
-0x4,
-0xa,
-0x4,
-0x3,
-0x4,
-0xfa,
-0x3,
-0xf7,
-0x3,
-0xf2,
-0x3,
-0xec,
-0x3,
-0xe5,
-0x3,
-0xe0,
-0x3,
-0xdc,
-0x3,
-0xd1,
-0x3,
-0xcb,
-0x3,
-0xc6,
-0x3,
-0xbb,
-0x3,
-0xb5,
-0x3,
-0xab,
-0x3,
-0xaa,
-0x3,
-0xa1,
-0x3,
-0x9f,
-0x3,
-0x94,
-0x3,
-0x8a,
-0x3,
-0x8f,
-0x3,
-0x8c,
-0x3,
-0x8a,
-0x3,
-0x81,
-0x3,
-0x88,
-0x3,
-0x80,
-0x3,
-0x80,
-0x3,
-0x7b,
-0x3,
-0x72,
-0x3,
-0x73,
-0x3,
-0x6b,
-0x3,
-0x65,
-0x3,
-0x67,
-0x3,
-0x5d,
-0x3,
-0x56,
-0x3,
-0x52,
-0x3,
-0x51,
-0x3,
-0x4e,
-0x3,
-0x48,
-0x3,
-0x41,
-0x3,
-0x3f,
-0x3,
-0x37,
-0x3,
-0x35,
-0x3,
-0x30,
-0x3,
-0x28,
-0x3,
-0x27,
-0x3,
-0x19,
-0x3,
-0x18,
-0x3,
-0x7,
-0x3,
-0x7,
-0x3,
-0xf8,
-0x2,
-0xf3,
-0x2,
-0xe4,
-0x2,
-0xdd,
-0x2,
-0xd4,
-0x2,
-0xcc,
-0x2,
-0xc3,
-0x2,
-0xbb,
-0x2,
-0xb1,
-0x2,
-0xa6,
-0x2,
-0xa1,
-0x2,
-0x97,
-0x2,
-0x8b,
-0x2,
-0x81,
-0x2,
-0x77,
-0x2,
-0x68,
-0x2,
-0x62,
-0x2,
-0x57,
-0x2,
-0x51,
-0x2,
-0x48,
-0x2,
-0x3e,
-0x2,
-0x32,
-0x2,
-0x2a,
-0x2,
-0x19,
-0x2,
-0x14,
-0x2,
-0x3,
-0x2,
-0xfd,
-0x1,
-0xf2,
-0x1,
-0xe7,
-0x1,
-0xdf,
-0x1,
-0xd7,
-0x1,
-0xca,
-0x1,
-0xc4,
-0x1,
-0xbf,
-0x1,
-0xbc,
-0x1,
-0xb1,
-0x1,
-0xa5,
-0x1,
-0x9d,
-0x1,
-0x97,
-0x1,
-0x8e,
-0x1,
-0x8d,
-0x1,
-0x83,
-0x1,
-0x7e,
-0x1,
-0x6f,
-0x1,
-0x6c,
-0x1,
-0x67,
-0x1,
-0x62,
-0x1,
-0x57,
-0x1,
-0x56,
-0x1,
-0x42,
-0x1,
-0x3a,
-0x1,
-0x2d,
-0x1,
-0x24,
-0x1,
-0x1e,
-0x1,
-0x15,
-0x1,
-0xb,
-0x1,
-0x0,
-0x1,
-0xf3,
-0x0,
-0xe8,
-0x0,
-0xe4,
-0x0,
-0xdb,
-0x0,
-0xcf,
-0x0,
-0xc5,
-0x0,
-0xbe,
-0x0,
-0xb5,
-0x0,
-0xa7,
-0x0,
-0xa1,
-0x0,
-0x96,
-0x0,
-0x84,
-0x0,
-0x80,
-0x0,
-0x73,
-0x0,
-0x69,
-0x0,
-0x63,
-0x0,
-0x58,
-0x0,
-0x53,
-0x0,
-0x43,
-0x0,
-0x3e,
-0x0,
-0x30,
-0x0,
-0x2b,
-0x0,
-0x27,
-0x0,
-0x21,
-0x0,
-0x1c,
-0x0,
-0x14,
-0x0,
-0xa,
-0x0,
-0x3,
-0x0,
-0xfc,
-0xff,
-0xf4,
-0xff,
-0xe5,
-0xff,
-0xe0,
-0xff,
-0xd8,
-0xff,
-0xcc,
-0xff,
-0xc8,
-0xff,
-0xbc,
-0xff,
-0xb4,
-0xff,
-0xa9,
-0xff,
-0xa5,
-0xff,
-0x9a,
-0xff,
-0x94,
-0xff,
-0x91,
-0xff,
-0x85,
-0xff,
-0x83,
-0xff,
-0x7b,
-0xff,
-0x6f,
-0xff,
-0x65,
-0xff,
-0x5e,
-0xff,
-0x58,
-0xff,
-0x4f,
-0xff,
-0x42,
-0xff,
-0x39,
-0xff,
-0x2a,
-0xff,
-0x1d,
-0xff,
-0x19,
-0xff,
-0x14,
-0xff,
-0xa,
-0xff,
-0x3,
-0xff,
-0xf1,
-0xfe,
-0xe9,
-0xfe,
-0xe0,
-0xfe,
-0xd3,
-0xfe,
-0xcb,
-0xfe,
-0xc5,
-0xfe,
-0xc3,
-0xfe,
-0xba,
-0xfe,
-0xac,
-0xfe,
-0xa4,
-0xfe,
-0x94,
-0xfe,
-0x8f,
-0xfe,
-0x89,
-0xfe,
-0x80,
-0xfe,
-0x7a,
-0xfe,
-0x74,
-0xfe,
-0x6d,
-0xfe,
-0x6b,
-0xfe,
-0x6a,
-0xfe,
-0x62,
-0xfe,
-0x62,
-0xfe,
-0x53,
-0xfe,
-0x51,
-0xfe,
-0x4d,
-0xfe,
-0x47,
-0xfe,
-0x3e,
-0xfe,
-0x39,
-0xfe,
-0x36,
-0xfe,
-0x3a,
-0xfe,
-0x32,
-0xfe,
-0x31,
-0xfe,
-0x2e,
-0xfe,
-0x26,
-0xfe,
-0x21,
-0xfe,
-0x21,
-0xfe,
-0x1e,
-0xfe,
-0x18,
-0xfe,
-0xa,
-0xfe,
-0xd,
-0xfe,
-0x5,
-0xfe,
-0x0,
-0xfe,
-0xfd,
-0xfd,
-0xfc,
-0xfd,
-0xf7,
-0xfd,
-0xf9,
-0xfd,
-0xf2,
-0xfd,
-0xed,
-0xfd,
-0xeb,
-0xfd,
-0xe3,
-0xfd,
-0xe3,
-0xfd,
-0xde,
-0xfd,
-0xd7,
-0xfd,
-0xd4,
-0xfd,
-0xd2,
-0xfd,
-0xd0,
-0xfd,
-0xc5,
-0xfd,
-0xc6,
-0xfd,
-0xbc,
-0xfd,
-0xb8,
-0xfd,
-0xb7,
-0xfd,
-0xa9,
-0xfd,
-0xae,
-0xfd,
-0xa4,
-0xfd,
-0xa5,
-0xfd,
-0xa3,
-0xfd,
-0x9e,
-0xfd,
-0x9d,
-0xfd,
-0x98,
-0xfd,
-0x9d,
-0xfd,
-0x98,
-0xfd,
-0x9a,
-0xfd,
-0x95,
-0xfd,
-0x98,
-0xfd,
-0x91,
-0xfd,
-0x95,
-0xfd,
-0x92,
-0xfd,
-0x99,
-0xfd,
-0x92,
-0xfd,
-0x97,
-0xfd,
-0x8f,
-0xfd,
-0x93,
-0xfd,
-0x8e,
-0xfd,
-0x87,
-0xfd,
-0x89,
-0xfd,
-0x7e,
-0xfd,
-0x80,
-0xfd,
-0x7a,
-0xfd,
-0x78,
-0xfd,
-0x72,
-0xfd,
-0x73,
-0xfd,
-0x69,
-0xfd,
-0x68,
-0xfd,
-0x5f,
-0xfd,
-0x68,
-0xfd,
-0x5b,
-0xfd,
-0x60,
-0xfd,
-0x5c,
-0xfd,
-0x5b,
-0xfd,
-0x59,
-0xfd,
-0x57,
-0xfd,
-0x55,
-0xfd,
-0x51,
-0xfd,
-0x47,
-0xfd,
-0x48,
-0xfd,
-0x45,
-0xfd,
-0x48,
-0xfd,
-0x41,
-0xfd,
-0x47,
-0xfd,
-0x41,
-0xfd,
-0x42,
-0xfd,
-0x44,
-0xfd,
-0x42,
-0xfd,
-0x40,
-0xfd,
-0x3c,
-0xfd,
-0x3d,
-0xfd,
-0x41,
-0xfd,
-0x38,
-0xfd,
-0x3c,
-0xfd,
-0x38,
-0xfd,
-0x37,
-0xfd,
-0x33,
-0xfd,
-0x2f,
-0xfd,
-0x34,
-0xfd,
-0x30,
-0xfd,
-0x39,
-0xfd,
-0x2f,
-0xfd,
-0x34,
-0xfd,
-0x2e,
-0xfd,
-0x2b,
-0xfd,
-0x2e,
-0xfd,
-0x2d,
-0xfd,
-0x28,
-0xfd,
-0x20,
-0xfd,
-0x1e,
-0xfd,
-0x11,
-0xfd,
-0x12,
-0xfd,
-0xf,
-0xfd,
-0xf,
-0xfd,
-0xa,
-0xfd,
-0x1,
-0xfd,
-0x4,
-0xfd,
-0xfc,
-0xfc,
-0xfc,
-0xfc,
-0xfe,
-0xfc,
-0xfd,
-0xfc,
-0x0,
-0xfd,
-0x2,
-0xfd,
-0x2,
-0xfd,
-0x4,
-0xfd,
-0x6,
-0xfd,
-0x1,
-0xfd,
-0x3,
-0xfd,
-0x5,
-0xfd,
-0x2,
-0xfd,
-0x9,
-0xfd,
-0x7,
-0xfd,
-0x7,
-0xfd,
-0x7,
-0xfd,
-0xe,
-0xfd,
-0x11,
-0xfd,
-0x13,
-0xfd,
-0x1a,
-0xfd,
-0x1b,
-0xfd,
-0x1d,
-0xfd,
-0x1d,
-0xfd,
-0x1f,
-0xfd,
-0x22,
-0xfd,
-0x28,
-0xfd,
-0x31,
-0xfd,
-0x30,
-0xfd,
-0x34,
-0xfd,
-0x34,
-0xfd,
-0x40,
-0xfd,
-0x42,
-0xfd,
-0x4e,
-0xfd,
-0x59,
-0xfd,
-0x5b,
-0xfd,
-0x5d,
-0xfd,
-0x66,
-0xfd,
-0x65,
-0xfd,
-0x63,
-0xfd,
-0x61,
-0xfd,
-0x5f,
-0xfd,
-0x5f,
-0xfd,
-0x5c,
-0xfd,
-0x5f,
-0xfd,
-0x65,
-0xfd,
-0x61,
-0xfd,
-0x62,
-0xfd,
-0x62,
-0xfd,
-0x5e,
-0xfd,
-0x60,
-0xfd,
-0x61,
-0xfd,
-0x64,
-0xfd,
-0x63,
-0xfd,
-0x61,
-0xfd,
-0x5e,
-0xfd,
-0x5f,
-0xfd,
-0x62,
-0xfd,
-0x64,
-0xfd,
-0x67,
-0xfd,
-0x6e,
-0xfd,
-0x74,
-0xfd,
-0x79,
-0xfd,
-0x80,
-0xfd,
-0x80,
-0xfd,
-0x85,
-0xfd,
-0x85,
-0xfd,
-0x88,
-0xfd,
-0x8a,
-0xfd,
-0x8a,
-0xfd,
-0x90,
-0xfd,
-0x8f,
-0xfd,
-0x97,
-0xfd,
-0x93,
-0xfd,
-0xa0,
-0xfd,
-0x9f,
-0xfd,
-0xaf,
-0xfd,
-0xab,
-0xfd,
-0xb2,
-0xfd,
-0xb8,
-0xfd,
-0xba,
-0xfd,
-0xba,
-0xfd,
-0xbc,
-0xfd,
-0xbc,
-0xfd,
-0xc1,
-0xfd,
-0xbe,
-0xfd,
-0xc6,
-0xfd,
-0xca,
-0xfd,
-0xcf,
-0xfd,
-0xd5,
-0xfd,
-0xd3,
-0xfd,
-0xde,
-0xfd,
-0xdf,
-0xfd,
-0xe9,
-0xfd,
-0xed,
-0xfd,
-0xf4,
-0xfd,
-0xf7,
-0xfd,
-0x6,
-0xfe,
-0x10,
-0xfe,
-0x16,
-0xfe,
-0x1e,
-0xfe,
-0x27,
-0xfe,
-0x2a,
-0xfe,
-0x31,
-0xfe,
-0x34,
-0xfe,
-0x44,
-0xfe,
-0x45,
-0xfe,
-0x54,
-0xfe,
-0x5b,
-0xfe,
-0x63,
-0xfe,
-0x6c,
-0xfe,
-0x6f,
-0xfe,
-0x78,
-0xfe,
-0x7d,
-0xfe,
-0x88,
-0xfe,
-0x93,
-0xfe,
-0x94,
-0xfe,
-0x99,
-0xfe,
-0x9e,
-0xfe,
-0xaa,
-0xfe,
-0xae,
-0xfe,
-0xaf,
-0xfe,
-0xb5,
-0xfe,
-0xb8,
-0xfe,
-0xc1,
-0xfe,
-0xc4,
-0xfe,
-0xc5,
-0xfe,
-0xc6,
-0xfe,
-0xcc,
-0xfe,
-0xcc,
-0xfe,
-0xd5,
-0xfe,
-0xd3,
-0xfe,
-0xde,
-0xfe,
-0xe0,
-0xfe,
-0xe9,
-0xfe,
-0xe6,
-0xfe,
-0xf1,
-0xfe,
-0xf1,
-0xfe,
-0xf9,
-0xfe,
-0xfd,
-0xfe,
-0x0,
-0xff,
-0x5,
-0xff,
-0x10,
-0xff,
-0x11,
-0xff,
-0x1b,
-0xff,
-0x1a,
-0xff,
-0x24,
-0xff,
-0x26,
-0xff,
-0x30,
-0xff,
-0x38,
-0xff,
-0x3c,
-0xff,
-0x44,
-0xff,
-0x4c,
-0xff,
-0x51,
-0xff,
-0x5c,
-0xff,
-0x69,
-0xff,
-0x6e,
-0xff,
-0x75,
-0xff,
-0x78,
-0xff,
-0x7f,
-0xff,
-0x85,
-0xff,
-0x8e,
-0xff,
-0x95,
-0xff,
-0x99,
-0xff,
-0x9d,
-0xff,
-0xa9,
-0xff,
-0xae,
-0xff,
-0xb1,
-0xff,
-0xb8,
-0xff,
-0xbd,
-0xff,
-0xc8,
-0xff,
-0xcb,
-0xff,
-0xd2,
-0xff,
-0xd9,
-0xff,
-0xe6,
-0xff,
-0xee,
-0xff,
-0xf6,
-0xff,
-0xfd,
-0xff,
-0xfd,
-0xff,
-0xb,
-0x0,
-0xb,
-0x0,
-0xf,
-0x0,
-0x18,
-0x0,
-0x17,
-0x0,
-0x1e,
-0x0,
-0x1f,
-0x0,
-0x23,
-0x0,
-0x2b,
-0x0,
-0x34,
-0x0,
-0x41,
-0x0,
-0x4b,
-0x0,
-0x50,
-0x0,
-0x55,
-0x0,
-0x5f,
-0x0,
-0x6d,
-0x0,
-0x75,
-0x0,
-0x84,
-0x0,
-0x8a,
-0x0,
-0x94,
-0x0,
-0x96,
-0x0,
-0xa9,
-0x0,
-0xaf,
-0x0,
-0xc1,
-0x0,
-0xc6,
-0x0,
-0xcb,
-0x0,
-0xd4,
-0x0,
-0xd9,
-0x0,
-0xe2,
-0x0,
-0xee,
-0x0,
-0xf3,
-0x0,
-0xf4,
-0x0,
-0xf8,
-0x0,
-0xfc,
-0x0,
-0x3,
-0x1,
-0x6,
-0x1,
-0xb,
-0x1,
-0x10,
-0x1,
-0x13,
-0x1,
-0x22,
-0x1,
-0x29,
-0x1,
-0x29,
-0x1,
-0x2f,
-0x1,
-0x34,
-0x1,
-0x37,
-0x1,
-0x3c,
-0x1,
-0x3f,
-0x1,
-0x3a,
-0x1,
-0x48,
-0x1,
-0x47,
-0x1,
-0x54,
-0x1,
-0x50,
-0x1,
-0x5e,
-0x1,
-0x67,
-0x1,
-0x6b,
-0x1,
-0x72,
-0x1,
-0x75,
-0x1,
-0x78,
-0x1,
-0x80,
-0x1,
-0x84,
-0x1,
-0x8a,
-0x1,
-0x8c,
-0x1,
-0x95,
-0x1,
-0x93,
-0x1,
-0x95,
-0x1,
-0x93,
-0x1,
-0x9d,
-0x1,
-0x9e,
-0x1,
-0xa7,
-0x1,
-0xa8,
-0x1,
-0xad,
-0x1,
-0xac,
-0x1,
-0xb0,
-0x1,
-0xb0,
-0x1,
-0xb7,
-0x1,
-0xb4,
-0x1,
-0xbd,
-0x1,
-0xbb,
-0x1,
-0xbe,
-0x1,
-0xbe,
-0x1,
-0xbe,
-0x1,
-0xc3,
-0x1,
-0xc2,
-0x1,
-0xc2,
-0x1,
-0xc6,
-0x1,
-0xc9,
-0x1,
-0xc9,
-0x1,
-0xca,
-0x1,
-0xcd,
-0x1,
-0xce,
-0x1,
-0xd0,
-0x1,
-0xcf,
-0x1,
-0xd0,
-0x1,
-0xcd,
-0x1,
-0xcd,
-0x1,
-0xc9,
-0x1,
-0xd1,
-0x1,
-0xc4,
-0x1,
-0xcd,
-0x1,
-0xc5,
-0x1,
-0xc7,
-0x1,
-0xc7,
-0x1,
-0xc4,
-0x1,
-0xbe,
-0x1,
-0xb5,
-0x1,
-0xb2,
-0x1,
-0xb0,
-0x1,
-0xab,
-0x1,
-0xae,
-0x1,
-0xa2,
-0x1,
-0x9e,
-0x1,
-0xa0,
-0x1,
-0x9c,
-0x1,
-0x9b,
-0x1,
-0x9a,
-0x1,
-0x98,
-0x1,
-0x90,
-0x1,
-0x92,
-0x1,
-0x8f,
-0x1,
-0x91,
-0x1,
-0x90,
-0x1,
-0x8f,
-0x1,
-0x8d,
-0x1,
-0x8b,
-0x1,
-0x88,
-0x1,
-0x83,
-0x1,
-0x87,
-0x1,
-0x83,
-0x1,
-0x85,
-0x1,
-0x89,
-0x1,
-0x87,
-0x1,
-0x85,
-0x1,
-0x87,
-0x1,
-0x88,
-0x1,
-0x83,
-0x1,
-0x87,
-0x1,
-0x85,
-0x1,
-0x87,
-0x1,
-0x83,
-0x1,
-0x86,
-0x1,
-0x7f,
-0x1,
-0x8b,
-0x1,
-0x86,
-0x1,
-0x8b,
-0x1,
-0x8e,
-0x1,
-0x8a,
-0x1,
-0x88,
-0x1,
-0x87,
-0x1,
-0x8d,
-0x1,
-0x90,
-0x1,
-0x93,
-0x1,
-0x94,
-0x1,
-0x98,
-0x1,
-0x9e,
-0x1,
-0x9b,
-0x1,
-0x9c,
-0x1,
-0x9f,
-0x1,
-0x9d,
-0x1,
-0xa9,
-0x1,
-0xa6,
-0x1,
-0xa8,
-0x1,
-0xab,
-0x1,
-0xa6,
-0x1,
-0xb5,
-0x1,
-0xb7,
-0x1,
-0xb4,
-0x1,
-0xb7,
-0x1,
-0xba,
-0x1,
-0xbc,
-0x1,
-0xb8,
-0x1,
-0xbc,
-0x1,
-0xbf,
-0x1,
-0xc0,
-0x1,
-0xc4,
-0x1,
-0xbe,
-0x1,
-0xc5,
-0x1,
-0xcc,
-0x1,
-0xcd,
-0x1,
-0xd4,
-0x1,
-0xd9,
-0x1,
-0xea,
-0x1,
-0xeb,
-0x1,
-0xf9,
-0x1,
-0xfd,
-0x1,
-0xfd,
-0x1,
-0x6,
-0x2,
-0xc,
-0x2,
-0x16,
-0x2,
-0x1a,
-0x2,
-0x22,
-0x2,
-0x26,
-0x2,
-0x29,
-0x2,
-0x2e,
-0x2,
-0x2e,
-0x2,
-0x36,
-0x2,
-0x3c,
-0x2,
-0x3d,
-0x2,
-0x43,
-0x2,
-0x47,
-0x2,
-0x4e,
-0x2,
-0x4d,
-0x2,
-0x54,
-0x2,
-0x58,
-0x2,
-0x5d,
-0x2,
-0x5f,
-0x2,
-0x5d,
-0x2,
-0x65,
-0x2,
-0x67,
-0x2,
-0x70,
-0x2,
-0x74,
-0x2,
-0x7e,
-0x2,
-0x82,
-0x2,
-0x88,
-0x2,
-0x85,
-0x2,
-0x84,
-0x2,
-0x86,
-0x2,
-0x8b,
-0x2,
-0x91,
-0x2,
-0x91,
-0x2,
-0x8e,
-0x2,
-0x96,
-0x2,
-0x95,
-0x2,
-0x9a,
-0x2,
-0x9e,
-0x2,
-0xa0,
-0x2,
-0xb2,
-0x2,
-0xa8,
-0x2,
-0xb4,
-0x2,
-0xb3,
-0x2,
-0xbd,
-0x2,
-0xc3,
-0x2,
-0xc8,
-0x2,
-0xcf,
-0x2,
-0xd5,
-0x2,
-0xda,
-0x2,
-0xe4,
-0x2,
-0xea,
-0x2,
-0xf0,
-0x2,
-0xf4,
-0x2,
-0xf7,
-0x2,
-0xfc,
-0x2,
-0x5,
-0x3,
-0x6,
-0x3,
-0x7,
-0x3,
-0x8,
-0x3,
-0xa,
-0x3,
-0xf,
-0x3,
-0xb,
-0x3,
-0x10,
-0x3,
-0xd,
-0x3,
-0x12,
-0x3,
-0xe,
-0x3,
-0x9,
-0x3,
-0xa,
-0x3,
-0x1,
-0x3,
-0x5,
-0x3,
-0xfd,
-0x2,
-0x7,
-0x3,
-0xfa,
-0x2,
-0xfe,
-0x2,
-0xf5,
-0x2,
-0xf0,
-0x2,
-0xed,
-0x2,
-0xec,
-0x2,
-0xe3,
-0x2,
-0xdf,
-0x2,
-0xd9,
-0x2,
-0xd6,
-0x2,
-0xcc,
-0x2,
-0xd4,
-0x2,
-0xca,
-0x2,
-0xcb,
-0x2,
-0xc1,
-0x2,
-0xbe,
-0x2,
-0xbc,
-0x2,
-0xb4,
-0x2,
-0xb6,
-0x2,
-0xb0,
-0x2,
-0xad,
-0x2,
-0xa5,
-0x2,
-0xa5,
-0x2,
-0x9e,
-0x2,
-0x99,
-0x2,
-0x95,
-0x2,
-0x85,
-0x2,
-0x86,
-0x2,
-0x7b,
-0x2,
-0x79,
-0x2,
-0x70,
-0x2,
-0x6a,
-0x2,
-0x62,
-0x2,
-0x5a,
-0x2,
-0x51,
-0x2,
-0x49,
-0x2,
-0x43,
-0x2,
-0x3b,
-0x2,
-0x34,
-0x2,
-0x2f,
-0x2,
-0x28,
-0x2,
-0x23,
-0x2,
-0x15,
-0x2,
-0x1b,
-0x2,
-0xe,
-0x2,
-0xa,
-0x2,
-0xfe,
-0x1,
-0xf9,
-0x1,
-0xf1,
-0x1,
-0xef,
-0x1,
-0xe6,
-0x1,
-0xe4,
-0x1,
-0xdd,
-0x1,
-0xdd,
-0x1,
-0xd3,
-0x1,
-0xd1,
-0x1,
-0xca,
-0x1,
-0xbe,
-0x1,
-0xba,
-0x1,
-0xac,
-0x1,
-0xab,
-0x1,
-0xa2,
-0x1,
-0xa2,
-0x1,
-0x9b,
-0x1,
-0x97,
-0x1,
-0x8c,
-0x1,
-0x8b,
-0x1,
-0x82,
-0x1,
-0x7b,
-0x1,
-0x73,
-0x1,
-0x6a,
-0x1,
-0x64,
-0x1,
-0x5a,
-0x1,
-0x4f,
-0x1,
-0x46,
-0x1,
-0x3f,
-0x1,
-0x36,
-0x1,
-0x33,
-0x1,
-0x29,
-0x1,
-0x23,
-0x1,
-0x1d,
-0x1,
-0x1d,
-0x1,
-0x19,
-0x1,
-0x1c,
-0x1,
-0xf,
-0x1,
-0x13,
-0x1,
-0x4,
-0x1,
-0x8,
-0x1,
-0xff,
-0x0,
-0x4,
-0x1,
-0xfc,
-0x0,
-0xfa,
-0x0,
-0xf2,
-0x0,
-0xeb,
-0x0,
-0xea,
-0x0,
-0xe4,
-0x0,
-0xe0,
-0x0,
-0xdb,
-0x0,
-0xd6,
-0x0,
-0xdb,
-0x0,
-0xd3,
-0x0,
-0xce,
-0x0,
-0xca,
-0x0,
-0xc2,
-0x0,
-0xc2,
-0x0,
-0xbe,
-0x0,
-0xc6,
-0x0,
-0xbe,
-0x0,
-0xbf,
-0x0,
-0xb6,
-0x0,
-0xbd,
-0x0,
-0xb5,
-0x0,
-0xbd,
-0x0,
-0xb8,
-0x0,
-0xb9,
-0x0,
-0xb1,
-0x0,
-0xa9,
-0x0,
-0xad,
-0x0,
-0xab,
-0x0,
-0xac,
-0x0,
-0xa3,
-0x0,
-0xa3,
-0x0,
-0x98,
-0x0,
-0x97,
-0x0,
-0x93,
-0x0,
-0x8b,
-0x0,
-0x88,
-0x0,
-0x7e,
-0x0,
-0x83,
-0x0,
-0x79,
-0x0,
-0x7c,
-0x0,
-0x6c,
-0x0,
-0x71,
-0x0,
-0x69,
-0x0,
-0x63,
-0x0,
-0x65,
-0x0,
-0x5d,
-0x0,
-0x56,
-0x0,
-0x58,
-0x0,
-0x54,
-0x0,
-0x4f,
-0x0,
-0x4d,
-0x0,
-0x45,
-0x0,
-0x43,
-0x0,
-0x3d,
-0x0,
-0x3c,
-0x0,
-0x3b,
-0x0,
-0x3d,
-0x0,
-0x33,
-0x0,
-0x37,
-0x0,
-0x33,
-0x0,
-0x35,
-0x0,
-0x39,
-0x0,
-0x3c,
-0x0,
-0x3c,
-0x0,
-0x39,
-0x0,
-0x39,
-0x0,
-0x3c,
-0x0,
-0x37,
-0x0,
-0x41,
-0x0,
-0x38,
-0x0,
-0x41,
-0x0,
-0x3b,
-0x0,
-0x38,
-0x0,
-0x3b,
-0x0,
-0x31,
-0x0,
-0x35,
-0x0,
-0x30,
-0x0,
-0x2c,
-0x0,
-0x2e,
-0x0,
-0x24,
-0x0,
-0x24,
-0x0,
-0x1a,
-0x0,
-0x20,
-0x0,
-0x1b,
-0x0,
-0xf,
-0x0,
-0x13,
-0x0,
-0x8,
-0x0,
-0x5,
-0x0,
-0x2,
-0x0,
-0xff,
-0xff,
-0xfd,
-0xff,
-0xf5,
-0xff,
-0xef,
-0xff,
-0xef,
-0xff,
-0xeb,
-0xff,
-0xe7,
-0xff,
-0xe5,
-0xff,
-0xdd,
-0xff,
-0xd5,
-0xff,
-0xd7,
-0xff,
-0xd1,
-0xff,
-0xd4,
-0xff,
-0xca,
-0xff,
-0xc5,
-0xff,
-0xc6,
-0xff,
-0xba,
-0xff,
-0xb6,
-0xff,
-0xb1,
-0xff,
-0xb1,
-0xff,
-0xad,
-0xff,
-0xac,
-0xff,
-0xae,
-0xff,
-0xad,
-0xff,
-0xb5,
-0xff,
-0xaf,
-0xff,
-0xaf,
-0xff,
-0xac,
-0xff,
-0xac,
-0xff,
-0xa8,
-0xff,
-0xa5,
-0xff,
-0xa6,
-0xff,
-0xa4,
-0xff,
-0xa0,
-0xff,
-0x9f,
-0xff,
-0x9c,
-0xff,
-0x96,
-0xff,
-0x8f,
-0xff,
-0x92,
-0xff,
-0x8a,
-0xff,
-0x8b,
-0xff,
-0x82,
-0xff,
-0x7b,
-0xff,
-0x77,
-0xff,
-0x74,
-0xff,
-0x6d,
-0xff,
-0x68,
-0xff,
-0x65,
-0xff,
-0x5f,
-0xff,
-0x58,
-0xff,
-0x51,
-0xff,
-0x53,
-0xff,
-0x4d,
-0xff,
-0x46,
-0xff,
-0x3b,
-0xff,
-0x3b,
-0xff,
-0x32,
-0xff,
-0x2f,
-0xff,
-0x26,
-0xff,
-0x1d,
-0xff,
-0x13,
-0xff,
-0xb,
-0xff,
-0x2,
-0xff,
-0xf9,
-0xfe,
-0xf5,
-0xfe,
-0xea,
-0xfe,
-0xde,
-0xfe,
-0xcc,
-0xfe,
-0xcb,
-0xfe,
-0xb8,
-0xfe,
-0xb7,
-0xfe,
-0xad,
-0xfe,
-0xa3,
-0xfe,
-0x9e,
-0xfe,
-0x96,
-0xfe,
-0x8e,
-0xfe,
-0x82,
-0xfe,
-0x7b,
-0xfe,
-0x6d,
-0xfe,
-0x66,
-0xfe,
-0x60,
-0xfe,
-0x5b,
-0xfe,
-0x53,
-0xfe,
-0x48,
-0xfe,
-0x40,
-0xfe,
-0x3c,
-0xfe,
-0x30,
-0xfe,
-0x2d,
-0xfe,
-0x21,
-0xfe,
-0x1e,
-0xfe,
-0x17,
-0xfe,
-0x14,
-0xfe,
-0x9,
-0xfe,
-0x3,
-0xfe,
-0x3,
-0xfe,
-0xf7,
-0xfd,
-0xf2,
-0xfd,
-0xe6,
-0xfd,
-0xe0,
-0xfd,
-0xdd,
-0xfd,
-0xd4,
-0xfd,
-0xd2,
-0xfd,
-0xc9,
-0xfd,
-0xc1,
-0xfd,
-0xbf,
-0xfd,
-0xb3,
-0xfd,
-0xb3,
-0xfd,
-0xad,
-0xfd,
-0xaa,
-0xfd,
-0x99,
-0xfd,
-0x96,
-0xfd,
-0x86,
-0xfd,
-0x8d,
-0xfd,
-0x87,
-0xfd,
-0x8b,
-0xfd,
-0x85,
-0xfd,
-0x7d,
-0xfd,
-0x77,
-0xfd,
-0x71,
-0xfd,
-0x72,
-0xfd,
-0x65,
-0xfd,
-0x66,
-0xfd,
-0x66,
-0xfd,
-0x5d,
-0xfd,
-0x5d,
-0xfd,
-0x56,
-0xfd,
-0x52,
-0xfd,
-0x4f,
-0xfd,
-0x49,
-0xfd,
-0x46,
-0xfd,
-0x3d,
-0xfd,
-0x38,
-0xfd,
-0x2c,
-0xfd,
-0x30,
-0xfd,
-0x28,
-0xfd,
-0x23,
-0xfd,
-0x23,
-0xfd,
-0x1d,
-0xfd,
-0x1d,
-0xfd,
-0x1e,
-0xfd,
-0x15,
-0xfd,
-0x13,
-0xfd,
-0x10,
-0xfd,
-0x10,
-0xfd,
-0x14,
-0xfd,
-0x15,
-0xfd,
-0x11,
-0xfd,
-0xc,
-0xfd,
-0x8,
-0xfd,
-0x4,
-0xfd,
-0x5,
-0xfd,
-0x8,
-0xfd,
-0x0,
-0xfd,
-0x0,
-0xfd,
-0x2,
-0xfd,
-0x0,
-0xfd,
-0x6,
-0xfd,
-0x5,
-0xfd,
-0x8,
-0xfd,
-0x4,
-0xfd,
-0x5,
-0xfd,
-0x9,
-0xfd,
-0x7,
-0xfd,
-0x4,
-0xfd,
-0x4,
-0xfd,
-0x7,
-0xfd,
-0x1,
-0xfd,
-0x3,
-0xfd,
-0x2,
-0xfd,
-0x4,
-0xfd,
-0x6,
-0xfd,
-0x9,
-0xfd,
-0xc,
-0xfd,
-0xc,
-0xfd,
-0xe,
-0xfd,
-0x10,
-0xfd,
-0x13,
-0xfd,
-0x19,
-0xfd,
-0x17,
-0xfd,
-0x1c,
-0xfd,
-0x17,
-0xfd,
-0x1d,
-0xfd,
-0x1b,
-0xfd,
-0x23,
-0xfd,
-0x25,
-0xfd,
-0x2f,
-0xfd,
-0x2e,
-0xfd,
-0x39,
-0xfd,
-0x3a,
-0xfd,
-0x3e,
-0xfd,
-0x40,
-0xfd,
-0x3f,
-0xfd,
-0x40,
-0xfd,
-0x41,
-0xfd,
-0x49,
-0xfd,
-0x4c,
-0xfd,
-0x50,
-0xfd,
-0x53,
-0xfd,
-0x5d,
-0xfd,
-0x5a,
-0xfd,
-0x63,
-0xfd,
-0x6f,
-0xfd,
-0x79,
-0xfd,
-0x81,
-0xfd,
-0x8b,
-0xfd,
-0x93,
-0xfd,
-0x9d,
-0xfd,
-0xa1,
-0xfd,
-0xad,
-0xfd,
-0xb5,
-0xfd,
-0xb6,
-0xfd,
-0xc9,
-0xfd,
-0xc9,
-0xfd,
-0xd7,
-0xfd,
-0xd8,
-0xfd,
-0xdf,
-0xfd,
-0xe5,
-0xfd,
-0xed,
-0xfd,
-0xec,
-0xfd,
-0xf6,
-0xfd,
-0xfd,
-0xfd,
-0x3,
-0xfe,
-0x6,
-0xfe,
-0xe,
-0xfe,
-0xd,
-0xfe,
-0x10,
-0xfe,
-0x13,
-0xfe,
-0x16,
-0xfe,
-0x1e,
-0xfe,
-0x17,
-0xfe,
-0x20,
-0xfe,
-0x1b,
-0xfe,
-0x1d,
-0xfe,
-0x20,
-0xfe,
-0x22,
-0xfe,
-0x26,
-0xfe,
-0x27,
-0xfe,
-0x26,
-0xfe,
-0x21,
-0xfe,
-0x27,
-0xfe,
-0x2f,
-0xfe,
-0x30,
-0xfe,
-0x35,
-0xfe,
-0x38,
-0xfe,
-0x43,
-0xfe,
-0x43,
-0xfe,
-0x49,
-0xfe,
-0x49,
-0xfe,
-0x50,
-0xfe,
-0x53,
-0xfe,
-0x5c,
-0xfe,
-0x60,
-0xfe,
-0x67,
-0xfe,
-0x62,
-0xfe,
-0x6a,
-0xfe,
-0x69,
-0xfe,
-0x70,
-0xfe,
-0x6b,
-0xfe,
-0x72,
-0xfe,
-0x6a,
-0xfe,
-0x74,
-0xfe,
-0x6c,
-0xfe,
-0x77,
-0xfe,
-0x71,
-0xfe,
-0x72,
-0xfe,
-0x77,
-0xfe,
-0x74,
-0xfe,
-0x73,
-0xfe,
-0x72,
-0xfe,
-0x72,
-0xfe,
-0x71,
-0xfe,
-0x7b,
-0xfe,
-0x7b,
-0xfe,
-0x7d,
-0xfe,
-0x82,
-0xfe,
-0x82,
-0xfe,
-0x80,
-0xfe,
-0x83,
-0xfe,
-0x85,
-0xfe,
-0x8a,
-0xfe,
-0x8b,
-0xfe,
-0x90,
-0xfe,
-0x93,
-0xfe,
-0x97,
-0xfe,
-0x9d,
-0xfe,
-0xa2,
-0xfe,
-0xa8,
-0xfe,
-0xaa,
-0xfe,
-0xa9,
-0xfe,
-0xae,
-0xfe,
-0xae,
-0xfe,
-0xb4,
-0xfe,
-0xb9,
-0xfe,
-0xbd,
-0xfe,
-0xc1,
-0xfe,
-0xc4,
-0xfe,
-0xc7,
-0xfe,
-0xca,
-0xfe,
-0xc9,
-0xfe,
-0xcc,
-0xfe,
-0xca,
-0xfe,
-0xc9,
-0xfe,
-0xc5,
-0xfe,
-0xc4,
-0xfe,
-0xc5,
-0xfe,
-0xc3,
-0xfe,
-0xc3,
-0xfe,
-0xc5,
-0xfe,
-0xc2,
-0xfe,
-0xc5,
-0xfe,
-0xc4,
-0xfe,
-0xca,
-0xfe,
-0xd2,
-0xfe,
-0xce,
-0xfe,
-0xd2,
-0xfe,
-0xcb,
-0xfe,
-0xd3,
-0xfe,
-0xd3,
-0xfe,
-0xdd,
-0xfe,
-0xd7,
-0xfe,
-0xde,
-0xfe,
-0xd7,
-0xfe,
-0xdc,
-0xfe,
-0xd9,
-0xfe,
-0xde,
-0xfe,
-0xdb,
-0xfe,
-0xd4,
-0xfe,
-0xd2,
-0xfe,
-0xd3,
-0xfe,
-0xd4,
-0xfe,
-0xd3,
-0xfe,
-0xd0,
-0xfe,
-0xd5,
-0xfe,
-0xd2,
-0xfe,
-0xcf,
-0xfe,
-0xcf,
-0xfe,
-0xc9,
-0xfe,
-0xd3,
-0xfe,
-0xcb,
-0xfe,
-0xcd,
-0xfe,
-0xc3,
-0xfe,
-0xca,
-0xfe,
-0xc9,
-0xfe,
-0xc9,
-0xfe,
-0xc7,
-0xfe,
-0xca,
-0xfe,
-0xca,
-0xfe,
-0xcb,
-0xfe,
-0xcd,
-0xfe,
-0xcc,
-0xfe,
-0xcf,
-0xfe,
-0xd0,
-0xfe,
-0xd4,
-0xfe,
-0xde,
-0xfe,
-0xdf,
-0xfe,
-0xe7,
-0xfe,
-0xe6,
-0xfe,
-0xef,
-0xfe,
-0xf1,
-0xfe,
-0xf3,
-0xfe,
-0xfc,
-0xfe,
-0xfc,
-0xfe,
-0xfc,
-0xfe,
-0xfb,
-0xfe,
-0x0,
-0xff,
-0x3,
-0xff,
-0x5,
-0xff,
-0xff,
-0xfe,
-0xff,
-0xfe,
-0xfa,
-0xfe,
-0xfa,
-0xfe,
-0xf3,
-0xfe,
-0xee,
-0xfe,
-0xe6,
-0xfe,
-0xe4,
-0xfe,
-0xdc,
-0xfe,
-0xda,
-0xfe,
-0xcf,
-0xfe,
-0xce,
-0xfe,
-0xc5,
-0xfe,
-0xbd,
-0xfe,
-0xb9,
-0xfe,
-0xad,
-0xfe,
-0xab,
-0xfe,
-0xa0,
-0xfe,
-0xa0,
-0xfe,
-0x96,
-0xfe,
-0x95,
-0xfe,
-0x8e,
-0xfe,
-0x88,
-0xfe,
-0x89,
-0xfe,
-0x84,
-0xfe,
-0x87,
-0xfe,
-0x7f,
-0xfe,
-0x84,
-0xfe,
-0x78,
-0xfe,
-0x7b,
-0xfe,
-0x78,
-0xfe,
-0x76,
-0xfe,
-0x7a,
-0xfe,
-0x7a,
-0xfe,
-0x77,
-0xfe,
-0x80,
-0xfe,
-0x7c,
-0xfe,
-0x85,
-0xfe,
-0x80,
-0xfe,
-0x7f,
-0xfe,
-0x83,
-0xfe,
-0x87,
-0xfe,
-0x8c,
-0xfe,
-0x91,
-0xfe,
-0x89,
-0xfe,
-0x90,
-0xfe,
-0x8f,
-0xfe,
-0x96,
-0xfe,
-0x97,
-0xfe,
-0x91,
-0xfe,
-0x94,
-0xfe,
-0x9f,
-0xfe,
-0x9f,
-0xfe,
-0xa6,
-0xfe,
-0xa3,
-0xfe,
-0xaa,
-0xfe,
-0xa9,
-0xfe,
-0xa4,
-0xfe,
-0xa5,
-0xfe,
-0xa9,
-0xfe,
-0xad,
-0xfe,
-0xad,
-0xfe,
-0xa4,
-0xfe,
-0xaa,
-0xfe,
-0xa5,
-0xfe,
-0xa6,
-0xfe,
-0xac,
-0xfe,
-0xab,
-0xfe,
-0xae,
-0xfe,
-0xab,
-0xfe,
-0xa9,
-0xfe,
-0xab,
-0xfe,
-0xaa,
-0xfe,
-0xa7,
-0xfe,
-0xa3,
-0xfe,
-0xa4,
-0xfe,
-0x9c,
-0xfe,
-0xa2,
-0xfe,
-0x9f,
-0xfe,
-0xa1,
-0xfe,
-0x9d,
-0xfe,
-0xa9,
-0xfe,
-0xa2,
-0xfe,
-0xb0,
-0xfe,
-0xa8,
-0xfe,
-0xae,
-0xfe,
-0xad,
-0xfe,
-0xb5,
-0xfe,
-0xb9,
-0xfe,
-0xb7,
-0xfe,
-0xba,
-0xfe,
-0xc1,
-0xfe,
-0xc2,
-0xfe,
-0xc3,
-0xfe,
-0xcf,
-0xfe,
-0xd4,
-0xfe,
-0xd6,
-0xfe,
-0xdf,
-0xfe,
-0xdf,
-0xfe,
-0xe7,
-0xfe,
-0xf0,
-0xfe,
-0xf5,
-0xfe,
-0xfe,
-0xfe,
-0xff,
-0xfe,
-0x6,
-0xff,
-0x9,
-0xff,
-0xd,
-0xff,
-0xd,
-0xff,
-0x17,
-0xff,
-0x19,
-0xff,
-0x26,
-0xff,
-0x21,
-0xff,
-0x2f,
-0xff,
-0x2b,
-0xff,
-0x33,
-0xff,
-0x38,
-0xff,
-0x41,
-0xff,
-0x4c,
-0xff,
-0x50,
-0xff,
-0x54,
-0xff,
-0x5e,
-0xff,
-0x62,
-0xff,
-0x6f,
-0xff,
-0x74,
-0xff,
-0x7c,
-0xff,
-0x82,
-0xff,
-0x8d,
-0xff,
-0x91,
-0xff,
-0x9b,
-0xff,
-0xa3,
-0xff,
-0xad,
-0xff,
-0xb9,
-0xff,
-0xbe,
-0xff,
-0xc7,
-0xff,
-0xce,
-0xff,
-0xda,
-0xff,
-0xe0,
-0xff,
-0xec,
-0xff,
-0xf4,
-0xff,
-0xfb,
-0xff,
-0x6,
-0x0,
-0x7,
-0x0,
-0x12,
-0x0,
-0x16,
-0x0,
-0x22,
-0x0,
-0x2c,
-0x0,
-0x36,
-0x0,
-0x40,
-0x0,
-0x43,
-0x0,
-0x4e,
-0x0,
-0x53,
-0x0,
-0x60,
-0x0,
-0x67,
-0x0,
-0x72,
-0x0,
-0x74,
-0x0,
-0x7f,
-0x0,
-0x80,
-0x0,
-0x8c,
-0x0,
-0x91,
-0x0,
-0x97,
-0x0,
-0x9f,
-0x0,
-0xa9,
-0x0,
-0xa8,
-0x0,
-0xb6,
-0x0,
-0xb3,
-0x0,
-0xba,
-0x0,
-0xc7,
-0x0,
-0xcb,
-0x0,
-0xd2,
-0x0,
-0xdc,
-0x0,
-0xdf,
-0x0,
-0xe7,
-0x0,
-0xe9,
-0x0,
-0xf2,
-0x0,
-0xf8,
-0x0,
-0xfe,
-0x0,
-0xfe,
-0x0,
-0xb,
-0x1,
-0x12,
-0x1,
-0x1b,
-0x1,
-0x1a,
-0x1,
-0x26,
-0x1,
-0x27,
-0x1,
-0x2f,
-0x1,
-0x38,
-0x1,
-0x3d,
-0x1,
-0x3d,
-0x1,
-0x3e,
-0x1,
-0x3f,
-0x1,
-0x45,
-0x1,
-0x4a,
-0x1,
-0x4f,
-0x1,
-0x5a,
-0x1,
-0x59,
-0x1,
-0x5f,
-0x1,
-0x61,
-0x1,
-0x63,
-0x1,
-0x61,
-0x1,
-0x62,
-0x1,
-0x66,
-0x1,
-0x6a,
-0x1,
-0x72,
-0x1,
-0x6f,
-0x1,
-0x73,
-0x1,
-0x73,
-0x1,
-0x73,
-0x1,
-0x75,
-0x1,
-0x74,
-0x1,
-0x74,
-0x1,
-0x7a,
-0x1,
-0x78,
-0x1,
-0x81,
-0x1,
-0x7c,
-0x1,
-0x7d,
-0x1,
-0x7a,
-0x1,
-0x7d,
-0x1,
-0x81,
-0x1,
-0x77,
-0x1,
-0x7a,
-0x1,
-0x72,
-0x1,
-0x73,
-0x1,
-0x6d,
-0x1,
-0x73,
-0x1,
-0x71,
-0x1,
-0x69,
-0x1,
-0x6a,
-0x1,
-0x68,
-0x1,
-0x6d,
-0x1,
-0x64,
-0x1,
-0x64,
-0x1,
-0x5e,
-0x1,
-0x64,
-0x1,
-0x63,
-0x1,
-0x61,
-0x1,
-0x5e,
-0x1,
-0x5c,
-0x1,
-0x5d,
-0x1,
-0x58,
-0x1,
-0x5d,
-0x1,
-0x56,
-0x1,
-0x58,
-0x1,
-0x52,
-0x1,
-0x55,
-0x1,
-0x56,
-0x1,
-0x51,
-0x1,
-0x51,
-0x1,
-0x50,
-0x1,
-0x4e,
-0x1,
-0x4c,
-0x1,
-0x48,
-0x1,
-0x47,
-0x1,
-0x41,
-0x1,
-0x48,
-0x1,
-0x47,
-0x1,
-0x47,
-0x1,
-0x44,
-0x1,
-0x40,
-0x1,
-0x3a,
-0x1,
-0x3e,
-0x1,
-0x3b,
-0x1,
-0x38,
-0x1,
-0x3b,
-0x1,
-0x3b,
-0x1,
-0x3d,
-0x1,
-0x39,
-0x1,
-0x38,
-0x1,
-0x34,
-0x1,
-0x37,
-0x1,
-0x30,
-0x1,
-0x2e,
-0x1,
-0x2b,
-0x1,
-0x31,
-0x1,
-0x2a,
-0x1,
-0x24,
-0x1,
-0x20,
-0x1,
-0x24,
-0x1,
-0x1e,
-0x1,
-0x1d,
-0x1,
-0x17,
-0x1,
-0x18,
-0x1,
-0xd,
-0x1,
-0x14,
-0x1,
-0xe,
-0x1,
-0xf,
-0x1,
-0x10,
-0x1,
-0xd,
-0x1,
-0x8,
-0x1,
-0x6,
-0x1,
-0x1,
-0x1,
-0x0,
-0x1,
-0xfc,
-0x0,
-0xf9,
-0x0,
-0xfa,
-0x0,
-0xf4,
-0x0,
-0xf9,
-0x0,
-0xf5,
-0x0,
-0xf9,
-0x0,
-0xf6,
-0x0,
-0xf5,
-0x0,
-0xf4,
-0x0,
-0xf2,
-0x0,
-0xf7,
-0x0,
-0xf7,
-0x0,
-0xf8,
-0x0,
-0xf3,
-0x0,
-0xf6,
-0x0,
-0xfd,
-0x0,
-0xf7,
-0x0,
-0x7,
-0x1,
-0xfe,
-0x0,
-0x3,
-0x1,
-0xfd,
-0x0,
-0x7,
-0x1,
-0x6,
-0x1,
-0xa,
-0x1,
-0x8,
-0x1,
-0x6,
-0x1,
-0x8,
-0x1,
-0x4,
-0x1,
-0x2,
-0x1,
-0x1,
-0x1,
-0x3,
-0x1,
-0x1,
-0x1,
-0xfd,
-0x0,
-0x0,
-0x1,
-0xfb,
-0x0,
-0x4,
-0x1,
-0xfd,
-0x0,
-0x5,
-0x1,
-0x0,
-0x1,
-0x7,
-0x1,
-0x2,
-0x1,
-0x0,
-0x1,
-0xff,
-0x0,
-0x1,
-0x1,
-0xff,
-0x0,
-0x0,
-0x1,
-0xfd,
-0x0,
-0x0,
-0x1,
-0xfe,
-0x0,
-0xfd,
-0x0,
-0x7,
-0x1,
-0x9,
-0x1,
-0xc,
-0x1,
-0xe,
-0x1,
-0x11,
-0x1,
-0x15,
-0x1,
-0x22,
-0x1,
-0x23,
-0x1,
-0x2f,
-0x1,
-0x30,
-0x1,
-0x3a,
-0x1,
-0x3d,
-0x1,
-0x47,
-0x1,
-0x4c,
-0x1,
-0x59,
-0x1,
-0x5b,
-0x1,
-0x66,
-0x1,
-0x67,
-0x1,
-0x74,
-0x1,
-0x74,
-0x1,
-0x7e,
-0x1,
-0x82,
-0x1,
-0x89,
-0x1,
-0x90,
-0x1,
-0x99,
-0x1,
-0x98,
-0x1,
-0xa4,
-0x1,
-0xa4,
-0x1,
-0xaf,
-0x1,
-0xb1,
-0x1,
-0xb7,
-0x1,
-0xc0,
-0x1,
-0xc5,
-0x1,
-0xd2,
-0x1,
-0xd3,
-0x1,
-0xd6,
-0x1,
-0xdf,
-0x1,
-0xdd,
-0x1,
-0xe1,
-0x1,
-0xe4,
-0x1,
-0xea,
-0x1,
-0xf1,
-0x1,
-0xf5,
-0x1,
-0xfa,
-0x1,
-0xf2,
-0x1,
-0xfa,
-0x1,
-0xfa,
-0x1,
-0xff,
-0x1,
-0x0,
-0x2,
-0xff,
-0x1,
-0x0,
-0x2,
-0xff,
-0x1,
-0x3,
-0x2,
-0x2,
-0x2,
-0x0,
-0x2,
-0x6,
-0x2,
-0x8,
-0x2,
-0x8,
-0x2,
-0x8,
-0x2,
-0x11,
-0x2,
-0xe,
-0x2,
-0x11,
-0x2,
-0xf,
-0x2,
-0x12,
-0x2,
-0x18,
-0x2,
-0x1c,
-0x2,
-0x1f,
-0x2,
-0x1f,
-0x2,
-0x20,
-0x2,
-0x21,
-0x2,
-0x22,
-0x2,
-0x28,
-0x2,
-0x2c,
-0x2,
-0x31,
-0x2,
-0x2c,
-0x2,
-0x34,
-0x2,
-0x30,
-0x2,
-0x31,
-0x2,
-0x2d,
-0x2,
-0x2e,
-0x2,
-0x2a,
-0x2,
-0x2d,
-0x2,
-0x2d,
-0x2,
-0x28,
-0x2,
-0x29,
-0x2,
-0x29,
-0x2,
-0x21,
-0x2,
-0x1d,
-0x2,
-0x12,
-0x2,
-0x12,
-0x2,
-0x13,
-0x2,
-0xc,
-0x2,
-0x12,
-0x2,
-0x9,
-0x2,
-0x3,
-0x2,
-0xf7,
-0x1,
-0xf6,
-0x1,
-0xf0,
-0x1,
-0xe9,
-0x1,
-0xe7,
-0x1,
-0xde,
-0x1,
-0xdc,
-0x1,
-0xd7,
-0x1,
-0xd0,
-0x1,
-0xd1,
-0x1,
-0xc9,
-0x1,
-0xc7,
-0x1,
-0xba,
-0x1,
-0xb5,
-0x1,
-0xb2,
-0x1,
-0xb0,
-0x1,
-0xa4,
-0x1,
-0xa2,
-0x1,
-0x9a,
-0x1,
-0x99,
-0x1,
-0x93,
-0x1,
-0x8d,
-0x1,
-0x8c,
-0x1,
-0x87,
-0x1,
-0x7e,
-0x1,
-0x79,
-0x1,
-0x7b,
-0x1,
-0x74,
-0x1,
-0x71,
-0x1,
-0x6c,
-0x1,
-0x6c,
-0x1,
-0x5e,
-0x1,
-0x59,
-0x1,
-0x4e,
-0x1,
-0x48,
-0x1,
-0x3e,
-0x1,
-0x2f,
-0x1,
-0x2b,
-0x1,
-0x24,
-0x1,
-0x1f,
-0x1,
-0x12,
-0x1,
-0xd,
-0x1,
-0x4,
-0x1,
-0xfd,
-0x0,
-0xf9,
-0x0,
-0xee,
-0x0,
-0xea,
-0x0,
-0xe7,
-0x0,
-0xdf,
-0x0,
-0xde,
-0x0,
-0xd4,
-0x0,
-0xd9,
-0x0,
-0xce,
-0x0,
-0xd0,
-0x0,
-0xc0,
-0x0,
-0xc3,
-0x0,
-0xc2,
-0x0,
-0xb9,
-0x0,
-0xb8,
-0x0,
-0xb6,
-0x0,
-0xb2,
-0x0,
-0xb5,
-0x0,
-0xa8,
-0x0,
-0xaa,
-0x0,
-0xa6,
-0x0,
-0xac,
-0x0,
-0xa4,
-0x0,
-0xa7,
-0x0,
-0xa3,
-0x0,
-0x9f,
-0x0,
-0x9f,
-0x0,
-0xa2,
-0x0,
-0xa0,
-0x0,
-0x9e,
-0x0,
-0xa2,
-0x0,
-0x9e,
-0x0,
-0xa5,
-0x0,
-0xa4,
-0x0,
-0xa4,
-0x0,
-0xa4,
-0x0,
-0x9f,
-0x0,
-0x9d,
-0x0,
-0xa0,
-0x0,
-0x9d,
-0x0,
-0xa2,
-0x0,
-0xa3,
-0x0,
-0x9e,
-0x0,
-0xa1,
-0x0,
-0xa0,
-0x0,
-0xa5,
-0x0,
-0xa5,
-0x0,
-0xa5,
-0x0,
-0xa5,
-0x0,
-0xa0,
-0x0,
-0x9e,
-0x0,
-0xa5,
-0x0,
-0xa4,
-0x0,
-0xac,
-0x0,
-0xa8,
-0x0,
-0xac,
-0x0,
-0xaf,
-0x0,
-0xac,
-0x0,
-0xb9,
-0x0,
-0xb1,
-0x0,
-0xbc,
-0x0,
-0xb4,
-0x0,
-0xbe,
-0x0,
-0xbd,
-0x0,
-0xbf,
-0x0,
-0xc0,
-0x0,
-0xc4,
-0x0,
-0xc7,
-0x0,
-0xc3,
-0x0,
-0xc5,
-0x0,
-0xc7,
-0x0,
-0xc4,
-0x0,
-0xc5,
-0x0,
-0xc8,
-0x0,
-0xd2,
-0x0,
-0xcd,
-0x0,
-0xd6,
-0x0,
-0xce,
-0x0,
-0xd3,
-0x0,
-0xcf,
-0x0,
-0xd5,
-0x0,
-0xd6,
-0x0,
-0xd5,
-0x0,
-0xd2,
-0x0,
-0xd3,
-0x0,
-0xd1,
-0x0,
-0xd6,
-0x0,
-0xd8,
-0x0,
-0xda,
-0x0,
-0xd9,
-0x0,
-0xdb,
-0x0,
-0xe0,
-0x0,
-0xe0,
-0x0,
-0xeb,
-0x0,
-0xe9,
-0x0,
-0xf1,
-0x0,
-0xf0,
-0x0,
-0xf6,
-0x0,
-0xfb,
-0x0,
-0xf7,
-0x0,
-0xfe,
-0x0,
-0xff,
-0x0,
-0x3,
-0x1,
-0x3,
-0x1,
-0x3,
-0x1,
-0xfc,
-0x0,
-0xfc,
-0x0,
-0xfd,
-0x0,
-0xf2,
-0x0,
-0xf2,
-0x0,
-0xe7,
-0x0,
-0xea,
-0x0,
-0xdd,
-0x0,
-0xdc,
-0x0,
-0xdf,
-0x0,
-0xd7,
-0x0,
-0xda,
-0x0,
-0xd1,
-0x0,
-0xd0,
-0x0,
-0xcf,
-0x0,
-0xcf,
-0x0,
-0xcd,
-0x0,
-0xcc,
-0x0,
-0xc7,
-0x0,
-0xca,
-0x0,
-0xca,
-0x0,
-0xc9,
-0x0,
-0xc6,
-0x0,
-0xc0,
-0x0,
-0xbf,
-0x0,
-0xbb,
-0x0,
-0xbd,
-0x0,
-0xb8,
-0x0,
-0xb6,
-0x0,
-0xb2,
-0x0,
-0xb0,
-0x0,
-0xad,
-0x0,
-0xa0,
-0x0,
-0xa4,
-0x0,
-0x96,
-0x0,
-0x99,
-0x0,
-0x92,
-0x0,
-0x91,
-0x0,
-0x8b,
-0x0,
-0x8f,
-0x0,
-0x87,
-0x0,
-0x8c,
-0x0,
-0x82,
-0x0,
-0x85,
-0x0,
-0x7b,
-0x0,
-0x7d,
-0x0,
-0x75,
-0x0,
-0x79,
-0x0,
-0x75,
-0x0,
-0x79,
-0x0,
-0x74,
-0x0,
-0x74,
-0x0,
-0x74,
-0x0,
-0x6e,
-0x0,
-0x71,
-0x0,
-0x71,
-0x0,
-0x74,
-0x0,
-0x6b,
-0x0,
-0x6e,
-0x0,
-0x70,
-0x0,
-0x72,
-0x0,
-0x69,
-0x0,
-0x6b,
-0x0,
-0x6a,
-0x0,
-0x68,
-0x0,
-0x67,
-0x0,
-0x67,
-0x0,
-0x67,
-0x0,
-0x61,
-0x0,
-0x61,
-0x0,
-0x5d,
-0x0,
-0x59,
-0x0,
-0x5b,
-0x0,
-0x51,
-0x0,
-0x4d,
-0x0,
-0x4a,
-0x0,
-0x44,
-0x0,
-0x45,
-0x0,
-0x3c,
-0x0,
-0x3b,
-0x0,
-0x2c,
-0x0,
-0x2c,
-0x0,
-0x22,
-0x0,
-0x1e,
-0x0,
-0x1f,
-0x0,
-0x1c,
-0x0,
-0x20,
-0x0,
-0x16,
-0x0,
-0x1a,
-0x0,
-0x15,
-0x0,
-0x7,
-0x0,
-0x6,
-0x0,
-0x6,
-0x0,
-0x6,
-0x0,
-0xff,
-0xff,
-0x1,
-0x0,
-0xfe,
-0xff,
-0xf5,
-0xff,
-0xf3,
-0xff,
-0xef,
-0xff,
-0xf4,
-0xff,
-0xeb,
-0xff,
-0xef,
-0xff,
-0xe7,
-0xff,
-0xe6,
-0xff,
-0xe1,
-0xff,
-0xe1,
-0xff,
-0xdc,
-0xff,
-0xdb,
-0xff,
-0xda,
-0xff,
-0xcf,
-0xff,
-0xc6,
-0xff,
-0xc6,
-0xff,
-0xca,
-0xff,
-0xcd,
-0xff,
-0xc8,
-0xff,
-0xc5,
-0xff,
-0xc8,
-0xff,
-0xbf,
-0xff,
-0xc0,
-0xff,
-0xbf,
-0xff,
-0xc0,
-0xff,
-0xbc,
-0xff,
-0xbd,
-0xff,
-0xb6,
-0xff,
-0xba,
-0xff,
-0xb3,
-0xff,
-0xb9,
-0xff,
-0xb2,
-0xff,
-0xb8,
-0xff,
-0xb2,
-0xff,
-0xb4,
-0xff,
-0xb5,
-0xff,
-0xb4,
-0xff,
-0xb5,
-0xff,
-0xb6,
-0xff,
-0xb3,
-0xff,
-0xb9,
-0xff,
-0xb1,
-0xff,
-0xb1,
-0xff,
-0xaf,
-0xff,
-0xaa,
-0xff,
-0xae,
-0xff,
-0xad,
-0xff,
-0xa8,
-0xff,
-0xa5,
-0xff,
-0xa1,
-0xff,
-0xa1,
-0xff,
-0xa0,
-0xff,
-0x9a,
-0xff,
-0x9a,
-0xff,
-0x8d,
-0xff,
-0x8a,
-0xff,
-0x87,
-0xff,
-0x83,
-0xff,
-0x7b,
-0xff,
-0x75,
-0xff,
-0x73,
-0xff,
-0x6c,
-0xff,
-0x6b,
-0xff,
-0x60,
-0xff,
-0x62,
-0xff,
-0x5d,
-0xff,
-0x5f,
-0xff,
-0x57,
-0xff,
-0x4f,
-0xff,
-0x51,
-0xff,
-0x4f,
-0xff,
-0x4e,
-0xff,
-0x4c,
-0xff,
-0x49,
-0xff,
-0x44,
-0xff,
-0x42,
-0xff,
-0x3d,
-0xff,
-0x41,
-0xff,
-0x3d,
-0xff,
-0x40,
-0xff,
-0x39,
-0xff,
-0x37,
-0xff,
-0x3a,
-0xff,
-0x30,
-0xff,
-0x38,
-0xff,
-0x30,
-0xff,
-0x2f,
-0xff,
-0x38,
-0xff,
-0x33,
-0xff,
-0x3e,
-0xff,
-0x36,
-0xff,
-0x3b,
-0xff,
-0x36,
-0xff,
-0x37,
-0xff,
-0x37,
-0xff,
-0x3a,
-0xff,
-0x35,
-0xff,
-0x3a,
-0xff,
-0x36,
-0xff,
-0x3a,
-0xff,
-0x39,
-0xff,
-0x3b,
-0xff,
-0x41,
-0xff,
-0x3e,
-0xff,
-0x47,
-0xff,
-0x46,
-0xff,
-0x4d,
-0xff,
-0x4a,
-0xff,
-0x4f,
-0xff,
-0x4e,
-0xff,
-0x52,
-0xff,
-0x55,
-0xff,
-0x50,
-0xff,
-0x4f,
-0xff,
-0x53,
-0xff,
-0x50,
-0xff,
-0x56,
-0xff,
-0x51,
-0xff,
-0x56,
-0xff,
-0x56,
-0xff,
-0x57,
-0xff,
-0x55,
-0xff,
-0x5b,
-0xff,
-0x57,
-0xff,
-0x55,
-0xff,
-0x53,
-0xff,
-0x54,
-0xff,
-0x5b,
-0xff,
-0x5d,
-0xff,
-0x5e,
-0xff,
-0x69,
-0xff,
-0x67,
-0xff,
-0x6a,
-0xff,
-0x72,
-0xff,
-0x79,
-0xff,
-0x7a,
-0xff,
-0x77,
-0xff,
-0x82,
-0xff,
-0x7f,
-0xff,
-0x85,
-0xff,
-0x86,
-0xff,
-0x89,
-0xff,
-0x84,
-0xff,
-0x8b,
-0xff,
-0x8d,
-0xff,
-0x8e,
-0xff,
-0x93,
-0xff,
-0x95,
-0xff,
-0x94,
-0xff,
-0x94,
-0xff,
-0x94,
-0xff,
-0x98,
-0xff,
-0x9a,
-0xff,
-0x9d,
-0xff,
-0x9d,
-0xff,
-0xa6,
-0xff,
-0xa5,
-0xff,
-0xac,
-0xff,
-0xa9,
-0xff,
-0xaf,
-0xff,
-0xb1,
-0xff,
-0xb1,
-0xff,
-0xb3,
-0xff,
-0xb6,
-0xff,
-0xb6,
-0xff,
-0xb9,
-0xff,
-0xae,
-0xff,
-0xb5,
-0xff,
-0xb0,
-0xff,
-0xb2,
-0xff,
-0xb8,
-0xff,
-0xaf,
-0xff,
-0xb9,
-0xff,
-0xb1,
-0xff,
-0xb8,
-0xff,
-0xbc,
-0xff,
-0xc0,
-0xff,
-0xbf,
-0xff,
-0xc6,
-0xff,
-0xbe,
-0xff,
-0xc6,
-0xff,
-0xc2,
-0xff,
-0xca,
-0xff,
-0xc2,
-0xff,
-0xc6,
-0xff,
-0xc3,
-0xff,
-0xc7,
-0xff,
-0xc8,
-0xff,
-0xc5,
-0xff,
-0xc7,
-0xff,
-0xc5,
-0xff,
-0xcd,
-0xff,
-0xcb,
-0xff,
-0xc9,
-0xff,
-0xc9,
-0xff,
-0xc7,
-0xff,
-0xcc,
-0xff,
-0xc2,
-0xff,
-0xc5,
-0xff,
-0xc1,
-0xff,
-0xc2,
-0xff,
-0xc5,
-0xff,
-0xc3,
-0xff,
-0xc4,
-0xff,
-0xc0,
-0xff,
-0xc3,
-0xff,
-0xc5,
-0xff,
-0xc6,
-0xff,
-0xc5,
-0xff,
-0xc9,
-0xff,
-0xc2,
-0xff,
-0xc0,
-0xff,
-0xc6,
-0xff,
-0xc5,
-0xff,
-0xc3,
-0xff,
-0xc0,
-0xff,
-0xc3,
-0xff,
-0xbd,
-0xff,
-0xc4,
-0xff,
-0xc1,
-0xff,
-0xc5,
-0xff,
-0xc0,
-0xff,
-0xc3,
-0xff,
-0xc5,
-0xff,
-0xbb,
-0xff,
-0xbe,
-0xff,
-0xb7,
-0xff,
-0xbf,
-0xff,
-0xbd,
-0xff,
-0xbb,
-0xff,
-0xc1,
-0xff,
-0xb8,
-0xff,
-0xbd,
-0xff,
-0xba,
-0xff,
-0xb7,
-0xff,
-0xb8,
-0xff,
-0xb7,
-0xff,
-0xba,
-0xff,
-0xb8,
-0xff,
-0xbb,
-0xff,
-0xb4,
-0xff,
-0xb7,
-0xff,
-0xb1,
-0xff,
-0xae,
-0xff,
-0xaf,
-0xff,
-0xae,
-0xff,
-0xad,
-0xff,
-0xae,
-0xff,
-0xa7,
-0xff,
-0xa6,
-0xff,
-0xa4,
-0xff,
-0xa2,
-0xff,
-0xa2,
-0xff,
-0x9f,
-0xff,
-0x98,
-0xff,
-0x96,
-0xff,
-0x8f,
-0xff,
-0x96,
-0xff,
-0x90,
-0xff,
-0x94,
-0xff,
-0x92,
-0xff,
-0x93,
-0xff,
-0x92,
-0xff,
-0x8f,
-0xff,
-0x91,
-0xff,
-0x8e,
-0xff,
-0x88,
-0xff,
-0x88,
-0xff,
-0x83,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x78,
-0xff,
-0x77,
-0xff,
-0x70,
-0xff,
-0x73,
-0xff,
-0x6f,
-0xff,
-0x6e,
-0xff,
-0x68,
-0xff,
-0x65,
-0xff,
-0x64,
-0xff,
-0x5c,
-0xff,
-0x58,
-0xff,
-0x50,
-0xff,
-0x49,
-0xff,
-0x49,
-0xff,
-0x46,
-0xff,
-0x47,
-0xff,
-0x35,
-0xff,
-0x37,
-0xff,
-0x31,
-0xff,
-0x2e,
-0xff,
-0x2c,
-0xff,
-0x23,
-0xff,
-0x29,
-0xff,
-0x21,
-0xff,
-0x20,
-0xff,
-0x1a,
-0xff,
-0x17,
-0xff,
-0x17,
-0xff,
-0x16,
-0xff,
-0x10,
-0xff,
-0x16,
-0xff,
-0x10,
-0xff,
-0x11,
-0xff,
-0xa,
-0xff,
-0x8,
-0xff,
-0x4,
-0xff,
-0x1,
-0xff,
-0x3,
-0xff,
-0xf9,
-0xfe,
-0xf9,
-0xfe,
-0xf1,
-0xfe,
-0xee,
-0xfe,
-0xeb,
-0xfe,
-0xe7,
-0xfe,
-0xe8,
-0xfe,
-0xdb,
-0xfe,
-0xdb,
-0xfe,
-0xd1,
-0xfe,
-0xd6,
-0xfe,
-0xd4,
-0xfe,
-0xce,
-0xfe,
-0xc6,
-0xfe,
-0xb9,
-0xfe,
-0xb2,
-0xfe,
-0xb1,
-0xfe,
-0xaa,
-0xfe,
-0xa4,
-0xfe,
-0xa0,
-0xfe,
-0x99,
-0xfe,
-0x9a,
-0xfe,
-0x94,
-0xfe,
-0x8d,
-0xfe,
-0x8c,
-0xfe,
-0x88,
-0xfe,
-0x8a,
-0xfe,
-0x8e,
-0xfe,
-0x8e,
-0xfe,
-0x91,
-0xfe,
-0x8c,
-0xfe,
-0x8d,
-0xfe,
-0x83,
-0xfe,
-0x81,
-0xfe,
-0x80,
-0xfe,
-0x85,
-0xfe,
-0x87,
-0xfe,
-0x82,
-0xfe,
-0x87,
-0xfe,
-0x84,
-0xfe,
-0x82,
-0xfe,
-0x85,
-0xfe,
-0x85,
-0xfe,
-0x81,
-0xfe,
-0x81,
-0xfe,
-0x82,
-0xfe,
-0x8a,
-0xfe,
-0x82,
-0xfe,
-0x87,
-0xfe,
-0x7f,
-0xfe,
-0x7d,
-0xfe,
-0x82,
-0xfe,
-0x7f,
-0xfe,
-0x84,
-0xfe,
-0x82,
-0xfe,
-0x8a,
-0xfe,
-0x87,
-0xfe,
-0x89,
-0xfe,
-0x86,
-0xfe,
-0x87,
-0xfe,
-0x84,
-0xfe,
-0x7f,
-0xfe,
-0x7f,
-0xfe,
-0x7e,
-0xfe,
-0x75,
-0xfe,
-0x72,
-0xfe,
-0x70,
-0xfe,
-0x73,
-0xfe,
-0x70,
-0xfe,
-0x6e,
-0xfe,
-0x6c,
-0xfe,
-0x68,
-0xfe,
-0x6a,
-0xfe,
-0x6a,
-0xfe,
-0x6a,
-0xfe,
-0x72,
-0xfe,
-0x6d,
-0xfe,
-0x7a,
-0xfe,
-0x76,
-0xfe,
-0x7c,
-0xfe,
-0x82,
-0xfe,
-0x87,
-0xfe,
-0x8d,
-0xfe,
-0x91,
-0xfe,
-0x97,
-0xfe,
-0x98,
-0xfe,
-0xa1,
-0xfe,
-0xa5,
-0xfe,
-0xa7,
-0xfe,
-0xac,
-0xfe,
-0xb3,
-0xfe,
-0xbe,
-0xfe,
-0xc7,
-0xfe,
-0xcd,
-0xfe,
-0xd3,
-0xfe,
-0xd4,
-0xfe,
-0xe0,
-0xfe,
-0xe3,
-0xfe,
-0xf1,
-0xfe,
-0xf6,
-0xfe,
-0xff,
-0xfe,
-0x1,
-0xff,
-0xe,
-0xff,
-0xf,
-0xff,
-0x18,
-0xff,
-0x18,
-0xff,
-0x26,
-0xff,
-0x28,
-0xff,
-0x31,
-0xff,
-0x3b,
-0xff,
-0x3c,
-0xff,
-0x43,
-0xff,
-0x45,
-0xff,
-0x49,
-0xff,
-0x4b,
-0xff,
-0x4f,
-0xff,
-0x53,
-0xff,
-0x56,
-0xff,
-0x5b,
-0xff,
-0x59,
-0xff,
-0x5b,
-0xff,
-0x5c,
-0xff,
-0x5f,
-0xff,
-0x62,
-0xff,
-0x65,
-0xff,
-0x68,
-0xff,
-0x69,
-0xff,
-0x6b,
-0xff,
-0x70,
-0xff,
-0x71,
-0xff,
-0x73,
-0xff,
-0x79,
-0xff,
-0x76,
-0xff,
-0x7a,
-0xff,
-0x7b,
-0xff,
-0x82,
-0xff,
-0x81,
-0xff,
-0x88,
-0xff,
-0x8e,
-0xff,
-0x93,
-0xff,
-0x9e,
-0xff,
-0x9c,
-0xff,
-0xa4,
-0xff,
-0xa0,
-0xff,
-0xac,
-0xff,
-0xa5,
-0xff,
-0xa5,
-0xff,
-0xa7,
-0xff,
-0xa1,
-0xff,
-0xaa,
-0xff,
-0xa4,
-0xff,
-0xa8,
-0xff,
-0xa8,
-0xff,
-0xab,
-0xff,
-0xae,
-0xff,
-0xb2,
-0xff,
-0xad,
-0xff,
-0xaa,
-0xff,
-0xaf,
-0xff,
-0xb0,
-0xff,
-0xb4,
-0xff,
-0xb2,
-0xff,
-0xb5,
-0xff,
-0xae,
-0xff,
-0xb8,
-0xff,
-0xb6,
-0xff,
-0xc3,
-0xff,
-0xb8,
-0xff,
-0xbc,
-0xff,
-0xb2,
-0xff,
-0xbe,
-0xff,
-0xbf,
-0xff,
-0xc1,
-0xff,
-0xbf,
-0xff,
-0xbe,
-0xff,
-0xc3,
-0xff,
-0xc3,
-0xff,
-0xcb,
-0xff,
-0xca,
-0xff,
-0xcb,
-0xff,
-0xca,
-0xff,
-0xd3,
-0xff,
-0xdb,
-0xff,
-0xdf,
-0xff,
-0xe3,
-0xff,
-0xe8,
-0xff,
-0xef,
-0xff,
-0xe9,
-0xff,
-0xe9,
-0xff,
-0xf0,
-0xff,
-0xf7,
-0xff,
-0xf9,
-0xff,
-0xfe,
-0xff,
-0x1,
-0x0,
-0x6,
-0x0,
-0x11,
-0x0,
-0x16,
-0x0,
-0x20,
-0x0,
-0x1d,
-0x0,
-0x21,
-0x0,
-0x23,
-0x0,
-0x29,
-0x0,
-0x23,
-0x0,
-0x2a,
-0x0,
-0x29,
-0x0,
-0x30,
-0x0,
-0x2e,
-0x0,
-0x34,
-0x0,
-0x2c,
-0x0,
-0x37,
-0x0,
-0x35,
-0x0,
-0x3c,
-0x0,
-0x3b,
-0x0,
-0x3d,
-0x0,
-0x3e,
-0x0,
-0x40,
-0x0,
-0x43,
-0x0,
-0x47,
-0x0,
-0x4e,
-0x0,
-0x4f,
-0x0,
-0x58,
-0x0,
-0x58,
-0x0,
-0x5d,
-0x0,
-0x62,
-0x0,
-0x66,
-0x0,
-0x6c,
-0x0,
-0x69,
-0x0,
-0x76,
-0x0,
-0x77,
-0x0,
-0x81,
-0x0,
-0x80,
-0x0,
-0x8a,
-0x0,
-0x8f,
-0x0,
-0x98,
-0x0,
-0x9f,
-0x0,
-0x9e,
-0x0,
-0xa8,
-0x0,
-0xa7,
-0x0,
-0xb0,
-0x0,
-0xb2,
-0x0,
-0xb6,
-0x0,
-0xba,
-0x0,
-0xba,
-0x0,
-0xc2,
-0x0,
-0xc3,
-0x0,
-0xca,
-0x0,
-0xcb,
-0x0,
-0xd1,
-0x0,
-0xd1,
-0x0,
-0xdd,
-0x0,
-0xe0,
-0x0,
-0xe6,
-0x0,
-0xe9,
-0x0,
-0xf3,
-0x0,
-0xf5,
-0x0,
-0xfe,
-0x0,
-0x3,
-0x1,
-0xa,
-0x1,
-0xf,
-0x1,
-0x19,
-0x1,
-0x1b,
-0x1,
-0x21,
-0x1,
-0x2e,
-0x1,
-0x2e,
-0x1,
-0x3f,
-0x1,
-0x3d,
-0x1,
-0x51,
-0x1,
-0x4f,
-0x1,
-0x60,
-0x1,
-0x62,
-0x1,
-0x6a,
-0x1,
-0x6e,
-0x1,
-0x76,
-0x1,
-0x7a,
-0x1,
-0x7f,
-0x1,
-0x83,
-0x1,
-0x84,
-0x1,
-0x8d,
-0x1,
-0x8d,
-0x1,
-0x95,
-0x1,
-0x99,
-0x1,
-0x9f,
-0x1,
-0x9e,
-0x1,
-0xa9,
-0x1,
-0xac,
-0x1,
-0xb7,
-0x1,
-0xc1,
-0x1,
-0xc5,
-0x1,
-0xce,
-0x1,
-0xd5,
-0x1,
-0xdc,
-0x1,
-0xe1,
-0x1,
-0xed,
-0x1,
-0xf4,
-0x1,
-0xfd,
-0x1,
-0x2,
-0x2,
-0xf,
-0x2,
-0x16,
-0x2,
-0x23,
-0x2,
-0x30,
-0x2,
-0x33,
-0x2,
-0x41,
-0x2,
-0x48,
-0x2,
-0x56,
-0x2,
-0x56,
-0x2,
-0x61,
-0x2,
-0x6a,
-0x2,
-0x6c,
-0x2,
-0x7f,
-0x2,
-0x81,
-0x2,
-0x92,
-0x2,
-0x92,
-0x2,
-0xa0,
-0x2,
-0x9d,
-0x2,
-0xa6,
-0x2,
-0xab,
-0x2,
-0xab,
-0x2,
-0xb7,
-0x2,
-0xb8,
-0x2,
-0xbb,
-0x2,
-0xbf,
-0x2,
-0xc0,
-0x2,
-0xc4,
-0x2,
-0xc2,
-0x2,
-0xca,
-0x2,
-0xcb,
-0x2,
-0xd0,
-0x2,
-0xd5,
-0x2,
-0xd4,
-0x2,
-0xd1,
-0x2,
-0xcf,
-0x2,
-0xd2,
-0x2,
-0xce,
-0x2,
-0xcf,
-0x2,
-0xcc,
-0x2,
-0xcc,
-0x2,
-0xc8,
-0x2,
-0xd0,
-0x2,
-0xd0,
-0x2,
-0xcc,
-0x2,
-0xcf,
-0x2,
-0xc9,
-0x2,
-0xcb,
-0x2,
-0xc7,
-0x2,
-0xcc,
-0x2,
-0xc8,
-0x2,
-0xc5,
-0x2,
-0xbf,
-0x2,
-0xc1,
-0x2,
-0xc4,
-0x2,
-0xbe,
-0x2,
-0xbe,
-0x2,
-0xb5,
-0x2,
-0xb8,
-0x2,
-0xb2,
-0x2,
-0xb1,
-0x2,
-0xab,
-0x2,
-0xac,
-0x2,
-0xa8,
-0x2,
-0xaa,
-0x2,
-0xa6,
-0x2,
-0x9f,
-0x2,
-0x93,
-0x2,
-0x8e,
-0x2,
-0x8d,
-0x2,
-0x85,
-0x2,
-0x87,
-0x2,
-0x80,
-0x2,
-0x7d,
-0x2,
-0x7c,
-0x2,
-0x76,
-0x2,
-0x72,
-0x2,
-0x70,
-0x2,
-0x6f,
-0x2,
-0x6e,
-0x2,
-0x6b,
-0x2,
-0x65,
-0x2,
-0x5c,
-0x2,
-0x5b,
-0x2,
-0x53,
-0x2,
-0x4c,
-0x2,
-0x46,
-0x2,
-0x43,
-0x2,
-0x40,
-0x2,
-0x37,
-0x2,
-0x37,
-0x2,
-0x28,
-0x2,
-0x2a,
-0x2,
-0x1b,
-0x2,
-0x1c,
-0x2,
-0x11,
-0x2,
-0x11,
-0x2,
-0x8,
-0x2,
-0x0,
-0x2,
-0xff,
-0x1,
-0xf7,
-0x1,
-0xf4,
-0x1,
-0xec,
-0x1,
-0xe1,
-0x1,
-0xe0,
-0x1,
-0xd5,
-0x1,
-0xd3,
-0x1,
-0xcc,
-0x1,
-0xcc,
-0x1,
-0xbd,
-0x1,
-0xba,
-0x1,
-0xb6,
-0x1,
-0xb2,
-0x1,
-0xa7,
-0x1,
-0xa3,
-0x1,
-0x9a,
-0x1,
-0x92,
-0x1,
-0x96,
-0x1,
-0x83,
-0x1,
-0x84,
-0x1,
-0x7b,
-0x1,
-0x7b,
-0x1,
-0x76,
-0x1,
-0x6f,
-0x1,
-0x6b,
-0x1,
-0x64,
-0x1,
-0x5b,
-0x1,
-0x57,
-0x1,
-0x4c,
-0x1,
-0x47,
-0x1,
-0x41,
-0x1,
-0x39,
-0x1,
-0x33,
-0x1,
-0x27,
-0x1,
-0x21,
-0x1,
-0x17,
-0x1,
-0xf,
-0x1,
-0x8,
-0x1,
-0xf9,
-0x0,
-0xed,
-0x0,
-0xe0,
-0x0,
-0xd6,
-0x0,
-0xcf,
-0x0,
-0xc2,
-0x0,
-0xb9,
-0x0,
-0xa9,
-0x0,
-0xaa,
-0x0,
-0x96,
-0x0,
-0x8e,
-0x0,
-0x81,
-0x0,
-0x79,
-0x0,
-0x72,
-0x0,
-0x6c,
-0x0,
-0x5e,
-0x0,
-0x52,
-0x0,
-0x48,
-0x0,
-0x3c,
-0x0,
-0x3a,
-0x0,
-0x2c,
-0x0,
-0x2a,
-0x0,
-0x23,
-0x0,
-0x22,
-0x0,
-0x1b,
-0x0,
-0x1a,
-0x0,
-0x11,
-0x0,
-0xb,
-0x0,
-0x0,
-0x0,
-0x0,
-0x0,
-0xf8,
-0xff,
-0xec,
-0xff,
-0xe7,
-0xff,
-0xdf,
-0xff,
-0xd9,
-0xff,
-0xd5,
-0xff,
-0xd1,
-0xff,
-0xcb,
-0xff,
-0xc1,
-0xff,
-0xbc,
-0xff,
-0xb6,
-0xff,
-0xb8,
-0xff,
-0xb2,
-0xff,
-0xb0,
-0xff,
-0xaa,
-0xff,
-0xa0,
-0xff,
-0x9d,
-0xff,
-0x93,
-0xff,
-0x94,
-0xff,
-0x86,
-0xff,
-0x8a,
-0xff,
-0x77,
-0xff,
-0x75,
-0xff,
-0x6d,
-0xff,
-0x65,
-0xff,
-0x62,
-0xff,
-0x5b,
-0xff,
-0x56,
-0xff,
-0x4c,
-0xff,
-0x40,
-0xff,
-0x3c,
-0xff,
-0x35,
-0xff,
-0x2e,
-0xff,
-0x2a,
-0xff,
-0x1a,
-0xff,
-0x1a,
-0xff,
-0x12,
-0xff,
-0x10,
-0xff,
-0xa,
-0xff,
-0x3,
-0xff,
-0xf9,
-0xfe,
-0xf7,
-0xfe,
-0xef,
-0xfe,
-0xed,
-0xfe,
-0xe6,
-0xfe,
-0xe4,
-0xfe,
-0xde,
-0xfe,
-0xd5,
-0xfe,
-0xd7,
-0xfe,
-0xd0,
-0xfe,
-0xca,
-0xfe,
-0xc5,
-0xfe,
-0xbf,
-0xfe,
-0xbe,
-0xfe,
-0xb1,
-0xfe,
-0xb4,
-0xfe,
-0xaf,
-0xfe,
-0xaf,
-0xfe,
-0x9e,
-0xfe,
-0x9d,
-0xfe,
-0x92,
-0xfe,
-0x92,
-0xfe,
-0x8a,
-0xfe,
-0x86,
-0xfe,
-0x83,
-0xfe,
-0x7b,
-0xfe,
-0x7b,
-0xfe,
-0x7a,
-0xfe,
-0x76,
-0xfe,
-0x78,
-0xfe,
-0x6f,
-0xfe,
-0x6f,
-0xfe,
-0x6c,
-0xfe,
-0x6d,
-0xfe,
-0x6a,
-0xfe,
-0x69,
-0xfe,
-0x68,
-0xfe,
-0x69,
-0xfe,
-0x66,
-0xfe,
-0x69,
-0xfe,
-0x68,
-0xfe,
-0x6b,
-0xfe,
-0x66,
-0xfe,
-0x6a,
-0xfe,
-0x67,
-0xfe,
-0x69,
-0xfe,
-0x5b,
-0xfe,
-0x60,
-0xfe,
-0x5c,
-0xfe,
-0x5d,
-0xfe,
-0x50,
-0xfe,
-0x51,
-0xfe,
-0x46,
-0xfe,
-0x4a,
-0xfe,
-0x49,
-0xfe,
-0x42,
-0xfe,
-0x40,
-0xfe,
-0x3a,
-0xfe,
-0x37,
-0xfe,
-0x34,
-0xfe,
-0x37,
-0xfe,
-0x2d,
-0xfe,
-0x2d,
-0xfe,
-0x26,
-0xfe,
-0x2c,
-0xfe,
-0x21,
-0xfe,
-0x26,
-0xfe,
-0x24,
-0xfe,
-0x26,
-0xfe,
-0x2a,
-0xfe,
-0x2c,
-0xfe,
-0x28,
-0xfe,
-0x2c,
-0xfe,
-0x30,
-0xfe,
-0x2d,
-0xfe,
-0x34,
-0xfe,
-0x2c,
-0xfe,
-0x34,
-0xfe,
-0x32,
-0xfe,
-0x32,
-0xfe,
-0x2f,
-0xfe,
-0x2d,
-0xfe,
-0x30,
-0xfe,
-0x2f,
-0xfe,
-0x33,
-0xfe,
-0x2d,
-0xfe,
-0x37,
-0xfe,
-0x31,
-0xfe,
-0x35,
-0xfe,
-0x2d,
-0xfe,
-0x3a,
-0xfe,
-0x2b,
-0xfe,
-0x36,
-0xfe,
-0x32,
-0xfe,
-0x35,
-0xfe,
-0x33,
-0xfe,
-0x2f,
-0xfe,
-0x2f,
-0xfe,
-0x33,
-0xfe,
-0x31,
-0xfe,
-0x35,
-0xfe,
-0x30,
-0xfe,
-0x37,
-0xfe,
-0x37,
-0xfe,
-0x3a,
-0xfe,
-0x3b,
-0xfe,
-0x34,
-0xfe,
-0x36,
-0xfe,
-0x35,
-0xfe,
-0x3c,
-0xfe,
-0x39,
-0xfe,
-0x37,
-0xfe,
-0x3a,
-0xfe,
-0x39,
-0xfe,
-0x3b,
-0xfe,
-0x3b,
-0xfe,
-0x3a,
-0xfe,
-0x39,
-0xfe,
-0x37,
-0xfe,
-0x3c,
-0xfe,
-0x3b,
-0xfe,
-0x45,
-0xfe,
-0x45,
-0xfe,
-0x4a,
-0xfe,
-0x48,
-0xfe,
-0x4c,
-0xfe,
-0x4a,
-0xfe,
-0x4d,
-0xfe,
-0x4f,
-0xfe,
-0x51,
-0xfe,
-0x57,
-0xfe,
-0x5b,
-0xfe,
-0x5e,
-0xfe,
-0x64,
-0xfe,
-0x65,
-0xfe,
-0x6b,
-0xfe,
-0x6e,
-0xfe,
-0x6f,
-0xfe,
-0x75,
-0xfe,
-0x76,
-0xfe,
-0x79,
-0xfe,
-0x7d,
-0xfe,
-0x81,
-0xfe,
-0x8a,
-0xfe,
-0x88,
-0xfe,
-0x8d,
-0xfe,
-0x91,
-0xfe,
-0x96,
-0xfe,
-0x9b,
-0xfe,
-0x9e,
-0xfe,
-0xa8,
-0xfe,
-0xaf,
-0xfe,
-0xb1,
-0xfe,
-0xae,
-0xfe,
-0xb1,
-0xfe,
-0xba,
-0xfe,
-0xba,
-0xfe,
-0xc4,
-0xfe,
-0xc7,
-0xfe,
-0xce,
-0xfe,
-0xca,
-0xfe,
-0xd2,
-0xfe,
-0xd4,
-0xfe,
-0xd9,
-0xfe,
-0xdb,
-0xfe,
-0xe3,
-0xfe,
-0xde,
-0xfe,
-0xe4,
-0xfe,
-0xe8,
-0xfe,
-0xef,
-0xfe,
-0xf9,
-0xfe,
-0xf3,
-0xfe,
-0xfe,
-0xfe,
-0xf7,
-0xfe,
-0xfd,
-0xfe,
-0xff,
-0xfe,
-0x0,
-0xff,
-0xfd,
-0xfe,
-0x1,
-0xff,
-0x0,
-0xff,
-0x9,
-0xff,
-0xa,
-0xff,
-0xb,
-0xff,
-0x12,
-0xff,
-0x12,
-0xff,
-0x1e,
-0xff,
-0x1b,
-0xff,
-0x2b,
-0xff,
-0x2a,
-0xff,
-0x2d,
-0xff,
-0x2e,
-0xff,
-0x30,
-0xff,
-0x3a,
-0xff,
-0x40,
-0xff,
-0x3e,
-0xff,
-0x49,
-0xff,
-0x48,
-0xff,
-0x4d,
-0xff,
-0x4f,
-0xff,
-0x56,
-0xff,
-0x55,
-0xff,
-0x55,
-0xff,
-0x57,
-0xff,
-0x58,
-0xff,
-0x61,
-0xff,
-0x5f,
-0xff,
-0x60,
-0xff,
-0x5c,
-0xff,
-0x61,
-0xff,
-0x5f,
-0xff,
-0x62,
-0xff,
-0x5e,
-0xff,
-0x5f,
-0xff,
-0x5f,
-0xff,
-0x5c,
-0xff,
-0x65,
-0xff,
-0x63,
-0xff,
-0x67,
-0xff,
-0x62,
-0xff,
-0x6e,
-0xff,
-0x69,
-0xff,
-0x69,
-0xff,
-0x6b,
-0xff,
-0x69,
-0xff,
-0x70,
-0xff,
-0x70,
-0xff,
-0x78,
-0xff,
-0x73,
-0xff,
-0x7c,
-0xff,
-0x79,
-0xff,
-0x84,
-0xff,
-0x7e,
-0xff,
-0x86,
-0xff,
-0x89,
-0xff,
-0x8e,
-0xff,
-0x8d,
-0xff,
-0x93,
-0xff,
-0x93,
-0xff,
-0x9a,
-0xff,
-0x91,
-0xff,
-0x9c,
-0xff,
-0x96,
-0xff,
-0x9b,
-0xff,
-0x96,
-0xff,
-0x9f,
-0xff,
-0x9a,
-0xff,
-0x9d,
-0xff,
-0x9a,
-0xff,
-0x9b,
-0xff,
-0x9f,
-0xff,
-0x9f,
-0xff,
-0xa4,
-0xff,
-0xa3,
-0xff,
-0xa4,
-0xff,
-0xa6,
-0xff,
-0xa6,
-0xff,
-0xaf,
-0xff,
-0xab,
-0xff,
-0xb6,
-0xff,
-0xaf,
-0xff,
-0xb9,
-0xff,
-0xb8,
-0xff,
-0xbe,
-0xff,
-0xbd,
-0xff,
-0xc8,
-0xff,
-0xcc,
-0xff,
-0xce,
-0xff,
-0xd5,
-0xff,
-0xd4,
-0xff,
-0xdb,
-0xff,
-0xde,
-0xff,
-0xdd,
-0xff,
-0xe3,
-0xff,
-0xe4,
-0xff,
-0xec,
-0xff,
-0xf2,
-0xff,
-0xf3,
-0xff,
-0xfb,
-0xff,
-0xfa,
-0xff,
-0x4,
-0x0,
-0x1,
-0x0,
-0xa,
-0x0,
-0x6,
-0x0,
-0x15,
-0x0,
-0xf,
-0x0,
-0x14,
-0x0,
-0x18,
-0x0,
-0x18,
-0x0,
-0x1d,
-0x0,
-0x1c,
-0x0,
-0x22,
-0x0,
-0x20,
-0x0,
-0x27,
-0x0,
-0x29,
-0x0,
-0x29,
-0x0,
-0x28,
-0x0,
-0x2f,
-0x0,
-0x2e,
-0x0,
-0x35,
-0x0,
-0x3e,
-0x0,
-0x41,
-0x0,
-0x4e,
-0x0,
-0x4d,
-0x0,
-0x5b,
-0x0,
-0x58,
-0x0,
-0x67,
-0x0,
-0x65,
-0x0,
-0x76,
-0x0,
-0x7b,
-0x0,
-0x80,
-0x0,
-0x8e,
-0x0,
-0x94,
-0x0,
-0xa0,
-0x0,
-0xa2,
-0x0,
-0xae,
-0x0,
-0xb0,
-0x0,
-0xb3,
-0x0,
-0xc0,
-0x0,
-0xc1,
-0x0,
-0xc6,
-0x0,
-0xca,
-0x0,
-0xcc,
-0x0,
-0xd7,
-0x0,
-0xd7,
-0x0,
-0xe0,
-0x0,
-0xe8,
-0x0,
-0xef,
-0x0,
-0xf3,
-0x0,
-0xf9,
-0x0,
-0xf6,
-0x0,
-0xfa,
-0x0,
-0x4,
-0x1,
-0x8,
-0x1,
-0x13,
-0x1,
-0x13,
-0x1,
-0x1d,
-0x1,
-0x22,
-0x1,
-0x28,
-0x1,
-0x33,
-0x1,
-0x32,
-0x1,
-0x3a,
-0x1,
-0x3a,
-0x1,
-0x42,
-0x1,
-0x4b,
-0x1,
-0x53,
-0x1,
-0x5b,
-0x1,
-0x64,
-0x1,
-0x68,
-0x1,
-0x70,
-0x1,
-0x6e,
-0x1,
-0x78,
-0x1,
-0x7e,
-0x1,
-0x80,
-0x1,
-0x88,
-0x1,
-0x8e,
-0x1,
-0x95,
-0x1,
-0x9a,
-0x1,
-0xa1,
-0x1,
-0xa9,
-0x1,
-0xab,
-0x1,
-0xb1,
-0x1,
-0xb4,
-0x1,
-0xbb,
-0x1,
-0xbc,
-0x1,
-0xbd,
-0x1,
-0xbf,
-0x1,
-0xbd,
-0x1,
-0xc8,
-0x1,
-0xc7,
-0x1,
-0xcf,
-0x1,
-0xcb,
-0x1,
-0xd2,
-0x1,
-0xca,
-0x1,
-0xd1,
-0x1,
-0xcc,
-0x1,
-0xd3,
-0x1,
-0xd3,
-0x1,
-0xd2,
-0x1,
-0xd0,
-0x1,
-0xd1,
-0x1,
-0xcc,
-0x1,
-0xcd,
-0x1,
-0xcb,
-0x1,
-0xc7,
-0x1,
-0xcb,
-0x1,
-0xcb,
-0x1,
-0xc8,
-0x1,
-0xc8,
-0x1,
-0xc6,
-0x1,
-0xc6,
-0x1,
-0xc5,
-0x1,
-0xbc,
-0x1,
-0xc1,
-0x1,
-0xbf,
-0x1,
-0xbf,
-0x1,
-0xb7,
-0x1,
-0xbd,
-0x1,
-0xbc,
-0x1,
-0xb6,
-0x1,
-0xb4,
-0x1,
-0xb3,
-0x1,
-0xb4,
-0x1,
-0xb2,
-0x1,
-0xac,
-0x1,
-0xac,
-0x1,
-0xa6,
-0x1,
-0xa7,
-0x1,
-0xa6,
-0x1,
-0xa4,
-0x1,
-0x9b,
-0x1,
-0x9a,
-0x1,
-0x94,
-0x1,
-0x8c,
-0x1,
-0x89,
-0x1,
-0x7d,
-0x1,
-0x78,
-0x1,
-0x6e,
-0x1,
-0x67,
-0x1,
-0x5f,
-0x1,
-0x58,
-0x1,
-0x53,
-0x1,
-0x4e,
-0x1,
-0x47,
-0x1,
-0x3b,
-0x1,
-0x3c,
-0x1,
-0x2e,
-0x1,
-0x2f,
-0x1,
-0x1f,
-0x1,
-0x25,
-0x1,
-0x1a,
-0x1,
-0x17,
-0x1,
-0xf,
-0x1,
-0x7,
-0x1,
-0x4,
-0x1,
-0xfb,
-0x0,
-0xfb,
-0x0,
-0xf8,
-0x0,
-0xf1,
-0x0,
-0xe9,
-0x0,
-0xe8,
-0x0,
-0xe1,
-0x0,
-0xe2,
-0x0,
-0xe2,
-0x0,
-0xde,
-0x0,
-0xd8,
-0x0,
-0xd7,
-0x0,
-0xd0,
-0x0,
-0xcd,
-0x0,
-0xc8,
-0x0,
-0xc6,
-0x0,
-0xc3,
-0x0,
-0xc5,
-0x0,
-0xc3,
-0x0,
-0xc3,
-0x0,
-0xc0,
-0x0,
-0xbc,
-0x0,
-0xbb,
-0x0,
-0xb2,
-0x0,
-0xb2,
-0x0,
-0xab,
-0x0,
-0xaf,
-0x0,
-0xa5,
-0x0,
-0xa3,
-0x0,
-0x96,
-0x0,
-0x95,
-0x0,
-0x90,
-0x0,
-0x8e,
-0x0,
-0x8a,
-0x0,
-0x84,
-0x0,
-0x85,
-0x0,
-0x7e,
-0x0,
-0x7e,
-0x0,
-0x7a,
-0x0,
-0x79,
-0x0,
-0x75,
-0x0,
-0x75,
-0x0,
-0x74,
-0x0,
-0x75,
-0x0,
-0x75,
-0x0,
-0x68,
-0x0,
-0x69,
-0x0,
-0x5f,
-0x0,
-0x65,
-0x0,
-0x62,
-0x0
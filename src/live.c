@@ -0,0 +1,170 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Live heartbeat timeline shared by all listeners of /dev/heart-live.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/mutex.h>
+#include <linux/ktime.h>
+#include <linux/math64.h> // mul_u64_u32_div
+
+#include "devheart.h"
+
+// number of most recent beats kept in the timeline, older ones are skipped
+#define LIVE_BEATS 8
+
+// bytes per second of the live stream
+#define LIVE_BYTE_RATE (SAMPLE_RATE * SAMPLE_SIZE)
+
+// a beat of the timeline and where in the stream it starts
+struct devheart_live_beat_t {
+    u64 start;
+    struct devheart_samples_t *samples; // the beat is made of, referenced
+    struct devheart_heartbeat_t heartbeat; // at its start
+};
+
+/*
+ * The timeline is generated once, beat by beat, as the listener furthest
+ * ahead needs it. Listeners only keep a copy of the beat they are in and
+ * their position, so adding listeners costs neither memory nor CPU.
+ */
+static struct {
+    struct mutex lock;
+    struct devheart_sound_buffer_t producer;
+    struct devheart_live_beat_t beats[LIVE_BEATS];
+    u64 nr_beats; // beats generated so far
+    u64 end;      // stream position after the last generated beat
+    ktime_t epoch;
+    unsigned int users;
+} live = {
+    .lock = __MUTEX_INITIALIZER(live.lock),
+};
+
+// Returns the stream position which is being played right now, in whole frames.
+static u64 live_now(void) {
+    u64 position = mul_u64_u32_div(ktime_to_ns(ktime_sub(ktime_get(), live.epoch)), LIVE_BYTE_RATE, NSEC_PER_SEC);
+
+    return position & ~(u64)(SAMPLE_SIZE - 1);
+}
+
+static void live_generate(void) {
+    struct devheart_live_beat_t *beat = &live.beats[live.nr_beats % LIVE_BEATS];
+    size_t size = generate_heartbeat(&live.producer);
+
+    beat->heartbeat = live.producer.heartbeat;
+    samples_hold(&beat->samples, live.producer.samples);
+    beat->start = live.end;
+
+    live.end += size;
+    live.nr_beats++;
+}
+
+// Loads the given beat of the timeline into the listener.
+static void live_load(struct devheart_sound_buffer_t *sound_buffer, u64 number) {
+    struct devheart_live_beat_t *beat = &live.beats[number % LIVE_BEATS];
+
+    sound_buffer->heartbeat = beat->heartbeat;
+    samples_hold(&sound_buffer->samples, beat->samples);
+    sound_buffer->beat = number;
+}
+
+// Moves the listener to the given stream position.
+static void live_seek(struct devheart_sound_buffer_t *sound_buffer, u64 position) {
+    const struct devheart_segment_t *segment;
+    unsigned int generated;
+    u64 number;
+    size_t offset;
+
+    // beats nobody heard during a long stall are not replayed, the timeline starts afresh at the position
+    for(generated = 0; live.end <= position; generated++) {
+        if(generated == LIVE_BEATS) {
+            live.end = position;
+        }
+        live_generate();
+    }
+
+    // the newest beat starting at or before the position
+    for(number = live.nr_beats - 1; live.beats[number % LIVE_BEATS].start > position; number--);
+
+    live_load(sound_buffer, number);
+
+    offset = position - live.beats[number % LIVE_BEATS].start;
+    for(segment = sound_buffer->heartbeat.segments; offset >= segment->size; segment++) {
+        offset -= segment->size;
+        sound_buffer->heartbeat.current_segment++;
+    }
+    sound_buffer->heartbeat.current_offset = offset;
+}
+
+/*
+ * Moves the listener on to its next beat. A listener which fell behind
+ * the beats kept in the timeline, or by more than its pacing lets it
+ * catch up with at once, skips forward to what is played now.
+ */
+void live_next_beat(struct devheart_sound_buffer_t *sound_buffer) {
+    u64 next = sound_buffer->beat + 1;
+    u64 oldest, position;
+
+    mutex_lock(&live.lock);
+    oldest = live.nr_beats > LIVE_BEATS ? live.nr_beats - LIVE_BEATS : 0;
+    if(next < oldest || pace_lagging(&sound_buffer->pace)) {
+        position = live_now();
+        live_seek(sound_buffer, position);
+        sound_buffer->pace.bytes_served = position;
+    }
+    else {
+        while(next >= live.nr_beats) {
+            live_generate();
+        }
+        live_load(sound_buffer, next);
+    }
+    mutex_unlock(&live.lock);
+}
+
+// Lets the listener join the timeline at what is played now.
+void live_join(struct devheart_sound_buffer_t *sound_buffer) {
+    u64 position;
+
+    mutex_lock(&live.lock);
+    if(live.users++ == 0) {
+        live.nr_beats = 0;
+        live.end = 0;
+        live.epoch = ktime_get();
+
+        // with lazy_sampling, the first beat starts at the last shared utilization instead of sampling an instant
+        live.producer.cpu_sample.timestamp = 0;
+    }
+
+    position = live_now();
+    live_seek(sound_buffer, position);
+    sound_buffer->live = true;
+    mutex_unlock(&live.lock);
+
+    // live listeners are always paced, so they all hear the same beat at the same time
+    pace_start_at(&sound_buffer->pace, LIVE_BYTE_RATE, SAMPLE_SIZE, live.epoch, position);
+}
+
+void live_leave(struct devheart_sound_buffer_t *sound_buffer) {
+    unsigned int i;
+
+    mutex_lock(&live.lock);
+    if(--live.users == 0) {
+        // let go of the samples, they may have been replaced in the meantime
+        for(i = 0; i < LIVE_BEATS; i++) {
+            samples_put(live.beats[i].samples);
+            live.beats[i].samples = NULL;
+        }
+        samples_put(live.producer.samples);
+        live.producer.samples = NULL;
+    }
+    mutex_unlock(&live.lock);
+}
@@ -0,0 +1,319 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Multichannel device with one heartbeat per CPU (group).
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/miscdevice.h>
+#include <linux/slab.h>
+#include <linux/uio.h> // copy_to_iter
+#include <linux/cpumask.h> // for_each_online_cpu
+#include <linux/cpu.h> // cpus_read_lock
+#include <linux/device.h> // DEVICE_ATTR_RO
+#include <linux/sysfs.h> // sysfs_emit
+#include <linux/gfp.h> // __get_free_page
+#include <linux/overflow.h> // struct_size
+#include <linux/mutex.h>
+#include <linux/bug.h> // WARN_ON_ONCE
+
+#include "devheart.h"
+
+// device name to use
+#define MULTICHANNEL_DEVICE_NAME "heart-percpu"
+
+// upper bound of channels in the stream, CPU groups get wider beyond that
+#define MULTICHANNEL_MAX_CHANNELS 256
+
+// bytes per sample of a single channel (s16_le)
+#define MULTICHANNEL_SAMPLE_SIZE SAMPLE_SIZE
+
+static unsigned int cpus_per_channel = 1;
+module_param(cpus_per_channel, uint, S_IRUGO);
+MODULE_PARM_DESC(cpus_per_channel, "Number of CPUs which share a channel of /dev/" MULTICHANNEL_DEVICE_NAME " (default: 1)");
+
+// interleaved stream of all channels which is being read
+struct devheart_multichannel_t {
+    char *block;          // one page of rendered interleaved frames
+    size_t block_size;
+    size_t block_offset;
+    struct devheart_pace_t pace;
+    struct mutex lock; // serializes readers of the block and the channel cursors
+    unsigned int channels;
+    struct devheart_sound_buffer_t channel[];
+};
+
+/*
+ * Renders the next block of interleaved frames. Each channel is written
+ * span by span: a contiguous run of its current heartbeat segment is
+ * strided into the block in one tight loop, so there is no per-sample
+ * branching no matter how many channels there are.
+ */
+static void render_block(struct devheart_multichannel_t *multichannel) {
+    unsigned int channels = multichannel->channels;
+    size_t frames = PAGE_SIZE / (channels * MULTICHANNEL_SAMPLE_SIZE);
+    struct devheart_sound_buffer_t *sound_buffer;
+    const u16 *samples;
+    const char *data;
+    size_t done, run, span, i;
+    unsigned int channel;
+    u16 *out;
+
+    for(channel = 0; channel < channels; channel++) {
+        sound_buffer = &multichannel->channel[channel];
+
+        for(done = 0; done < frames; done += run) {
+            span = heartbeat_span(sound_buffer, &data);
+
+            // segments are whole frames, but never spin on a stray byte if one is not
+            if(WARN_ON_ONCE(span < MULTICHANNEL_SAMPLE_SIZE)) {
+                heartbeat_advance(sound_buffer, span);
+                run = 0;
+                continue;
+            }
+
+            run = min(span / MULTICHANNEL_SAMPLE_SIZE, frames - done);
+            samples = (const u16 *)data;
+            out = (u16 *)multichannel->block + done * channels + channel;
+
+            for(i = 0; i < run; i++) {
+                out[i * channels] = samples[i];
+            }
+
+            heartbeat_advance(sound_buffer, run * MULTICHANNEL_SAMPLE_SIZE);
+        }
+    }
+
+    multichannel->block_size = frames * channels * MULTICHANNEL_SAMPLE_SIZE;
+    multichannel->block_offset = 0;
+}
+
+// CPUs sharing a channel when the given number of CPUs is online
+static unsigned int multichannel_group_size(unsigned int online) {
+    return max3(cpus_per_channel, 1U, DIV_ROUND_UP(online, MULTICHANNEL_MAX_CHANNELS));
+}
+
+// channels of a stream opened now, one per group of online CPUs
+static unsigned int multichannel_channels(void) {
+    unsigned int online = num_online_cpus();
+
+    return DIV_ROUND_UP(online, multichannel_group_size(online));
+}
+
+/*
+ * Allocates a stream with one channel per group of online CPUs, in the
+ * order of their ids. The layout is fixed for the lifetime of the open
+ * file, a CPU going offline later keeps its channel beating at the last
+ * utilization of its group.
+ */
+static struct devheart_multichannel_t *multichannel_alloc(void) {
+    struct devheart_multichannel_t *multichannel;
+    struct devheart_sound_buffer_t *sound_buffer;
+    unsigned int online, group_size, channels, n = 0;
+    int cpu;
+
+    cpus_read_lock();
+    online = num_online_cpus();
+    group_size = multichannel_group_size(online);
+    channels = DIV_ROUND_UP(online, group_size);
+
+    multichannel = kzalloc(struct_size(multichannel, channel, channels), GFP_KERNEL);
+    if(multichannel) {
+        multichannel->channels = channels;
+
+        // a group spans the ids of its online CPUs, CPUs which are not online in between add no time
+        for_each_online_cpu(cpu) {
+            sound_buffer = &multichannel->channel[n / group_size];
+            if(n++ % group_size == 0) {
+                sound_buffer->first_cpu = cpu;
+            }
+            sound_buffer->nr_cpus = cpu - sound_buffer->first_cpu + 1;
+        }
+    }
+    cpus_read_unlock();
+
+    return multichannel;
+}
+
+static int multichannel_open(struct inode *inode, struct file *file) {
+    struct devheart_multichannel_t *multichannel;
+    struct devheart_sound_buffer_t *sound_buffer;
+    unsigned int channel;
+
+    multichannel = multichannel_alloc();
+    if(!multichannel) {
+        pr_err("could not allocate kernel memory for heartbeat read data\n");
+        stat_inc(STAT_ALLOC_FAILURES);
+        return -ENOMEM;
+    }
+
+    pr_info("Okay, let's listen to each of Master Tuxs %u heart chambers ...\n", multichannel->channels);
+
+    multichannel->block = (char *)__get_free_page(GFP_KERNEL);
+    if(!multichannel->block) {
+        pr_err("could not allocate kernel memory for heartbeat read data\n");
+        stat_inc(STAT_ALLOC_FAILURES);
+        kfree(multichannel);
+        return -ENOMEM;
+    }
+
+    mutex_init(&multichannel->lock);
+    pace_init(&multichannel->pace);
+    for(channel = 0; channel < multichannel->channels; channel++) {
+        sound_buffer = &multichannel->channel[channel];
+
+        // generate first heartbeat on open to be ready when it staaaarts!
+        // it beats at the last utilization of the shared sampler, later ones at the group's own
+        generate_heartbeat(sound_buffer);
+    }
+
+    pace_start(&multichannel->pace, SAMPLE_RATE * MULTICHANNEL_SAMPLE_SIZE * multichannel->channels,
+               MULTICHANNEL_SAMPLE_SIZE * multichannel->channels);
+
+    file->private_data = multichannel;
+
+    // reads honour IOCB_NOWAIT, so io_uring may complete them inline
+    file->f_mode |= FMODE_NOWAIT;
+
+    stat_inc(STAT_OPENS);
+    return 0;
+}
+
+static int multichannel_release(struct inode *inode, struct file *file) {
+    struct devheart_multichannel_t *multichannel = file->private_data;
+    unsigned int channel;
+
+    pace_stop(&multichannel->pace);
+    for(channel = 0; channel < multichannel->channels; channel++) {
+        samples_put(multichannel->channel[channel].samples);
+    }
+    free_page((unsigned long)multichannel->block);
+    kfree(multichannel);
+    stat_inc(STAT_RELEASES);
+
+    pr_info("I'll check in on all of you later, Master Tux!\n");
+    return 0;
+}
+
+static ssize_t multichannel_read_iter(struct kiocb *iocb, struct iov_iter *to) {
+    struct devheart_multichannel_t *multichannel = iocb->ki_filp->private_data;
+    bool nonblock = (iocb->ki_flags & IOCB_NOWAIT) || (iocb->ki_filp->f_flags & O_NONBLOCK);
+    size_t length = iov_iter_count(to);
+    size_t bytes_read = 0;
+    size_t chunk, copied;
+    ssize_t allowed;
+
+    // in paced mode only serve what is due by now
+    allowed = pace_wait_for(&multichannel->pace, nonblock, length);
+    if(allowed < 0) {
+        return allowed;
+    }
+    length = allowed;
+
+    if(iocb->ki_flags & IOCB_NOWAIT) {
+        if(!mutex_trylock(&multichannel->lock)) {
+            return -EAGAIN;
+        }
+    }
+    else {
+        mutex_lock(&multichannel->lock);
+    }
+
+    while(length) {
+        if(multichannel->block_offset >= multichannel->block_size) {
+            render_block(multichannel);
+        }
+
+        chunk = min(length, multichannel->block_size - multichannel->block_offset);
+        copied = copy_to_iter(multichannel->block + multichannel->block_offset, chunk, to);
+
+        multichannel->block_offset += copied;
+        bytes_read += copied;
+        length -= copied;
+
+        if(copied < chunk) {
+            break;
+        }
+    }
+
+    pace_consume(&multichannel->pace, bytes_read);
+    mutex_unlock(&multichannel->lock);
+
+    stat_inc(STAT_READ_CALLS);
+    stat_add(STAT_BYTES_SERVED, bytes_read);
+    stat_histogram(HISTOGRAM_READ_SIZE, bytes_read);
+
+    if(length && !bytes_read) {
+        return -EFAULT;
+    }
+
+    iocb->ki_pos += bytes_read;
+    return bytes_read;
+}
+
+static __poll_t multichannel_poll(struct file *file, poll_table *wait) {
+    struct devheart_multichannel_t *multichannel = file->private_data;
+
+    return pace_poll(&multichannel->pace, file, wait);
+}
+
+static const struct file_operations multichannel_fileops = {
+    .owner = THIS_MODULE,
+    .read_iter = multichannel_read_iter,
+    .poll = multichannel_poll,
+    .open = multichannel_open,
+    .release = multichannel_release
+};
+
+// /sys/class/misc/heart-percpu/channels: channels of a stream opened now, to pass to aplay -c
+static ssize_t channels_show(struct device *dev, struct device_attribute *attr, char *buffer) {
+    unsigned int channels;
+
+    cpus_read_lock();
+    channels = multichannel_channels();
+    cpus_read_unlock();
+
+    return sysfs_emit(buffer, "%u\n", channels);
+}
+static DEVICE_ATTR_RO(channels);
+
+static struct attribute *multichannel_attrs[] = {
+    &dev_attr_channels.attr,
+    NULL
+};
+ATTRIBUTE_GROUPS(multichannel);
+
+static struct miscdevice multichannel_dev = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name = MULTICHANNEL_DEVICE_NAME,
+    .fops = &multichannel_fileops,
+    .groups = multichannel_groups,
+    .mode = S_IRUGO,
+};
+
+int multichannel_init(void) {
+    int ret;
+
+    ret = misc_register(&multichannel_dev);
+    if(ret) {
+        pr_err("could not register multichannel heart device as misc device\n");
+        return ret;
+    }
+
+    pr_info("--> aplay -r 44100 -f s16_le -c $(cat /sys/class/misc/" MULTICHANNEL_DEVICE_NAME "/channels) /dev/"
+            MULTICHANNEL_DEVICE_NAME "\n");
+    return 0;
+}
+
+void multichannel_exit(void) {
+    misc_deregister(&multichannel_dev);
+}
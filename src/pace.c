@@ -0,0 +1,199 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Pacing of reads to the real-time byte rate of the stream.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/poll.h>
+#include <linux/wait.h>
+#include <linux/hrtimer.h>
+#include <linux/ktime.h>
+#include <linux/math64.h> // mul_u64_u32_div
+#include <linux/version.h>
+
+#include "devheart.h"
+
+// slack granted to the wakeup timer, so wakeups of readers can be coalesced
+#define PACE_SLACK_MS 5
+
+// how far readers may run ahead of real time, so players can fill their buffers
+#define PACE_LEAD_MS 100
+
+static bool paced_reads;
+module_param(paced_reads, bool, S_IRUGO);
+MODULE_PARM_DESC(paced_reads, "Meter reads out at the real-time byte rate of the stream (default: off)");
+
+static enum hrtimer_restart pace_expired(struct hrtimer *timer) {
+    struct devheart_pace_t *pace = container_of(timer, struct devheart_pace_t, timer);
+
+    wake_up_interruptible(&pace->wait);
+    return HRTIMER_NORESTART;
+}
+
+// Prepares the pacing of a reader, once before it is started the first time.
+void pace_init(struct devheart_pace_t *pace) {
+    init_waitqueue_head(&pace->wait);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 13, 0)
+    hrtimer_setup(&pace->timer, pace_expired, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
+#else
+    hrtimer_init(&pace->timer, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
+    pace->timer.function = pace_expired;
+#endif
+}
+
+void pace_start(struct devheart_pace_t *pace, u32 byte_rate, u32 frame_size) {
+    pace->byte_rate = byte_rate;
+    pace->frame_size = frame_size;
+    pace->bytes_served = 0;
+    pace->start = ktime_get();
+    pace->timeline = false;
+    pace->enabled = paced_reads;
+
+    // readers blocked on the previous pacing look again
+    wake_up_interruptible(&pace->wait);
+}
+
+// Always paces, as if the stream started at start and position bytes were already served.
+void pace_start_at(struct devheart_pace_t *pace, u32 byte_rate, u32 frame_size, ktime_t start, u64 position) {
+    pace->byte_rate = byte_rate;
+    pace->frame_size = frame_size;
+    pace->bytes_served = position;
+    pace->start = start;
+    pace->timeline = true;
+    pace->enabled = true;
+
+    wake_up_interruptible(&pace->wait);
+}
+
+void pace_stop(struct devheart_pace_t *pace) {
+    if(!pace->enabled) {
+        return;
+    }
+
+    pace->enabled = false;
+    hrtimer_cancel(&pace->timer);
+}
+
+// bytes of PACE_LEAD_MS at the byte rate of the pace, in whole frames
+static u64 pace_lead(const struct devheart_pace_t *pace) {
+    u32 lead = (u32)div_u64((u64)pace->byte_rate * PACE_LEAD_MS, MSEC_PER_SEC);
+
+    return rounddown(lead, pace->frame_size);
+}
+
+// Returns how many bytes of the stream are due by now, including the lead.
+static u64 pace_due(const struct devheart_pace_t *pace) {
+    u64 elapsed = ktime_to_ns(ktime_sub(ktime_get(), pace->start)) + PACE_LEAD_MS * NSEC_PER_MSEC;
+
+    return mul_u64_u32_div(elapsed, pace->byte_rate, NSEC_PER_SEC);
+}
+
+/*
+ * Returns how many bytes may be served now, in whole frames. Never more
+ * than the lead at once, so a reader which comes back after a while
+ * does not get all the time it was away in one burst.
+ */
+static size_t pace_allowance(const struct devheart_pace_t *pace) {
+    u64 due = pace_due(pace);
+
+    if(due <= pace->bytes_served) {
+        return 0;
+    }
+
+    // round down to whole frames, do_div leaves the quotient in due
+    due = min(due - pace->bytes_served, pace_lead(pace));
+    do_div(due, pace->frame_size);
+    return due * pace->frame_size;
+}
+
+// Arms the timer of the pace for when the next frame is due.
+static void pace_arm(struct devheart_pace_t *pace) {
+    // rounded up, so the frame is due for sure once the timer fires
+    u64 ns = mul_u64_u32_div(pace->bytes_served + pace->frame_size, NSEC_PER_SEC, pace->byte_rate) + 1;
+    ktime_t expires = ktime_add_ns(pace->start, ns - min_t(u64, ns, PACE_LEAD_MS * NSEC_PER_MSEC));
+
+    hrtimer_start_range_ns(&pace->timer, expires, PACE_SLACK_MS * NSEC_PER_MSEC, HRTIMER_MODE_ABS);
+}
+
+// Returns how many bytes may be served now, without limit if reads are not paced.
+size_t pace_available(const struct devheart_pace_t *pace) {
+    return pace->enabled ? pace_allowance(pace) : SIZE_MAX;
+}
+
+// Returns whether a reader on a shared timeline fell behind it by more than the lead.
+bool pace_lagging(const struct devheart_pace_t *pace) {
+    return pace->enabled && pace_due(pace) > pace->bytes_served + 2 * pace_lead(pace);
+}
+
+/*
+ * Returns how many of the requested bytes may be read now. Blocks until
+ * at least one frame is due, unless the read is non-blocking. Only this
+ * reader is woken up, and only once there is something to read.
+ */
+ssize_t pace_wait_for(struct devheart_pace_t *pace, bool nonblock, size_t length) {
+    size_t allowance;
+    int ret;
+
+    for(;;) {
+        if(!pace->enabled) {
+            return length;
+        }
+
+        allowance = pace_allowance(pace);
+        if(allowance) {
+            return min(length, allowance);
+        }
+
+        if(nonblock) {
+            return -EAGAIN;
+        }
+
+        pace_arm(pace);
+        ret = wait_event_interruptible(pace->wait, !pace->enabled || pace_allowance(pace));
+        if(ret) {
+            return ret;
+        }
+    }
+}
+
+/*
+ * Accounts served bytes. A free running reader which fell behind by more
+ * than the lead drops the time it missed and carries on at real time.
+ */
+void pace_consume(struct devheart_pace_t *pace, size_t length) {
+    u64 due;
+
+    pace->bytes_served += length;
+    if(!pace->enabled || pace->timeline) {
+        return;
+    }
+
+    due = pace_due(pace);
+    if(due > pace->bytes_served + 2 * pace_lead(pace)) {
+        pace->bytes_served = due - pace_lead(pace);
+    }
+}
+
+__poll_t pace_poll(struct devheart_pace_t *pace, struct file *file, poll_table *wait) {
+    if(!pace->enabled) {
+        return EPOLLIN | EPOLLRDNORM;
+    }
+
+    poll_wait(file, &pace->wait, wait);
+    if(pace_allowance(pace)) {
+        return EPOLLIN | EPOLLRDNORM;
+    }
+
+    pace_arm(pace);
+    return 0;
+}
@@ -6,13 +6,15 @@
  *
  */
 
-#include "devheart.h"
+#include "heartbeat.h"
 
 #define DEVHEART_RIGHT_VENTRICLE_BEAT_SIZE 17710
+#define DEVHEART_RIGHT_VENTRICLE_BEAT_ADPCM_SIZE 4491
 
-struct devheart_sound_t right_ventricle_beat_sound = {
+const struct devheart_adpcm_sound_t right_ventricle_beat_adpcm = {
     .size = DEVHEART_RIGHT_VENTRICLE_BEAT_SIZE,
+    .encoded_size = DEVHEART_RIGHT_VENTRICLE_BEAT_ADPCM_SIZE,
     .data = {
-#include "right_ventricle_beat_data.h"
+#include "right_ventricle_beat_adpcm_data.h"
     }
 };
@@ -0,0 +1,282 @@
+// 17710 bytes of s16_le PCM as 4491 bytes of IMA ADPCM
+0xb, 0xff, 0x0, 0x0, 0xbd, 0x9b, 0xa8, 0x1b, 0xb9, 0xfb, 0xd8, 0xa0, 0xb0, 0x1, 0x9a, 0xb9,
+0xb9, 0xc4, 0xa1, 0xda, 0xa9, 0x2b, 0x9e, 0xe, 0x9, 0x9, 0xb8, 0x91, 0x94, 0xd2, 0x89, 0x49,
+0x9a, 0x12, 0x97, 0xb2, 0x9, 0x28, 0x80, 0x1c, 0x4b, 0x3b, 0xe, 0x38, 0x98, 0x9a, 0x23, 0x99,
+0x3d, 0x29, 0x18, 0x53, 0x21, 0x19, 0x3f, 0x59, 0x3a, 0x18, 0x12, 0x0, 0x32, 0x49, 0x28, 0x39,
+0x52, 0x3a, 0x4a, 0x83, 0xa3, 0x33, 0x44, 0x20, 0x33, 0x49, 0x40, 0x20, 0x14, 0x14, 0x33, 0x41,
+0x82, 0x11, 0x27, 0x22, 0x42, 0x62, 0x21, 0x11, 0x33, 0x7, 0x11, 0x32, 0x32, 0x21, 0x53, 0x30,
+0x39, 0x62, 0x10, 0x12, 0x83, 0x15, 0x33, 0x34, 0x50, 0x40, 0x21, 0x40, 0x20, 0x0, 0x12, 0x33,
+0x17, 0x21, 0x5, 0x1, 0x18, 0x21, 0x23, 0xa6, 0x91, 0x33, 0x12, 0x95, 0xa4, 0xa2, 0x93, 0xb4,
+0x3, 0xc3, 0x1, 0x13, 0xb9, 0xd, 0x11, 0xc, 0x19, 0xc3, 0xbb, 0x13, 0x85, 0x1b, 0x4d, 0x19,
+0xbb, 0x80, 0xd2, 0xa9, 0xca, 0xaa, 0x9b, 0xb9, 0xf0, 0xa9, 0x9a, 0x9b, 0xe1, 0x98, 0x3, 0x9e,
+0x9, 0x89, 0xac, 0xb2, 0xb1, 0x2c, 0x9d, 0xea, 0xc0, 0xa0, 0xa0, 0xb9, 0x19, 0xba, 0xaf, 0x99,
+0x9, 0xdb, 0xbd, 0xab, 0xcb, 0xb9, 0xbb, 0xf8, 0xd9, 0xa9, 0xa0, 0xaa, 0xa, 0xab, 0x9c, 0xbb,
+0xc9, 0xf0, 0xca, 0x88, 0xb9, 0xb, 0xb0, 0xce, 0xb8, 0xba, 0xaa, 0x29, 0xdb, 0xfb, 0x8a, 0x99,
+0xa8, 0xb8, 0xa0, 0xab, 0x1f, 0x9b, 0x9d, 0x9, 0x8a, 0xa9, 0x9c, 0x28, 0x4a, 0x43, 0x1, 0x56,
+0x31, 0x51, 0x42, 0x32, 0x34, 0x23, 0x34, 0x44, 0x24, 0x32, 0x44, 0x33, 0x43, 0x35, 0x43, 0x33,
+0x44, 0x33, 0x34, 0x34, 0x44, 0x43, 0x33, 0x34, 0x34, 0x43, 0x22, 0x24, 0x33, 0x32, 0x42, 0x24,
+0x30, 0xf, 0x1d, 0x0, 0x22, 0x24, 0x32, 0x44, 0x32, 0x32, 0x33, 0x35, 0x34, 0x42, 0x32, 0x34,
+0x34, 0x33, 0x34, 0x34, 0x43, 0x22, 0x23, 0x33, 0x33, 0x22, 0x11, 0x21, 0x2, 0xb8, 0xbe, 0xcb,
+0xdb, 0xcc, 0xbc, 0xbb, 0xdc, 0xbb, 0xbc, 0xcb, 0xcb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xbc,
+0xcb, 0xdb, 0xbb, 0xbc, 0xbc, 0xdb, 0xbb, 0xcb, 0xac, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb,
+0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xac, 0xbb, 0xbb, 0xbc, 0xbc,
+0xba, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xab, 0xbb, 0xac, 0xba, 0xaa, 0xa9, 0xaa, 0x8a, 0x8,
+0x32, 0x53, 0x44, 0x53, 0x53, 0x33, 0x35, 0x34, 0x34, 0x44, 0x33, 0x44, 0x33, 0x44, 0x42, 0x33,
+0x34, 0x43, 0x34, 0x43, 0x43, 0x33, 0x34, 0x44, 0x33, 0x43, 0x34, 0x33, 0x35, 0x33, 0x44, 0x32,
+0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43,
+0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0,
+0x80, 0x0, 0x80, 0x80, 0x80, 0x0, 0x0, 0x90, 0xa1, 0x2, 0x0, 0x2a, 0x19, 0x0, 0xff, 0xff,
+0xff, 0xcf, 0x99, 0x9a, 0xaa, 0xaa, 0xbb, 0xbc, 0xbb, 0xcc, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb,
+0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xca, 0xba,
+0xba, 0xbc, 0xbb, 0xbc, 0xcb, 0xca, 0xaa, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xac, 0xcb, 0xab, 0x8a,
+0x80, 0x8, 0x8, 0x88, 0x80, 0x80, 0x8, 0x88, 0x80, 0x80, 0x8, 0x88, 0x80, 0x80, 0x80, 0x80,
+0x8, 0x88, 0x91, 0xa1, 0x74, 0x77, 0x77, 0x67, 0x1, 0x21, 0x21, 0x22, 0x33, 0x34, 0x43, 0x33,
+0x5f, 0xb5, 0x2f, 0x0, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x43,
+0x23, 0x24, 0x24, 0x24, 0x42, 0x22, 0x43, 0x33, 0x33, 0x44, 0x32, 0x24, 0x33, 0x34, 0x33, 0x24,
+0x33, 0x34, 0x32, 0x24, 0x33, 0x33, 0x24, 0x33, 0x43, 0x32, 0x32, 0x33, 0x43, 0x33, 0x32, 0x42,
+0x22, 0x22, 0x22, 0x2, 0x80, 0xa9, 0xca, 0xbd, 0xbe, 0xcc, 0xcb, 0xdb, 0xbb, 0xbd, 0xbc, 0xbc,
+0xbc, 0xbc, 0xdb, 0xca, 0xca, 0xba, 0xbc, 0xcb, 0xbb, 0xad, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+0xbc, 0xbb, 0xbc, 0xac, 0xcb, 0xab, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xba,
+0xcb, 0xba, 0xba, 0xba, 0xba, 0xba, 0x9a, 0x9a, 0x89, 0x10, 0x41, 0x43, 0x54, 0x33, 0x35, 0x34,
+0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x25, 0x43, 0x42, 0x32, 0x24, 0x24, 0x33,
+0x34, 0x43, 0x33, 0x43, 0x24, 0x43, 0x33, 0x33, 0x44, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x43,
+0x33, 0x34, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33, 0x34, 0x33, 0x43, 0x33, 0x24, 0x33, 0x24, 0x32,
+0x33, 0x33, 0x33, 0x24, 0x23, 0x23, 0x23, 0x21, 0x81, 0x80, 0xa0, 0xcb, 0xbe, 0xbd, 0xcc, 0xcb,
+0xdb, 0xca, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xcc, 0xbb, 0xcb, 0xbc, 0xbb, 0xcc, 0xbb, 0xcb,
+0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xac,
+0xac, 0xbb, 0xcb, 0xca, 0xba, 0xcb, 0xab, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xac, 0xbb, 0xac, 0xcb,
+0xba, 0xcb, 0xca, 0xaa, 0xbb, 0xbc, 0xca, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xbb,
+0xbb, 0xcb, 0xaa, 0xba, 0xaa, 0x9a, 0x89, 0x81, 0x32, 0x45, 0x53, 0x24, 0x35, 0x34, 0x34, 0x34,
+0xb5, 0xbd, 0x1d, 0x0, 0x44, 0x33, 0x44, 0x33, 0x53, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x35,
+0x33, 0x34, 0x34, 0x43, 0x33, 0x44, 0x32, 0x43, 0x43, 0x33, 0x43, 0x33, 0x34, 0x24, 0x43, 0x33,
+0x43, 0x33, 0x34, 0x34, 0x42, 0x33, 0x33, 0x44, 0x32, 0x43, 0x32, 0x34, 0x33, 0x24, 0x24, 0x33,
+0x24, 0x33, 0x34, 0x33, 0x43, 0x43, 0x42, 0x22, 0x33, 0x43, 0x32, 0x24, 0x33, 0x33, 0x34, 0x33,
+0x43, 0x42, 0x32, 0x32, 0x32, 0x32, 0x33, 0x32, 0x33, 0x13, 0x13, 0x0, 0xb9, 0xac, 0xbd, 0xaf,
+0xcb, 0xdb, 0xca, 0xcb, 0xcb, 0xcb, 0xbb, 0xbd, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb,
+0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xba,
+0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xca, 0xba, 0xba, 0xbc, 0xbb, 0xdb,
+0xba, 0xcb, 0xba, 0xcb, 0xab, 0xbc, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xac, 0xab, 0xba,
+0xbb, 0xac, 0xab, 0xaa, 0xba, 0x9a, 0x9a, 0xa, 0x98, 0x10, 0x32, 0x73, 0x34, 0x44, 0x43, 0x24,
+0x44, 0x33, 0x53, 0x42, 0x33, 0x34, 0x53, 0x33, 0x43, 0x24, 0x24, 0x33, 0x44, 0x32, 0x43, 0x33,
+0x34, 0x53, 0x32, 0x43, 0x33, 0x43, 0x43, 0x33, 0x34, 0x43, 0x33, 0x34, 0x43, 0x33, 0x43, 0x33,
+0x34, 0x24, 0x33, 0x34, 0x33, 0x53, 0x32, 0x43, 0x32, 0x43, 0x22, 0x33, 0x35, 0x22, 0x14, 0x33,
+0x43, 0x32, 0x42, 0x33, 0x23, 0x34, 0x23, 0x32, 0x43, 0x33, 0x22, 0x33, 0x23, 0x22, 0x52, 0x82,
+0x8, 0x11, 0x92, 0xfa, 0x89, 0xc9, 0xbc, 0xdb, 0xcb, 0xac, 0xcb, 0xbc, 0xbc, 0xac, 0xbb, 0xcc,
+0xbb, 0xad, 0xbb, 0xcb, 0xac, 0xac, 0xbb, 0xac, 0xcb, 0xcb, 0xca, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb,
+0x1d, 0x9, 0x18, 0x0, 0xba, 0xcb, 0xdb, 0xba, 0xbb, 0xbc, 0xad, 0xab, 0xbb, 0xad, 0xbb, 0xcb,
+0xca, 0xba, 0xcb, 0xca, 0xba, 0xba, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xcb, 0xcb, 0xba, 0xab, 0xbc,
+0xaa, 0xcc, 0xba, 0xcb, 0xca, 0xaa, 0xac, 0xba, 0xca, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb,
+0xbb, 0xac, 0xac, 0x9a, 0xac, 0xac, 0xba, 0xcb, 0xb8, 0xbb, 0x9c, 0xad, 0xba, 0xca, 0xd9, 0xb9,
+0xb9, 0xaa, 0xdb, 0xbb, 0xba, 0xcb, 0xca, 0xbc, 0x9c, 0xba, 0x9c, 0x9c, 0xbb, 0xab, 0xaa, 0xeb,
+0xc9, 0x99, 0xaa, 0x9c, 0x9c, 0x9b, 0x9b, 0xbb, 0xae, 0xba, 0xbb, 0xad, 0xdb, 0xaa, 0xa0, 0xcb,
+0xca, 0x99, 0xc9, 0xaa, 0xa0, 0xa9, 0xa9, 0xb9, 0x99, 0x59, 0x19, 0x3b, 0xb0, 0x15, 0x38, 0x30,
+0x51, 0x21, 0x63, 0x42, 0x13, 0x3, 0x25, 0x22, 0x33, 0x37, 0x43, 0x23, 0x24, 0x13, 0x38, 0x37,
+0x30, 0x52, 0x33, 0x42, 0x34, 0x32, 0x25, 0x43, 0x22, 0x52, 0x22, 0x43, 0x43, 0x33, 0x23, 0x63,
+0x22, 0x13, 0x15, 0x14, 0x43, 0x32, 0x32, 0x34, 0x24, 0x41, 0x21, 0x32, 0x52, 0x32, 0x43, 0x33,
+0x44, 0x22, 0x23, 0x24, 0x14, 0x14, 0x14, 0x22, 0x21, 0x42, 0x22, 0x32, 0x24, 0x30, 0x32, 0x13,
+0x3, 0x25, 0x33, 0x80, 0x51, 0x32, 0x91, 0x81, 0x87, 0xaa, 0x1, 0x21, 0xfb, 0xb9, 0xbb, 0xaf,
+0x8b, 0x8d, 0x9d, 0x9a, 0xbb, 0xbd, 0xa9, 0xda, 0xab, 0xaa, 0xab, 0xcb, 0xad, 0x9b, 0x9d, 0xba,
+0xcb, 0xba, 0xcb, 0xbc, 0xdb, 0xba, 0xcb, 0xcb, 0xba, 0xac, 0xaa, 0xbc, 0xbb, 0xbb, 0xbe, 0xaa,
+0xba, 0xbc, 0xbb, 0xba, 0xbb, 0xcb, 0xbb, 0xcb, 0xca, 0x9a, 0xab, 0x8e, 0xa, 0x1a, 0x20, 0x10,
+0x27, 0x43, 0x20, 0x13, 0x27, 0x33, 0x43, 0x23, 0x34, 0x15, 0x33, 0x35, 0x23, 0x34, 0x63, 0x41,
+0xd7, 0xf6, 0x12, 0x0, 0x23, 0x33, 0x73, 0x32, 0x32, 0x53, 0x32, 0x44, 0x32, 0x43, 0x43, 0x32,
+0x43, 0x33, 0x53, 0x32, 0x24, 0x24, 0x33, 0x34, 0x42, 0x42, 0x33, 0x33, 0x34, 0x53, 0x33, 0x43,
+0x33, 0x25, 0x33, 0x43, 0x33, 0x34, 0x24, 0x33, 0x24, 0x43, 0x33, 0x43, 0x43, 0x32, 0x42, 0x24,
+0x22, 0x43, 0x23, 0x33, 0x25, 0x14, 0x23, 0x24, 0x32, 0x43, 0x42, 0x32, 0x22, 0x34, 0x43, 0x32,
+0x43, 0x33, 0x53, 0x32, 0x43, 0x31, 0x34, 0x32, 0x52, 0x31, 0x43, 0x31, 0x31, 0x32, 0x32, 0x53,
+0x33, 0x24, 0x31, 0x21, 0x32, 0x31, 0x83, 0xa3, 0x12, 0x60, 0x18, 0x9a, 0xa3, 0x9b, 0x8d, 0xc8,
+0xd0, 0xc8, 0xba, 0xac, 0x9a, 0xdb, 0x9c, 0x9b, 0xbd, 0xe9, 0xa9, 0xba, 0xbb, 0xcc, 0xba, 0xca,
+0xbb, 0xbc, 0xbb, 0xbc, 0xcb, 0x9a, 0xbd, 0xcb, 0xc8, 0xca, 0xa9, 0x9b, 0xbb, 0xad, 0xbc, 0xab,
+0xcc, 0xaa, 0xac, 0xaa, 0xab, 0x9c, 0xab, 0x8c, 0x1a, 0xba, 0x8b, 0xc0, 0xa9, 0xd1, 0xa, 0x8c,
+0x1c, 0x9b, 0x1d, 0x19, 0xaa, 0x0, 0xb3, 0xb1, 0x23, 0x15, 0x3, 0x14, 0x34, 0x21, 0x17, 0x34,
+0x14, 0x32, 0x33, 0x15, 0x4, 0x24, 0x33, 0x52, 0x40, 0x40, 0x30, 0x22, 0x32, 0x62, 0x22, 0x22,
+0x23, 0x33, 0x34, 0x33, 0x35, 0x42, 0x50, 0x21, 0x33, 0x34, 0x23, 0x34, 0x72, 0x38, 0x38, 0x39,
+0x38, 0x2, 0xa3, 0x10, 0x93, 0x29, 0x91, 0xd2, 0x19, 0xe0, 0xc0, 0xb1, 0xd2, 0xb1, 0x8b, 0xda,
+0xc9, 0xab, 0x9c, 0xad, 0xad, 0xaa, 0xeb, 0xb9, 0xba, 0xcb, 0xbc, 0xba, 0xbc, 0xbd, 0xbb, 0xcb,
+0xdb, 0xaa, 0xcb, 0xbb, 0xbc, 0xdb, 0xba, 0xbc, 0xca, 0xbb, 0xad, 0xbb, 0xdb, 0xba, 0xac, 0xbb,
+0xbc, 0xcb, 0xcb, 0xca, 0xbb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xdb, 0xba, 0xbb,
+0xc5, 0xfe, 0x13, 0x0, 0xcb, 0xbb, 0xcc, 0xba, 0xcb, 0xba, 0xcb, 0xca, 0xba, 0xcb, 0xca, 0xca,
+0xaa, 0xca, 0xba, 0xba, 0xac, 0xcb, 0xca, 0xaa, 0xbb, 0xac, 0xbb, 0xdb, 0xba, 0xba, 0xbc, 0xc9,
+0xb9, 0xca, 0xaa, 0xaa, 0xbc, 0xcb, 0xa9, 0xca, 0xc8, 0xb8, 0xaa, 0xb8, 0xab, 0xad, 0xa9, 0xb8,
+0xa8, 0x9b, 0x9c, 0xba, 0x99, 0x11, 0x94, 0x10, 0x0, 0x33, 0x2d, 0x0, 0x92, 0x16, 0x22, 0x5,
+0x12, 0x3, 0x5, 0x32, 0x31, 0x79, 0x41, 0x20, 0x31, 0x4, 0x13, 0x44, 0x42, 0x22, 0x14, 0x23,
+0x23, 0x53, 0x51, 0x42, 0x30, 0x43, 0x41, 0x40, 0x40, 0x20, 0x33, 0x12, 0x72, 0x21, 0x20, 0x33,
+0x24, 0x52, 0x52, 0x21, 0x32, 0x33, 0x24, 0x33, 0x44, 0x23, 0x41, 0x33, 0x33, 0x42, 0x53, 0x21,
+0x33, 0x23, 0x3, 0x17, 0x13, 0x13, 0x7, 0x3, 0x32, 0x22, 0x12, 0x33, 0x15, 0x33, 0x3, 0x5,
+0x12, 0x31, 0x12, 0xa3, 0xb3, 0xc1, 0xd2, 0xe1, 0xb2, 0x88, 0xb, 0xa1, 0xc1, 0x29, 0xb0, 0xc9,
+0x8a, 0x91, 0x9d, 0xac, 0xd0, 0xf8, 0xa9, 0xa8, 0xab, 0xba, 0x9d, 0xba, 0xb9, 0xbc, 0xea, 0xba,
+0x98, 0xbb, 0xad, 0xba, 0xba, 0xf9, 0xb9, 0xa9, 0x90, 0x9c, 0x8b, 0xeb, 0x9a, 0xb9, 0xd0, 0xa9,
+0xa, 0xbb, 0x8b, 0x9f, 0xaa, 0xca, 0x89, 0x9a, 0xb, 0x3b, 0x9b, 0x9b, 0x99, 0x95, 0xb3, 0xb2,
+0xa5, 0x81, 0x1, 0x63, 0x40, 0x28, 0x30, 0x53, 0x20, 0x30, 0x33, 0x5, 0x16, 0x4, 0x21, 0x52,
+0x32, 0x32, 0x64, 0x31, 0x41, 0x32, 0x24, 0x33, 0x44, 0x32, 0x43, 0x24, 0x32, 0x63, 0x22, 0x31,
+0x33, 0x63, 0x22, 0x32, 0x43, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x33, 0x25, 0x14, 0x23, 0x33,
+0x63, 0x31, 0x32, 0x33, 0x34, 0x43, 0x32, 0x42, 0x32, 0x23, 0x15, 0x14, 0x22, 0x62, 0x28, 0x13,
+0xa5, 0xff, 0xa, 0x0, 0x14, 0x22, 0x33, 0x43, 0x24, 0x5, 0x24, 0x30, 0x22, 0x32, 0x33, 0x52,
+0x33, 0x33, 0x44, 0x40, 0x21, 0x32, 0x53, 0x33, 0x53, 0x43, 0x21, 0x32, 0x25, 0x22, 0x25, 0x24,
+0x22, 0x23, 0x43, 0x52, 0x21, 0x33, 0x24, 0x14, 0x23, 0x41, 0x33, 0x16, 0x23, 0x33, 0x16, 0x13,
+0x53, 0x32, 0x23, 0x24, 0x43, 0x32, 0x24, 0x24, 0x53, 0x22, 0x33, 0x63, 0x21, 0x22, 0x33, 0x6,
+0x13, 0x31, 0x43, 0x32, 0x33, 0x43, 0x43, 0x22, 0x34, 0x73, 0x30, 0x41, 0x31, 0x32, 0x15, 0x33,
+0x24, 0x33, 0x15, 0x33, 0x32, 0x43, 0x32, 0x13, 0x11, 0x13, 0x6, 0x2, 0x85, 0x81, 0x21, 0x49,
+0x49, 0x0, 0x3, 0x23, 0x2, 0x84, 0x4, 0xa1, 0xb5, 0x92, 0xb1, 0xa0, 0x9b, 0x9d, 0x98, 0xa9,
+0xab, 0x9f, 0x99, 0xba, 0xcc, 0xba, 0xdb, 0xab, 0xdb, 0xbb, 0xcb, 0xbb, 0xdb, 0xbb, 0xd9, 0xca,
+0xba, 0xb9, 0xdb, 0xc9, 0xc8, 0xc9, 0xb9, 0xba, 0xbb, 0xca, 0xad, 0x9b, 0xad, 0xca, 0xc9, 0xc8,
+0xb8, 0x9b, 0x8c, 0x9c, 0xab, 0xbb, 0xba, 0xdb, 0xc9, 0xba, 0x9c, 0xab, 0xab, 0x9e, 0xba, 0xaa,
+0xc9, 0xca, 0xb8, 0xc8, 0xa8, 0x9a, 0xcb, 0xba, 0x8a, 0xba, 0x8d, 0xda, 0xe2, 0xa0, 0x19, 0x1d,
+0xc, 0x99, 0x99, 0x9a, 0x9a, 0xaa, 0xc9, 0xb, 0x2d, 0xb, 0xbb, 0xb2, 0xd, 0xa0, 0x1b, 0xac,
+0x99, 0xd, 0x9b, 0xb8, 0xbb, 0x1d, 0xd, 0x1c, 0xb, 0xab, 0xb1, 0xf2, 0xa8, 0xb0, 0xd9, 0xa0,
+0xaa, 0xd1, 0x8a, 0xea, 0x98, 0xb9, 0xda, 0xa8, 0xd8, 0xa8, 0xa0, 0x8d, 0x89, 0xca, 0xbb, 0xba,
+0xcc, 0xcb, 0x9b, 0xeb, 0xb9, 0xcb, 0xcb, 0xba, 0xab, 0xbd, 0x8c, 0x9c, 0x9b, 0xac, 0xb9, 0xc9,
+0xba, 0xab, 0xbc, 0xad, 0xab, 0x9c, 0xac, 0xac, 0x9b, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb,
+0x14, 0xfe, 0xa, 0x0, 0xdb, 0xaa, 0xbb, 0x9d, 0xbb, 0xb9, 0xcb, 0x8d, 0x8c, 0x9b, 0x9a, 0xba,
+0x9d, 0x89, 0x9c, 0x9b, 0xbb, 0xea, 0xc8, 0xc9, 0x9a, 0x9c, 0xbb, 0xab, 0x8d, 0xab, 0xbb, 0xab,
+0xcb, 0x8b, 0x8c, 0x9d, 0x99, 0xd9, 0xb8, 0xc9, 0xa8, 0x2b, 0x9d, 0x8b, 0xbb, 0x8a, 0xb2, 0x9b,
+0xeb, 0xa1, 0xe3, 0xa3, 0x92, 0x0, 0x39, 0x3b, 0x43, 0x52, 0x11, 0x23, 0x51, 0x39, 0x51, 0x41,
+0x32, 0x33, 0x33, 0x37, 0x30, 0x24, 0x33, 0x63, 0x21, 0x51, 0x41, 0x20, 0x32, 0x31, 0x7, 0x11,
+0x13, 0x4, 0x13, 0x23, 0x34, 0x33, 0x54, 0x21, 0x22, 0x23, 0x70, 0x3, 0x22, 0x41, 0x31, 0x51,
+0x30, 0x22, 0x14, 0x14, 0x14, 0x3, 0x23, 0x53, 0x41, 0x12, 0x33, 0x61, 0x42, 0x28, 0x21, 0x32,
+0x33, 0x11, 0x94, 0x23, 0x85, 0x41, 0x4a, 0x11, 0x33, 0x20, 0x41, 0x3a, 0x29, 0x7b, 0x9, 0x89,
+0x8, 0x9, 0x8c, 0xd0, 0x99, 0xbb, 0xbb, 0xeb, 0xb0, 0xb1, 0x9b, 0xe0, 0xc8, 0xc8, 0xa9, 0x9b,
+0x98, 0xac, 0xb8, 0x91, 0x1, 0xbb, 0x11, 0x9b, 0x1a, 0x40, 0x3a, 0xb9, 0x39, 0xa1, 0xb0, 0x1b,
+0x11, 0x1f, 0x3b, 0x1b, 0x19, 0x5a, 0x3b, 0x39, 0x21, 0x7, 0x21, 0x10, 0x11, 0x38, 0x23, 0x33,
+0x31, 0x29, 0x29, 0x19, 0x71, 0x18, 0x10, 0x13, 0x13, 0x7, 0x23, 0x24, 0x22, 0x31, 0x61, 0x30,
+0x21, 0x24, 0x13, 0x33, 0x27, 0x30, 0x41, 0x33, 0x15, 0x5, 0x4, 0x22, 0x21, 0x30, 0x41, 0x21,
+0x21, 0x31, 0x61, 0x39, 0x41, 0x31, 0x5, 0x12, 0x15, 0x81, 0x33, 0x12, 0x20, 0x53, 0x23, 0x12,
+0x11, 0x15, 0x31, 0x38, 0x53, 0x29, 0x81, 0x31, 0x95, 0x2, 0x4, 0x90, 0x15, 0x93, 0x93, 0x50,
+0x28, 0x5a, 0x1a, 0x0, 0xb1, 0x31, 0x21, 0x15, 0x21, 0x59, 0x40, 0x40, 0x30, 0x33, 0x3, 0x6,
+0x68, 0x1, 0x5, 0x0, 0x21, 0x32, 0x12, 0x16, 0x92, 0x33, 0x34, 0x31, 0x40, 0x12, 0x42, 0x5,
+0x14, 0x22, 0x50, 0x31, 0x69, 0x11, 0x31, 0x3, 0x22, 0x15, 0x42, 0x21, 0x34, 0x40, 0x50, 0x10,
+0x84, 0x2, 0x32, 0x50, 0x22, 0x3a, 0x42, 0x38, 0x32, 0x51, 0x32, 0x53, 0x20, 0x52, 0x58, 0x40,
+0x10, 0x40, 0x20, 0x11, 0x21, 0x42, 0x23, 0x31, 0x79, 0x11, 0x29, 0x21, 0x32, 0x23, 0x93, 0x5,
+0x13, 0xb0, 0xb0, 0x32, 0x7b, 0x29, 0x3a, 0x3a, 0x38, 0x49, 0x41, 0x59, 0x10, 0x92, 0x83, 0x2,
+0x21, 0xb, 0x19, 0x1b, 0x3a, 0xa, 0x1c, 0x1c, 0x88, 0xb9, 0x9b, 0x92, 0x9b, 0xc, 0x11, 0x3a,
+0x19, 0x99, 0xc, 0x1b, 0x9, 0x8d, 0x9a, 0xb9, 0x9b, 0x9b, 0x3b, 0xaa, 0xa9, 0x99, 0x2, 0x3b,
+0x9a, 0x1d, 0x3a, 0xa, 0xba, 0x11, 0xb0, 0x9f, 0x99, 0x98, 0xab, 0x9c, 0xbd, 0xf8, 0xa0, 0xb9,
+0xa9, 0x9, 0x9d, 0x89, 0x8b, 0x9c, 0xab, 0xdb, 0xa9, 0xdb, 0xc1, 0xcb, 0xd0, 0xa8, 0xc, 0xab,
+0xab, 0xac, 0xab, 0xad, 0x9d, 0xab, 0xac, 0x9d, 0xab, 0xdb, 0xb9, 0xca, 0xca, 0xaa, 0xbb, 0xad,
+0xbb, 0xcb, 0xda, 0xba, 0xac, 0xbb, 0xac, 0xbb, 0xbd, 0xcb, 0xba, 0xcb, 0xba, 0xdb, 0xba, 0xba,
+0xbb, 0xcb, 0xdb, 0xaa, 0xda, 0xaa, 0xab, 0xbb, 0xd9, 0xba, 0xab, 0xcb, 0xd8, 0xc8, 0x98, 0x9b,
+0xa, 0x1b, 0x9c, 0x9b, 0x1c, 0x9a, 0xf, 0x8a, 0xa1, 0xb0, 0xa0, 0x21, 0xd, 0x9b, 0x12, 0x91,
+0x93, 0x41, 0x98, 0x13, 0x12, 0x3a, 0x2, 0x87, 0x2, 0x32, 0x11, 0x85, 0x33, 0x24, 0x13, 0x85,
+0x62, 0x28, 0x28, 0x28, 0x29, 0x31, 0x31, 0xb3, 0x7, 0x3, 0x12, 0x31, 0x5, 0x19, 0x3, 0xa3,
+0x15, 0x10, 0xa0, 0x93, 0x91, 0xb2, 0xa5, 0x94, 0xb3, 0x94, 0x11, 0x10, 0x22, 0x39, 0x5b, 0x1,
+0x18, 0xfd, 0x2, 0x0, 0xa0, 0x0, 0xb1, 0x1a, 0xb2, 0xd9, 0xb1, 0xb1, 0xb0, 0x99, 0x9, 0x99,
+0x2c, 0xd, 0xa, 0x10, 0xd1, 0xd1, 0x9, 0x19, 0x1a, 0x3a, 0xb9, 0xd0, 0x83, 0xa2, 0x33, 0x3a,
+0x49, 0x2b, 0x93, 0x13, 0x22, 0x3, 0x2, 0x31, 0x11, 0x33, 0x25, 0x38, 0x21, 0x13, 0x33, 0x87,
+0x92, 0x4, 0x11, 0x11, 0x12, 0x15, 0x71, 0x28, 0x21, 0x21, 0x50, 0x11, 0x93, 0x7, 0x2, 0x12,
+0x43, 0x33, 0x23, 0x6, 0x23, 0x13, 0x42, 0x33, 0x15, 0x23, 0x14, 0x33, 0x15, 0x13, 0x13, 0x22,
+0x17, 0x84, 0x3, 0x33, 0x31, 0x35, 0x52, 0x2, 0x4, 0x52, 0x20, 0x28, 0x31, 0x23, 0x94, 0x87,
+0x3, 0x38, 0x20, 0x13, 0xb4, 0x87, 0x1, 0x80, 0x11, 0x11, 0x5b, 0x2a, 0x12, 0x93, 0x1, 0x21,
+0x9b, 0x19, 0x5a, 0x1a, 0x1b, 0xcb, 0xd1, 0xb0, 0xbb, 0xf1, 0x98, 0x9b, 0x8c, 0xaa, 0xd9, 0xaa,
+0xbb, 0x9c, 0x9e, 0xab, 0xac, 0xba, 0xea, 0xc8, 0xa8, 0xaa, 0xca, 0xb8, 0xba, 0xdb, 0xc8, 0xc9,
+0x98, 0xbb, 0xa9, 0xad, 0x89, 0xae, 0xb, 0x9d, 0xa9, 0xa8, 0xa9, 0x89, 0xc8, 0xb9, 0x8c, 0x89,
+0x99, 0x3c, 0x5c, 0x1a, 0xb0, 0x2, 0x53, 0x49, 0x19, 0x20, 0x51, 0x49, 0x2, 0x22, 0x5b, 0x51,
+0x50, 0x30, 0x1, 0x4, 0x23, 0x34, 0x52, 0x41, 0x32, 0x33, 0x34, 0x53, 0x23, 0x33, 0x26, 0x13,
+0x14, 0x24, 0x13, 0x14, 0x15, 0x23, 0x14, 0x13, 0x33, 0x34, 0x24, 0x41, 0x32, 0x43, 0x42, 0x42,
+0x23, 0x33, 0x63, 0x32, 0x32, 0x14, 0x24, 0x3, 0x33, 0x52, 0x31, 0x50, 0x32, 0x22, 0x23, 0x35,
+0x33, 0x43, 0x33, 0x34, 0x24, 0x33, 0x32, 0x73, 0x21, 0x22, 0x13, 0x15, 0x13, 0x12, 0x33, 0x94,
+0x15, 0x23, 0x12, 0x31, 0x11, 0x19, 0xa5, 0x28, 0x6a, 0x20, 0x3a, 0x22, 0x51, 0x49, 0x39, 0x30,
+0x92, 0x4, 0x1, 0x0, 0x1, 0xb1, 0xb2, 0xf3, 0xb8, 0xa0, 0xc0, 0xb9, 0xa9, 0xea, 0x9a, 0xac,
+0xba, 0xca, 0xc9, 0xd9, 0x9a, 0x8f, 0x99, 0x9a, 0xbb, 0xbb, 0xf9, 0xa8, 0xab, 0xc9, 0xba, 0xba,
+0xad, 0x8b, 0xbb, 0xbc, 0xea, 0xc8, 0xa8, 0xab, 0xad, 0xba, 0xba, 0xbb, 0xbb, 0xca, 0x8e, 0x9b,
+0xbc, 0xba, 0xda, 0xb9, 0xbb, 0xe8, 0x90, 0x8a, 0xaa, 0xbb, 0xb1, 0xbb, 0x8d, 0x2a, 0x1d, 0xab,
+0xc0, 0xc0, 0xb0, 0x99, 0xa, 0x9d, 0xbb, 0xf3, 0x89, 0x98, 0xc, 0x90, 0xb0, 0x90, 0xa4, 0x92,
+0x3b, 0x9b, 0xb3, 0x0, 0x50, 0x39, 0x49, 0xa, 0x39, 0x11, 0x31, 0x11, 0x59, 0x90, 0x90, 0xa2,
+0x10, 0x1b, 0x31, 0x11, 0xa0, 0x9a, 0x51, 0x20, 0x2b, 0x91, 0x90, 0x1b, 0x11, 0xa0, 0xb3, 0xaa,
+0xc, 0xc9, 0xb0, 0xc1, 0xb8, 0xc1, 0x19, 0xb1, 0xd2, 0xa9, 0xa0, 0xd9, 0x99, 0x8b, 0x9d, 0xbb,
+0xb9, 0xba, 0x2b, 0xf, 0xb, 0xb9, 0xd9, 0xc0, 0xb8, 0xb0, 0x8c, 0x1b, 0xf, 0xa, 0x8a, 0x98,
+0xe, 0x8a, 0xcb, 0xd9, 0xa8, 0xaa, 0x9c, 0xaa, 0x99, 0x9b, 0x1d, 0x1b, 0xa, 0xbb, 0x9c, 0x2d,
+0x1c, 0x1d, 0x3b, 0x1d, 0xb, 0x9a, 0xb8, 0x99, 0x2b, 0xbb, 0xb, 0xad, 0xa, 0x1e, 0x90, 0xe1,
+0xa2, 0xa3, 0x8, 0x10, 0x29, 0x9a, 0x9a, 0x22, 0x3a, 0x9, 0x19, 0x10, 0x1b, 0x24, 0x23, 0x29,
+0x4b, 0x18, 0x31, 0x93, 0x41, 0x91, 0x3, 0x39, 0x91, 0xa1, 0x10, 0x90, 0x2f, 0x19, 0x98, 0xb0,
+0xa1, 0x33, 0x21, 0x5b, 0x1b, 0xa, 0x9c, 0x2a, 0xb9, 0xb9, 0xc2, 0x90, 0xb1, 0xd, 0x2a, 0xe,
+0xa, 0x1b, 0x2a, 0x1d, 0xc9, 0x2a, 0x39, 0x4b, 0x3c, 0xaa, 0xb3, 0x9, 0x4b, 0x2d, 0xa, 0x9,
+0xa5, 0xa8, 0x8, 0xb, 0x1c, 0x9c, 0xc1, 0xc0, 0x29, 0x2a, 0x1b, 0xf2, 0x91, 0xa9, 0xa1, 0xc1,
+0xf6, 0xfd, 0x3, 0x0, 0xd, 0x8, 0x9, 0x80, 0xa4, 0x97, 0x94, 0x1, 0x10, 0x92, 0x31, 0x18,
+0x7b, 0x11, 0x20, 0x7a, 0x0, 0x11, 0x22, 0x2, 0x33, 0x15, 0x43, 0x34, 0x32, 0x33, 0x16, 0x4,
+0x52, 0x30, 0x51, 0x38, 0x30, 0x21, 0x23, 0x13, 0x7, 0x2, 0x13, 0x43, 0x21, 0x31, 0x33, 0x95,
+0x53, 0x41, 0x10, 0x12, 0x4, 0x5, 0x22, 0x42, 0x10, 0x48, 0x31, 0x79, 0x10, 0xa2, 0x3, 0x31,
+0xa1, 0x93, 0x97, 0xa3, 0x10, 0x33, 0x30, 0x71, 0x29, 0x89, 0x93, 0x12, 0x3a, 0x39, 0x1b, 0x9,
+0xa3, 0xb3, 0x93, 0x2, 0xa4, 0xc3, 0x93, 0x12, 0x4b, 0x58, 0x19, 0x18, 0xb1, 0x61, 0x29, 0x19,
+0x10, 0x99, 0x1b, 0x2c, 0x2b, 0xa9, 0xba, 0xa1, 0xbb, 0x9d, 0xb1, 0xd1, 0x98, 0x90, 0x2, 0x2b,
+0x2f, 0x29, 0xa0, 0x91, 0x3, 0x3a, 0x13, 0x93, 0x32, 0x30, 0x1d, 0x18, 0x8, 0x1b, 0x1d, 0xc,
+0xaa, 0x19, 0xb, 0xd, 0x1e, 0x99, 0xa9, 0x8d, 0xa, 0x9b, 0xb9, 0xb1, 0xab, 0xfa, 0xb0, 0x91,
+0xb3, 0x2, 0x3a, 0x99, 0x1b, 0x90, 0x20, 0xa, 0x5a, 0x21, 0x8, 0x1a, 0x92, 0x92, 0x31, 0x69,
+0x29, 0x3a, 0x48, 0x9, 0xa5, 0x94, 0x29, 0x39, 0x39, 0x19, 0x39, 0x15, 0x3, 0x24, 0x3, 0x23,
+0x44, 0x11, 0x13, 0x51, 0x81, 0x85, 0x12, 0x20, 0x31, 0x61, 0x18, 0x10, 0x92, 0x33, 0x31, 0x39,
+0x43, 0x0, 0x24, 0x33, 0x43, 0x39, 0x2b, 0x24, 0xb1, 0x16, 0x18, 0x3a, 0x98, 0x30, 0x92, 0x92,
+0xd3, 0xb3, 0x11, 0x9a, 0xb9, 0x1d, 0x9, 0xa0, 0xb1, 0xd0, 0x92, 0x9b, 0xba, 0xab, 0xd, 0xb9,
+0xb9, 0xbb, 0xd9, 0xb9, 0xac, 0xab, 0x9c, 0xca, 0xd9, 0xaa, 0x8d, 0x9c, 0x8a, 0xb8, 0xac, 0x9a,
+0xbb, 0xbb, 0xfb, 0xc8, 0xa8, 0xa9, 0xb9, 0x9b, 0xba, 0x9f, 0xb9, 0xe0, 0xb0, 0xb9, 0xf8, 0xa9,
+0x97, 0xff, 0xb, 0x0, 0xa8, 0x9a, 0x9a, 0x1c, 0x8c, 0xab, 0xc9, 0xd8, 0xa0, 0xa9, 0xaa, 0xbb,
+0x9b, 0x9f, 0xb9, 0xd0, 0xa1, 0xa0, 0xbb, 0x9b, 0xb9, 0xbd, 0xa9, 0x9d, 0xb9, 0xb8, 0xa5, 0xc0,
+0xb1, 0x9, 0x1f, 0x1c, 0x19, 0xb, 0x19, 0x90, 0x22, 0x91, 0xa4, 0x22, 0x3d, 0x39, 0x14, 0x21,
+0x1a, 0x35, 0x1, 0xa3, 0x33, 0x71, 0x30, 0x21, 0x21, 0x22, 0x31, 0x43, 0x23, 0x71, 0x40, 0x28,
+0x11, 0x14, 0x14, 0x33, 0x14, 0x23, 0x36, 0x22, 0x42, 0x42, 0x23, 0x68, 0x20, 0x10, 0x21, 0x30,
+0x23, 0x22, 0x72, 0x28, 0x32, 0x32, 0x3, 0x15, 0x15, 0x18, 0x0, 0x21, 0x33, 0x39, 0x29, 0x99,
+0x4a, 0x18, 0x60, 0xa, 0x99, 0xf2, 0x81, 0xb2, 0xb0, 0x11, 0xb, 0xa9, 0xc0, 0xb2, 0xbb, 0x40,
+0x1d, 0x1a, 0x9c, 0xc1, 0xa0, 0x9a, 0xb9, 0xfb, 0xb1, 0xa0, 0x9b, 0xd9, 0xd0, 0xb1, 0x8a, 0x10,
+0xb9, 0xc9, 0xa8, 0xb0, 0x9b, 0xb9, 0x9b, 0x1a, 0x0, 0x9b, 0x1b, 0x19, 0x99, 0x99, 0xb9, 0xa9,
+0x90, 0x1b, 0xb, 0x21, 0x92, 0x3b, 0x13, 0x33, 0x29, 0x41, 0x49, 0x7a, 0x20, 0x1, 0x39, 0x39,
+0xa, 0x85, 0x0, 0x2c, 0x19, 0x4a, 0x4a, 0x9b, 0xb2, 0x10, 0x49, 0x3b, 0x19, 0x10, 0x90, 0x5b,
+0x3b, 0xd, 0x39, 0x20, 0x39, 0x53, 0x2b, 0x41, 0x22, 0x1, 0x30, 0x39, 0x30, 0x1, 0x13, 0x93,
+0x33, 0x92, 0x31, 0x21, 0x12, 0x32, 0x13, 0x12, 0x59, 0x30, 0x91, 0x1, 0x21, 0x12, 0x43, 0x4a,
+0x8b, 0x19, 0x1b, 0x4b, 0x1b, 0x3b, 0xd3, 0xc3, 0xb0, 0x8, 0xb9, 0xd1, 0xb1, 0xa2, 0x1, 0x2d,
+0x1d, 0xa9, 0xd8, 0x99, 0x19, 0xc, 0xab, 0xbd, 0xa9, 0xb9, 0xfb, 0xa9, 0xc0, 0xb9, 0xf0, 0xa1,
+0x98, 0x8a, 0xa8, 0x99, 0xbb, 0x9d, 0xb, 0x9b, 0xb9, 0xd0, 0xca, 0x19, 0x1d, 0xaa, 0x99, 0x9c,
+0x11, 0xff, 0x3, 0x0, 0x9a, 0x9c, 0xad, 0xe8, 0xa8, 0xd8, 0xa8, 0xc0, 0xb1, 0xc0, 0xa9, 0x89,
+0xab, 0xb9, 0xb9, 0xba, 0x9d, 0x2b, 0x3b, 0x3b, 0x99, 0x9, 0x3d, 0xc, 0x1b, 0xaa, 0xb1, 0xb9,
+0x11, 0xa0, 0x3a, 0x5b, 0x19, 0x49, 0x29, 0x30, 0x61, 0x11, 0x51, 0x21, 0x32, 0x72, 0x30, 0x58,
+0x12, 0x33, 0x31, 0x61, 0x22, 0x22, 0x61, 0x40, 0x30, 0x11, 0x33, 0x22, 0x43, 0x33, 0x73, 0x20,
+0x22, 0x43, 0x32, 0x33, 0x73, 0x33, 0x22, 0x26, 0x13, 0x22, 0x43, 0x23, 0x23, 0x34, 0x13, 0x5,
+0x5, 0x83, 0x31, 0x32, 0x43, 0x23, 0x71, 0x30, 0x39, 0x42, 0x21, 0x53, 0x31, 0x31, 0x30, 0x31,
+0x17, 0x21, 0x93, 0x82, 0x22, 0xb2, 0x11, 0x30, 0xa3, 0x31, 0x5, 0x98, 0x22, 0x3a, 0x9c, 0xc5,
+0x81, 0x99, 0x3b, 0x1f, 0xb, 0x8c, 0xab, 0xda, 0xe8, 0xa8, 0xb9, 0x9c, 0x9a, 0xb8, 0xea, 0xaa,
+0xb9, 0xcb, 0xba, 0x9e, 0x9b, 0x9b, 0xca, 0xc0, 0xb9, 0xc, 0xb, 0x8b, 0x9b, 0xc, 0xf, 0x8b,
+0x9a, 0x99, 0x9b, 0x8d, 0x3b, 0x1c, 0x9b, 0x1b, 0xb9, 0xb1, 0x91, 0x3b, 0x5b, 0xb, 0x1c, 0x0,
+0xb0, 0x9d, 0x9, 0x19, 0x91, 0x21, 0x93, 0xb5, 0xa5, 0xa3, 0x5, 0x12, 0x30, 0x50, 0x32, 0x39,
+0x22, 0x30, 0x93, 0x42, 0x20, 0x4d, 0x20, 0x92, 0x15, 0x12, 0x93, 0x96, 0x84, 0x12, 0x22, 0x33,
+0x39, 0x51, 0x39, 0x30, 0x3d, 0x29, 0x98, 0x13, 0x19, 0x13, 0x93, 0x22, 0x93, 0xa3, 0xd2, 0xb3,
+0xc2, 0x39, 0x1a, 0x20, 0xa2, 0x3, 0x3, 0x2a, 0x19, 0xc9, 0xa3, 0x10, 0xa2, 0x2b, 0xb9, 0x1b,
+0xb9, 0x9a, 0xbb, 0xac, 0xe0, 0xaa, 0x99, 0x3c, 0x9a, 0xb, 0x2c, 0xe, 0xa9, 0xa9, 0x8d, 0xd8,
+0x98, 0x99, 0xab, 0xb, 0xbb, 0x9c, 0x1b, 0x2e, 0x9b, 0xa9, 0xb8, 0xb2, 0xb9, 0x12, 0xc9, 0x9b,
+0xcb, 0xff, 0x0, 0x0, 0xd1, 0xb0, 0xc9, 0xab, 0xda, 0xba, 0xab, 0xbb, 0x9c, 0x1c, 0x1e, 0x2b,
+0x8a, 0xbb, 0xd1, 0xc0, 0xb8, 0x8, 0x3a, 0x9f, 0x99, 0x91, 0x91, 0x0, 0x99, 0xba, 0xd1, 0xa3,
+0xa, 0x1b, 0xcb, 0x2b, 0xd, 0xaa, 0xb0, 0xc0, 0x1, 0xb9, 0xb9, 0xa0, 0xc1, 0x0, 0x90, 0x9b,
+0x30, 0x31, 0x6b, 0x3b, 0x92, 0xd3, 0x20, 0xb2, 0xd3, 0x12, 0x20, 0x5b, 0x3a, 0x90, 0x85, 0x90,
+0xa4, 0x93, 0x21, 0x59, 0x18, 0x13, 0x4, 0x39, 0x3a, 0xb3, 0x5, 0x1a, 0x3a, 0x93, 0x10, 0x5,
+0xa4, 0x32, 0x22, 0xb2, 0x93, 0xc4, 0x84, 0x31, 0x1, 0x11, 0x3, 0x94, 0x12, 0x91, 0x1, 0x0,
+0xa3, 0x11, 0x3a, 0x86, 0x11, 0x10, 0x94, 0xa4, 0x15, 0x21, 0x30, 0x3b, 0x5b, 0x11, 0x23, 0x1b,
+0x33, 0x62, 0x80, 0x30, 0x23, 0x41, 0x5b, 0x19, 0x59, 0x39, 0x19, 0x18, 0x4, 0xe1, 0x91, 0x83,
+0x99, 0x19, 0xba, 0x12, 0x93, 0xb0, 0xb1, 0x99, 0x31, 0x31, 0x1b, 0x3b, 0x90, 0x21, 0x3, 0xb1,
+0x9b, 0x9, 0x91, 0xb1, 0x19, 0x9a, 0xa9, 0xba, 0x93, 0x13, 0x7b, 0x19, 0x10, 0x9, 0x80, 0xb3,
+0xb1, 0xa9, 0x29, 0xab, 0xb3, 0xb1, 0xbb, 0xa3, 0x32, 0x39, 0x39, 0x39, 0xda, 0xb2, 0x92, 0x99,
+0x39, 0x3b, 0x1a, 0x59, 0x29, 0x3a, 0x30, 0x13, 0xb5, 0xa5, 0x83, 0xa2, 0x22, 0x7b, 0x88, 0x2,
+0x11, 0x1, 0x49, 0x40, 0x1, 0x40, 0x68, 0x3a, 0x40, 0x10, 0x1, 0x11, 0x14, 0x0, 0x73, 0x10,
+0x18, 0x3a, 0x88, 0xa2, 0xa7, 0xb2, 0x83, 0x11, 0x91, 0x19, 0x12, 0x96, 0x2, 0x10, 0x90, 0x39,
+0xa1, 0x39, 0x31, 0x1, 0x21, 0x99, 0xb, 0x93, 0x11, 0xbb, 0xb3, 0x99, 0xba, 0xb0, 0xbb, 0x9b,
+0x8e, 0x9b, 0x0, 0x1e, 0x19, 0x9a, 0x8d, 0x99, 0xc8, 0x99, 0xab, 0xfa, 0x99, 0x98, 0x89, 0x29,
+0x37, 0x0, 0x0, 0x0, 0xd1, 0xc2, 0xc2, 0xb1, 0xaa, 0x9b, 0x9a, 0xb, 0xb1, 0x99, 0xd, 0x3c,
+0x1d, 0x9, 0x8, 0x89, 0xb1, 0x93, 0x90, 0x1a, 0x11, 0xb2, 0xb3, 0x9b, 0x11, 0x39, 0x5d, 0x1b,
+0x9, 0x91, 0x10, 0x5, 0x90, 0xa4, 0x96, 0x83, 0x11, 0x31, 0x33, 0x93, 0x11, 0x15, 0x90, 0xa5,
+0x11, 0x29, 0x39, 0x5b, 0x10, 0x2a, 0x13, 0x93, 0x12, 0x11, 0x32, 0x31, 0x23, 0x5, 0x92, 0x5,
+0x1, 0x3, 0x40, 0x4a, 0xa, 0x2b, 0xb9, 0xb0, 0x91, 0xb9, 0xb9, 0xd1, 0xe0, 0xb2, 0x91, 0xa0,
+0xc8, 0x91, 0x0, 0xbb, 0x9b, 0xab, 0x1a, 0x2b, 0xa9, 0x9, 0xb3, 0xa3, 0xd2, 0x9a, 0x90, 0x9d,
+0x9b, 0xaa, 0xf3, 0xb8, 0xa1, 0xa2, 0x8b, 0xb, 0x2d, 0x3b, 0xb, 0x99, 0x99, 0xb3, 0x19, 0x31,
+0x90, 0x93, 0xb2, 0xa6, 0xa2, 0x93, 0x92, 0x1a, 0x30, 0x33, 0x19, 0x3, 0x92, 0x95, 0x92, 0x20,
+0x40, 0x41, 0x3a, 0x53, 0x58, 0x20, 0x28, 0x39, 0x33, 0x21, 0x59, 0x10, 0x92, 0x7, 0x1, 0x3,
+0x12, 0x40, 0x48, 0x2a, 0x48, 0x5a, 0x0, 0xa1, 0xa3, 0x23, 0x14, 0x32, 0x26, 0x31, 0x61, 0x10,
+0x3, 0x15, 0x91, 0x93, 0x83, 0x13, 0x11, 0x2a, 0x3b, 0x3a, 0xb9, 0xbb, 0xb9, 0xb1, 0x9b, 0x91,
+0xc0, 0x8, 0x1b, 0x59, 0x29, 0x91, 0x21, 0x19, 0x90, 0x3a, 0x2d, 0x9b, 0x9b, 0x8e, 0x8c, 0x8c,
+0x89, 0x9a, 0xda, 0xc8, 0xb8, 0x9a, 0x9e, 0x9b, 0x8c, 0xa9, 0xc9, 0xaa, 0xab, 0xc0, 0xc0, 0x99,
+0xcb, 0xba, 0xb9, 0xcd, 0xe8, 0xa9, 0xa, 0x8e, 0xb, 0xba, 0xb0, 0xb0, 0xca, 0xc0, 0xd9, 0xb0,
+0x8a, 0x8c, 0xc, 0xc, 0xb, 0xab, 0x98, 0xd, 0x2b, 0x9c, 0x9b, 0xbb, 0xbc, 0x2c, 0xd, 0xba,
+0xaa, 0xb9, 0xcb, 0xb0, 0x9a, 0xba, 0xad, 0xa9, 0x99, 0xab, 0x1b, 0xe9, 0xa0, 0x0, 0x1c, 0x9a,
+0xee, 0xfd, 0x1, 0x0, 0x90, 0xb1, 0xc1, 0x81, 0x19, 0xb, 0xb3, 0xd0, 0xb2, 0xb4, 0xa1, 0x1b,
+0x91, 0xa5, 0xb1, 0x93, 0x19, 0x7a, 0x18, 0x40, 0x10, 0x81, 0xb2, 0xa7, 0xa2, 0x0, 0x1a, 0x10,
+0x31, 0xaa, 0x7b, 0x28, 0x30, 0x51, 0x38, 0x30, 0x32, 0x73, 0x30, 0x10, 0x14, 0x31, 0x78, 0x28,
+0x18, 0x94, 0x83, 0x32, 0x72, 0x38, 0x59, 0x38, 0x10, 0x31, 0x22, 0x31, 0x25, 0x61, 0x20, 0x12,
+0x93, 0x15, 0x23, 0x4, 0x53, 0x31, 0x12, 0x33, 0x42, 0x71, 0x11, 0x82, 0x4, 0x4, 0x12, 0x1,
+0x95, 0x94, 0x82, 0x28, 0x1a, 0x1a, 0x20, 0x0, 0x33, 0xbb, 0x11, 0x95, 0x92, 0x20, 0x23, 0x93,
+0x86, 0x20, 0x9, 0xd3, 0x92, 0x90, 0x39, 0x3a, 0x9, 0x9d, 0xc, 0xa9, 0xd1, 0xb2, 0x89, 0xf2,
+0x90, 0x9, 0x89, 0x91, 0xb9, 0xc3, 0xd1, 0xa1, 0xc3, 0x99, 0x19, 0x99, 0xe, 0x1d, 0x9, 0x8b,
+0x1b, 0xd2, 0xb2, 0x1, 0x2a, 0x3b, 0x30, 0x39, 0xa9, 0xb3, 0x5
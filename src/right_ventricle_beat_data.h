@@ -1,17710 +0,0 @@
-0xb,
-0xff,
-0x3,
-0xff,
-0xfa,
-0xfe,
-0xf3,
-0xfe,
-0xf0,
-0xfe,
-0xef,
-0xfe,
-0xec,
-0xfe,
-0xe8,
-0xfe,
-0xea,
-0xfe,
-0xe7,
-0xfe,
-0xe4,
-0xfe,
-0xe0,
-0xfe,
-0xd3,
-0xfe,
-0xd2,
-0xfe,
-0xc2,
-0xfe,
-0xc1,
-0xfe,
-0xb9,
-0xfe,
-0xb9,
-0xfe,
-0xae,
-0xfe,
-0xb1,
-0xfe,
-0xb0,
-0xfe,
-0xa9,
-0xfe,
-0xa7,
-0xfe,
-0xa3,
-0xfe,
-0x9d,
-0xfe,
-0x9b,
-0xfe,
-0x95,
-0xfe,
-0x9d,
-0xfe,
-0x93,
-0xfe,
-0x96,
-0xfe,
-0x90,
-0xfe,
-0x8b,
-0xfe,
-0x81,
-0xfe,
-0x7d,
-0xfe,
-0x77,
-0xfe,
-0x6f,
-0xfe,
-0x73,
-0xfe,
-0x66,
-0xfe,
-0x61,
-0xfe,
-0x4e,
-0xfe,
-0x50,
-0xfe,
-0x48,
-0xfe,
-0x4c,
-0xfe,
-0x44,
-0xfe,
-0x45,
-0xfe,
-0x46,
-0xfe,
-0x3d,
-0xfe,
-0x40,
-0xfe,
-0x3d,
-0xfe,
-0x47,
-0xfe,
-0x44,
-0xfe,
-0x49,
-0xfe,
-0x3d,
-0xfe,
-0x39,
-0xfe,
-0x38,
-0xfe,
-0x34,
-0xfe,
-0x40,
-0xfe,
-0x3a,
-0xfe,
-0x36,
-0xfe,
-0x3b,
-0xfe,
-0x3d,
-0xfe,
-0x4d,
-0xfe,
-0x4a,
-0xfe,
-0x50,
-0xfe,
-0x45,
-0xfe,
-0x41,
-0xfe,
-0x41,
-0xfe,
-0x3f,
-0xfe,
-0x46,
-0xfe,
-0x47,
-0xfe,
-0x46,
-0xfe,
-0x3e,
-0xfe,
-0x3f,
-0xfe,
-0x3a,
-0xfe,
-0x42,
-0xfe,
-0x3b,
-0xfe,
-0x41,
-0xfe,
-0x34,
-0xfe,
-0x34,
-0xfe,
-0x34,
-0xfe,
-0x3d,
-0xfe,
-0x3d,
-0xfe,
-0x3a,
-0xfe,
-0x35,
-0xfe,
-0x33,
-0xfe,
-0x38,
-0xfe,
-0x39,
-0xfe,
-0x38,
-0xfe,
-0x36,
-0xfe,
-0x2e,
-0xfe,
-0x38,
-0xfe,
-0x34,
-0xfe,
-0x39,
-0xfe,
-0x38,
-0xfe,
-0x3a,
-0xfe,
-0x3e,
-0xfe,
-0x45,
-0xfe,
-0x49,
-0xfe,
-0x4d,
-0xfe,
-0x4b,
-0xfe,
-0x4d,
-0xfe,
-0x43,
-0xfe,
-0x51,
-0xfe,
-0x4e,
-0xfe,
-0x5d,
-0xfe,
-0x53,
-0xfe,
-0x61,
-0xfe,
-0x60,
-0xfe,
-0x65,
-0xfe,
-0x6a,
-0xfe,
-0x6f,
-0xfe,
-0x6e,
-0xfe,
-0x70,
-0xfe,
-0x75,
-0xfe,
-0x7c,
-0xfe,
-0x7b,
-0xfe,
-0x82,
-0xfe,
-0x81,
-0xfe,
-0x85,
-0xfe,
-0x84,
-0xfe,
-0x8a,
-0xfe,
-0x8c,
-0xfe,
-0x94,
-0xfe,
-0x8e,
-0xfe,
-0x97,
-0xfe,
-0x92,
-0xfe,
-0x9a,
-0xfe,
-0xa2,
-0xfe,
-0xa1,
-0xfe,
-0xa7,
-0xfe,
-0xa5,
-0xfe,
-0xab,
-0xfe,
-0xad,
-0xfe,
-0xb4,
-0xfe,
-0xbd,
-0xfe,
-0xbe,
-0xfe,
-0xc5,
-0xfe,
-0xcb,
-0xfe,
-0xd2,
-0xfe,
-0xd2,
-0xfe,
-0xd9,
-0xfe,
-0xda,
-0xfe,
-0xe3,
-0xfe,
-0xe3,
-0xfe,
-0xe9,
-0xfe,
-0xf2,
-0xfe,
-0xf6,
-0xfe,
-0xff,
-0xfe,
-0x3,
-0xff,
-0xb,
-0xff,
-0x11,
-0xff,
-0x14,
-0xff,
-0x1b,
-0xff,
-0x1f,
-0xff,
-0x1f,
-0xff,
-0x21,
-0xff,
-0x22,
-0xff,
-0x2d,
-0xff,
-0x36,
-0xff,
-0x3d,
-0xff,
-0x45,
-0xff,
-0x4d,
-0xff,
-0x57,
-0xff,
-0x60,
-0xff,
-0x72,
-0xff,
-0x7a,
-0xff,
-0x83,
-0xff,
-0x8a,
-0xff,
-0x8e,
-0xff,
-0x9c,
-0xff,
-0xa7,
-0xff,
-0xba,
-0xff,
-0xbd,
-0xff,
-0xc3,
-0xff,
-0xca,
-0xff,
-0xd5,
-0xff,
-0xe5,
-0xff,
-0xed,
-0xff,
-0xfa,
-0xff,
-0xff,
-0xff,
-0x5,
-0x0,
-0xe,
-0x0,
-0x19,
-0x0,
-0x1c,
-0x0,
-0x25,
-0x0,
-0x21,
-0x0,
-0x29,
-0x0,
-0x2e,
-0x0,
-0x3c,
-0x0,
-0x3f,
-0x0,
-0x42,
-0x0,
-0x49,
-0x0,
-0x4d,
-0x0,
-0x56,
-0x0,
-0x55,
-0x0,
-0x60,
-0x0,
-0x65,
-0x0,
-0x70,
-0x0,
-0x78,
-0x0,
-0x81,
-0x0,
-0x8c,
-0x0,
-0x8c,
-0x0,
-0x99,
-0x0,
-0x9c,
-0x0,
-0xaa,
-0x0,
-0xae,
-0x0,
-0xb6,
-0x0,
-0xb8,
-0x0,
-0xc4,
-0x0,
-0xc6,
-0x0,
-0xcc,
-0x0,
-0xcd,
-0x0,
-0xcf,
-0x0,
-0xd5,
-0x0,
-0xd8,
-0x0,
-0xde,
-0x0,
-0xe4,
-0x0,
-0xf0,
-0x0,
-0xf2,
-0x0,
-0xfa,
-0x0,
-0xff,
-0x0,
-0x10,
-0x1,
-0x10,
-0x1,
-0x17,
-0x1,
-0x18,
-0x1,
-0x16,
-0x1,
-0x1b,
-0x1,
-0x1f,
-0x1,
-0x24,
-0x1,
-0x2b,
-0x1,
-0x2f,
-0x1,
-0x3a,
-0x1,
-0x34,
-0x1,
-0x37,
-0x1,
-0x34,
-0x1,
-0x3b,
-0x1,
-0x43,
-0x1,
-0x47,
-0x1,
-0x49,
-0x1,
-0x51,
-0x1,
-0x4d,
-0x1,
-0x59,
-0x1,
-0x51,
-0x1,
-0x57,
-0x1,
-0x53,
-0x1,
-0x59,
-0x1,
-0x57,
-0x1,
-0x5d,
-0x1,
-0x56,
-0x1,
-0x5d,
-0x1,
-0x5d,
-0x1,
-0x62,
-0x1,
-0x5a,
-0x1,
-0x5c,
-0x1,
-0x5d,
-0x1,
-0x63,
-0x1,
-0x63,
-0x1,
-0x62,
-0x1,
-0x5c,
-0x1,
-0x55,
-0x1,
-0x56,
-0x1,
-0x59,
-0x1,
-0x5c,
-0x1,
-0x54,
-0x1,
-0x54,
-0x1,
-0x53,
-0x1,
-0x54,
-0x1,
-0x59,
-0x1,
-0x52,
-0x1,
-0x4b,
-0x1,
-0x45,
-0x1,
-0x48,
-0x1,
-0x49,
-0x1,
-0x52,
-0x1,
-0x50,
-0x1,
-0x47,
-0x1,
-0x4b,
-0x1,
-0x40,
-0x1,
-0x4c,
-0x1,
-0x4a,
-0x1,
-0x4d,
-0x1,
-0x44,
-0x1,
-0x39,
-0x1,
-0x3c,
-0x1,
-0x3b,
-0x1,
-0x40,
-0x1,
-0x38,
-0x1,
-0x35,
-0x1,
-0x2f,
-0x1,
-0x2a,
-0x1,
-0x22,
-0x1,
-0x1c,
-0x1,
-0x16,
-0x1,
-0xf,
-0x1,
-0xe,
-0x1,
-0xc,
-0x1,
-0x7,
-0x1,
-0x9,
-0x1,
-0xfd,
-0x0,
-0xf8,
-0x0,
-0xf0,
-0x0,
-0xe8,
-0x0,
-0xe5,
-0x0,
-0xdc,
-0x0,
-0xd9,
-0x0,
-0xdc,
-0x0,
-0xd1,
-0x0,
-0xce,
-0x0,
-0xcb,
-0x0,
-0xd5,
-0x0,
-0xd6,
-0x0,
-0xc7,
-0x0,
-0xc0,
-0x0,
-0xbb,
-0x0,
-0xbc,
-0x0,
-0xb6,
-0x0,
-0xb5,
-0x0,
-0xaa,
-0x0,
-0xa3,
-0x0,
-0xab,
-0x0,
-0xa3,
-0x0,
-0xa4,
-0x0,
-0x9f,
-0x0,
-0x96,
-0x0,
-0x9a,
-0x0,
-0x90,
-0x0,
-0x8c,
-0x0,
-0x84,
-0x0,
-0x74,
-0x0,
-0x74,
-0x0,
-0x62,
-0x0,
-0x66,
-0x0,
-0x58,
-0x0,
-0x5a,
-0x0,
-0x51,
-0x0,
-0x4c,
-0x0,
-0x44,
-0x0,
-0x3f,
-0x0,
-0x42,
-0x0,
-0x3d,
-0x0,
-0x35,
-0x0,
-0x26,
-0x0,
-0x1b,
-0x0,
-0x15,
-0x0,
-0x10,
-0x0,
-0xf,
-0x0,
-0xe,
-0x0,
-0x6,
-0x0,
-0xfb,
-0xff,
-0xe8,
-0xff,
-0xd5,
-0xff,
-0xc9,
-0xff,
-0xbe,
-0xff,
-0xb2,
-0xff,
-0xa0,
-0xff,
-0x9b,
-0xff,
-0x8f,
-0xff,
-0x83,
-0xff,
-0x79,
-0xff,
-0x77,
-0xff,
-0x63,
-0xff,
-0x5a,
-0xff,
-0x42,
-0xff,
-0x38,
-0xff,
-0x28,
-0xff,
-0x29,
-0xff,
-0x1a,
-0xff,
-0xf,
-0xff,
-0x6,
-0xff,
-0xfb,
-0xfe,
-0xfb,
-0xfe,
-0xf1,
-0xfe,
-0xea,
-0xfe,
-0xdf,
-0xfe,
-0xd9,
-0xfe,
-0xcf,
-0xfe,
-0xc7,
-0xfe,
-0xc4,
-0xfe,
-0xb9,
-0xfe,
-0xb8,
-0xfe,
-0x9e,
-0xfe,
-0x99,
-0xfe,
-0x80,
-0xfe,
-0x81,
-0xfe,
-0x7b,
-0xfe,
-0x76,
-0xfe,
-0x66,
-0xfe,
-0x59,
-0xfe,
-0x5b,
-0xfe,
-0x5c,
-0xfe,
-0x51,
-0xfe,
-0x3f,
-0xfe,
-0x29,
-0xfe,
-0x24,
-0xfe,
-0x11,
-0xfe,
-0x6,
-0xfe,
-0xf9,
-0xfd,
-0xed,
-0xfd,
-0xe5,
-0xfd,
-0xe0,
-0xfd,
-0xe6,
-0xfd,
-0xde,
-0xfd,
-0xd0,
-0xfd,
-0xc0,
-0xfd,
-0xa6,
-0xfd,
-0x97,
-0xfd,
-0x93,
-0xfd,
-0x8c,
-0xfd,
-0x82,
-0xfd,
-0x81,
-0xfd,
-0x75,
-0xfd,
-0x74,
-0xfd,
-0x66,
-0xfd,
-0x66,
-0xfd,
-0x61,
-0xfd,
-0x55,
-0xfd,
-0x50,
-0xfd,
-0x3e,
-0xfd,
-0x46,
-0xfd,
-0x37,
-0xfd,
-0x30,
-0xfd,
-0x1b,
-0xfd,
-0x11,
-0xfd,
-0xd,
-0xfd,
-0xc,
-0xfd,
-0x3,
-0xfd,
-0x2,
-0xfd,
-0xfc,
-0xfc,
-0xf8,
-0xfc,
-0xea,
-0xfc,
-0xe4,
-0xfc,
-0xe5,
-0xfc,
-0xec,
-0xfc,
-0xe7,
-0xfc,
-0xf0,
-0xfc,
-0xfb,
-0xfc,
-0x7,
-0xfd,
-0xb,
-0xfd,
-0xb,
-0xfd,
-0x1d,
-0xfd,
-0x34,
-0xfd,
-0x42,
-0xfd,
-0x53,
-0xfd,
-0x5a,
-0xfd,
-0x77,
-0xfd,
-0x8a,
-0xfd,
-0xaa,
-0xfd,
-0xbc,
-0xfd,
-0xd8,
-0xfd,
-0xf5,
-0xfd,
-0x10,
-0xfe,
-0x29,
-0xfe,
-0x3d,
-0xfe,
-0x56,
-0xfe,
-0x72,
-0xfe,
-0x94,
-0xfe,
-0xb7,
-0xfe,
-0xe5,
-0xfe,
-0x2,
-0xff,
-0x22,
-0xff,
-0x47,
-0xff,
-0x6f,
-0xff,
-0xa0,
-0xff,
-0xca,
-0xff,
-0xfa,
-0xff,
-0x1f,
-0x0,
-0x4e,
-0x0,
-0x89,
-0x0,
-0xc6,
-0x0,
-0x5,
-0x1,
-0x47,
-0x1,
-0x81,
-0x1,
-0xc6,
-0x1,
-0x2,
-0x2,
-0x4e,
-0x2,
-0xa2,
-0x2,
-0xf2,
-0x2,
-0x42,
-0x3,
-0x8f,
-0x3,
-0xe2,
-0x3,
-0x42,
-0x4,
-0xa3,
-0x4,
-0x19,
-0x5,
-0x91,
-0x5,
-0xc,
-0x6,
-0x7d,
-0x6,
-0x0,
-0x7,
-0x7e,
-0x7,
-0xf9,
-0x7,
-0x74,
-0x8,
-0xfe,
-0x8,
-0x87,
-0x9,
-0xe,
-0xa,
-0x74,
-0xa,
-0xe0,
-0xa,
-0x57,
-0xb,
-0xd4,
-0xb,
-0x46,
-0xc,
-0xa8,
-0xc,
-0xfa,
-0xc,
-0x4e,
-0xd,
-0x99,
-0xd,
-0xfd,
-0xd,
-0x62,
-0xe,
-0xcb,
-0xe,
-0x30,
-0xf,
-0x7b,
-0xf,
-0xc6,
-0xf,
-0x21,
-0x10,
-0x6f,
-0x10,
-0xba,
-0x10,
-0xe,
-0x11,
-0x70,
-0x11,
-0xe1,
-0x11,
-0x3f,
-0x12,
-0x9d,
-0x12,
-0xe4,
-0x12,
-0x2b,
-0x13,
-0x74,
-0x13,
-0xc2,
-0x13,
-0x25,
-0x14,
-0x8c,
-0x14,
-0xf4,
-0x14,
-0x4e,
-0x15,
-0x9e,
-0x15,
-0xf8,
-0x15,
-0x4d,
-0x16,
-0xb3,
-0x16,
-0x21,
-0x17,
-0x87,
-0x17,
-0xf7,
-0x17,
-0x5f,
-0x18,
-0xce,
-0x18,
-0x30,
-0x19,
-0x96,
-0x19,
-0xfb,
-0x19,
-0x6b,
-0x1a,
-0xd5,
-0x1a,
-0x4f,
-0x1b,
-0xbb,
-0x1b,
-0x1a,
-0x1c,
-0x63,
-0x1c,
-0xac,
-0x1c,
-0xec,
-0x1c,
-0x36,
-0x1d,
-0x7d,
-0x1d,
-0xbc,
-0x1d,
-0x1,
-0x1e,
-0x25,
-0x1e,
-0x42,
-0x1e,
-0x54,
-0x1e,
-0x62,
-0x1e,
-0x78,
-0x1e,
-0x8e,
-0x1e,
-0xa0,
-0x1e,
-0xa5,
-0x1e,
-0xa2,
-0x1e,
-0x89,
-0x1e,
-0x67,
-0x1e,
-0x3f,
-0x1e,
-0x24,
-0x1e,
-0xff,
-0x1d,
-0xdf,
-0x1d,
-0xa9,
-0x1d,
-0x71,
-0x1d,
-0x1d,
-0x1d,
-0xc8,
-0x1c,
-0x76,
-0x1c,
-0x2e,
-0x1c,
-0xdc,
-0x1b,
-0x88,
-0x1b,
-0x20,
-0x1b,
-0xb2,
-0x1a,
-0x32,
-0x1a,
-0xca,
-0x19,
-0x53,
-0x19,
-0xec,
-0x18,
-0x78,
-0x18,
-0x4,
-0x18,
-0x79,
-0x17,
-0xee,
-0x16,
-0x56,
-0x16,
-0xd0,
-0x15,
-0x41,
-0x15,
-0xb6,
-0x14,
-0x26,
-0x14,
-0x95,
-0x13,
-0xf5,
-0x12,
-0x47,
-0x12,
-0x9e,
-0x11,
-0x1,
-0x11,
-0x5c,
-0x10,
-0x98,
-0xf,
-0xce,
-0xe,
-0x11,
-0xe,
-0x44,
-0xd,
-0x56,
-0xc,
-0x5b,
-0xb,
-0x5f,
-0xa,
-0x58,
-0x9,
-0x52,
-0x8,
-0x28,
-0x7,
-0x5,
-0x6,
-0xd8,
-0x4,
-0xa8,
-0x3,
-0x53,
-0x2,
-0xfe,
-0x0,
-0xae,
-0xff,
-0x64,
-0xfe,
-0xfd,
-0xfc,
-0xa3,
-0xfb,
-0x4d,
-0xfa,
-0xed,
-0xf8,
-0x7e,
-0xf7,
-0xfc,
-0xf5,
-0x7b,
-0xf4,
-0xfe,
-0xf2,
-0x7d,
-0xf1,
-0xe2,
-0xef,
-0x37,
-0xee,
-0x95,
-0xec,
-0xf,
-0xeb,
-0x7b,
-0xe9,
-0xe5,
-0xe7,
-0x44,
-0xe6,
-0xa4,
-0xe4,
-0xf1,
-0xe2,
-0x5a,
-0xe1,
-0xc9,
-0xdf,
-0x37,
-0xde,
-0xac,
-0xdc,
-0x38,
-0xdb,
-0xb2,
-0xd9,
-0x1e,
-0xd8,
-0x7a,
-0xd6,
-0xdc,
-0xd4,
-0x46,
-0xd3,
-0xbe,
-0xd1,
-0x35,
-0xd0,
-0xaa,
-0xce,
-0x1a,
-0xcd,
-0x88,
-0xcb,
-0xf6,
-0xc9,
-0x77,
-0xc8,
-0xeb,
-0xc6,
-0x5e,
-0xc5,
-0xcf,
-0xc3,
-0x4a,
-0xc2,
-0xc6,
-0xc0,
-0x5c,
-0xbf,
-0xfd,
-0xbd,
-0xae,
-0xbc,
-0x55,
-0xbb,
-0xfd,
-0xb9,
-0xab,
-0xb8,
-0x55,
-0xb7,
-0xc,
-0xb6,
-0xc6,
-0xb4,
-0x97,
-0xb3,
-0x73,
-0xb2,
-0x4d,
-0xb1,
-0x24,
-0xb0,
-0xfd,
-0xae,
-0xd2,
-0xad,
-0xc4,
-0xac,
-0xc4,
-0xab,
-0xc7,
-0xaa,
-0xcc,
-0xa9,
-0xdd,
-0xa8,
-0xf1,
-0xa7,
-0xff,
-0xa6,
-0x1e,
-0xa6,
-0x61,
-0xa5,
-0xb9,
-0xa4,
-0x21,
-0xa4,
-0x81,
-0xa3,
-0xed,
-0xa2,
-0x5e,
-0xa2,
-0xea,
-0xa1,
-0x7e,
-0xa1,
-0x1a,
-0xa1,
-0xd8,
-0xa0,
-0x98,
-0xa0,
-0x5b,
-0xa0,
-0x1e,
-0xa0,
-0xf0,
-0x9f,
-0xc3,
-0x9f,
-0xad,
-0x9f,
-0xb0,
-0x9f,
-0xb7,
-0x9f,
-0xd3,
-0x9f,
-0xfa,
-0x9f,
-0x25,
-0xa0,
-0x58,
-0xa0,
-0x98,
-0xa0,
-0xf4,
-0xa0,
-0x45,
-0xa1,
-0xa8,
-0xa1,
-0x1a,
-0xa2,
-0xa1,
-0xa2,
-0x30,
-0xa3,
-0xb5,
-0xa3,
-0x51,
-0xa4,
-0xf3,
-0xa4,
-0xad,
-0xa5,
-0x66,
-0xa6,
-0x37,
-0xa7,
-0x18,
-0xa8,
-0x10,
-0xa9,
-0x14,
-0xaa,
-0x15,
-0xab,
-0x2a,
-0xac,
-0x4b,
-0xad,
-0x7a,
-0xae,
-0xb7,
-0xaf,
-0xa,
-0xb1,
-0x68,
-0xb2,
-0xc5,
-0xb3,
-0x31,
-0xb5,
-0xbd,
-0xb6,
-0x69,
-0xb8,
-0x2c,
-0xba,
-0xe0,
-0xbb,
-0x8b,
-0xbd,
-0x37,
-0xbf,
-0xf3,
-0xc0,
-0xd1,
-0xc2,
-0xc7,
-0xc4,
-0xdd,
-0xc6,
-0xf4,
-0xc8,
-0x14,
-0xcb,
-0x3e,
-0xcd,
-0x82,
-0xcf,
-0xdf,
-0xd1,
-0x33,
-0xd4,
-0xab,
-0xd6,
-0x4f,
-0xd9,
-0x13,
-0xdc,
-0xe7,
-0xde,
-0xb3,
-0xe1,
-0x95,
-0xe4,
-0x89,
-0xe7,
-0x92,
-0xea,
-0xa3,
-0xed,
-0xbc,
-0xf0,
-0x3,
-0xf4,
-0x66,
-0xf7,
-0xd9,
-0xfa,
-0x4b,
-0xfe,
-0xc0,
-0x1,
-0x4a,
-0x5,
-0xe4,
-0x8,
-0x7e,
-0xc,
-0x30,
-0x10,
-0xec,
-0x13,
-0xb0,
-0x17,
-0x78,
-0x1b,
-0x3d,
-0x1f,
-0x2,
-0x23,
-0xd4,
-0x26,
-0xa7,
-0x2a,
-0x77,
-0x2e,
-0x2a,
-0x32,
-0xe4,
-0x35,
-0xa0,
-0x39,
-0x5f,
-0x3d,
-0x12,
-0x41,
-0xc0,
-0x44,
-0x58,
-0x48,
-0xf5,
-0x4b,
-0x8e,
-0x4f,
-0x17,
-0x53,
-0x87,
-0x56,
-0xd8,
-0x59,
-0x16,
-0x5d,
-0x4a,
-0x60,
-0x81,
-0x63,
-0x99,
-0x66,
-0xa1,
-0x69,
-0x97,
-0x6c,
-0x88,
-0x6f,
-0x76,
-0x72,
-0x3b,
-0x75,
-0xfc,
-0x77,
-0xa5,
-0x7a,
-0x44,
-0x7d,
-0xc2,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfe,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xfc,
-0x7f,
-0xff,
-0x7f,
-0xfd,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xff,
-0x7f,
-0xa9,
-0x7f,
-0x62,
-0x7d,
-0xfa,
-0x7a,
-0x93,
-0x78,
-0x27,
-0x76,
-0xb6,
-0x73,
-0x2a,
-0x71,
-0x9e,
-0x6e,
-0xfa,
-0x6b,
-0x56,
-0x69,
-0xb1,
-0x66,
-0x11,
-0x64,
-0x64,
-0x61,
-0xad,
-0x5e,
-0xf4,
-0x5b,
-0x2e,
-0x59,
-0x53,
-0x56,
-0x69,
-0x53,
-0x79,
-0x50,
-0x9c,
-0x4d,
-0xcb,
-0x4a,
-0x4,
-0x48,
-0x20,
-0x45,
-0x1c,
-0x42,
-0x7,
-0x3f,
-0xf1,
-0x3b,
-0xe0,
-0x38,
-0xc9,
-0x35,
-0xc7,
-0x32,
-0xcd,
-0x2f,
-0xe3,
-0x2c,
-0xdd,
-0x29,
-0xc2,
-0x26,
-0xa6,
-0x23,
-0x9c,
-0x20,
-0x9b,
-0x1d,
-0x8e,
-0x1a,
-0x86,
-0x17,
-0x83,
-0x14,
-0x96,
-0x11,
-0x98,
-0xe,
-0x91,
-0xb,
-0x96,
-0x8,
-0xa8,
-0x5,
-0x95,
-0x2,
-0x96,
-0xff,
-0x9d,
-0xfc,
-0xba,
-0xf9,
-0xd8,
-0xf6,
-0xef,
-0xf3,
-0x3,
-0xf1,
-0x4,
-0xee,
-0x6,
-0xeb,
-0xa,
-0xe8,
-0x16,
-0xe5,
-0x38,
-0xe2,
-0x75,
-0xdf,
-0xa2,
-0xdc,
-0xca,
-0xd9,
-0xed,
-0xd6,
-0x28,
-0xd4,
-0x64,
-0xd1,
-0xa7,
-0xce,
-0xe8,
-0xcb,
-0x3c,
-0xc9,
-0x7f,
-0xc6,
-0xce,
-0xc3,
-0x3a,
-0xc1,
-0xc1,
-0xbe,
-0x36,
-0xbc,
-0x99,
-0xb9,
-0xc,
-0xb7,
-0x7f,
-0xb4,
-0x7,
-0xb2,
-0x8c,
-0xaf,
-0x1e,
-0xad,
-0xb9,
-0xaa,
-0x60,
-0xa8,
-0xc,
-0xa6,
-0xc4,
-0xa3,
-0x92,
-0xa1,
-0x64,
-0x9f,
-0x36,
-0x9d,
-0x14,
-0x9b,
-0xf6,
-0x98,
-0xd5,
-0x96,
-0xcc,
-0x94,
-0xd9,
-0x92,
-0xe2,
-0x90,
-0xf1,
-0x8e,
-0x8,
-0x8d,
-0x27,
-0x8b,
-0x65,
-0x89,
-0xac,
-0x87,
-0xfc,
-0x85,
-0x4f,
-0x84,
-0xa4,
-0x82,
-0x1,
-0x81,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x1,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x2,
-0x80,
-0x0,
-0x80,
-0x0,
-0x80,
-0x3,
-0x80,
-0x0,
-0x80,
-0x4,
-0x80,
-0x0,
-0x80,
-0x9,
-0x80,
-0x8b,
-0x81,
-0x22,
-0x83,
-0xcc,
-0x84,
-0x91,
-0x86,
-0x4d,
-0x88,
-0x2b,
-0x8a,
-0x17,
-0x8c,
-0x8,
-0x8e,
-0x2,
-0x90,
-0x1e,
-0x92,
-0x59,
-0x94,
-0x9e,
-0x96,
-0xf6,
-0x98,
-0x4d,
-0x9b,
-0xbc,
-0x9d,
-0x30,
-0xa0,
-0xb4,
-0xa2,
-0x4e,
-0xa5,
-0xf7,
-0xa7,
-0xbf,
-0xaa,
-0x75,
-0xad,
-0x1b,
-0xb0,
-0xb6,
-0xb2,
-0x5f,
-0xb5,
-0x5,
-0xb8,
-0xaa,
-0xba,
-0x56,
-0xbd,
-0x11,
-0xc0,
-0xb3,
-0xc2,
-0x42,
-0xc5,
-0xbe,
-0xc7,
-0x36,
-0xca,
-0xbd,
-0xcc,
-0x3e,
-0xcf,
-0xc4,
-0xd1,
-0x4a,
-0xd4,
-0xc1,
-0xd6,
-0x19,
-0xd9,
-0x64,
-0xdb,
-0xbd,
-0xdd,
-0x18,
-0xe0,
-0x62,
-0xe2,
-0x88,
-0xe4,
-0xa5,
-0xe6,
-0xd3,
-0xe8,
-0x15,
-0xeb,
-0x5a,
-0xed,
-0x82,
-0xef,
-0x8a,
-0xf1,
-0x85,
-0xf3,
-0x88,
-0xf5,
-0x99,
-0xf7,
-0xc1,
-0xf9,
-0x8,
-0xfc,
-0x41,
-0xfe,
-0x79,
-0x0,
-0xa1,
-0x2,
-0xdc,
-0x4,
-0xf9,
-0x6,
-0x29,
-0x9,
-0x5e,
-0xb,
-0xb8,
-0xd,
-0xb,
-0x10,
-0x40,
-0x12,
-0x61,
-0x14,
-0x87,
-0x16,
-0xb7,
-0x18,
-0xee,
-0x1a,
-0x1a,
-0x1d,
-0x4d,
-0x1f,
-0x8e,
-0x21,
-0xc9,
-0x23,
-0xf7,
-0x25,
-0x19,
-0x28,
-0x31,
-0x2a,
-0x51,
-0x2c,
-0x68,
-0x2e,
-0x6b,
-0x30,
-0x52,
-0x32,
-0x28,
-0x34,
-0xee,
-0x35,
-0xb4,
-0x37,
-0x73,
-0x39,
-0x20,
-0x3b,
-0xb6,
-0x3c,
-0x3d,
-0x3e,
-0xc5,
-0x3f,
-0x46,
-0x41,
-0xac,
-0x42,
-0xfc,
-0x43,
-0x3e,
-0x45,
-0x75,
-0x46,
-0xae,
-0x47,
-0xd3,
-0x48,
-0xe8,
-0x49,
-0xeb,
-0x4a,
-0xe7,
-0x4b,
-0xd3,
-0x4c,
-0xb1,
-0x4d,
-0x8e,
-0x4e,
-0x56,
-0x4f,
-0xf,
-0x50,
-0xb1,
-0x50,
-0x5c,
-0x51,
-0xc,
-0x52,
-0xba,
-0x52,
-0x49,
-0x53,
-0xd2,
-0x53,
-0x41,
-0x54,
-0xbb,
-0x54,
-0x1f,
-0x55,
-0x87,
-0x55,
-0xe4,
-0x55,
-0x3e,
-0x56,
-0x95,
-0x56,
-0xd5,
-0x56,
-0xf,
-0x57,
-0x3c,
-0x57,
-0x64,
-0x57,
-0x79,
-0x57,
-0x7a,
-0x57,
-0x79,
-0x57,
-0x64,
-0x57,
-0x49,
-0x57,
-0x26,
-0x57,
-0xfa,
-0x56,
-0xbf,
-0x56,
-0x76,
-0x56,
-0x13,
-0x56,
-0x9e,
-0x55,
-0x27,
-0x55,
-0xa8,
-0x54,
-0x1b,
-0x54,
-0x7a,
-0x53,
-0xcb,
-0x52,
-0x11,
-0x52,
-0x53,
-0x51,
-0x7b,
-0x50,
-0x91,
-0x4f,
-0x92,
-0x4e,
-0x88,
-0x4d,
-0x63,
-0x4c,
-0x3a,
-0x4b,
-0x9,
-0x4a,
-0xca,
-0x48,
-0x79,
-0x47,
-0x13,
-0x46,
-0xad,
-0x44,
-0x2c,
-0x43,
-0xa7,
-0x41,
-0x19,
-0x40,
-0x76,
-0x3e,
-0xc8,
-0x3c,
-0xa,
-0x3b,
-0x43,
-0x39,
-0x68,
-0x37,
-0x7a,
-0x35,
-0x87,
-0x33,
-0x7a,
-0x31,
-0x6e,
-0x2f,
-0x53,
-0x2d,
-0x2e,
-0x2b,
-0xed,
-0x28,
-0xbb,
-0x26,
-0x70,
-0x24,
-0x25,
-0x22,
-0xc6,
-0x1f,
-0x71,
-0x1d,
-0xa,
-0x1b,
-0x95,
-0x18,
-0x1c,
-0x16,
-0x97,
-0x13,
-0xc,
-0x11,
-0x8c,
-0xe,
-0xfc,
-0xb,
-0x77,
-0x9,
-0xdc,
-0x6,
-0x51,
-0x4,
-0xad,
-0x1,
-0x19,
-0xff,
-0x82,
-0xfc,
-0x3,
-0xfa,
-0x88,
-0xf7,
-0x14,
-0xf5,
-0x8e,
-0xf2,
-0xe,
-0xf0,
-0x9f,
-0xed,
-0x48,
-0xeb,
-0xf4,
-0xe8,
-0xb5,
-0xe6,
-0x81,
-0xe4,
-0x5c,
-0xe2,
-0x38,
-0xe0,
-0x20,
-0xde,
-0x17,
-0xdc,
-0x29,
-0xda,
-0x41,
-0xd8,
-0x6c,
-0xd6,
-0xae,
-0xd4,
-0x2,
-0xd3,
-0x57,
-0xd1,
-0xc9,
-0xcf,
-0x49,
-0xce,
-0xd5,
-0xcc,
-0x67,
-0xcb,
-0x16,
-0xca,
-0xeb,
-0xc8,
-0xd3,
-0xc7,
-0xbd,
-0xc6,
-0xb3,
-0xc5,
-0xb7,
-0xc4,
-0xd7,
-0xc3,
-0x0,
-0xc3,
-0x42,
-0xc2,
-0x8e,
-0xc1,
-0xf1,
-0xc0,
-0x65,
-0xc0,
-0xe6,
-0xbf,
-0x6f,
-0xbf,
-0x12,
-0xbf,
-0xbf,
-0xbe,
-0x81,
-0xbe,
-0x3d,
-0xbe,
-0x19,
-0xbe,
-0xf7,
-0xbd,
-0xfa,
-0xbd,
-0x3,
-0xbe,
-0x14,
-0xbe,
-0x31,
-0xbe,
-0x6b,
-0xbe,
-0x9f,
-0xbe,
-0xe7,
-0xbe,
-0x38,
-0xbf,
-0xab,
-0xbf,
-0x19,
-0xc0,
-0x96,
-0xc0,
-0x13,
-0xc1,
-0xa7,
-0xc1,
-0x40,
-0xc2,
-0xd8,
-0xc2,
-0x80,
-0xc3,
-0x31,
-0xc4,
-0xef,
-0xc4,
-0xbe,
-0xc5,
-0x89,
-0xc6,
-0x56,
-0xc7,
-0x3a,
-0xc8,
-0x1b,
-0xc9,
-0xd,
-0xca,
-0x0,
-0xcb,
-0x5,
-0xcc,
-0xa,
-0xcd,
-0x19,
-0xce,
-0x2d,
-0xcf,
-0x43,
-0xd0,
-0x65,
-0xd1,
-0x8e,
-0xd2,
-0xc5,
-0xd3,
-0x3,
-0xd5,
-0x37,
-0xd6,
-0x70,
-0xd7,
-0xc6,
-0xd8,
-0xf,
-0xda,
-0x60,
-0xdb,
-0xaf,
-0xdc,
-0x17,
-0xde,
-0x7b,
-0xdf,
-0xe7,
-0xe0,
-0x52,
-0xe2,
-0xbe,
-0xe3,
-0x32,
-0xe5,
-0xac,
-0xe6,
-0x24,
-0xe8,
-0xa3,
-0xe9,
-0x28,
-0xeb,
-0xa7,
-0xec,
-0x26,
-0xee,
-0xa0,
-0xef,
-0x22,
-0xf1,
-0xa5,
-0xf2,
-0x21,
-0xf4,
-0xb8,
-0xf5,
-0x3d,
-0xf7,
-0xcc,
-0xf8,
-0x54,
-0xfa,
-0xd8,
-0xfb,
-0x51,
-0xfd,
-0xd5,
-0xfe,
-0x50,
-0x0,
-0xd2,
-0x1,
-0x41,
-0x3,
-0xb9,
-0x4,
-0x2e,
-0x6,
-0xa8,
-0x7,
-0x1f,
-0x9,
-0x9d,
-0xa,
-0xb,
-0xc,
-0x76,
-0xd,
-0xe5,
-0xe,
-0x58,
-0x10,
-0xc1,
-0x11,
-0x25,
-0x13,
-0x85,
-0x14,
-0xe9,
-0x15,
-0x4d,
-0x17,
-0xb3,
-0x18,
-0x10,
-0x1a,
-0x6a,
-0x1b,
-0xb2,
-0x1c,
-0xfe,
-0x1d,
-0x4a,
-0x1f,
-0x99,
-0x20,
-0xdd,
-0x21,
-0x1a,
-0x23,
-0x52,
-0x24,
-0x81,
-0x25,
-0xb0,
-0x26,
-0xd6,
-0x27,
-0x2,
-0x29,
-0x21,
-0x2a,
-0x37,
-0x2b,
-0x47,
-0x2c,
-0x54,
-0x2d,
-0x5b,
-0x2e,
-0x54,
-0x2f,
-0x48,
-0x30,
-0x31,
-0x31,
-0x1d,
-0x32,
-0xf2,
-0x32,
-0xca,
-0x33,
-0x9e,
-0x34,
-0x6c,
-0x35,
-0x2e,
-0x36,
-0xd7,
-0x36,
-0x7a,
-0x37,
-0x1d,
-0x38,
-0xc0,
-0x38,
-0x5b,
-0x39,
-0xde,
-0x39,
-0x5e,
-0x3a,
-0xcb,
-0x3a,
-0x43,
-0x3b,
-0xb0,
-0x3b,
-0x11,
-0x3c,
-0x5d,
-0x3c,
-0xac,
-0x3c,
-0xf6,
-0x3c,
-0x3e,
-0x3d,
-0x75,
-0x3d,
-0xa4,
-0x3d,
-0xc9,
-0x3d,
-0xe4,
-0x3d,
-0xf3,
-0x3d,
-0xf7,
-0x3d,
-0xfc,
-0x3d,
-0xf7,
-0x3d,
-0xf5,
-0x3d,
-0xe0,
-0x3d,
-0xc9,
-0x3d,
-0xa7,
-0x3d,
-0x73,
-0x3d,
-0x3c,
-0x3d,
-0xf4,
-0x3c,
-0xa9,
-0x3c,
-0x5b,
-0x3c,
-0x5,
-0x3c,
-0xa2,
-0x3b,
-0x2c,
-0x3b,
-0xbc,
-0x3a,
-0x45,
-0x3a,
-0xc5,
-0x39,
-0x34,
-0x39,
-0x94,
-0x38,
-0xf2,
-0x37,
-0x4c,
-0x37,
-0xa3,
-0x36,
-0xee,
-0x35,
-0x34,
-0x35,
-0x79,
-0x34,
-0xa3,
-0x33,
-0xd6,
-0x32,
-0xf3,
-0x31,
-0x14,
-0x31,
-0x25,
-0x30,
-0x38,
-0x2f,
-0x41,
-0x2e,
-0x48,
-0x2d,
-0x51,
-0x2c,
-0x50,
-0x2b,
-0x3f,
-0x2a,
-0x26,
-0x29,
-0x7,
-0x28,
-0xfc,
-0x26,
-0xdd,
-0x25,
-0xc4,
-0x24,
-0x95,
-0x23,
-0x65,
-0x22,
-0x38,
-0x21,
-0xe,
-0x20,
-0xdb,
-0x1e,
-0x9c,
-0x1d,
-0x64,
-0x1c,
-0x28,
-0x1b,
-0xf3,
-0x19,
-0xb2,
-0x18,
-0x70,
-0x17,
-0x2b,
-0x16,
-0xe6,
-0x14,
-0x9d,
-0x13,
-0x53,
-0x12,
-0xc,
-0x11,
-0xc3,
-0xf,
-0x6e,
-0xe,
-0x14,
-0xd,
-0xc8,
-0xb,
-0x6b,
-0xa,
-0x1b,
-0x9,
-0xc9,
-0x7,
-0x7c,
-0x6,
-0x2e,
-0x5,
-0xde,
-0x3,
-0x8a,
-0x2,
-0x38,
-0x1,
-0xe3,
-0xff,
-0x97,
-0xfe,
-0x3d,
-0xfd,
-0xfc,
-0xfb,
-0xab,
-0xfa,
-0x60,
-0xf9,
-0xd,
-0xf8,
-0xbc,
-0xf6,
-0x73,
-0xf5,
-0x2a,
-0xf4,
-0xec,
-0xf2,
-0xa0,
-0xf1,
-0x67,
-0xf0,
-0x22,
-0xef,
-0xe5,
-0xed,
-0xb2,
-0xec,
-0x7e,
-0xeb,
-0x48,
-0xea,
-0x10,
-0xe9,
-0xd9,
-0xe7,
-0xb2,
-0xe6,
-0x8a,
-0xe5,
-0x72,
-0xe4,
-0x48,
-0xe3,
-0x25,
-0xe2,
-0x8,
-0xe1,
-0xea,
-0xdf,
-0xce,
-0xde,
-0xaf,
-0xdd,
-0xa4,
-0xdc,
-0x92,
-0xdb,
-0x8d,
-0xda,
-0x85,
-0xd9,
-0x7c,
-0xd8,
-0x74,
-0xd7,
-0x7b,
-0xd6,
-0x83,
-0xd5,
-0x8c,
-0xd4,
-0x9f,
-0xd3,
-0xaf,
-0xd2,
-0xc5,
-0xd1,
-0xe0,
-0xd0,
-0xfb,
-0xcf,
-0x12,
-0xcf,
-0x2e,
-0xce,
-0x53,
-0xcd,
-0x75,
-0xcc,
-0xa0,
-0xcb,
-0xcf,
-0xca,
-0xfa,
-0xc9,
-0x2d,
-0xc9,
-0x62,
-0xc8,
-0x98,
-0xc7,
-0xd5,
-0xc6,
-0x13,
-0xc6,
-0x54,
-0xc5,
-0x98,
-0xc4,
-0xe9,
-0xc3,
-0x31,
-0xc3,
-0x86,
-0xc2,
-0xdb,
-0xc1,
-0x3c,
-0xc1,
-0x9e,
-0xc0,
-0x5,
-0xc0,
-0x71,
-0xbf,
-0xe9,
-0xbe,
-0x56,
-0xbe,
-0xd1,
-0xbd,
-0x55,
-0xbd,
-0xd7,
-0xbc,
-0x62,
-0xbc,
-0xf7,
-0xbb,
-0x97,
-0xbb,
-0x3a,
-0xbb,
-0xdf,
-0xba,
-0x87,
-0xba,
-0x3e,
-0xba,
-0xf8,
-0xb9,
-0xba,
-0xb9,
-0x86,
-0xb9,
-0x4d,
-0xb9,
-0x27,
-0xb9,
-0x1,
-0xb9,
-0xe2,
-0xb8,
-0xca,
-0xb8,
-0xc4,
-0xb8,
-0xbe,
-0xb8,
-0xc3,
-0xb8,
-0xc1,
-0xb8,
-0xd4,
-0xb8,
-0xec,
-0xb8,
-0xe,
-0xb9,
-0x38,
-0xb9,
-0x64,
-0xb9,
-0x96,
-0xb9,
-0xd2,
-0xb9,
-0xd,
-0xba,
-0x5b,
-0xba,
-0xb0,
-0xba,
-0xf,
-0xbb,
-0x6c,
-0xbb,
-0xdb,
-0xbb,
-0x49,
-0xbc,
-0xbd,
-0xbc,
-0x36,
-0xbd,
-0xb5,
-0xbd,
-0x36,
-0xbe,
-0xcb,
-0xbe,
-0x60,
-0xbf,
-0xfd,
-0xbf,
-0xa2,
-0xc0,
-0x48,
-0xc1,
-0xfa,
-0xc1,
-0xb1,
-0xc2,
-0x60,
-0xc3,
-0x27,
-0xc4,
-0xf1,
-0xc4,
-0xca,
-0xc5,
-0x9e,
-0xc6,
-0x74,
-0xc7,
-0x5a,
-0xc8,
-0x3e,
-0xc9,
-0x2e,
-0xca,
-0x1f,
-0xcb,
-0xf,
-0xcc,
-0x1,
-0xcd,
-0xfb,
-0xcd,
-0xff,
-0xce,
-0xb,
-0xd0,
-0x19,
-0xd1,
-0x2c,
-0xd2,
-0x3b,
-0xd3,
-0x51,
-0xd4,
-0x6b,
-0xd5,
-0x8e,
-0xd6,
-0xb9,
-0xd7,
-0xdc,
-0xd8,
-0x4,
-0xda,
-0x29,
-0xdb,
-0x5b,
-0xdc,
-0x8a,
-0xdd,
-0xc9,
-0xde,
-0xfe,
-0xdf,
-0x3d,
-0xe1,
-0x72,
-0xe2,
-0xc1,
-0xe3,
-0x19,
-0xe5,
-0x85,
-0xe6,
-0xd1,
-0xe7,
-0xc,
-0xe9,
-0x40,
-0xea,
-0x8b,
-0xeb,
-0xca,
-0xec,
-0x23,
-0xee,
-0x67,
-0xef,
-0xb5,
-0xf0,
-0xf5,
-0xf1,
-0x3f,
-0xf3,
-0x81,
-0xf4,
-0xd2,
-0xf5,
-0x1d,
-0xf7,
-0x6a,
-0xf8,
-0xb0,
-0xf9,
-0x0,
-0xfb,
-0x44,
-0xfc,
-0x87,
-0xfd,
-0xc0,
-0xfe,
-0xe,
-0x0,
-0x56,
-0x1,
-0xab,
-0x2,
-0xee,
-0x3,
-0x38,
-0x5,
-0x72,
-0x6,
-0xb9,
-0x7,
-0xf0,
-0x8,
-0x33,
-0xa,
-0x6c,
-0xb,
-0xb0,
-0xc,
-0xe4,
-0xd,
-0x18,
-0xf,
-0x43,
-0x10,
-0x6f,
-0x11,
-0x9d,
-0x12,
-0xc2,
-0x13,
-0xee,
-0x14,
-0xd,
-0x16,
-0x30,
-0x17,
-0x56,
-0x18,
-0x80,
-0x19,
-0x99,
-0x1a,
-0xb1,
-0x1b,
-0xcb,
-0x1c,
-0xdd,
-0x1d,
-0xf4,
-0x1e,
-0xff,
-0x1f,
-0x8,
-0x21,
-0xff,
-0x21,
-0x8,
-0x23,
-0xff,
-0x23,
-0xf9,
-0x24,
-0xeb,
-0x25,
-0xe0,
-0x26,
-0xb8,
-0x27,
-0xa1,
-0x28,
-0x7f,
-0x29,
-0x66,
-0x2a,
-0x3c,
-0x2b,
-0x1b,
-0x2c,
-0xe7,
-0x2c,
-0xb6,
-0x2d,
-0x79,
-0x2e,
-0x3d,
-0x2f,
-0xff,
-0x2f,
-0xbc,
-0x30,
-0x76,
-0x31,
-0x21,
-0x32,
-0xd6,
-0x32,
-0x7b,
-0x33,
-0x20,
-0x34,
-0xc4,
-0x34,
-0x5b,
-0x35,
-0xf5,
-0x35,
-0x8a,
-0x36,
-0x1d,
-0x37,
-0xa0,
-0x37,
-0x29,
-0x38,
-0xa8,
-0x38,
-0x26,
-0x39,
-0x8c,
-0x39,
-0x7,
-0x3a,
-0x6e,
-0x3a,
-0xd8,
-0x3a,
-0x3a,
-0x3b,
-0x94,
-0x3b,
-0xe2,
-0x3b,
-0x2f,
-0x3c,
-0x6a,
-0x3c,
-0xad,
-0x3c,
-0xed,
-0x3c,
-0x2c,
-0x3d,
-0x56,
-0x3d,
-0x84,
-0x3d,
-0xa8,
-0x3d,
-0xd3,
-0x3d,
-0xf0,
-0x3d,
-0x1,
-0x3e,
-0x19,
-0x3e,
-0x24,
-0x3e,
-0x2c,
-0x3e,
-0x2b,
-0x3e,
-0x26,
-0x3e,
-0x14,
-0x3e,
-0x0,
-0x3e,
-0xf1,
-0x3d,
-0xd7,
-0x3d,
-0xbd,
-0x3d,
-0x88,
-0x3d,
-0x5e,
-0x3d,
-0x30,
-0x3d,
-0xfc,
-0x3c,
-0xc4,
-0x3c,
-0x83,
-0x3c,
-0x49,
-0x3c,
-0xff,
-0x3b,
-0xb5,
-0x3b,
-0x5a,
-0x3b,
-0x5,
-0x3b,
-0xa6,
-0x3a,
-0x3f,
-0x3a,
-0xd8,
-0x39,
-0x6e,
-0x39,
-0x6,
-0x39,
-0x88,
-0x38,
-0xb,
-0x38,
-0x88,
-0x37,
-0xb,
-0x37,
-0x81,
-0x36,
-0xf6,
-0x35,
-0x6e,
-0x35,
-0xd2,
-0x34,
-0x37,
-0x34,
-0x9e,
-0x33,
-0xfd,
-0x32,
-0x5b,
-0x32,
-0xbf,
-0x31,
-0x15,
-0x31,
-0x6b,
-0x30,
-0xb2,
-0x2f,
-0x7,
-0x2f,
-0x47,
-0x2e,
-0x94,
-0x2d,
-0xd6,
-0x2c,
-0x1b,
-0x2c,
-0x58,
-0x2b,
-0x96,
-0x2a,
-0xc7,
-0x29,
-0x7,
-0x29,
-0x43,
-0x28,
-0x76,
-0x27,
-0xab,
-0x26,
-0xd9,
-0x25,
-0xd,
-0x25,
-0x39,
-0x24,
-0x66,
-0x23,
-0x95,
-0x22,
-0xc4,
-0x21,
-0xe9,
-0x20,
-0x10,
-0x20,
-0x37,
-0x1f,
-0x5c,
-0x1e,
-0x81,
-0x1d,
-0xa7,
-0x1c,
-0xcb,
-0x1b,
-0xec,
-0x1a,
-0xa,
-0x1a,
-0x2d,
-0x19,
-0x53,
-0x18,
-0x71,
-0x17,
-0x8e,
-0x16,
-0xad,
-0x15,
-0xd6,
-0x14,
-0xf2,
-0x13,
-0x15,
-0x13,
-0x31,
-0x12,
-0x54,
-0x11,
-0x76,
-0x10,
-0x97,
-0xf,
-0xc1,
-0xe,
-0xe6,
-0xd,
-0xe,
-0xd,
-0x30,
-0xc,
-0x5c,
-0xb,
-0x83,
-0xa,
-0xb7,
-0x9,
-0xe5,
-0x8,
-0xd,
-0x8,
-0x3e,
-0x7,
-0x6d,
-0x6,
-0xa5,
-0x5,
-0xdc,
-0x4,
-0xd,
-0x4,
-0x43,
-0x3,
-0x7a,
-0x2,
-0xae,
-0x1,
-0xe5,
-0x0,
-0x25,
-0x0,
-0x69,
-0xff,
-0xb7,
-0xfe,
-0x1,
-0xfe,
-0x42,
-0xfd,
-0x8d,
-0xfc,
-0xd5,
-0xfb,
-0x25,
-0xfb,
-0x70,
-0xfa,
-0xc3,
-0xf9,
-0x1d,
-0xf9,
-0x6e,
-0xf8,
-0xc9,
-0xf7,
-0x28,
-0xf7,
-0x87,
-0xf6,
-0xea,
-0xf5,
-0x51,
-0xf5,
-0xb2,
-0xf4,
-0x24,
-0xf4,
-0x89,
-0xf3,
-0xfa,
-0xf2,
-0x67,
-0xf2,
-0xe1,
-0xf1,
-0x5b,
-0xf1,
-0xd9,
-0xf0,
-0x57,
-0xf0,
-0xdd,
-0xef,
-0x67,
-0xef,
-0xe9,
-0xee,
-0x78,
-0xee,
-0x6,
-0xee,
-0xa4,
-0xed,
-0x3d,
-0xed,
-0xdb,
-0xec,
-0x7e,
-0xec,
-0x1a,
-0xec,
-0xbf,
-0xeb,
-0x66,
-0xeb,
-0x1b,
-0xeb,
-0xd4,
-0xea,
-0x8d,
-0xea,
-0x44,
-0xea,
-0x6,
-0xea,
-0xc5,
-0xe9,
-0x8f,
-0xe9,
-0x58,
-0xe9,
-0x2d,
-0xe9,
-0xfc,
-0xe8,
-0xdf,
-0xe8,
-0xc0,
-0xe8,
-0xa0,
-0xe8,
-0x85,
-0xe8,
-0x75,
-0xe8,
-0x60,
-0xe8,
-0x52,
-0xe8,
-0x47,
-0xe8,
-0x45,
-0xe8,
-0x44,
-0xe8,
-0x40,
-0xe8,
-0x42,
-0xe8,
-0x46,
-0xe8,
-0x50,
-0xe8,
-0x5c,
-0xe8,
-0x65,
-0xe8,
-0x83,
-0xe8,
-0x96,
-0xe8,
-0xb4,
-0xe8,
-0xd1,
-0xe8,
-0xf5,
-0xe8,
-0x1e,
-0xe9,
-0x41,
-0xe9,
-0x72,
-0xe9,
-0x96,
-0xe9,
-0xcd,
-0xe9,
-0xa,
-0xea,
-0x49,
-0xea,
-0x89,
-0xea,
-0xbe,
-0xea,
-0x5,
-0xeb,
-0x41,
-0xeb,
-0x8c,
-0xeb,
-0xd4,
-0xeb,
-0x1a,
-0xec,
-0x67,
-0xec,
-0xb5,
-0xec,
-0x8,
-0xed,
-0x62,
-0xed,
-0xb7,
-0xed,
-0xa,
-0xee,
-0x60,
-0xee,
-0xb9,
-0xee,
-0x20,
-0xef,
-0x7f,
-0xef,
-0xde,
-0xef,
-0x44,
-0xf0,
-0xa7,
-0xf0,
-0xc,
-0xf1,
-0x72,
-0xf1,
-0xe2,
-0xf1,
-0x4a,
-0xf2,
-0xba,
-0xf2,
-0x25,
-0xf3,
-0x96,
-0xf3,
-0x4,
-0xf4,
-0x71,
-0xf4,
-0xe4,
-0xf4,
-0x51,
-0xf5,
-0xc5,
-0xf5,
-0x41,
-0xf6,
-0xae,
-0xf6,
-0x29,
-0xf7,
-0x96,
-0xf7,
-0x13,
-0xf8,
-0x89,
-0xf8,
-0xfc,
-0xf8,
-0x74,
-0xf9,
-0xe3,
-0xf9,
-0x62,
-0xfa,
-0xda,
-0xfa,
-0x5b,
-0xfb,
-0xd5,
-0xfb,
-0x4b,
-0xfc,
-0xbf,
-0xfc,
-0x3e,
-0xfd,
-0xb7,
-0xfd,
-0x35,
-0xfe,
-0xaf,
-0xfe,
-0x27,
-0xff,
-0x99,
-0xff,
-0x18,
-0x0,
-0x94,
-0x0,
-0xe,
-0x1,
-0x80,
-0x1,
-0xf2,
-0x1,
-0x62,
-0x2,
-0xd7,
-0x2,
-0x4b,
-0x3,
-0xbb,
-0x3,
-0x2e,
-0x4,
-0x9f,
-0x4,
-0xb,
-0x5,
-0x78,
-0x5,
-0xe0,
-0x5,
-0x50,
-0x6,
-0xbb,
-0x6,
-0x1e,
-0x7,
-0x82,
-0x7,
-0xe4,
-0x7,
-0x4c,
-0x8,
-0xad,
-0x8,
-0x11,
-0x9,
-0x6c,
-0x9,
-0xc8,
-0x9,
-0x24,
-0xa,
-0x71,
-0xa,
-0xcd,
-0xa,
-0x25,
-0xb,
-0x73,
-0xb,
-0xb7,
-0xb,
-0xfe,
-0xb,
-0x49,
-0xc,
-0xa1,
-0xc,
-0xf3,
-0xc,
-0x44,
-0xd,
-0x7a,
-0xd,
-0xc3,
-0xd,
-0xfb,
-0xd,
-0x3d,
-0xe,
-0x87,
-0xe,
-0xca,
-0xe,
-0xa,
-0xf,
-0x3e,
-0xf,
-0x75,
-0xf,
-0xae,
-0xf,
-0xec,
-0xf,
-0x2a,
-0x10,
-0x63,
-0x10,
-0x91,
-0x10,
-0xbb,
-0x10,
-0xea,
-0x10,
-0x1f,
-0x11,
-0x4b,
-0x11,
-0x6e,
-0x11,
-0x8f,
-0x11,
-0xab,
-0x11,
-0xd2,
-0x11,
-0xf1,
-0x11,
-0x17,
-0x12,
-0x31,
-0x12,
-0x47,
-0x12,
-0x5b,
-0x12,
-0x75,
-0x12,
-0x88,
-0x12,
-0x9b,
-0x12,
-0xa7,
-0x12,
-0xb3,
-0x12,
-0xbc,
-0x12,
-0xc7,
-0x12,
-0xd7,
-0x12,
-0xe5,
-0x12,
-0xe3,
-0x12,
-0xe0,
-0x12,
-0xe1,
-0x12,
-0xe5,
-0x12,
-0xe9,
-0x12,
-0xf0,
-0x12,
-0xed,
-0x12,
-0xe9,
-0x12,
-0xd7,
-0x12,
-0xd2,
-0x12,
-0xd1,
-0x12,
-0xca,
-0x12,
-0xbb,
-0x12,
-0xa7,
-0x12,
-0x94,
-0x12,
-0x86,
-0x12,
-0x70,
-0x12,
-0x5b,
-0x12,
-0x42,
-0x12,
-0x27,
-0x12,
-0xd,
-0x12,
-0xf1,
-0x11,
-0xd9,
-0x11,
-0xb2,
-0x11,
-0x8b,
-0x11,
-0x66,
-0x11,
-0x41,
-0x11,
-0x16,
-0x11,
-0xee,
-0x10,
-0xcc,
-0x10,
-0xa7,
-0x10,
-0x7f,
-0x10,
-0x51,
-0x10,
-0x1e,
-0x10,
-0xf1,
-0xf,
-0xbc,
-0xf,
-0x90,
-0xf,
-0x60,
-0xf,
-0x2f,
-0xf,
-0xfc,
-0xe,
-0xd1,
-0xe,
-0x95,
-0xe,
-0x66,
-0xe,
-0x2c,
-0xe,
-0xfb,
-0xd,
-0xbb,
-0xd,
-0x88,
-0xd,
-0x52,
-0xd,
-0x22,
-0xd,
-0xec,
-0xc,
-0xb8,
-0xc,
-0x7a,
-0xc,
-0x41,
-0xc,
-0x6,
-0xc,
-0xc2,
-0xb,
-0x81,
-0xb,
-0x3e,
-0xb,
-0x0,
-0xb,
-0xc4,
-0xa,
-0x8a,
-0xa,
-0x4b,
-0xa,
-0x19,
-0xa,
-0xdc,
-0x9,
-0x9b,
-0x9,
-0x61,
-0x9,
-0x1d,
-0x9,
-0xec,
-0x8,
-0xb5,
-0x8,
-0x87,
-0x8,
-0x42,
-0x8,
-0x5,
-0x8,
-0xc0,
-0x7,
-0x85,
-0x7,
-0x44,
-0x7,
-0x3,
-0x7,
-0xc1,
-0x6,
-0x7c,
-0x6,
-0x3d,
-0x6,
-0xf2,
-0x5,
-0xb3,
-0x5,
-0x6a,
-0x5,
-0x30,
-0x5,
-0xe9,
-0x4,
-0xb0,
-0x4,
-0x67,
-0x4,
-0x2b,
-0x4,
-0xe9,
-0x3,
-0xb1,
-0x3,
-0x73,
-0x3,
-0x30,
-0x3,
-0xfe,
-0x2,
-0xba,
-0x2,
-0x7c,
-0x2,
-0x44,
-0x2,
-0xc,
-0x2,
-0xd0,
-0x1,
-0x96,
-0x1,
-0x51,
-0x1,
-0x18,
-0x1,
-0xe3,
-0x0,
-0xb8,
-0x0,
-0x84,
-0x0,
-0x4f,
-0x0,
-0x19,
-0x0,
-0xe4,
-0xff,
-0xb0,
-0xff,
-0x7b,
-0xff,
-0x44,
-0xff,
-0x9,
-0xff,
-0xd1,
-0xfe,
-0xa9,
-0xfe,
-0x74,
-0xfe,
-0x4a,
-0xfe,
-0x16,
-0xfe,
-0xe7,
-0xfd,
-0xb8,
-0xfd,
-0x8b,
-0xfd,
-0x66,
-0xfd,
-0x3a,
-0xfd,
-0x18,
-0xfd,
-0xe9,
-0xfc,
-0xc3,
-0xfc,
-0xa7,
-0xfc,
-0x8c,
-0xfc,
-0x64,
-0xfc,
-0x34,
-0xfc,
-0xe,
-0xfc,
-0xea,
-0xfb,
-0xc4,
-0xfb,
-0x96,
-0xfb,
-0x6f,
-0xfb,
-0x42,
-0xfb,
-0x1e,
-0xfb,
-0x0,
-0xfb,
-0xd3,
-0xfa,
-0xac,
-0xfa,
-0x8b,
-0xfa,
-0x6d,
-0xfa,
-0x51,
-0xfa,
-0x29,
-0xfa,
-0x9,
-0xfa,
-0xe5,
-0xf9,
-0xca,
-0xf9,
-0xad,
-0xf9,
-0x8f,
-0xf9,
-0x70,
-0xf9,
-0x4f,
-0xf9,
-0x31,
-0xf9,
-0xe,
-0xf9,
-0xf4,
-0xf8,
-0xd5,
-0xf8,
-0xb9,
-0xf8,
-0x9d,
-0xf8,
-0x7d,
-0xf8,
-0x5d,
-0xf8,
-0x3c,
-0xf8,
-0x1f,
-0xf8,
-0x3,
-0xf8,
-0xe5,
-0xf7,
-0xcc,
-0xf7,
-0xb5,
-0xf7,
-0xa3,
-0xf7,
-0x82,
-0xf7,
-0x6b,
-0xf7,
-0x46,
-0xf7,
-0x2d,
-0xf7,
-0x17,
-0xf7,
-0xfd,
-0xf6,
-0xe4,
-0xf6,
-0xc5,
-0xf6,
-0xbe,
-0xf6,
-0xa3,
-0xf6,
-0x92,
-0xf6,
-0x7d,
-0xf6,
-0x62,
-0xf6,
-0x54,
-0xf6,
-0x37,
-0xf6,
-0x23,
-0xf6,
-0x7,
-0xf6,
-0xf4,
-0xf5,
-0xde,
-0xf5,
-0xc4,
-0xf5,
-0xb7,
-0xf5,
-0x96,
-0xf5,
-0x86,
-0xf5,
-0x6a,
-0xf5,
-0x5e,
-0xf5,
-0x41,
-0xf5,
-0x31,
-0xf5,
-0x24,
-0xf5,
-0xe,
-0xf5,
-0xf1,
-0xf4,
-0xdb,
-0xf4,
-0xc5,
-0xf4,
-0xb5,
-0xf4,
-0x9d,
-0xf4,
-0x92,
-0xf4,
-0x7c,
-0xf4,
-0x70,
-0xf4,
-0x58,
-0xf4,
-0x3d,
-0xf4,
-0x1e,
-0xf4,
-0x2,
-0xf4,
-0xf6,
-0xf3,
-0xe2,
-0xf3,
-0xcd,
-0xf3,
-0xb2,
-0xf3,
-0xa5,
-0xf3,
-0x8a,
-0xf3,
-0x7e,
-0xf3,
-0x64,
-0xf3,
-0x4a,
-0xf3,
-0x39,
-0xf3,
-0x28,
-0xf3,
-0x1c,
-0xf3,
-0x12,
-0xf3,
-0x6,
-0xf3,
-0xe9,
-0xf2,
-0xdd,
-0xf2,
-0xc6,
-0xf2,
-0xb9,
-0xf2,
-0xb2,
-0xf2,
-0xa0,
-0xf2,
-0x95,
-0xf2,
-0x7d,
-0xf2,
-0x74,
-0xf2,
-0x5b,
-0xf2,
-0x54,
-0xf2,
-0x39,
-0xf2,
-0x35,
-0xf2,
-0x25,
-0xf2,
-0x1f,
-0xf2,
-0xf,
-0xf2,
-0x1,
-0xf2,
-0xed,
-0xf1,
-0xde,
-0xf1,
-0xce,
-0xf1,
-0xbf,
-0xf1,
-0xae,
-0xf1,
-0xa0,
-0xf1,
-0x8b,
-0xf1,
-0x7e,
-0xf1,
-0x6d,
-0xf1,
-0x57,
-0xf1,
-0x47,
-0xf1,
-0x38,
-0xf1,
-0x39,
-0xf1,
-0x29,
-0xf1,
-0x1e,
-0xf1,
-0x8,
-0xf1,
-0xff,
-0xf0,
-0xe9,
-0xf0,
-0xe3,
-0xf0,
-0xdb,
-0xf0,
-0xd4,
-0xf0,
-0xc1,
-0xf0,
-0xb6,
-0xf0,
-0xac,
-0xf0,
-0xab,
-0xf0,
-0xa2,
-0xf0,
-0x9e,
-0xf0,
-0x96,
-0xf0,
-0x93,
-0xf0,
-0x8e,
-0xf0,
-0x89,
-0xf0,
-0x83,
-0xf0,
-0x81,
-0xf0,
-0x7f,
-0xf0,
-0x7e,
-0xf0,
-0x86,
-0xf0,
-0x82,
-0xf0,
-0x85,
-0xf0,
-0x7f,
-0xf0,
-0x85,
-0xf0,
-0x86,
-0xf0,
-0x82,
-0xf0,
-0x8b,
-0xf0,
-0x8d,
-0xf0,
-0x8c,
-0xf0,
-0x93,
-0xf0,
-0x93,
-0xf0,
-0x9a,
-0xf0,
-0x9a,
-0xf0,
-0xa1,
-0xf0,
-0xa4,
-0xf0,
-0xaa,
-0xf0,
-0xb1,
-0xf0,
-0xbe,
-0xf0,
-0xc6,
-0xf0,
-0xd4,
-0xf0,
-0xe0,
-0xf0,
-0xe5,
-0xf0,
-0xf0,
-0xf0,
-0xf2,
-0xf0,
-0xff,
-0xf0,
-0x7,
-0xf1,
-0x12,
-0xf1,
-0x19,
-0xf1,
-0x22,
-0xf1,
-0x2b,
-0xf1,
-0x3f,
-0xf1,
-0x4c,
-0xf1,
-0x5d,
-0xf1,
-0x6e,
-0xf1,
-0x7f,
-0xf1,
-0x8b,
-0xf1,
-0x9c,
-0xf1,
-0xaa,
-0xf1,
-0xb7,
-0xf1,
-0xbd,
-0xf1,
-0xbd,
-0xf1,
-0xca,
-0xf1,
-0xe0,
-0xf1,
-0xf4,
-0xf1,
-0xfc,
-0xf1,
-0xa,
-0xf2,
-0x18,
-0xf2,
-0x30,
-0xf2,
-0x48,
-0xf2,
-0x5c,
-0xf2,
-0x6d,
-0xf2,
-0x82,
-0xf2,
-0x9b,
-0xf2,
-0xb6,
-0xf2,
-0xca,
-0xf2,
-0xdf,
-0xf2,
-0xf9,
-0xf2,
-0xc,
-0xf3,
-0x2d,
-0xf3,
-0x48,
-0xf3,
-0x5c,
-0xf3,
-0x70,
-0xf3,
-0x83,
-0xf3,
-0xa2,
-0xf3,
-0xb4,
-0xf3,
-0xcb,
-0xf3,
-0xe8,
-0xf3,
-0x2,
-0xf4,
-0x1e,
-0xf4,
-0x43,
-0xf4,
-0x60,
-0xf4,
-0x7c,
-0xf4,
-0x98,
-0xf4,
-0xaa,
-0xf4,
-0xc0,
-0xf4,
-0xe1,
-0xf4,
-0x0,
-0xf5,
-0x12,
-0xf5,
-0x2e,
-0xf5,
-0x3a,
-0xf5,
-0x5f,
-0xf5,
-0x70,
-0xf5,
-0x93,
-0xf5,
-0xac,
-0xf5,
-0xcb,
-0xf5,
-0xf1,
-0xf5,
-0xf,
-0xf6,
-0x30,
-0xf6,
-0x49,
-0xf6,
-0x62,
-0xf6,
-0x88,
-0xf6,
-0xa5,
-0xf6,
-0xc9,
-0xf6,
-0xdf,
-0xf6,
-0xf2,
-0xf6,
-0x13,
-0xf7,
-0x25,
-0xf7,
-0x40,
-0xf7,
-0x51,
-0xf7,
-0x68,
-0xf7,
-0x7e,
-0xf7,
-0x9e,
-0xf7,
-0xb5,
-0xf7,
-0xd3,
-0xf7,
-0xed,
-0xf7,
-0x6,
-0xf8,
-0x22,
-0xf8,
-0x43,
-0xf8,
-0x5d,
-0xf8,
-0x80,
-0xf8,
-0x99,
-0xf8,
-0xb4,
-0xf8,
-0xcc,
-0xf8,
-0xe4,
-0xf8,
-0x2,
-0xf9,
-0x16,
-0xf9,
-0x36,
-0xf9,
-0x43,
-0xf9,
-0x66,
-0xf9,
-0x79,
-0xf9,
-0xa1,
-0xf9,
-0xb3,
-0xf9,
-0xcc,
-0xf9,
-0xdf,
-0xf9,
-0xee,
-0xf9,
-0x2,
-0xfa,
-0x11,
-0xfa,
-0x2b,
-0xfa,
-0x3c,
-0xfa,
-0x50,
-0xfa,
-0x5f,
-0xfa,
-0x70,
-0xfa,
-0x86,
-0xfa,
-0x94,
-0xfa,
-0x99,
-0xfa,
-0xaa,
-0xfa,
-0xb4,
-0xfa,
-0xc4,
-0xfa,
-0xd0,
-0xfa,
-0xd6,
-0xfa,
-0xde,
-0xfa,
-0xdf,
-0xfa,
-0xee,
-0xfa,
-0xf8,
-0xfa,
-0x2,
-0xfb,
-0xc,
-0xfb,
-0xe,
-0xfb,
-0xc,
-0xfb,
-0x10,
-0xfb,
-0x1b,
-0xfb,
-0x22,
-0xfb,
-0x2d,
-0xfb,
-0x2f,
-0xfb,
-0x2d,
-0xfb,
-0x2e,
-0xfb,
-0x2e,
-0xfb,
-0x3c,
-0xfb,
-0x37,
-0xfb,
-0x2e,
-0xfb,
-0x29,
-0xfb,
-0x2d,
-0xfb,
-0x2d,
-0xfb,
-0x31,
-0xfb,
-0x34,
-0xfb,
-0x2f,
-0xfb,
-0x22,
-0xfb,
-0x1f,
-0xfb,
-0x11,
-0xfb,
-0x8,
-0xfb,
-0xfe,
-0xfa,
-0xec,
-0xfa,
-0xe0,
-0xfa,
-0xcc,
-0xfa,
-0xcb,
-0xfa,
-0xb6,
-0xfa,
-0xaf,
-0xfa,
-0x95,
-0xfa,
-0x86,
-0xfa,
-0x74,
-0xfa,
-0x68,
-0xfa,
-0x57,
-0xfa,
-0x44,
-0xfa,
-0x29,
-0xfa,
-0x12,
-0xfa,
-0x7,
-0xfa,
-0xf9,
-0xf9,
-0xe8,
-0xf9,
-0xcd,
-0xf9,
-0xb2,
-0xf9,
-0xa5,
-0xf9,
-0x93,
-0xf9,
-0x85,
-0xf9,
-0x73,
-0xf9,
-0x6a,
-0xf9,
-0x5f,
-0xf9,
-0x4a,
-0xf9,
-0x30,
-0xf9,
-0x20,
-0xf9,
-0xe,
-0xf9,
-0x4,
-0xf9,
-0xeb,
-0xf8,
-0xe0,
-0xf8,
-0xd0,
-0xf8,
-0xbc,
-0xf8,
-0xa3,
-0xf8,
-0x90,
-0xf8,
-0x81,
-0xf8,
-0x70,
-0xf8,
-0x5d,
-0xf8,
-0x48,
-0xf8,
-0x31,
-0xf8,
-0x1b,
-0xf8,
-0x3,
-0xf8,
-0xe6,
-0xf7,
-0xd3,
-0xf7,
-0xba,
-0xf7,
-0x9d,
-0xf7,
-0x86,
-0xf7,
-0x67,
-0xf7,
-0x4a,
-0xf7,
-0x36,
-0xf7,
-0x18,
-0xf7,
-0x1,
-0xf7,
-0xe9,
-0xf6,
-0xda,
-0xf6,
-0xc3,
-0xf6,
-0xaa,
-0xf6,
-0x90,
-0xf6,
-0x79,
-0xf6,
-0x61,
-0xf6,
-0x50,
-0xf6,
-0x3f,
-0xf6,
-0x25,
-0xf6,
-0x8,
-0xf6,
-0xf7,
-0xf5,
-0xe5,
-0xf5,
-0xd7,
-0xf5,
-0xbe,
-0xf5,
-0xad,
-0xf5,
-0x97,
-0xf5,
-0x83,
-0xf5,
-0x73,
-0xf5,
-0x68,
-0xf5,
-0x58,
-0xf5,
-0x4c,
-0xf5,
-0x42,
-0xf5,
-0x35,
-0xf5,
-0x2b,
-0xf5,
-0x1f,
-0xf5,
-0x13,
-0xf5,
-0xa,
-0xf5,
-0x0,
-0xf5,
-0xf7,
-0xf4,
-0xea,
-0xf4,
-0xe4,
-0xf4,
-0xde,
-0xf4,
-0xd5,
-0xf4,
-0xcf,
-0xf4,
-0xbf,
-0xf4,
-0xbe,
-0xf4,
-0xb3,
-0xf4,
-0xb3,
-0xf4,
-0xad,
-0xf4,
-0xb0,
-0xf4,
-0xb1,
-0xf4,
-0xb7,
-0xf4,
-0xb9,
-0xf4,
-0xbc,
-0xf4,
-0xc7,
-0xf4,
-0xd1,
-0xf4,
-0xdc,
-0xf4,
-0xea,
-0xf4,
-0xeb,
-0xf4,
-0xf3,
-0xf4,
-0xfe,
-0xf4,
-0x3,
-0xf5,
-0x1b,
-0xf5,
-0x20,
-0xf5,
-0x33,
-0xf5,
-0x44,
-0xf5,
-0x52,
-0xf5,
-0x61,
-0xf5,
-0x70,
-0xf5,
-0x7a,
-0xf5,
-0x8e,
-0xf5,
-0x9e,
-0xf5,
-0xb3,
-0xf5,
-0xbc,
-0xf5,
-0xcf,
-0xf5,
-0xdf,
-0xf5,
-0xf9,
-0xf5,
-0xd,
-0xf6,
-0x22,
-0xf6,
-0x33,
-0xf6,
-0x4a,
-0xf6,
-0x5d,
-0xf6,
-0x72,
-0xf6,
-0x8f,
-0xf6,
-0xa2,
-0xf6,
-0xc3,
-0xf6,
-0xd7,
-0xf6,
-0xfd,
-0xf6,
-0xe,
-0xf7,
-0x2c,
-0xf7,
-0x43,
-0xf7,
-0x60,
-0xf7,
-0x89,
-0xf7,
-0xaa,
-0xf7,
-0xd7,
-0xf7,
-0xf5,
-0xf7,
-0x18,
-0xf8,
-0x34,
-0xf8,
-0x5f,
-0xf8,
-0x80,
-0xf8,
-0xae,
-0xf8,
-0xda,
-0xf8,
-0x8,
-0xf9,
-0x37,
-0xf9,
-0x64,
-0xf9,
-0x8d,
-0xf9,
-0xc2,
-0xf9,
-0xef,
-0xf9,
-0x25,
-0xfa,
-0x48,
-0xfa,
-0x77,
-0xfa,
-0xa7,
-0xfa,
-0xd8,
-0xfa,
-0xfe,
-0xfa,
-0x2e,
-0xfb,
-0x58,
-0xfb,
-0x88,
-0xfb,
-0xb2,
-0xfb,
-0xe4,
-0xfb,
-0x1a,
-0xfc,
-0x40,
-0xfc,
-0x7c,
-0xfc,
-0xa5,
-0xfc,
-0xd1,
-0xfc,
-0x3,
-0xfd,
-0x35,
-0xfd,
-0x6a,
-0xfd,
-0x96,
-0xfd,
-0xc5,
-0xfd,
-0xf2,
-0xfd,
-0x2a,
-0xfe,
-0x60,
-0xfe,
-0x91,
-0xfe,
-0xbf,
-0xfe,
-0xed,
-0xfe,
-0x1e,
-0xff,
-0x4f,
-0xff,
-0x7e,
-0xff,
-0xb3,
-0xff,
-0xea,
-0xff,
-0x2a,
-0x0,
-0x5a,
-0x0,
-0x89,
-0x0,
-0xb8,
-0x0,
-0xf0,
-0x0,
-0x2d,
-0x1,
-0x65,
-0x1,
-0x99,
-0x1,
-0xc7,
-0x1,
-0xfc,
-0x1,
-0x34,
-0x2,
-0x6a,
-0x2,
-0x9b,
-0x2,
-0xd0,
-0x2,
-0x4,
-0x3,
-0x37,
-0x3,
-0x67,
-0x3,
-0x9b,
-0x3,
-0xcc,
-0x3,
-0xfe,
-0x3,
-0x29,
-0x4,
-0x59,
-0x4,
-0x8c,
-0x4,
-0xbc,
-0x4,
-0xf4,
-0x4,
-0x1d,
-0x5,
-0x4d,
-0x5,
-0x7a,
-0x5,
-0xaa,
-0x5,
-0xd9,
-0x5,
-0xfe,
-0x5,
-0x26,
-0x6,
-0x58,
-0x6,
-0x8d,
-0x6,
-0xb4,
-0x6,
-0xd8,
-0x6,
-0xfe,
-0x6,
-0x29,
-0x7,
-0x5b,
-0x7,
-0x86,
-0x7,
-0xac,
-0x7,
-0xd3,
-0x7,
-0xf7,
-0x7,
-0x24,
-0x8,
-0x49,
-0x8,
-0x77,
-0x8,
-0x9a,
-0x8,
-0xc3,
-0x8,
-0xe1,
-0x8,
-0xf,
-0x9,
-0x2e,
-0x9,
-0x57,
-0x9,
-0x7a,
-0x9,
-0x9e,
-0x9,
-0xc1,
-0x9,
-0xe0,
-0x9,
-0xc,
-0xa,
-0x29,
-0xa,
-0x50,
-0xa,
-0x67,
-0xa,
-0x85,
-0xa,
-0xa6,
-0xa,
-0xce,
-0xa,
-0xeb,
-0xa,
-0xd,
-0xb,
-0x28,
-0xb,
-0x43,
-0xb,
-0x65,
-0xb,
-0x88,
-0xb,
-0xa8,
-0xb,
-0xc3,
-0xb,
-0xe0,
-0xb,
-0xfe,
-0xb,
-0x1c,
-0xc,
-0x3e,
-0xc,
-0x55,
-0xc,
-0x77,
-0xc,
-0x87,
-0xc,
-0xa6,
-0xc,
-0xc2,
-0xc,
-0xe4,
-0xc,
-0xf6,
-0xc,
-0xe,
-0xd,
-0x24,
-0xd,
-0x44,
-0xd,
-0x54,
-0xd,
-0x71,
-0xd,
-0x86,
-0xd,
-0xa7,
-0xd,
-0xb0,
-0xd,
-0xc9,
-0xd,
-0xd3,
-0xd,
-0xeb,
-0xd,
-0xf8,
-0xd,
-0xa,
-0xe,
-0x11,
-0xe,
-0x22,
-0xe,
-0x2f,
-0xe,
-0x40,
-0xe,
-0x53,
-0xe,
-0x5f,
-0xe,
-0x72,
-0xe,
-0x7e,
-0xe,
-0x88,
-0xe,
-0x93,
-0xe,
-0x9b,
-0xe,
-0xa2,
-0xe,
-0xa8,
-0xe,
-0xb3,
-0xe,
-0xb7,
-0xe,
-0xbd,
-0xe,
-0xc5,
-0xe,
-0xc4,
-0xe,
-0xc9,
-0xe,
-0xc5,
-0xe,
-0xc8,
-0xe,
-0xca,
-0xe,
-0xc9,
-0xe,
-0xd3,
-0xe,
-0xd2,
-0xe,
-0xd6,
-0xe,
-0xd1,
-0xe,
-0xce,
-0xe,
-0xd4,
-0xe,
-0xcf,
-0xe,
-0xc9,
-0xe,
-0xc9,
-0xe,
-0xc1,
-0xe,
-0xc1,
-0xe,
-0xc0,
-0xe,
-0xb7,
-0xe,
-0xb6,
-0xe,
-0xab,
-0xe,
-0xa8,
-0xe,
-0x9a,
-0xe,
-0x92,
-0xe,
-0x87,
-0xe,
-0x79,
-0xe,
-0x70,
-0xe,
-0x67,
-0xe,
-0x63,
-0xe,
-0x59,
-0xe,
-0x49,
-0xe,
-0x37,
-0xe,
-0x31,
-0xe,
-0x24,
-0xe,
-0x20,
-0xe,
-0xa,
-0xe,
-0xf8,
-0xd,
-0xf3,
-0xd,
-0xd9,
-0xd,
-0xd2,
-0xd,
-0xbc,
-0xd,
-0xae,
-0xd,
-0x9c,
-0xd,
-0x8b,
-0xd,
-0x7b,
-0xd,
-0x6d,
-0xd,
-0x54,
-0xd,
-0x43,
-0xd,
-0x31,
-0xd,
-0x26,
-0xd,
-0x14,
-0xd,
-0xfd,
-0xc,
-0xef,
-0xc,
-0xda,
-0xc,
-0xca,
-0xc,
-0xb9,
-0xc,
-0xa5,
-0xc,
-0x97,
-0xc,
-0x85,
-0xc,
-0x74,
-0xc,
-0x63,
-0xc,
-0x54,
-0xc,
-0x51,
-0xc,
-0x3b,
-0xc,
-0x26,
-0xc,
-0x13,
-0xc,
-0xfb,
-0xb,
-0xf6,
-0xb,
-0xdd,
-0xb,
-0xd0,
-0xb,
-0xb4,
-0xb,
-0xa4,
-0xb,
-0x96,
-0xb,
-0x84,
-0xb,
-0x78,
-0xb,
-0x68,
-0xb,
-0x5d,
-0xb,
-0x45,
-0xb,
-0x36,
-0xb,
-0x1a,
-0xb,
-0x7,
-0xb,
-0xf0,
-0xa,
-0xe1,
-0xa,
-0xc9,
-0xa,
-0xb2,
-0xa,
-0x9a,
-0xa,
-0x89,
-0xa,
-0x73,
-0xa,
-0x61,
-0xa,
-0x4f,
-0xa,
-0x3f,
-0xa,
-0x29,
-0xa,
-0x20,
-0xa,
-0xb,
-0xa,
-0x4,
-0xa,
-0xf2,
-0x9,
-0xea,
-0x9,
-0xd6,
-0x9,
-0xd4,
-0x9,
-0xc9,
-0x9,
-0xcc,
-0x9,
-0xc3,
-0x9,
-0xb9,
-0x9,
-0xad,
-0x9,
-0xad,
-0x9,
-0xae,
-0x9,
-0xa5,
-0x9,
-0x9f,
-0x9,
-0x9b,
-0x9,
-0x9e,
-0x9,
-0x91,
-0x9,
-0x8a,
-0x9,
-0x8b,
-0x9,
-0x80,
-0x9,
-0x7d,
-0x9,
-0x72,
-0x9,
-0x76,
-0x9,
-0x6a,
-0x9,
-0x68,
-0x9,
-0x59,
-0x9,
-0x5f,
-0x9,
-0x5b,
-0x9,
-0x5e,
-0x9,
-0x58,
-0x9,
-0x53,
-0x9,
-0x53,
-0x9,
-0x54,
-0x9,
-0x5a,
-0x9,
-0x57,
-0x9,
-0x58,
-0x9,
-0x54,
-0x9,
-0x5a,
-0x9,
-0x5b,
-0x9,
-0x63,
-0x9,
-0x65,
-0x9,
-0x6e,
-0x9,
-0x6f,
-0x9,
-0x78,
-0x9,
-0x7a,
-0x9,
-0x84,
-0x9,
-0x8c,
-0x9,
-0x91,
-0x9,
-0x94,
-0x9,
-0xa5,
-0x9,
-0xa9,
-0x9,
-0xbd,
-0x9,
-0xcc,
-0x9,
-0xdc,
-0x9,
-0xe5,
-0x9,
-0xf1,
-0x9,
-0x0,
-0xa,
-0xb,
-0xa,
-0x19,
-0xa,
-0x28,
-0xa,
-0x30,
-0xa,
-0x3f,
-0xa,
-0x45,
-0xa,
-0x57,
-0xa,
-0x63,
-0xa,
-0x76,
-0xa,
-0x86,
-0xa,
-0x90,
-0xa,
-0xa3,
-0xa,
-0xa8,
-0xa,
-0xbe,
-0xa,
-0xc2,
-0xa,
-0xd8,
-0xa,
-0xdf,
-0xa,
-0xef,
-0xa,
-0xfd,
-0xa,
-0xd,
-0xb,
-0x14,
-0xb,
-0x23,
-0xb,
-0x2f,
-0xb,
-0x43,
-0xb,
-0x55,
-0xb,
-0x5e,
-0xb,
-0x6c,
-0xb,
-0x76,
-0xb,
-0x84,
-0xb,
-0x8d,
-0xb,
-0x99,
-0xb,
-0xa6,
-0xb,
-0xb0,
-0xb,
-0xbd,
-0xb,
-0xc5,
-0xb,
-0xd1,
-0xb,
-0xdf,
-0xb,
-0xec,
-0xb,
-0xf5,
-0xb,
-0x1,
-0xc,
-0x5,
-0xc,
-0x15,
-0xc,
-0x1f,
-0xc,
-0x29,
-0xc,
-0x37,
-0xc,
-0x45,
-0xc,
-0x53,
-0xc,
-0x62,
-0xc,
-0x6e,
-0xc,
-0x78,
-0xc,
-0x86,
-0xc,
-0x93,
-0xc,
-0x9a,
-0xc,
-0xb2,
-0xc,
-0xb1,
-0xc,
-0xc5,
-0xc,
-0xc3,
-0xc,
-0xd4,
-0xc,
-0xcc,
-0xc,
-0xda,
-0xc,
-0xda,
-0xc,
-0xe3,
-0xc,
-0xeb,
-0xc,
-0xed,
-0xc,
-0xf4,
-0xc,
-0xee,
-0xc,
-0xef,
-0xc,
-0xf2,
-0xc,
-0xf6,
-0xc,
-0xf4,
-0xc,
-0xf3,
-0xc,
-0xf7,
-0xc,
-0xf9,
-0xc,
-0xf7,
-0xc,
-0xfa,
-0xc,
-0xf1,
-0xc,
-0xee,
-0xc,
-0xf2,
-0xc,
-0xf2,
-0xc,
-0xe7,
-0xc,
-0xe8,
-0xc,
-0xd9,
-0xc,
-0xde,
-0xc,
-0xd2,
-0xc,
-0xdb,
-0xc,
-0xcb,
-0xc,
-0xd0,
-0xc,
-0xc3,
-0xc,
-0xb8,
-0xc,
-0xb7,
-0xc,
-0xaf,
-0xc,
-0xa3,
-0xc,
-0x9b,
-0xc,
-0x8e,
-0xc,
-0x81,
-0xc,
-0x77,
-0xc,
-0x67,
-0xc,
-0x5f,
-0xc,
-0x4a,
-0xc,
-0x3b,
-0xc,
-0x23,
-0xc,
-0x12,
-0xc,
-0xfe,
-0xb,
-0xed,
-0xb,
-0xd9,
-0xb,
-0xbe,
-0xb,
-0xac,
-0xb,
-0x92,
-0xb,
-0x81,
-0xb,
-0x67,
-0xb,
-0x51,
-0xb,
-0x3c,
-0xb,
-0x1c,
-0xb,
-0x2,
-0xb,
-0xec,
-0xa,
-0xd2,
-0xa,
-0xb9,
-0xa,
-0x9a,
-0xa,
-0x77,
-0xa,
-0x55,
-0xa,
-0x36,
-0xa,
-0x1d,
-0xa,
-0x4,
-0xa,
-0xe0,
-0x9,
-0xc3,
-0x9,
-0x9b,
-0x9,
-0x84,
-0x9,
-0x6c,
-0x9,
-0x45,
-0x9,
-0x23,
-0x9,
-0xff,
-0x8,
-0xdf,
-0x8,
-0xbc,
-0x8,
-0x94,
-0x8,
-0x77,
-0x8,
-0x4c,
-0x8,
-0x2c,
-0x8,
-0x0,
-0x8,
-0xdb,
-0x7,
-0xb1,
-0x7,
-0x8f,
-0x7,
-0x66,
-0x7,
-0x3a,
-0x7,
-0x11,
-0x7,
-0xdd,
-0x6,
-0xba,
-0x6,
-0x8b,
-0x6,
-0x60,
-0x6,
-0x32,
-0x6,
-0xff,
-0x5,
-0xd3,
-0x5,
-0xa9,
-0x5,
-0x77,
-0x5,
-0x53,
-0x5,
-0x21,
-0x5,
-0xf8,
-0x4,
-0xc5,
-0x4,
-0x98,
-0x4,
-0x6a,
-0x4,
-0x3b,
-0x4,
-0xa,
-0x4,
-0xd5,
-0x3,
-0xa9,
-0x3,
-0x70,
-0x3,
-0x3e,
-0x3,
-0xa,
-0x3,
-0xdc,
-0x2,
-0xaa,
-0x2,
-0x7a,
-0x2,
-0x4b,
-0x2,
-0x19,
-0x2,
-0xeb,
-0x1,
-0xbc,
-0x1,
-0x85,
-0x1,
-0x56,
-0x1,
-0x28,
-0x1,
-0xf8,
-0x0,
-0xcd,
-0x0,
-0x9b,
-0x0,
-0x6a,
-0x0,
-0x3f,
-0x0,
-0xb,
-0x0,
-0xe1,
-0xff,
-0xa6,
-0xff,
-0x7f,
-0xff,
-0x4d,
-0xff,
-0x21,
-0xff,
-0xf4,
-0xfe,
-0xc5,
-0xfe,
-0x99,
-0xfe,
-0x70,
-0xfe,
-0x43,
-0xfe,
-0x1a,
-0xfe,
-0xef,
-0xfd,
-0xbc,
-0xfd,
-0x91,
-0xfd,
-0x61,
-0xfd,
-0x38,
-0xfd,
-0xa,
-0xfd,
-0xe3,
-0xfc,
-0xb8,
-0xfc,
-0x95,
-0xfc,
-0x6d,
-0xfc,
-0x47,
-0xfc,
-0x1c,
-0xfc,
-0xf4,
-0xfb,
-0xc9,
-0xfb,
-0xa1,
-0xfb,
-0x76,
-0xfb,
-0x57,
-0xfb,
-0x29,
-0xfb,
-0x3,
-0xfb,
-0xd2,
-0xfa,
-0xb0,
-0xfa,
-0x88,
-0xfa,
-0x65,
-0xfa,
-0x39,
-0xfa,
-0x19,
-0xfa,
-0xf2,
-0xf9,
-0xd3,
-0xf9,
-0xab,
-0xf9,
-0x88,
-0xf9,
-0x68,
-0xf9,
-0x45,
-0xf9,
-0x20,
-0xf9,
-0xfe,
-0xf8,
-0xd5,
-0xf8,
-0xb7,
-0xf8,
-0x9f,
-0xf8,
-0x7a,
-0xf8,
-0x5b,
-0xf8,
-0x33,
-0xf8,
-0x17,
-0xf8,
-0xf8,
-0xf7,
-0xe0,
-0xf7,
-0xc5,
-0xf7,
-0xa1,
-0xf7,
-0x87,
-0xf7,
-0x6b,
-0xf7,
-0x53,
-0xf7,
-0x36,
-0xf7,
-0x19,
-0xf7,
-0xfd,
-0xf6,
-0xef,
-0xf6,
-0xd3,
-0xf6,
-0xc5,
-0xf6,
-0xad,
-0xf6,
-0x9d,
-0xf6,
-0x85,
-0xf6,
-0x71,
-0xf6,
-0x61,
-0xf6,
-0x4f,
-0xf6,
-0x44,
-0xf6,
-0x2d,
-0xf6,
-0x15,
-0xf6,
-0x2,
-0xf6,
-0xf0,
-0xf5,
-0xe6,
-0xf5,
-0xd6,
-0xf5,
-0xcc,
-0xf5,
-0xb7,
-0xf5,
-0xb4,
-0xf5,
-0x9f,
-0xf5,
-0x99,
-0xf5,
-0x8b,
-0xf5,
-0x7d,
-0xf5,
-0x74,
-0xf5,
-0x70,
-0xf5,
-0x64,
-0xf5,
-0x56,
-0xf5,
-0x50,
-0xf5,
-0x41,
-0xf5,
-0x36,
-0xf5,
-0x32,
-0xf5,
-0x27,
-0xf5,
-0x27,
-0xf5,
-0x1e,
-0xf5,
-0x1c,
-0xf5,
-0x16,
-0xf5,
-0x10,
-0xf5,
-0xd,
-0xf5,
-0x5,
-0xf5,
-0x3,
-0xf5,
-0xfe,
-0xf4,
-0xf8,
-0xf4,
-0xf8,
-0xf4,
-0xf6,
-0xf4,
-0xf9,
-0xf4,
-0xfa,
-0xf4,
-0x0,
-0xf5,
-0xfd,
-0xf4,
-0xfd,
-0xf4,
-0x0,
-0xf5,
-0xff,
-0xf4,
-0xff,
-0xf4,
-0x4,
-0xf5,
-0x7,
-0xf5,
-0xff,
-0xf4,
-0x5,
-0xf5,
-0x6,
-0xf5,
-0x7,
-0xf5,
-0xb,
-0xf5,
-0xb,
-0xf5,
-0x15,
-0xf5,
-0x18,
-0xf5,
-0x21,
-0xf5,
-0x25,
-0xf5,
-0x34,
-0xf5,
-0x35,
-0xf5,
-0x3c,
-0xf5,
-0x40,
-0xf5,
-0x46,
-0xf5,
-0x48,
-0xf5,
-0x53,
-0xf5,
-0x55,
-0xf5,
-0x5c,
-0xf5,
-0x63,
-0xf5,
-0x66,
-0xf5,
-0x6e,
-0xf5,
-0x6b,
-0xf5,
-0x7b,
-0xf5,
-0x7d,
-0xf5,
-0x8c,
-0xf5,
-0x8d,
-0xf5,
-0x96,
-0xf5,
-0x9b,
-0xf5,
-0xa4,
-0xf5,
-0xb2,
-0xf5,
-0xb4,
-0xf5,
-0xbf,
-0xf5,
-0xc0,
-0xf5,
-0xcd,
-0xf5,
-0xda,
-0xf5,
-0xe5,
-0xf5,
-0xf4,
-0xf5,
-0xfd,
-0xf5,
-0x6,
-0xf6,
-0x16,
-0xf6,
-0x1d,
-0xf6,
-0x29,
-0xf6,
-0x33,
-0xf6,
-0x3d,
-0xf6,
-0x45,
-0xf6,
-0x4e,
-0xf6,
-0x59,
-0xf6,
-0x5e,
-0xf6,
-0x6f,
-0xf6,
-0x7a,
-0xf6,
-0x8b,
-0xf6,
-0x8d,
-0xf6,
-0x9c,
-0xf6,
-0xab,
-0xf6,
-0xbb,
-0xf6,
-0xc3,
-0xf6,
-0xd6,
-0xf6,
-0xda,
-0xf6,
-0xeb,
-0xf6,
-0xed,
-0xf6,
-0x4,
-0xf7,
-0xa,
-0xf7,
-0x18,
-0xf7,
-0x27,
-0xf7,
-0x34,
-0xf7,
-0x3e,
-0xf7,
-0x46,
-0xf7,
-0x4f,
-0xf7,
-0x64,
-0xf7,
-0x6e,
-0xf7,
-0x7b,
-0xf7,
-0x7f,
-0xf7,
-0x8b,
-0xf7,
-0x99,
-0xf7,
-0xaa,
-0xf7,
-0xbc,
-0xf7,
-0xc4,
-0xf7,
-0xd1,
-0xf7,
-0xe5,
-0xf7,
-0xf4,
-0xf7,
-0xe,
-0xf8,
-0x17,
-0xf8,
-0x28,
-0xf8,
-0x39,
-0xf8,
-0x4a,
-0xf8,
-0x5b,
-0xf8,
-0x69,
-0xf8,
-0x7c,
-0xf8,
-0x8c,
-0xf8,
-0x98,
-0xf8,
-0xa6,
-0xf8,
-0xb8,
-0xf8,
-0xcc,
-0xf8,
-0xe2,
-0xf8,
-0xed,
-0xf8,
-0xf4,
-0xf8,
-0x3,
-0xf9,
-0x19,
-0xf9,
-0x26,
-0xf9,
-0x33,
-0xf9,
-0x3f,
-0xf9,
-0x4a,
-0xf9,
-0x56,
-0xf9,
-0x64,
-0xf9,
-0x79,
-0xf9,
-0x80,
-0xf9,
-0x88,
-0xf9,
-0x99,
-0xf9,
-0xa4,
-0xf9,
-0xb0,
-0xf9,
-0xb6,
-0xf9,
-0xc1,
-0xf9,
-0xc2,
-0xf9,
-0xd3,
-0xf9,
-0xdd,
-0xf9,
-0xea,
-0xf9,
-0xf0,
-0xf9,
-0xfe,
-0xf9,
-0x2,
-0xfa,
-0x18,
-0xfa,
-0x1b,
-0xfa,
-0x2e,
-0xfa,
-0x33,
-0xfa,
-0x3f,
-0xfa,
-0x4e,
-0xfa,
-0x56,
-0xfa,
-0x60,
-0xfa,
-0x6a,
-0xfa,
-0x6f,
-0xfa,
-0x77,
-0xfa,
-0x7f,
-0xfa,
-0x8d,
-0xfa,
-0x90,
-0xfa,
-0x9d,
-0xfa,
-0xa5,
-0xfa,
-0xad,
-0xfa,
-0xae,
-0xfa,
-0xb9,
-0xfa,
-0xbc,
-0xfa,
-0xc1,
-0xfa,
-0xc6,
-0xfa,
-0xc7,
-0xfa,
-0xce,
-0xfa,
-0xd3,
-0xfa,
-0xd6,
-0xfa,
-0xdb,
-0xfa,
-0xd6,
-0xfa,
-0xdc,
-0xfa,
-0xd6,
-0xfa,
-0xd7,
-0xfa,
-0xd0,
-0xfa,
-0xd5,
-0xfa,
-0xca,
-0xfa,
-0xcd,
-0xfa,
-0xbd,
-0xfa,
-0xc8,
-0xfa,
-0xbb,
-0xfa,
-0xb9,
-0xfa,
-0xb7,
-0xfa,
-0xad,
-0xfa,
-0xad,
-0xfa,
-0xb1,
-0xfa,
-0xab,
-0xfa,
-0xad,
-0xfa,
-0xa6,
-0xfa,
-0xa3,
-0xfa,
-0xa6,
-0xfa,
-0xa8,
-0xfa,
-0xa3,
-0xfa,
-0xa3,
-0xfa,
-0x9c,
-0xfa,
-0x97,
-0xfa,
-0x96,
-0xfa,
-0x98,
-0xfa,
-0x96,
-0xfa,
-0x8d,
-0xfa,
-0x8b,
-0xfa,
-0x80,
-0xfa,
-0x78,
-0xfa,
-0x79,
-0xfa,
-0x6c,
-0xfa,
-0x6c,
-0xfa,
-0x50,
-0xfa,
-0x4e,
-0xfa,
-0x3f,
-0xfa,
-0x3a,
-0xfa,
-0x2e,
-0xfa,
-0x21,
-0xfa,
-0x17,
-0xfa,
-0xc,
-0xfa,
-0xff,
-0xf9,
-0xee,
-0xf9,
-0xe8,
-0xf9,
-0xe1,
-0xf9,
-0xd3,
-0xf9,
-0xcb,
-0xf9,
-0xc1,
-0xf9,
-0xb6,
-0xf9,
-0xab,
-0xf9,
-0xa3,
-0xf9,
-0x92,
-0xf9,
-0x85,
-0xf9,
-0x78,
-0xf9,
-0x74,
-0xf9,
-0x6e,
-0xf9,
-0x61,
-0xf9,
-0x5a,
-0xf9,
-0x48,
-0xf9,
-0x3f,
-0xf9,
-0x34,
-0xf9,
-0x29,
-0xf9,
-0x24,
-0xf9,
-0x1a,
-0xf9,
-0x16,
-0xf9,
-0x3,
-0xf9,
-0xfb,
-0xf8,
-0xee,
-0xf8,
-0xe7,
-0xf8,
-0xe0,
-0xf8,
-0xde,
-0xf8,
-0xdb,
-0xf8,
-0xce,
-0xf8,
-0xc9,
-0xf8,
-0xc0,
-0xf8,
-0xbf,
-0xf8,
-0xb5,
-0xf8,
-0xa8,
-0xf8,
-0x9c,
-0xf8,
-0x97,
-0xf8,
-0x94,
-0xf8,
-0x89,
-0xf8,
-0x8b,
-0xf8,
-0x7c,
-0xf8,
-0x76,
-0xf8,
-0x6f,
-0xf8,
-0x67,
-0xf8,
-0x67,
-0xf8,
-0x5f,
-0xf8,
-0x59,
-0xf8,
-0x50,
-0xf8,
-0x50,
-0xf8,
-0x42,
-0xf8,
-0x41,
-0xf8,
-0x38,
-0xf8,
-0x31,
-0xf8,
-0x29,
-0xf8,
-0x1d,
-0xf8,
-0x1a,
-0xf8,
-0x18,
-0xf8,
-0x13,
-0xf8,
-0x10,
-0xf8,
-0x9,
-0xf8,
-0x9,
-0xf8,
-0x4,
-0xf8,
-0xb,
-0xf8,
-0x3,
-0xf8,
-0x3,
-0xf8,
-0x0,
-0xf8,
-0xfe,
-0xf7,
-0xfe,
-0xf7,
-0xfd,
-0xf7,
-0x5,
-0xf8,
-0x2,
-0xf8,
-0x9,
-0xf8,
-0x2,
-0xf8,
-0x7,
-0xf8,
-0x3,
-0xf8,
-0xc,
-0xf8,
-0x7,
-0xf8,
-0xa,
-0xf8,
-0x8,
-0xf8,
-0xb,
-0xf8,
-0xb,
-0xf8,
-0x10,
-0xf8,
-0x19,
-0xf8,
-0x1b,
-0xf8,
-0x26,
-0xf8,
-0x25,
-0xf8,
-0x2d,
-0xf8,
-0x2e,
-0xf8,
-0x38,
-0xf8,
-0x3f,
-0xf8,
-0x4a,
-0xf8,
-0x4a,
-0xf8,
-0x52,
-0xf8,
-0x52,
-0xf8,
-0x5c,
-0xf8,
-0x62,
-0xf8,
-0x68,
-0xf8,
-0x72,
-0xf8,
-0x72,
-0xf8,
-0x82,
-0xf8,
-0x86,
-0xf8,
-0x99,
-0xf8,
-0x9c,
-0xf8,
-0xa2,
-0xf8,
-0xac,
-0xf8,
-0xb5,
-0xf8,
-0xc4,
-0xf8,
-0xd1,
-0xf8,
-0xdf,
-0xf8,
-0xe6,
-0xf8,
-0xf5,
-0xf8,
-0x0,
-0xf9,
-0x19,
-0xf9,
-0x23,
-0xf9,
-0x3c,
-0xf9,
-0x44,
-0xf9,
-0x5a,
-0xf9,
-0x64,
-0xf9,
-0x78,
-0xf9,
-0x8e,
-0xf9,
-0xa1,
-0xf9,
-0xaf,
-0xf9,
-0xc5,
-0xf9,
-0xd8,
-0xf9,
-0xf0,
-0xf9,
-0x3,
-0xfa,
-0x18,
-0xfa,
-0x2a,
-0xfa,
-0x40,
-0xfa,
-0x5a,
-0xfa,
-0x6c,
-0xfa,
-0x7f,
-0xfa,
-0x96,
-0xfa,
-0xa9,
-0xfa,
-0xc4,
-0xfa,
-0xd9,
-0xfa,
-0xed,
-0xfa,
-0xff,
-0xfa,
-0x12,
-0xfb,
-0x26,
-0xfb,
-0x3d,
-0xfb,
-0x4e,
-0xfb,
-0x68,
-0xfb,
-0x7d,
-0xfb,
-0x90,
-0xfb,
-0xa1,
-0xfb,
-0xb6,
-0xfb,
-0xcc,
-0xfb,
-0xdf,
-0xfb,
-0xf6,
-0xfb,
-0xa,
-0xfc,
-0x1f,
-0xfc,
-0x31,
-0xfc,
-0x49,
-0xfc,
-0x60,
-0xfc,
-0x7b,
-0xfc,
-0x8e,
-0xfc,
-0xa1,
-0xfc,
-0xb8,
-0xfc,
-0xc9,
-0xfc,
-0xdd,
-0xfc,
-0xf6,
-0xfc,
-0xa,
-0xfd,
-0x20,
-0xfd,
-0x35,
-0xfd,
-0x50,
-0xfd,
-0x62,
-0xfd,
-0x78,
-0xfd,
-0x8a,
-0xfd,
-0x9e,
-0xfd,
-0xb4,
-0xfd,
-0xc2,
-0xfd,
-0xe0,
-0xfd,
-0xef,
-0xfd,
-0x6,
-0xfe,
-0x17,
-0xfe,
-0x27,
-0xfe,
-0x3d,
-0xfe,
-0x4e,
-0xfe,
-0x62,
-0xfe,
-0x72,
-0xfe,
-0x85,
-0xfe,
-0x98,
-0xfe,
-0xa5,
-0xfe,
-0xb7,
-0xfe,
-0xc3,
-0xfe,
-0xd7,
-0xfe,
-0xe1,
-0xfe,
-0xf0,
-0xfe,
-0x0,
-0xff,
-0x8,
-0xff,
-0x1b,
-0xff,
-0x23,
-0xff,
-0x36,
-0xff,
-0x40,
-0xff,
-0x4b,
-0xff,
-0x56,
-0xff,
-0x60,
-0xff,
-0x77,
-0xff,
-0x78,
-0xff,
-0x87,
-0xff,
-0x95,
-0xff,
-0x9d,
-0xff,
-0xa5,
-0xff,
-0xb9,
-0xff,
-0xbf,
-0xff,
-0xce,
-0xff,
-0xd6,
-0xff,
-0xe4,
-0xff,
-0xf2,
-0xff,
-0xfe,
-0xff,
-0xe,
-0x0,
-0x1d,
-0x0,
-0x2b,
-0x0,
-0x42,
-0x0,
-0x46,
-0x0,
-0x5e,
-0x0,
-0x6c,
-0x0,
-0x73,
-0x0,
-0x86,
-0x0,
-0x90,
-0x0,
-0x98,
-0x0,
-0xa4,
-0x0,
-0xb0,
-0x0,
-0xbf,
-0x0,
-0xc9,
-0x0,
-0xcd,
-0x0,
-0xdd,
-0x0,
-0xea,
-0x0,
-0xf4,
-0x0,
-0x1,
-0x1,
-0x9,
-0x1,
-0x15,
-0x1,
-0x22,
-0x1,
-0x26,
-0x1,
-0x34,
-0x1,
-0x3a,
-0x1,
-0x45,
-0x1,
-0x4b,
-0x1,
-0x55,
-0x1,
-0x5f,
-0x1,
-0x6d,
-0x1,
-0x7c,
-0x1,
-0x86,
-0x1,
-0x92,
-0x1,
-0xa0,
-0x1,
-0xb1,
-0x1,
-0xbf,
-0x1,
-0xc5,
-0x1,
-0xd1,
-0x1,
-0xdc,
-0x1,
-0xe7,
-0x1,
-0xf8,
-0x1,
-0x1,
-0x2,
-0xd,
-0x2,
-0x17,
-0x2,
-0x28,
-0x2,
-0x34,
-0x2,
-0x49,
-0x2,
-0x56,
-0x2,
-0x62,
-0x2,
-0x6c,
-0x2,
-0x7b,
-0x2,
-0x86,
-0x2,
-0x8f,
-0x2,
-0x9e,
-0x2,
-0xa9,
-0x2,
-0xba,
-0x2,
-0xc3,
-0x2,
-0xca,
-0x2,
-0xd9,
-0x2,
-0xe8,
-0x2,
-0xf8,
-0x2,
-0x1,
-0x3,
-0x11,
-0x3,
-0x1a,
-0x3,
-0x25,
-0x3,
-0x30,
-0x3,
-0x36,
-0x3,
-0x44,
-0x3,
-0x51,
-0x3,
-0x5d,
-0x3,
-0x6f,
-0x3,
-0x77,
-0x3,
-0x89,
-0x3,
-0x91,
-0x3,
-0xa1,
-0x3,
-0xb0,
-0x3,
-0xc4,
-0x3,
-0xd0,
-0x3,
-0xe1,
-0x3,
-0xe8,
-0x3,
-0xf8,
-0x3,
-0xb,
-0x4,
-0x1d,
-0x4,
-0x2e,
-0x4,
-0x41,
-0x4,
-0x4b,
-0x4,
-0x5b,
-0x4,
-0x69,
-0x4,
-0x7a,
-0x4,
-0x8a,
-0x4,
-0x98,
-0x4,
-0xa6,
-0x4,
-0xb7,
-0x4,
-0xc3,
-0x4,
-0xd9,
-0x4,
-0xe6,
-0x4,
-0xfa,
-0x4,
-0x10,
-0x5,
-0x22,
-0x5,
-0x31,
-0x5,
-0x43,
-0x5,
-0x52,
-0x5,
-0x62,
-0x5,
-0x7c,
-0x5,
-0x8a,
-0x5,
-0x99,
-0x5,
-0xa5,
-0x5,
-0xb5,
-0x5,
-0xc8,
-0x5,
-0xd4,
-0x5,
-0xee,
-0x5,
-0xf6,
-0x5,
-0xd,
-0x6,
-0x11,
-0x6,
-0x1a,
-0x6,
-0x2f,
-0x6,
-0x3b,
-0x6,
-0x4e,
-0x6,
-0x5b,
-0x6,
-0x67,
-0x6,
-0x75,
-0x6,
-0x86,
-0x6,
-0x90,
-0x6,
-0x9f,
-0x6,
-0xaa,
-0x6,
-0xba,
-0x6,
-0xc4,
-0x6,
-0xcd,
-0x6,
-0xdd,
-0x6,
-0xed,
-0x6,
-0xfb,
-0x6,
-0x13,
-0x7,
-0x18,
-0x7,
-0x30,
-0x7,
-0x36,
-0x7,
-0x4f,
-0x7,
-0x58,
-0x7,
-0x6d,
-0x7,
-0x7e,
-0x7,
-0x8f,
-0x7,
-0xa5,
-0x7,
-0xb1,
-0x7,
-0xc7,
-0x7,
-0xd9,
-0x7,
-0xec,
-0x7,
-0xfd,
-0x7,
-0xe,
-0x8,
-0x21,
-0x8,
-0x38,
-0x8,
-0x45,
-0x8,
-0x59,
-0x8,
-0x6b,
-0x8,
-0x75,
-0x8,
-0x85,
-0x8,
-0x94,
-0x8,
-0xa6,
-0x8,
-0xb1,
-0x8,
-0xc0,
-0x8,
-0xcb,
-0x8,
-0xcf,
-0x8,
-0xd4,
-0x8,
-0xd7,
-0x8,
-0xe2,
-0x8,
-0xe4,
-0x8,
-0xf0,
-0x8,
-0xf1,
-0x8,
-0xfa,
-0x8,
-0xfc,
-0x8,
-0xb,
-0x9,
-0x9,
-0x9,
-0xf,
-0x9,
-0xf,
-0x9,
-0x14,
-0x9,
-0x1a,
-0x9,
-0x16,
-0x9,
-0x21,
-0x9,
-0x1f,
-0x9,
-0x29,
-0x9,
-0x2c,
-0x9,
-0x2d,
-0x9,
-0x33,
-0x9,
-0x35,
-0x9,
-0x3b,
-0x9,
-0x41,
-0x9,
-0x44,
-0x9,
-0x44,
-0x9,
-0x4b,
-0x9,
-0x4a,
-0x9,
-0x52,
-0x9,
-0x53,
-0x9,
-0x57,
-0x9,
-0x53,
-0x9,
-0x5b,
-0x9,
-0x52,
-0x9,
-0x58,
-0x9,
-0x56,
-0x9,
-0x58,
-0x9,
-0x54,
-0x9,
-0x54,
-0x9,
-0x51,
-0x9,
-0x4b,
-0x9,
-0x4b,
-0x9,
-0x44,
-0x9,
-0x42,
-0x9,
-0x40,
-0x9,
-0x3e,
-0x9,
-0x3a,
-0x9,
-0x37,
-0x9,
-0x32,
-0x9,
-0x30,
-0x9,
-0x22,
-0x9,
-0x20,
-0x9,
-0x1b,
-0x9,
-0x17,
-0x9,
-0xf,
-0x9,
-0x7,
-0x9,
-0xfe,
-0x8,
-0xf0,
-0x8,
-0xe8,
-0x8,
-0xdf,
-0x8,
-0xd4,
-0x8,
-0xc6,
-0x8,
-0xb8,
-0x8,
-0xb0,
-0x8,
-0xa7,
-0x8,
-0x96,
-0x8,
-0x87,
-0x8,
-0x7b,
-0x8,
-0x6f,
-0x8,
-0x61,
-0x8,
-0x55,
-0x8,
-0x48,
-0x8,
-0x3f,
-0x8,
-0x2d,
-0x8,
-0x22,
-0x8,
-0x13,
-0x8,
-0xe,
-0x8,
-0xfe,
-0x7,
-0xf4,
-0x7,
-0xdf,
-0x7,
-0xd2,
-0x7,
-0xc6,
-0x7,
-0xbd,
-0x7,
-0xb2,
-0x7,
-0xa4,
-0x7,
-0x95,
-0x7,
-0x8c,
-0x7,
-0x7d,
-0x7,
-0x7a,
-0x7,
-0x64,
-0x7,
-0x5e,
-0x7,
-0x44,
-0x7,
-0x3b,
-0x7,
-0x28,
-0x7,
-0x21,
-0x7,
-0xd,
-0x7,
-0x4,
-0x7,
-0xf3,
-0x6,
-0xec,
-0x6,
-0xde,
-0x6,
-0xca,
-0x6,
-0xbb,
-0x6,
-0xa7,
-0x6,
-0xa2,
-0x6,
-0x8e,
-0x6,
-0x7d,
-0x6,
-0x70,
-0x6,
-0x58,
-0x6,
-0x50,
-0x6,
-0x39,
-0x6,
-0x34,
-0x6,
-0x1a,
-0x6,
-0x13,
-0x6,
-0xff,
-0x5,
-0xeb,
-0x5,
-0xe3,
-0x5,
-0xcd,
-0x5,
-0xc9,
-0x5,
-0xb1,
-0x5,
-0xa2,
-0x5,
-0x8f,
-0x5,
-0x83,
-0x5,
-0x71,
-0x5,
-0x65,
-0x5,
-0x59,
-0x5,
-0x4d,
-0x5,
-0x41,
-0x5,
-0x30,
-0x5,
-0x2a,
-0x5,
-0x16,
-0x5,
-0xa,
-0x5,
-0xfb,
-0x4,
-0xe9,
-0x4,
-0xe2,
-0x4,
-0xd1,
-0x4,
-0xca,
-0x4,
-0xba,
-0x4,
-0xb3,
-0x4,
-0x9e,
-0x4,
-0x98,
-0x4,
-0x89,
-0x4,
-0x7d,
-0x4,
-0x71,
-0x4,
-0x69,
-0x4,
-0x63,
-0x4,
-0x55,
-0x4,
-0x4d,
-0x4,
-0x3e,
-0x4,
-0x3c,
-0x4,
-0x2e,
-0x4,
-0x2b,
-0x4,
-0x1e,
-0x4,
-0x1b,
-0x4,
-0x13,
-0x4,
-0xe,
-0x4,
-0xa,
-0x4,
-0xff,
-0x3,
-0xf7,
-0x3,
-0xf0,
-0x3,
-0xe8,
-0x3,
-0xe1,
-0x3,
-0xe0,
-0x3,
-0xdb,
-0x3,
-0xd7,
-0x3,
-0xce,
-0x3,
-0xce,
-0x3,
-0xc8,
-0x3,
-0xbd,
-0x3,
-0xc2,
-0x3,
-0xaf,
-0x3,
-0xb0,
-0x3,
-0xa9,
-0x3,
-0xa2,
-0x3,
-0xa5,
-0x3,
-0x96,
-0x3,
-0x9a,
-0x3,
-0x86,
-0x3,
-0x89,
-0x3,
-0x81,
-0x3,
-0x7b,
-0x3,
-0x78,
-0x3,
-0x70,
-0x3,
-0x68,
-0x3,
-0x65,
-0x3,
-0x5e,
-0x3,
-0x5a,
-0x3,
-0x54,
-0x3,
-0x4f,
-0x3,
-0x4c,
-0x3,
-0x45,
-0x3,
-0x3d,
-0x3,
-0x3f,
-0x3,
-0x36,
-0x3,
-0x3d,
-0x3,
-0x36,
-0x3,
-0x35,
-0x3,
-0x30,
-0x3,
-0x29,
-0x3,
-0x2e,
-0x3,
-0x28,
-0x3,
-0x22,
-0x3,
-0x23,
-0x3,
-0x24,
-0x3,
-0x1f,
-0x3,
-0x18,
-0x3,
-0x19,
-0x3,
-0x12,
-0x3,
-0xd,
-0x3,
-0xb,
-0x3,
-0x8,
-0x3,
-0x1,
-0x3,
-0x1,
-0x3,
-0xfa,
-0x2,
-0xf8,
-0x2,
-0xf6,
-0x2,
-0xf2,
-0x2,
-0xed,
-0x2,
-0xe8,
-0x2,
-0xe2,
-0x2,
-0xe6,
-0x2,
-0xd7,
-0x2,
-0xda,
-0x2,
-0xcc,
-0x2,
-0xd2,
-0x2,
-0xc7,
-0x2,
-0xc8,
-0x2,
-0xbe,
-0x2,
-0xb7,
-0x2,
-0xb9,
-0x2,
-0xb2,
-0x2,
-0xb8,
-0x2,
-0xab,
-0x2,
-0xab,
-0x2,
-0xa4,
-0x2,
-0xa5,
-0x2,
-0x9a,
-0x2,
-0x98,
-0x2,
-0x8b,
-0x2,
-0x8a,
-0x2,
-0x83,
-0x2,
-0x7c,
-0x2,
-0x77,
-0x2,
-0x79,
-0x2,
-0x6f,
-0x2,
-0x67,
-0x2,
-0x66,
-0x2,
-0x61,
-0x2,
-0x51,
-0x2,
-0x4f,
-0x2,
-0x47,
-0x2,
-0x45,
-0x2,
-0x39,
-0x2,
-0x33,
-0x2,
-0x26,
-0x2,
-0x23,
-0x2,
-0x1c,
-0x2,
-0x19,
-0x2,
-0x9,
-0x2,
-0x9,
-0x2,
-0xff,
-0x1,
-0xfe,
-0x1,
-0xf9,
-0x1,
-0xe9,
-0x1,
-0xe7,
-0x1,
-0xe1,
-0x1,
-0xdf,
-0x1,
-0xd7,
-0x1,
-0xcc,
-0x1,
-0xbe,
-0x1,
-0xb4,
-0x1,
-0xaf,
-0x1,
-0xa5,
-0x1,
-0x9c,
-0x1,
-0x8e,
-0x1,
-0x82,
-0x1,
-0x75,
-0x1,
-0x69,
-0x1,
-0x63,
-0x1,
-0x59,
-0x1,
-0x47,
-0x1,
-0x3e,
-0x1,
-0x31,
-0x1,
-0x23,
-0x1,
-0x13,
-0x1,
-0x0,
-0x1,
-0xf1,
-0x0,
-0xe4,
-0x0,
-0xd4,
-0x0,
-0xc8,
-0x0,
-0xbb,
-0x0,
-0xa9,
-0x0,
-0x99,
-0x0,
-0x86,
-0x0,
-0x82,
-0x0,
-0x6d,
-0x0,
-0x65,
-0x0,
-0x4f,
-0x0,
-0x4b,
-0x0,
-0x34,
-0x0,
-0x26,
-0x0,
-0x1e,
-0x0,
-0x13,
-0x0,
-0xa,
-0x0,
-0xfb,
-0xff,
-0xef,
-0xff,
-0xe1,
-0xff,
-0xd4,
-0xff,
-0xc9,
-0xff,
-0xbb,
-0xff,
-0xae,
-0xff,
-0x9c,
-0xff,
-0x90,
-0xff,
-0x83,
-0xff,
-0x79,
-0xff,
-0x64,
-0xff,
-0x5e,
-0xff,
-0x4d,
-0xff,
-0x40,
-0xff,
-0x2c,
-0xff,
-0x1c,
-0xff,
-0xf,
-0xff,
-0x6,
-0xff,
-0xf3,
-0xfe,
-0xe5,
-0xfe,
-0xd3,
-0xfe,
-0xc4,
-0xfe,
-0xb4,
-0xfe,
-0xa4,
-0xfe,
-0x97,
-0xfe,
-0x86,
-0xfe,
-0x75,
-0xfe,
-0x66,
-0xfe,
-0x56,
-0xfe,
-0x49,
-0xfe,
-0x3a,
-0xfe,
-0x29,
-0xfe,
-0x14,
-0xfe,
-0x4,
-0xfe,
-0xee,
-0xfd,
-0xe2,
-0xfd,
-0xd2,
-0xfd,
-0xc0,
-0xfd,
-0xb1,
-0xfd,
-0x9b,
-0xfd,
-0x93,
-0xfd,
-0x80,
-0xfd,
-0x6f,
-0xfd,
-0x6b,
-0xfd,
-0x5a,
-0xfd,
-0x4c,
-0xfd,
-0x3d,
-0xfd,
-0x29,
-0xfd,
-0x22,
-0xfd,
-0xa,
-0xfd,
-0x8,
-0xfd,
-0xf5,
-0xfc,
-0xec,
-0xfc,
-0xdf,
-0xfc,
-0xd8,
-0xfc,
-0xd1,
-0xfc,
-0xc1,
-0xfc,
-0xb1,
-0xfc,
-0xaa,
-0xfc,
-0xa3,
-0xfc,
-0xa0,
-0xfc,
-0x91,
-0xfc,
-0x89,
-0xfc,
-0x7d,
-0xfc,
-0x75,
-0xfc,
-0x6b,
-0xfc,
-0x61,
-0xfc,
-0x58,
-0xfc,
-0x48,
-0xfc,
-0x47,
-0xfc,
-0x35,
-0xfc,
-0x2c,
-0xfc,
-0x18,
-0xfc,
-0xc,
-0xfc,
-0x1,
-0xfc,
-0xf0,
-0xfb,
-0xe5,
-0xfb,
-0xd6,
-0xfb,
-0xc9,
-0xfb,
-0xbb,
-0xfb,
-0xb0,
-0xfb,
-0x9c,
-0xfb,
-0x9a,
-0xfb,
-0x8b,
-0xfb,
-0x84,
-0xfb,
-0x76,
-0xfb,
-0x68,
-0xfb,
-0x5f,
-0xfb,
-0x57,
-0xfb,
-0x4f,
-0xfb,
-0x46,
-0xfb,
-0x3c,
-0xfb,
-0x3a,
-0xfb,
-0x30,
-0xfb,
-0x2d,
-0xfb,
-0x1f,
-0xfb,
-0x1a,
-0xfb,
-0x17,
-0xfb,
-0x12,
-0xfb,
-0xe,
-0xfb,
-0x0,
-0xfb,
-0xfd,
-0xfa,
-0xf3,
-0xfa,
-0xf0,
-0xfa,
-0xe2,
-0xfa,
-0xe1,
-0xfa,
-0xd9,
-0xfa,
-0xd1,
-0xfa,
-0xd5,
-0xfa,
-0xc9,
-0xfa,
-0xc5,
-0xfa,
-0xbb,
-0xfa,
-0xb9,
-0xfa,
-0xb1,
-0xfa,
-0xab,
-0xfa,
-0xa6,
-0xfa,
-0xa4,
-0xfa,
-0xa7,
-0xfa,
-0xa1,
-0xfa,
-0x9f,
-0xfa,
-0x9d,
-0xfa,
-0x9a,
-0xfa,
-0x90,
-0xfa,
-0x95,
-0xfa,
-0x8c,
-0xfa,
-0x95,
-0xfa,
-0x86,
-0xfa,
-0x93,
-0xfa,
-0x89,
-0xfa,
-0x90,
-0xfa,
-0x8c,
-0xfa,
-0x8e,
-0xfa,
-0x8f,
-0xfa,
-0x8c,
-0xfa,
-0x94,
-0xfa,
-0x8c,
-0xfa,
-0x92,
-0xfa,
-0x95,
-0xfa,
-0x9b,
-0xfa,
-0x9f,
-0xfa,
-0xaa,
-0xfa,
-0xae,
-0xfa,
-0xb2,
-0xfa,
-0xb9,
-0xfa,
-0xbf,
-0xfa,
-0xc1,
-0xfa,
-0xca,
-0xfa,
-0xc8,
-0xfa,
-0xd0,
-0xfa,
-0xd2,
-0xfa,
-0xdd,
-0xfa,
-0xe1,
-0xfa,
-0xed,
-0xfa,
-0xf4,
-0xfa,
-0xff,
-0xfa,
-0x7,
-0xfb,
-0xd,
-0xfb,
-0x16,
-0xfb,
-0x1c,
-0xfb,
-0x29,
-0xfb,
-0x33,
-0xfb,
-0x37,
-0xfb,
-0x41,
-0xfb,
-0x4e,
-0xfb,
-0x55,
-0xfb,
-0x5f,
-0xfb,
-0x68,
-0xfb,
-0x73,
-0xfb,
-0x81,
-0xfb,
-0x86,
-0xfb,
-0x8f,
-0xfb,
-0x96,
-0xfb,
-0xa6,
-0xfb,
-0xae,
-0xfb,
-0xbd,
-0xfb,
-0xbf,
-0xfb,
-0xcd,
-0xfb,
-0xd5,
-0xfb,
-0xe2,
-0xfb,
-0xea,
-0xfb,
-0xf1,
-0xfb,
-0x7,
-0xfc,
-0xa,
-0xfc,
-0x12,
-0xfc,
-0x19,
-0xfc,
-0x28,
-0xfc,
-0x2f,
-0xfc,
-0x40,
-0xfc,
-0x42,
-0xfc,
-0x52,
-0xfc,
-0x55,
-0xfc,
-0x60,
-0xfc,
-0x69,
-0xfc,
-0x75,
-0xfc,
-0x80,
-0xfc,
-0x8a,
-0xfc,
-0x95,
-0xfc,
-0xa0,
-0xfc,
-0xb0,
-0xfc,
-0xb7,
-0xfc,
-0xc1,
-0xfc,
-0xca,
-0xfc,
-0xd4,
-0xfc,
-0xdd,
-0xfc,
-0xe5,
-0xfc,
-0xe5,
-0xfc,
-0xf8,
-0xfc,
-0x8,
-0xfd,
-0xb,
-0xfd,
-0x13,
-0xfd,
-0x1d,
-0xfd,
-0x22,
-0xfd,
-0x2f,
-0xfd,
-0x35,
-0xfd,
-0x41,
-0xfd,
-0x44,
-0xfd,
-0x56,
-0xfd,
-0x57,
-0xfd,
-0x64,
-0xfd,
-0x6e,
-0xfd,
-0x74,
-0xfd,
-0x80,
-0xfd,
-0x87,
-0xfd,
-0x94,
-0xfd,
-0x9a,
-0xfd,
-0xa7,
-0xfd,
-0xaf,
-0xfd,
-0xbc,
-0xfd,
-0xbc,
-0xfd,
-0xc6,
-0xfd,
-0xcd,
-0xfd,
-0xd6,
-0xfd,
-0xe2,
-0xfd,
-0xe8,
-0xfd,
-0xf5,
-0xfd,
-0xfd,
-0xfd,
-0x4,
-0xfe,
-0xc,
-0xfe,
-0x16,
-0xfe,
-0x1b,
-0xfe,
-0x29,
-0xfe,
-0x33,
-0xfe,
-0x45,
-0xfe,
-0x45,
-0xfe,
-0x4f,
-0xfe,
-0x52,
-0xfe,
-0x5b,
-0xfe,
-0x62,
-0xfe,
-0x6d,
-0xfe,
-0x75,
-0xfe,
-0x7c,
-0xfe,
-0x7f,
-0xfe,
-0x82,
-0xfe,
-0x8a,
-0xfe,
-0x88,
-0xfe,
-0x8e,
-0xfe,
-0x91,
-0xfe,
-0x99,
-0xfe,
-0x98,
-0xfe,
-0x9c,
-0xfe,
-0xa4,
-0xfe,
-0xa0,
-0xfe,
-0xa9,
-0xfe,
-0xae,
-0xfe,
-0xb2,
-0xfe,
-0xb9,
-0xfe,
-0xbf,
-0xfe,
-0xc0,
-0xfe,
-0xc4,
-0xfe,
-0xc5,
-0xfe,
-0xcc,
-0xfe,
-0xc8,
-0xfe,
-0xce,
-0xfe,
-0xcc,
-0xfe,
-0xd0,
-0xfe,
-0xcb,
-0xfe,
-0xd8,
-0xfe,
-0xd1,
-0xfe,
-0xd1,
-0xfe,
-0xcd,
-0xfe,
-0xcd,
-0xfe,
-0xcc,
-0xfe,
-0xcd,
-0xfe,
-0xca,
-0xfe,
-0xcb,
-0xfe,
-0xc4,
-0xfe,
-0xc3,
-0xfe,
-0xc3,
-0xfe,
-0xbb,
-0xfe,
-0xb9,
-0xfe,
-0xb5,
-0xfe,
-0xb0,
-0xfe,
-0xa8,
-0xfe,
-0xa4,
-0xfe,
-0x9f,
-0xfe,
-0x9b,
-0xfe,
-0x92,
-0xfe,
-0x92,
-0xfe,
-0x88,
-0xfe,
-0x8b,
-0xfe,
-0x83,
-0xfe,
-0x7c,
-0xfe,
-0x7b,
-0xfe,
-0x7a,
-0xfe,
-0x70,
-0xfe,
-0x6f,
-0xfe,
-0x63,
-0xfe,
-0x61,
-0xfe,
-0x53,
-0xfe,
-0x4d,
-0xfe,
-0x44,
-0xfe,
-0x3c,
-0xfe,
-0x37,
-0xfe,
-0x36,
-0xfe,
-0x32,
-0xfe,
-0x2a,
-0xfe,
-0x24,
-0xfe,
-0x22,
-0xfe,
-0x1c,
-0xfe,
-0x1e,
-0xfe,
-0x1d,
-0xfe,
-0x1f,
-0xfe,
-0x1e,
-0xfe,
-0x19,
-0xfe,
-0x16,
-0xfe,
-0x18,
-0xfe,
-0x18,
-0xfe,
-0x14,
-0xfe,
-0x12,
-0xfe,
-0x10,
-0xfe,
-0x12,
-0xfe,
-0x11,
-0xfe,
-0x18,
-0xfe,
-0x13,
-0xfe,
-0x19,
-0xfe,
-0x18,
-0xfe,
-0x13,
-0xfe,
-0x13,
-0xfe,
-0x18,
-0xfe,
-0x1a,
-0xfe,
-0x16,
-0xfe,
-0x16,
-0xfe,
-0x10,
-0xfe,
-0xd,
-0xfe,
-0xf,
-0xfe,
-0x11,
-0xfe,
-0x11,
-0xfe,
-0x4,
-0xfe,
-0xd,
-0xfe,
-0x2,
-0xfe,
-0xa,
-0xfe,
-0x1,
-0xfe,
-0x5,
-0xfe,
-0x0,
-0xfe,
-0x3,
-0xfe,
-0x0,
-0xfe,
-0x7,
-0xfe,
-0xff,
-0xfd,
-0x7,
-0xfe,
-0x4,
-0xfe,
-0xb,
-0xfe,
-0xd,
-0xfe,
-0xf,
-0xfe,
-0x1b,
-0xfe,
-0x1b,
-0xfe,
-0x21,
-0xfe,
-0x26,
-0xfe,
-0x29,
-0xfe,
-0x2a,
-0xfe,
-0x2f,
-0xfe,
-0x30,
-0xfe,
-0x30,
-0xfe,
-0x35,
-0xfe,
-0x39,
-0xfe,
-0x3b,
-0xfe,
-0x40,
-0xfe,
-0x45,
-0xfe,
-0x45,
-0xfe,
-0x49,
-0xfe,
-0x47,
-0xfe,
-0x4a,
-0xfe,
-0x49,
-0xfe,
-0x4c,
-0xfe,
-0x4b,
-0xfe,
-0x4c,
-0xfe,
-0x4e,
-0xfe,
-0x58,
-0xfe,
-0x55,
-0xfe,
-0x5b,
-0xfe,
-0x5c,
-0xfe,
-0x5f,
-0xfe,
-0x68,
-0xfe,
-0x69,
-0xfe,
-0x70,
-0xfe,
-0x74,
-0xfe,
-0x7f,
-0xfe,
-0x80,
-0xfe,
-0x8c,
-0xfe,
-0x93,
-0xfe,
-0x9f,
-0xfe,
-0xa7,
-0xfe,
-0xaf,
-0xfe,
-0xb7,
-0xfe,
-0xb9,
-0xfe,
-0xc0,
-0xfe,
-0xc4,
-0xfe,
-0xd0,
-0xfe,
-0xd3,
-0xfe,
-0xdc,
-0xfe,
-0xdf,
-0xfe,
-0xe6,
-0xfe,
-0xf1,
-0xfe,
-0xf8,
-0xfe,
-0x1,
-0xff,
-0x4,
-0xff,
-0x9,
-0xff,
-0x10,
-0xff,
-0x1c,
-0xff,
-0x25,
-0xff,
-0x27,
-0xff,
-0x30,
-0xff,
-0x36,
-0xff,
-0x41,
-0xff,
-0x4c,
-0xff,
-0x54,
-0xff,
-0x64,
-0xff,
-0x6a,
-0xff,
-0x7c,
-0xff,
-0x7e,
-0xff,
-0x92,
-0xff,
-0x96,
-0xff,
-0xa1,
-0xff,
-0xaa,
-0xff,
-0xb1,
-0xff,
-0xbb,
-0xff,
-0xbc,
-0xff,
-0xc7,
-0xff,
-0xc9,
-0xff,
-0xd5,
-0xff,
-0xd9,
-0xff,
-0xe0,
-0xff,
-0xe5,
-0xff,
-0xe9,
-0xff,
-0xed,
-0xff,
-0xf4,
-0xff,
-0xf5,
-0xff,
-0xff,
-0xff,
-0xfb,
-0xff,
-0x4,
-0x0,
-0x9,
-0x0,
-0x12,
-0x0,
-0x18,
-0x0,
-0x1e,
-0x0,
-0x2c,
-0x0,
-0x2d,
-0x0,
-0x33,
-0x0,
-0x39,
-0x0,
-0x45,
-0x0,
-0x4a,
-0x0,
-0x52,
-0x0,
-0x4f,
-0x0,
-0x58,
-0x0,
-0x60,
-0x0,
-0x67,
-0x0,
-0x69,
-0x0,
-0x6b,
-0x0,
-0x6e,
-0x0,
-0x74,
-0x0,
-0x7a,
-0x0,
-0x81,
-0x0,
-0x87,
-0x0,
-0x8c,
-0x0,
-0x8f,
-0x0,
-0x91,
-0x0,
-0x92,
-0x0,
-0x9a,
-0x0,
-0x9c,
-0x0,
-0xa0,
-0x0,
-0xa6,
-0x0,
-0xa6,
-0x0,
-0xac,
-0x0,
-0xae,
-0x0,
-0xb7,
-0x0,
-0xb4,
-0x0,
-0xb9,
-0x0,
-0xbb,
-0x0,
-0xbb,
-0x0,
-0xbd,
-0x0,
-0xc0,
-0x0,
-0xc8,
-0x0,
-0xc4,
-0x0,
-0xcb,
-0x0,
-0xcc,
-0x0,
-0xd4,
-0x0,
-0xd6,
-0x0,
-0xd6,
-0x0,
-0xd5,
-0x0,
-0xdc,
-0x0,
-0xde,
-0x0,
-0xe7,
-0x0,
-0xe4,
-0x0,
-0xeb,
-0x0,
-0xea,
-0x0,
-0xea,
-0x0,
-0xf2,
-0x0,
-0xf1,
-0x0,
-0xf6,
-0x0,
-0xf3,
-0x0,
-0xfd,
-0x0,
-0xf5,
-0x0,
-0xfa,
-0x0,
-0xfa,
-0x0,
-0xfa,
-0x0,
-0xfd,
-0x0,
-0xfa,
-0x0,
-0xfb,
-0x0,
-0x1,
-0x1,
-0x1,
-0x1,
-0x3,
-0x1,
-0xc,
-0x1,
-0xe,
-0x1,
-0x11,
-0x1,
-0x16,
-0x1,
-0x13,
-0x1,
-0x1c,
-0x1,
-0x1c,
-0x1,
-0x27,
-0x1,
-0x27,
-0x1,
-0x33,
-0x1,
-0x36,
-0x1,
-0x40,
-0x1,
-0x48,
-0x1,
-0x4f,
-0x1,
-0x56,
-0x1,
-0x57,
-0x1,
-0x61,
-0x1,
-0x61,
-0x1,
-0x68,
-0x1,
-0x6d,
-0x1,
-0x71,
-0x1,
-0x77,
-0x1,
-0x7e,
-0x1,
-0x84,
-0x1,
-0x86,
-0x1,
-0x8f,
-0x1,
-0x93,
-0x1,
-0x9b,
-0x1,
-0x98,
-0x1,
-0x9e,
-0x1,
-0xa5,
-0x1,
-0xae,
-0x1,
-0xb6,
-0x1,
-0xba,
-0x1,
-0xc1,
-0x1,
-0xc1,
-0x1,
-0xc8,
-0x1,
-0xcc,
-0x1,
-0xcf,
-0x1,
-0xd3,
-0x1,
-0xda,
-0x1,
-0xe6,
-0x1,
-0xe8,
-0x1,
-0xf3,
-0x1,
-0xf8,
-0x1,
-0xfe,
-0x1,
-0x7,
-0x2,
-0x7,
-0x2,
-0x15,
-0x2,
-0x18,
-0x2,
-0x24,
-0x2,
-0x1f,
-0x2,
-0x2e,
-0x2,
-0x33,
-0x2,
-0x3c,
-0x2,
-0x42,
-0x2,
-0x4e,
-0x2,
-0x55,
-0x2,
-0x57,
-0x2,
-0x5d,
-0x2,
-0x63,
-0x2,
-0x6e,
-0x2,
-0x74,
-0x2,
-0x7a,
-0x2,
-0x86,
-0x2,
-0x8a,
-0x2,
-0x90,
-0x2,
-0x9c,
-0x2,
-0xa6,
-0x2,
-0xa9,
-0x2,
-0xb3,
-0x2,
-0xb5,
-0x2,
-0xc4,
-0x2,
-0xc8,
-0x2,
-0xcc,
-0x2,
-0xdc,
-0x2,
-0xda,
-0x2,
-0xe4,
-0x2,
-0xe6,
-0x2,
-0xed,
-0x2,
-0xf5,
-0x2,
-0xf7,
-0x2,
-0x5,
-0x3,
-0xd,
-0x3,
-0x13,
-0x3,
-0xc,
-0x3,
-0x16,
-0x3,
-0x1a,
-0x3,
-0x23,
-0x3,
-0x23,
-0x3,
-0x2c,
-0x3,
-0x2f,
-0x3,
-0x37,
-0x3,
-0x38,
-0x3,
-0x40,
-0x3,
-0x46,
-0x3,
-0x4e,
-0x3,
-0x55,
-0x3,
-0x60,
-0x3,
-0x60,
-0x3,
-0x66,
-0x3,
-0x6d,
-0x3,
-0x78,
-0x3,
-0x77,
-0x3,
-0x87,
-0x3,
-0x88,
-0x3,
-0x9b,
-0x3,
-0x9d,
-0x3,
-0xa5,
-0x3,
-0xa5,
-0x3,
-0xb6,
-0x3,
-0xb5,
-0x3,
-0xc1,
-0x3,
-0xc4,
-0x3,
-0xc8,
-0x3,
-0xce,
-0x3,
-0xd2,
-0x3,
-0xd9,
-0x3,
-0xe2,
-0x3,
-0xec,
-0x3,
-0xf0,
-0x3,
-0xf4,
-0x3,
-0xfb,
-0x3,
-0xfa,
-0x3,
-0x7,
-0x4,
-0xc,
-0x4,
-0x11,
-0x4,
-0xc,
-0x4,
-0x13,
-0x4,
-0x16,
-0x4,
-0x1b,
-0x4,
-0x20,
-0x4,
-0x27,
-0x4,
-0x2c,
-0x4,
-0x2e,
-0x4,
-0x32,
-0x4,
-0x31,
-0x4,
-0x39,
-0x4,
-0x39,
-0x4,
-0x41,
-0x4,
-0x44,
-0x4,
-0x45,
-0x4,
-0x42,
-0x4,
-0x42,
-0x4,
-0x3e,
-0x4,
-0x41,
-0x4,
-0x45,
-0x4,
-0x41,
-0x4,
-0x4f,
-0x4,
-0x46,
-0x4,
-0x4f,
-0x4,
-0x47,
-0x4,
-0x52,
-0x4,
-0x4b,
-0x4,
-0x53,
-0x4,
-0x52,
-0x4,
-0x58,
-0x4,
-0x58,
-0x4,
-0x5f,
-0x4,
-0x61,
-0x4,
-0x6a,
-0x4,
-0x67,
-0x4,
-0x74,
-0x4,
-0x74,
-0x4,
-0x79,
-0x4,
-0x7e,
-0x4,
-0x7d,
-0x4,
-0x83,
-0x4,
-0x82,
-0x4,
-0x85,
-0x4,
-0x85,
-0x4,
-0x87,
-0x4,
-0x89,
-0x4,
-0x85,
-0x4,
-0x85,
-0x4,
-0x84,
-0x4,
-0x86,
-0x4,
-0x7f,
-0x4,
-0x83,
-0x4,
-0x7f,
-0x4,
-0x84,
-0x4,
-0x80,
-0x4,
-0x80,
-0x4,
-0x79,
-0x4,
-0x7c,
-0x4,
-0x73,
-0x4,
-0x77,
-0x4,
-0x75,
-0x4,
-0x74,
-0x4,
-0x73,
-0x4,
-0x6f,
-0x4,
-0x6a,
-0x4,
-0x6a,
-0x4,
-0x6d,
-0x4,
-0x6b,
-0x4,
-0x68,
-0x4,
-0x67,
-0x4,
-0x60,
-0x4,
-0x61,
-0x4,
-0x63,
-0x4,
-0x66,
-0x4,
-0x62,
-0x4,
-0x67,
-0x4,
-0x65,
-0x4,
-0x67,
-0x4,
-0x64,
-0x4,
-0x63,
-0x4,
-0x5d,
-0x4,
-0x5e,
-0x4,
-0x57,
-0x4,
-0x58,
-0x4,
-0x56,
-0x4,
-0x57,
-0x4,
-0x4f,
-0x4,
-0x4e,
-0x4,
-0x48,
-0x4,
-0x45,
-0x4,
-0x42,
-0x4,
-0x3e,
-0x4,
-0x38,
-0x4,
-0x38,
-0x4,
-0x35,
-0x4,
-0x34,
-0x4,
-0x2f,
-0x4,
-0x34,
-0x4,
-0x31,
-0x4,
-0x2e,
-0x4,
-0x2d,
-0x4,
-0x2a,
-0x4,
-0x29,
-0x4,
-0x28,
-0x4,
-0x2b,
-0x4,
-0x2b,
-0x4,
-0x27,
-0x4,
-0x2b,
-0x4,
-0x28,
-0x4,
-0x27,
-0x4,
-0x1f,
-0x4,
-0x22,
-0x4,
-0x1d,
-0x4,
-0x24,
-0x4,
-0x1e,
-0x4,
-0x1e,
-0x4,
-0x1b,
-0x4,
-0x15,
-0x4,
-0x19,
-0x4,
-0x19,
-0x4,
-0x19,
-0x4,
-0x15,
-0x4,
-0xa,
-0x4,
-0x6,
-0x4,
-0x1,
-0x4,
-0xfb,
-0x3,
-0xfb,
-0x3,
-0xf9,
-0x3,
-0xf1,
-0x3,
-0xec,
-0x3,
-0xe3,
-0x3,
-0xde,
-0x3,
-0xd4,
-0x3,
-0xc8,
-0x3,
-0xc7,
-0x3,
-0xb6,
-0x3,
-0xb8,
-0x3,
-0xa9,
-0x3,
-0xa4,
-0x3,
-0x96,
-0x3,
-0x93,
-0x3,
-0x8a,
-0x3,
-0x86,
-0x3,
-0x86,
-0x3,
-0x79,
-0x3,
-0x73,
-0x3,
-0x6e,
-0x3,
-0x6c,
-0x3,
-0x64,
-0x3,
-0x62,
-0x3,
-0x58,
-0x3,
-0x54,
-0x3,
-0x4a,
-0x3,
-0x45,
-0x3,
-0x3e,
-0x3,
-0x34,
-0x3,
-0x2e,
-0x3,
-0x29,
-0x3,
-0x21,
-0x3,
-0x15,
-0x3,
-0x18,
-0x3,
-0xb,
-0x3,
-0x2,
-0x3,
-0xf4,
-0x2,
-0xf3,
-0x2,
-0xe2,
-0x2,
-0xdf,
-0x2,
-0xd5,
-0x2,
-0xc5,
-0x2,
-0xc6,
-0x2,
-0xb4,
-0x2,
-0xad,
-0x2,
-0xa0,
-0x2,
-0x97,
-0x2,
-0x88,
-0x2,
-0x80,
-0x2,
-0x73,
-0x2,
-0x6d,
-0x2,
-0x5b,
-0x2,
-0x51,
-0x2,
-0x3e,
-0x2,
-0x34,
-0x2,
-0x26,
-0x2,
-0x1a,
-0x2,
-0x7,
-0x2,
-0xfa,
-0x1,
-0xe1,
-0x1,
-0xd9,
-0x1,
-0xc0,
-0x1,
-0xb3,
-0x1,
-0xa3,
-0x1,
-0x8b,
-0x1,
-0x7f,
-0x1,
-0x69,
-0x1,
-0x5e,
-0x1,
-0x47,
-0x1,
-0x3c,
-0x1,
-0x1e,
-0x1,
-0xf,
-0x1,
-0x0,
-0x1,
-0xec,
-0x0,
-0xde,
-0x0,
-0xc6,
-0x0,
-0xb3,
-0x0,
-0x9f,
-0x0,
-0x8d,
-0x0,
-0x7c,
-0x0,
-0x66,
-0x0,
-0x59,
-0x0,
-0x3c,
-0x0,
-0x2b,
-0x0,
-0x14,
-0x0,
-0xfa,
-0xff,
-0xe3,
-0xff,
-0xcd,
-0xff,
-0xba,
-0xff,
-0xa1,
-0xff,
-0x8f,
-0xff,
-0x76,
-0xff,
-0x66,
-0xff,
-0x4a,
-0xff,
-0x2f,
-0xff,
-0x1a,
-0xff,
-0xff,
-0xfe,
-0xee,
-0xfe,
-0xd5,
-0xfe,
-0xc1,
-0xfe,
-0xa7,
-0xfe,
-0x96,
-0xfe,
-0x7f,
-0xfe,
-0x6b,
-0xfe,
-0x52,
-0xfe,
-0x43,
-0xfe,
-0x28,
-0xfe,
-0x1b,
-0xfe,
-0x4,
-0xfe,
-0xf6,
-0xfd,
-0xe5,
-0xfd,
-0xd8,
-0xfd,
-0xc6,
-0xfd,
-0xb5,
-0xfd,
-0xa2,
-0xfd,
-0x95,
-0xfd,
-0x85,
-0xfd,
-0x77,
-0xfd,
-0x62,
-0xfd,
-0x51,
-0xfd,
-0x42,
-0xfd,
-0x2f,
-0xfd,
-0x22,
-0xfd,
-0x10,
-0xfd,
-0x7,
-0xfd,
-0xff,
-0xfc,
-0xed,
-0xfc,
-0xdf,
-0xfc,
-0xd3,
-0xfc,
-0xc6,
-0xfc,
-0xbb,
-0xfc,
-0xae,
-0xfc,
-0xa2,
-0xfc,
-0xa0,
-0xfc,
-0x8b,
-0xfc,
-0x8c,
-0xfc,
-0x76,
-0xfc,
-0x75,
-0xfc,
-0x6b,
-0xfc,
-0x60,
-0xfc,
-0x5a,
-0xfc,
-0x50,
-0xfc,
-0x4e,
-0xfc,
-0x46,
-0xfc,
-0x48,
-0xfc,
-0x3e,
-0xfc,
-0x38,
-0xfc,
-0x2e,
-0xfc,
-0x2b,
-0xfc,
-0x22,
-0xfc,
-0x24,
-0xfc,
-0x1f,
-0xfc,
-0x1c,
-0xfc,
-0xd,
-0xfc,
-0xd,
-0xfc,
-0x6,
-0xfc,
-0x3,
-0xfc,
-0x6,
-0xfc,
-0x0,
-0xfc,
-0xff,
-0xfb,
-0xf8,
-0xfb,
-0xf9,
-0xfb,
-0xf4,
-0xfb,
-0xf7,
-0xfb,
-0xfa,
-0xfb,
-0xf1,
-0xfb,
-0xf2,
-0xfb,
-0xeb,
-0xfb,
-0xe8,
-0xfb,
-0xec,
-0xfb,
-0xef,
-0xfb,
-0xef,
-0xfb,
-0xed,
-0xfb,
-0xf4,
-0xfb,
-0xf0,
-0xfb,
-0xf3,
-0xfb,
-0xf9,
-0xfb,
-0xf8,
-0xfb,
-0xf6,
-0xfb,
-0xf9,
-0xfb,
-0xfb,
-0xfb,
-0xfd,
-0xfb,
-0xff,
-0xfb,
-0xfb,
-0xfb,
-0xff,
-0xfb,
-0x2,
-0xfc,
-0x2,
-0xfc,
-0xe,
-0xfc,
-0xc,
-0xfc,
-0x13,
-0xfc,
-0x13,
-0xfc,
-0x1c,
-0xfc,
-0x22,
-0xfc,
-0x27,
-0xfc,
-0x29,
-0xfc,
-0x34,
-0xfc,
-0x32,
-0xfc,
-0x3c,
-0xfc,
-0x43,
-0xfc,
-0x4c,
-0xfc,
-0x52,
-0xfc,
-0x5a,
-0xfc,
-0x5d,
-0xfc,
-0x68,
-0xfc,
-0x67,
-0xfc,
-0x6d,
-0xfc,
-0x7d,
-0xfc,
-0x7b,
-0xfc,
-0x85,
-0xfc,
-0x84,
-0xfc,
-0x8c,
-0xfc,
-0x8b,
-0xfc,
-0x91,
-0xfc,
-0x8d,
-0xfc,
-0x93,
-0xfc,
-0x96,
-0xfc,
-0x9a,
-0xfc,
-0x9c,
-0xfc,
-0x9f,
-0xfc,
-0xa3,
-0xfc,
-0x9f,
-0xfc,
-0xaf,
-0xfc,
-0xad,
-0xfc,
-0xb9,
-0xfc,
-0xb9,
-0xfc,
-0xbf,
-0xfc,
-0xc2,
-0xfc,
-0xc6,
-0xfc,
-0xcd,
-0xfc,
-0xd6,
-0xfc,
-0xd8,
-0xfc,
-0xd6,
-0xfc,
-0xd9,
-0xfc,
-0xdf,
-0xfc,
-0xe0,
-0xfc,
-0xe5,
-0xfc,
-0xe1,
-0xfc,
-0xe9,
-0xfc,
-0xec,
-0xfc,
-0xec,
-0xfc,
-0xf0,
-0xfc,
-0xf0,
-0xfc,
-0xee,
-0xfc,
-0xf3,
-0xfc,
-0xf1,
-0xfc,
-0xf2,
-0xfc,
-0xf0,
-0xfc,
-0xf4,
-0xfc,
-0xf0,
-0xfc,
-0xf8,
-0xfc,
-0xf3,
-0xfc,
-0xfd,
-0xfc,
-0xf8,
-0xfc,
-0x0,
-0xfd,
-0xf9,
-0xfc,
-0x2,
-0xfd,
-0x1,
-0xfd,
-0x4,
-0xfd,
-0x6,
-0xfd,
-0x7,
-0xfd,
-0x8,
-0xfd,
-0xb,
-0xfd,
-0xe,
-0xfd,
-0xc,
-0xfd,
-0x13,
-0xfd,
-0xd,
-0xfd,
-0x16,
-0xfd,
-0x18,
-0xfd,
-0x18,
-0xfd,
-0x18,
-0xfd,
-0x19,
-0xfd,
-0x15,
-0xfd,
-0x14,
-0xfd,
-0x14,
-0xfd,
-0x15,
-0xfd,
-0x11,
-0xfd,
-0xe,
-0xfd,
-0xf,
-0xfd,
-0x12,
-0xfd,
-0xc,
-0xfd,
-0xd,
-0xfd,
-0x5,
-0xfd,
-0x9,
-0xfd,
-0x0,
-0xfd,
-0x2,
-0xfd,
-0xfc,
-0xfc,
-0xfc,
-0xfc,
-0xf7,
-0xfc,
-0xf6,
-0xfc,
-0xf5,
-0xfc,
-0xf5,
-0xfc,
-0xf5,
-0xfc,
-0xf3,
-0xfc,
-0xf3,
-0xfc,
-0xec,
-0xfc,
-0xf1,
-0xfc,
-0xe6,
-0xfc,
-0xe6,
-0xfc,
-0xe1,
-0xfc,
-0xe1,
-0xfc,
-0xe3,
-0xfc,
-0xe6,
-0xfc,
-0xe7,
-0xfc,
-0xdf,
-0xfc,
-0xe2,
-0xfc,
-0xd6,
-0xfc,
-0xd2,
-0xfc,
-0xd1,
-0xfc,
-0xce,
-0xfc,
-0xd1,
-0xfc,
-0xcc,
-0xfc,
-0xce,
-0xfc,
-0xca,
-0xfc,
-0xcd,
-0xfc,
-0xcb,
-0xfc,
-0xc6,
-0xfc,
-0xc8,
-0xfc,
-0xbf,
-0xfc,
-0xc8,
-0xfc,
-0xc7,
-0xfc,
-0xcb,
-0xfc,
-0xc7,
-0xfc,
-0xcb,
-0xfc,
-0xd0,
-0xfc,
-0xcc,
-0xfc,
-0xd1,
-0xfc,
-0xcf,
-0xfc,
-0xd6,
-0xfc,
-0xd0,
-0xfc,
-0xd3,
-0xfc,
-0xd9,
-0xfc,
-0xd7,
-0xfc,
-0xdc,
-0xfc,
-0xdc,
-0xfc,
-0xdf,
-0xfc,
-0xe2,
-0xfc,
-0xe6,
-0xfc,
-0xe6,
-0xfc,
-0xe9,
-0xfc,
-0xe9,
-0xfc,
-0xea,
-0xfc,
-0xee,
-0xfc,
-0xf0,
-0xfc,
-0xf0,
-0xfc,
-0xf6,
-0xfc,
-0xfa,
-0xfc,
-0x0,
-0xfd,
-0x5,
-0xfd,
-0x5,
-0xfd,
-0xb,
-0xfd,
-0xe,
-0xfd,
-0x12,
-0xfd,
-0x16,
-0xfd,
-0x18,
-0xfd,
-0x1c,
-0xfd,
-0x20,
-0xfd,
-0x2b,
-0xfd,
-0x29,
-0xfd,
-0x30,
-0xfd,
-0x2d,
-0xfd,
-0x38,
-0xfd,
-0x3b,
-0xfd,
-0x3e,
-0xfd,
-0x41,
-0xfd,
-0x45,
-0xfd,
-0x47,
-0xfd,
-0x4d,
-0xfd,
-0x50,
-0xfd,
-0x58,
-0xfd,
-0x5c,
-0xfd,
-0x5f,
-0xfd,
-0x6d,
-0xfd,
-0x6c,
-0xfd,
-0x74,
-0xfd,
-0x7a,
-0xfd,
-0x85,
-0xfd,
-0x87,
-0xfd,
-0x90,
-0xfd,
-0x8f,
-0xfd,
-0x9c,
-0xfd,
-0xa3,
-0xfd,
-0xa4,
-0xfd,
-0xae,
-0xfd,
-0xab,
-0xfd,
-0xbd,
-0xfd,
-0xbe,
-0xfd,
-0xcb,
-0xfd,
-0xcc,
-0xfd,
-0xd8,
-0xfd,
-0xdd,
-0xfd,
-0xe7,
-0xfd,
-0xf3,
-0xfd,
-0xff,
-0xfd,
-0x6,
-0xfe,
-0x11,
-0xfe,
-0x17,
-0xfe,
-0x26,
-0xfe,
-0x2a,
-0xfe,
-0x36,
-0xfe,
-0x40,
-0xfe,
-0x48,
-0xfe,
-0x4c,
-0xfe,
-0x53,
-0xfe,
-0x5d,
-0xfe,
-0x68,
-0xfe,
-0x70,
-0xfe,
-0x7d,
-0xfe,
-0x81,
-0xfe,
-0x8b,
-0xfe,
-0x92,
-0xfe,
-0x9d,
-0xfe,
-0xa2,
-0xfe,
-0xad,
-0xfe,
-0xb4,
-0xfe,
-0xc2,
-0xfe,
-0xc4,
-0xfe,
-0xce,
-0xfe,
-0xd2,
-0xfe,
-0xdc,
-0xfe,
-0xdf,
-0xfe,
-0xe2,
-0xfe,
-0xe8,
-0xfe,
-0xf7,
-0xfe,
-0xf7,
-0xfe,
-0x9,
-0xff,
-0x6,
-0xff,
-0x14,
-0xff,
-0x16,
-0xff,
-0x21,
-0xff,
-0x28,
-0xff,
-0x2c,
-0xff,
-0x35,
-0xff,
-0x3f,
-0xff,
-0x4a,
-0xff,
-0x51,
-0xff,
-0x60,
-0xff,
-0x6a,
-0xff,
-0x6a,
-0xff,
-0x79,
-0xff,
-0x79,
-0xff,
-0x83,
-0xff,
-0x94,
-0xff,
-0x96,
-0xff,
-0x9e,
-0xff,
-0x9c,
-0xff,
-0xa6,
-0xff,
-0xaa,
-0xff,
-0xb4,
-0xff,
-0xba,
-0xff,
-0xc0,
-0xff,
-0xcb,
-0xff,
-0xc9,
-0xff,
-0xd9,
-0xff,
-0xd9,
-0xff,
-0xe5,
-0xff,
-0xe7,
-0xff,
-0xe6,
-0xff,
-0xf3,
-0xff,
-0xf3,
-0xff,
-0xfb,
-0xff,
-0x1,
-0x0,
-0x4,
-0x0,
-0xf,
-0x0,
-0x8,
-0x0,
-0x1a,
-0x0,
-0x15,
-0x0,
-0x1b,
-0x0,
-0x20,
-0x0,
-0x22,
-0x0,
-0x20,
-0x0,
-0x24,
-0x0,
-0x29,
-0x0,
-0x2c,
-0x0,
-0x2f,
-0x0,
-0x27,
-0x0,
-0x32,
-0x0,
-0x2b,
-0x0,
-0x30,
-0x0,
-0x36,
-0x0,
-0x3a,
-0x0,
-0x40,
-0x0,
-0x3f,
-0x0,
-0x41,
-0x0,
-0x41,
-0x0,
-0x42,
-0x0,
-0x45,
-0x0,
-0x41,
-0x0,
-0x40,
-0x0,
-0x3e,
-0x0,
-0x41,
-0x0,
-0x3d,
-0x0,
-0x45,
-0x0,
-0x3f,
-0x0,
-0x41,
-0x0,
-0x3a,
-0x0,
-0x3d,
-0x0,
-0x38,
-0x0,
-0x33,
-0x0,
-0x35,
-0x0,
-0x2c,
-0x0,
-0x2b,
-0x0,
-0x22,
-0x0,
-0x1d,
-0x0,
-0x15,
-0x0,
-0x17,
-0x0,
-0xc,
-0x0,
-0xa,
-0x0,
-0x6,
-0x0,
-0xfb,
-0xff,
-0xf9,
-0xff,
-0xed,
-0xff,
-0xeb,
-0xff,
-0xe5,
-0xff,
-0xdf,
-0xff,
-0xdc,
-0xff,
-0xd0,
-0xff,
-0xca,
-0xff,
-0xc2,
-0xff,
-0xba,
-0xff,
-0xb3,
-0xff,
-0xa9,
-0xff,
-0xa4,
-0xff,
-0x96,
-0xff,
-0x8e,
-0xff,
-0x83,
-0xff,
-0x7a,
-0xff,
-0x6a,
-0xff,
-0x61,
-0xff,
-0x59,
-0xff,
-0x4d,
-0xff,
-0x48,
-0xff,
-0x37,
-0xff,
-0x34,
-0xff,
-0x23,
-0xff,
-0x21,
-0xff,
-0x17,
-0xff,
-0xc,
-0xff,
-0x2,
-0xff,
-0xfa,
-0xfe,
-0xec,
-0xfe,
-0xea,
-0xfe,
-0xdd,
-0xfe,
-0xd7,
-0xfe,
-0xcc,
-0xfe,
-0xc3,
-0xfe,
-0xb8,
-0xfe,
-0xb7,
-0xfe,
-0xa8,
-0xfe,
-0xa2,
-0xfe,
-0x94,
-0xfe,
-0x91,
-0xfe,
-0x8d,
-0xfe,
-0x7f,
-0xfe,
-0x77,
-0xfe,
-0x74,
-0xfe,
-0x6d,
-0xfe,
-0x61,
-0xfe,
-0x58,
-0xfe,
-0x53,
-0xfe,
-0x52,
-0xfe,
-0x43,
-0xfe,
-0x39,
-0xfe,
-0x2a,
-0xfe,
-0x2a,
-0xfe,
-0x19,
-0xfe,
-0x13,
-0xfe,
-0xc,
-0xfe,
-0x4,
-0xfe,
-0xff,
-0xfd,
-0xf9,
-0xfd,
-0xf4,
-0xfd,
-0xee,
-0xfd,
-0xe9,
-0xfd,
-0xe9,
-0xfd,
-0xe8,
-0xfd,
-0xdf,
-0xfd,
-0xdb,
-0xfd,
-0xd4,
-0xfd,
-0xcd,
-0xfd,
-0xcb,
-0xfd,
-0xc9,
-0xfd,
-0xc7,
-0xfd,
-0xc5,
-0xfd,
-0xc4,
-0xfd,
-0xbe,
-0xfd,
-0xc4,
-0xfd,
-0xbd,
-0xfd,
-0xc9,
-0xfd,
-0xc2,
-0xfd,
-0xc4,
-0xfd,
-0xc6,
-0xfd,
-0xbf,
-0xfd,
-0xc4,
-0xfd,
-0xc4,
-0xfd,
-0xcc,
-0xfd,
-0xd4,
-0xfd,
-0xd1,
-0xfd,
-0xdb,
-0xfd,
-0xd9,
-0xfd,
-0xdb,
-0xfd,
-0xdc,
-0xfd,
-0xe0,
-0xfd,
-0xe3,
-0xfd,
-0xed,
-0xfd,
-0xea,
-0xfd,
-0xf4,
-0xfd,
-0xfb,
-0xfd,
-0xfc,
-0xfd,
-0x1,
-0xfe,
-0x7,
-0xfe,
-0x1,
-0xfe,
-0x8,
-0xfe,
-0xb,
-0xfe,
-0x18,
-0xfe,
-0x19,
-0xfe,
-0x2a,
-0xfe,
-0x2b,
-0xfe,
-0x38,
-0xfe,
-0x41,
-0xfe,
-0x42,
-0xfe,
-0x4f,
-0xfe,
-0x50,
-0xfe,
-0x5b,
-0xfe,
-0x62,
-0xfe,
-0x71,
-0xfe,
-0x7c,
-0xfe,
-0x81,
-0xfe,
-0x92,
-0xfe,
-0x99,
-0xfe,
-0xa8,
-0xfe,
-0xb6,
-0xfe,
-0xc5,
-0xfe,
-0xd1,
-0xfe,
-0xde,
-0xfe,
-0xea,
-0xfe,
-0xf6,
-0xfe,
-0x3,
-0xff,
-0x14,
-0xff,
-0x22,
-0xff,
-0x2c,
-0xff,
-0x3a,
-0xff,
-0x45,
-0xff,
-0x5a,
-0xff,
-0x67,
-0xff,
-0x77,
-0xff,
-0x7c,
-0xff,
-0x8f,
-0xff,
-0x98,
-0xff,
-0xab,
-0xff,
-0xb9,
-0xff,
-0xcb,
-0xff,
-0xd0,
-0xff,
-0xe3,
-0xff,
-0xec,
-0xff,
-0x4,
-0x0,
-0x10,
-0x0,
-0x21,
-0x0,
-0x2f,
-0x0,
-0x45,
-0x0,
-0x50,
-0x0,
-0x60,
-0x0,
-0x68,
-0x0,
-0x77,
-0x0,
-0x88,
-0x0,
-0x99,
-0x0,
-0xa6,
-0x0,
-0xb8,
-0x0,
-0xc5,
-0x0,
-0xcd,
-0x0,
-0xdd,
-0x0,
-0xea,
-0x0,
-0xf8,
-0x0,
-0x8,
-0x1,
-0x19,
-0x1,
-0x26,
-0x1,
-0x39,
-0x1,
-0x44,
-0x1,
-0x59,
-0x1,
-0x6e,
-0x1,
-0x79,
-0x1,
-0x84,
-0x1,
-0x96,
-0x1,
-0xa3,
-0x1,
-0xb9,
-0x1,
-0xc5,
-0x1,
-0xda,
-0x1,
-0xe3,
-0x1,
-0xf4,
-0x1,
-0x5,
-0x2,
-0xd,
-0x2,
-0x21,
-0x2,
-0x2f,
-0x2,
-0x43,
-0x2,
-0x44,
-0x2,
-0x51,
-0x2,
-0x5f,
-0x2,
-0x68,
-0x2,
-0x77,
-0x2,
-0x7f,
-0x2,
-0x8b,
-0x2,
-0x8f,
-0x2,
-0xa2,
-0x2,
-0xac,
-0x2,
-0xba,
-0x2,
-0xc3,
-0x2,
-0xcf,
-0x2,
-0xdc,
-0x2,
-0xe1,
-0x2,
-0xf2,
-0x2,
-0xfe,
-0x2,
-0xb,
-0x3,
-0x17,
-0x3,
-0x22,
-0x3,
-0x2e,
-0x3,
-0x3b,
-0x3,
-0x43,
-0x3,
-0x51,
-0x3,
-0x5d,
-0x3,
-0x6a,
-0x3,
-0x75,
-0x3,
-0x7f,
-0x3,
-0x88,
-0x3,
-0x90,
-0x3,
-0x99,
-0x3,
-0xa1,
-0x3,
-0xb0,
-0x3,
-0xb5,
-0x3,
-0xc1,
-0x3,
-0xca,
-0x3,
-0xd1,
-0x3,
-0xdc,
-0x3,
-0xe1,
-0x3,
-0xed,
-0x3,
-0xf2,
-0x3,
-0xfe,
-0x3,
-0x2,
-0x4,
-0x9,
-0x4,
-0xe,
-0x4,
-0x16,
-0x4,
-0x1b,
-0x4,
-0x25,
-0x4,
-0x23,
-0x4,
-0x2d,
-0x4,
-0x32,
-0x4,
-0x3d,
-0x4,
-0x42,
-0x4,
-0x47,
-0x4,
-0x4b,
-0x4,
-0x4e,
-0x4,
-0x53,
-0x4,
-0x54,
-0x4,
-0x54,
-0x4,
-0x52,
-0x4,
-0x55,
-0x4,
-0x5c,
-0x4,
-0x56,
-0x4,
-0x55,
-0x4,
-0x59,
-0x4,
-0x56,
-0x4,
-0x5f,
-0x4,
-0x5f,
-0x4,
-0x66,
-0x4,
-0x62,
-0x4,
-0x69,
-0x4,
-0x6d,
-0x4,
-0x72,
-0x4,
-0x74,
-0x4,
-0x7d,
-0x4,
-0x7a,
-0x4,
-0x83,
-0x4,
-0x81,
-0x4,
-0x89,
-0x4,
-0x88,
-0x4,
-0x90,
-0x4,
-0x92,
-0x4,
-0x94,
-0x4,
-0x95,
-0x4,
-0x97,
-0x4,
-0x92,
-0x4,
-0x95,
-0x4,
-0x90,
-0x4,
-0x96,
-0x4,
-0x87,
-0x4,
-0x87,
-0x4,
-0x7e,
-0x4,
-0x7d,
-0x4,
-0x78,
-0x4,
-0x77,
-0x4,
-0x6e,
-0x4,
-0x69,
-0x4,
-0x5f,
-0x4,
-0x5d,
-0x4,
-0x59,
-0x4,
-0x55,
-0x4,
-0x4a,
-0x4,
-0x42,
-0x4,
-0x3f,
-0x4,
-0x33,
-0x4,
-0x2d,
-0x4,
-0x24,
-0x4,
-0x1c,
-0x4,
-0x18,
-0x4,
-0xd,
-0x4,
-0xa,
-0x4,
-0xff,
-0x3,
-0xfb,
-0x3,
-0xee,
-0x3,
-0xe5,
-0x3,
-0xdd,
-0x3,
-0xc9,
-0x3,
-0xc7,
-0x3,
-0xbc,
-0x3,
-0xb5,
-0x3,
-0xaa,
-0x3,
-0xa3,
-0x3,
-0x97,
-0x3,
-0x88,
-0x3,
-0x7d,
-0x3,
-0x72,
-0x3,
-0x6f,
-0x3,
-0x5a,
-0x3,
-0x57,
-0x3,
-0x4e,
-0x3,
-0x3d,
-0x3,
-0x36,
-0x3,
-0x2f,
-0x3,
-0x20,
-0x3,
-0x16,
-0x3,
-0x6,
-0x3,
-0xfe,
-0x2,
-0xf4,
-0x2,
-0xe5,
-0x2,
-0xda,
-0x2,
-0xcf,
-0x2,
-0xcb,
-0x2,
-0xc3,
-0x2,
-0xb9,
-0x2,
-0xac,
-0x2,
-0xa1,
-0x2,
-0x9a,
-0x2,
-0x8b,
-0x2,
-0x87,
-0x2,
-0x75,
-0x2,
-0x73,
-0x2,
-0x67,
-0x2,
-0x59,
-0x2,
-0x4f,
-0x2,
-0x3e,
-0x2,
-0x33,
-0x2,
-0x29,
-0x2,
-0x1a,
-0x2,
-0x10,
-0x2,
-0x3,
-0x2,
-0xfa,
-0x1,
-0xf0,
-0x1,
-0xe6,
-0x1,
-0xe0,
-0x1,
-0xdb,
-0x1,
-0xd3,
-0x1,
-0xc3,
-0x1,
-0xbf,
-0x1,
-0xb2,
-0x1,
-0xae,
-0x1,
-0xa1,
-0x1,
-0x94,
-0x1,
-0x8a,
-0x1,
-0x80,
-0x1,
-0x79,
-0x1,
-0x6c,
-0x1,
-0x65,
-0x1,
-0x58,
-0x1,
-0x51,
-0x1,
-0x45,
-0x1,
-0x45,
-0x1,
-0x35,
-0x1,
-0x36,
-0x1,
-0x30,
-0x1,
-0x2a,
-0x1,
-0x28,
-0x1,
-0x22,
-0x1,
-0x1c,
-0x1,
-0x13,
-0x1,
-0xd,
-0x1,
-0xe,
-0x1,
-0x9,
-0x1,
-0x7,
-0x1,
-0x1,
-0x1,
-0xfb,
-0x0,
-0xfa,
-0x0,
-0xf4,
-0x0,
-0xf9,
-0x0,
-0xef,
-0x0,
-0xf2,
-0x0,
-0xea,
-0x0,
-0xe4,
-0x0,
-0xe4,
-0x0,
-0xdc,
-0x0,
-0xdd,
-0x0,
-0xd4,
-0x0,
-0xd4,
-0x0,
-0xcc,
-0x0,
-0xc9,
-0x0,
-0xc6,
-0x0,
-0xc3,
-0x0,
-0xc3,
-0x0,
-0xba,
-0x0,
-0xb7,
-0x0,
-0xb1,
-0x0,
-0xaa,
-0x0,
-0xb0,
-0x0,
-0xa1,
-0x0,
-0xa1,
-0x0,
-0x9d,
-0x0,
-0x9c,
-0x0,
-0x9a,
-0x0,
-0x8d,
-0x0,
-0x8f,
-0x0,
-0x8f,
-0x0,
-0x8d,
-0x0,
-0x8c,
-0x0,
-0x87,
-0x0,
-0x86,
-0x0,
-0x86,
-0x0,
-0x8d,
-0x0,
-0x88,
-0x0,
-0x8c,
-0x0,
-0x8b,
-0x0,
-0x88,
-0x0,
-0x8d,
-0x0,
-0x86,
-0x0,
-0x87,
-0x0,
-0x8b,
-0x0,
-0x85,
-0x0,
-0x87,
-0x0,
-0x87,
-0x0,
-0x87,
-0x0,
-0x90,
-0x0,
-0x8d,
-0x0,
-0x93,
-0x0,
-0x91,
-0x0,
-0x99,
-0x0,
-0x95,
-0x0,
-0x95,
-0x0,
-0x93,
-0x0,
-0x98,
-0x0,
-0x97,
-0x0,
-0x99,
-0x0,
-0x99,
-0x0,
-0x9e,
-0x0,
-0x9e,
-0x0,
-0xa0,
-0x0,
-0x9e,
-0x0,
-0xa6,
-0x0,
-0xa6,
-0x0,
-0xa4,
-0x0,
-0xa5,
-0x0,
-0xa2,
-0x0,
-0xa5,
-0x0,
-0xa2,
-0x0,
-0xa2,
-0x0,
-0xa3,
-0x0,
-0x9d,
-0x0,
-0xa0,
-0x0,
-0xa2,
-0x0,
-0xa7,
-0x0,
-0xa6,
-0x0,
-0xa7,
-0x0,
-0xa7,
-0x0,
-0xa4,
-0x0,
-0xa1,
-0x0,
-0xa0,
-0x0,
-0xa1,
-0x0,
-0xa9,
-0x0,
-0xa9,
-0x0,
-0xb0,
-0x0,
-0xaa,
-0x0,
-0xad,
-0x0,
-0xaf,
-0x0,
-0xad,
-0x0,
-0xae,
-0x0,
-0xac,
-0x0,
-0xa8,
-0x0,
-0xab,
-0x0,
-0xab,
-0x0,
-0xad,
-0x0,
-0xac,
-0x0,
-0xa9,
-0x0,
-0xad,
-0x0,
-0xa9,
-0x0,
-0xa6,
-0x0,
-0xa3,
-0x0,
-0x9c,
-0x0,
-0x9c,
-0x0,
-0x9a,
-0x0,
-0x93,
-0x0,
-0x93,
-0x0,
-0x8d,
-0x0,
-0x8e,
-0x0,
-0x87,
-0x0,
-0x86,
-0x0,
-0x7f,
-0x0,
-0x80,
-0x0,
-0x79,
-0x0,
-0x77,
-0x0,
-0x78,
-0x0,
-0x7b,
-0x0,
-0x74,
-0x0,
-0x79,
-0x0,
-0x70,
-0x0,
-0x6d,
-0x0,
-0x68,
-0x0,
-0x69,
-0x0,
-0x64,
-0x0,
-0x63,
-0x0,
-0x5b,
-0x0,
-0x58,
-0x0,
-0x55,
-0x0,
-0x4e,
-0x0,
-0x4d,
-0x0,
-0x44,
-0x0,
-0x43,
-0x0,
-0x3b,
-0x0,
-0x33,
-0x0,
-0x31,
-0x0,
-0x2b,
-0x0,
-0x29,
-0x0,
-0x25,
-0x0,
-0x20,
-0x0,
-0x24,
-0x0,
-0x15,
-0x0,
-0x19,
-0x0,
-0xf,
-0x0,
-0x12,
-0x0,
-0xd,
-0x0,
-0x5,
-0x0,
-0x3,
-0x0,
-0xf7,
-0xff,
-0xf8,
-0xff,
-0xe9,
-0xff,
-0xe9,
-0xff,
-0xde,
-0xff,
-0xe1,
-0xff,
-0xd7,
-0xff,
-0xcd,
-0xff,
-0xcb,
-0xff,
-0xc5,
-0xff,
-0xc6,
-0xff,
-0xb7,
-0xff,
-0xb8,
-0xff,
-0xaf,
-0xff,
-0xb0,
-0xff,
-0xaa,
-0xff,
-0xa7,
-0xff,
-0xa7,
-0xff,
-0xa3,
-0xff,
-0x95,
-0xff,
-0x94,
-0xff,
-0x8d,
-0xff,
-0x8b,
-0xff,
-0x82,
-0xff,
-0x74,
-0xff,
-0x6e,
-0xff,
-0x60,
-0xff,
-0x5c,
-0xff,
-0x52,
-0xff,
-0x49,
-0xff,
-0x41,
-0xff,
-0x34,
-0xff,
-0x2c,
-0xff,
-0x25,
-0xff,
-0x1f,
-0xff,
-0x1a,
-0xff,
-0x17,
-0xff,
-0xe,
-0xff,
-0xc,
-0xff,
-0x1,
-0xff,
-0x6,
-0xff,
-0xfc,
-0xfe,
-0x0,
-0xff,
-0xfb,
-0xfe,
-0xfc,
-0xfe,
-0xf8,
-0xfe,
-0xf3,
-0xfe,
-0xed,
-0xfe,
-0xea,
-0xfe,
-0xdf,
-0xfe,
-0xe6,
-0xfe,
-0xda,
-0xfe,
-0xde,
-0xfe,
-0xcf,
-0xfe,
-0xd2,
-0xfe,
-0xc7,
-0xfe,
-0xd1,
-0xfe,
-0xc0,
-0xfe,
-0xc7,
-0xfe,
-0xb7,
-0xfe,
-0xb9,
-0xfe,
-0xb1,
-0xfe,
-0xad,
-0xfe,
-0xac,
-0xfe,
-0xa5,
-0xfe,
-0xa2,
-0xfe,
-0xa0,
-0xfe,
-0x98,
-0xfe,
-0x9b,
-0xfe,
-0x96,
-0xfe,
-0x91,
-0xfe,
-0x8d,
-0xfe,
-0x8f,
-0xfe,
-0x87,
-0xfe,
-0x82,
-0xfe,
-0x7c,
-0xfe,
-0x7b,
-0xfe,
-0x70,
-0xfe,
-0x74,
-0xfe,
-0x74,
-0xfe,
-0x71,
-0xfe,
-0x72,
-0xfe,
-0x64,
-0xfe,
-0x6d,
-0xfe,
-0x65,
-0xfe,
-0x6d,
-0xfe,
-0x68,
-0xfe,
-0x65,
-0xfe,
-0x67,
-0xfe,
-0x67,
-0xfe,
-0x6a,
-0xfe,
-0x68,
-0xfe,
-0x6b,
-0xfe,
-0x68,
-0xfe,
-0x66,
-0xfe,
-0x64,
-0xfe,
-0x62,
-0xfe,
-0x66,
-0xfe,
-0x69,
-0xfe,
-0x66,
-0xfe,
-0x6a,
-0xfe,
-0x68,
-0xfe,
-0x69,
-0xfe,
-0x68,
-0xfe,
-0x69,
-0xfe,
-0x69,
-0xfe,
-0x6a,
-0xfe,
-0x66,
-0xfe,
-0x68,
-0xfe,
-0x6e,
-0xfe,
-0x72,
-0xfe,
-0x7a,
-0xfe,
-0x7d,
-0xfe,
-0x7c,
-0xfe,
-0x7f,
-0xfe,
-0x7b,
-0xfe,
-0x82,
-0xfe,
-0x81,
-0xfe,
-0x83,
-0xfe,
-0x86,
-0xfe,
-0x8a,
-0xfe,
-0x8d,
-0xfe,
-0x8c,
-0xfe,
-0x8e,
-0xfe,
-0x94,
-0xfe,
-0x97,
-0xfe,
-0x95,
-0xfe,
-0x99,
-0xfe,
-0x98,
-0xfe,
-0x97,
-0xfe,
-0x9b,
-0xfe,
-0x9c,
-0xfe,
-0x9b,
-0xfe,
-0x9d,
-0xfe,
-0x99,
-0xfe,
-0x99,
-0xfe,
-0x9b,
-0xfe,
-0x9a,
-0xfe,
-0x98,
-0xfe,
-0x8d,
-0xfe,
-0x96,
-0xfe,
-0x92,
-0xfe,
-0x98,
-0xfe,
-0x96,
-0xfe,
-0x95,
-0xfe,
-0x94,
-0xfe,
-0x8d,
-0xfe,
-0x91,
-0xfe,
-0x8e,
-0xfe,
-0x93,
-0xfe,
-0x97,
-0xfe,
-0x97,
-0xfe,
-0x9a,
-0xfe,
-0x94,
-0xfe,
-0x9e,
-0xfe,
-0x97,
-0xfe,
-0x98,
-0xfe,
-0x94,
-0xfe,
-0x94,
-0xfe,
-0x8e,
-0xfe,
-0x8c,
-0xfe,
-0x86,
-0xfe,
-0x89,
-0xfe,
-0x88,
-0xfe,
-0x83,
-0xfe,
-0x82,
-0xfe,
-0x7f,
-0xfe,
-0x82,
-0xfe,
-0x7b,
-0xfe,
-0x7c,
-0xfe,
-0x7a,
-0xfe,
-0x7a,
-0xfe,
-0x75,
-0xfe,
-0x6e,
-0xfe,
-0x6f,
-0xfe,
-0x69,
-0xfe,
-0x6d,
-0xfe,
-0x61,
-0xfe,
-0x63,
-0xfe,
-0x5a,
-0xfe,
-0x5c,
-0xfe,
-0x54,
-0xfe,
-0x58,
-0xfe,
-0x52,
-0xfe,
-0x56,
-0xfe,
-0x4f,
-0xfe,
-0x52,
-0xfe,
-0x4f,
-0xfe,
-0x46,
-0xfe,
-0x3f,
-0xfe,
-0x45,
-0xfe,
-0x42,
-0xfe,
-0x49,
-0xfe,
-0x45,
-0xfe,
-0x4c,
-0xfe,
-0x42,
-0xfe,
-0x49,
-0xfe,
-0x44,
-0xfe,
-0x3f,
-0xfe,
-0x45,
-0xfe,
-0x42,
-0xfe,
-0x40,
-0xfe,
-0x41,
-0xfe,
-0x3b,
-0xfe,
-0x44,
-0xfe,
-0x39,
-0xfe,
-0x3e,
-0xfe,
-0x38,
-0xfe,
-0x38,
-0xfe,
-0x36,
-0xfe,
-0x36,
-0xfe,
-0x41,
-0xfe,
-0x3c,
-0xfe,
-0x3a,
-0xfe,
-0x34,
-0xfe,
-0x33,
-0xfe,
-0x34,
-0xfe,
-0x2e,
-0xfe,
-0x30,
-0xfe,
-0x29,
-0xfe,
-0x2c,
-0xfe,
-0x23,
-0xfe,
-0x1f,
-0xfe,
-0x22,
-0xfe,
-0x1a,
-0xfe,
-0x1b,
-0xfe,
-0x12,
-0xfe,
-0xf,
-0xfe,
-0x13,
-0xfe,
-0xf,
-0xfe,
-0x13,
-0xfe,
-0x10,
-0xfe,
-0x11,
-0xfe,
-0x14,
-0xfe,
-0x9,
-0xfe,
-0xe,
-0xfe,
-0x9,
-0xfe,
-0x7,
-0xfe,
-0xff,
-0xfd,
-0x4,
-0xfe,
-0xfd,
-0xfd,
-0xff,
-0xfd,
-0xf8,
-0xfd,
-0xf6,
-0xfd,
-0xe9,
-0xfd,
-0xea,
-0xfd,
-0xe9,
-0xfd,
-0xeb,
-0xfd,
-0xe7,
-0xfd,
-0xe7,
-0xfd,
-0xe8,
-0xfd,
-0xe8,
-0xfd,
-0xef,
-0xfd,
-0xeb,
-0xfd,
-0xf8,
-0xfd,
-0xf5,
-0xfd,
-0x3,
-0xfe,
-0x0,
-0xfe,
-0x5,
-0xfe,
-0x7,
-0xfe,
-0x8,
-0xfe,
-0xc,
-0xfe,
-0x12,
-0xfe,
-0x11,
-0xfe,
-0x13,
-0xfe,
-0x19,
-0xfe,
-0x19,
-0xfe,
-0x1a,
-0xfe,
-0x16,
-0xfe,
-0x23,
-0xfe,
-0x25,
-0xfe,
-0x2a,
-0xfe,
-0x2b,
-0xfe,
-0x33,
-0xfe,
-0x2e,
-0xfe,
-0x40,
-0xfe,
-0x42,
-0xfe,
-0x43,
-0xfe,
-0x49,
-0xfe,
-0x4d,
-0xfe,
-0x58,
-0xfe,
-0x5d,
-0xfe,
-0x64,
-0xfe,
-0x65,
-0xfe,
-0x6f,
-0xfe,
-0x75,
-0xfe,
-0x7f,
-0xfe,
-0x84,
-0xfe,
-0x8e,
-0xfe,
-0x96,
-0xfe,
-0xa5,
-0xfe,
-0xaf,
-0xfe,
-0xb7,
-0xfe,
-0xc1,
-0xfe,
-0xca,
-0xfe,
-0xd1,
-0xfe,
-0xdd,
-0xfe,
-0xe4,
-0xfe,
-0xf2,
-0xfe,
-0xf6,
-0xfe,
-0x0,
-0xff,
-0x10,
-0xff,
-0x15,
-0xff,
-0x24,
-0xff,
-0x28,
-0xff,
-0x3c,
-0xff,
-0x3d,
-0xff,
-0x4c,
-0xff,
-0x4d,
-0xff,
-0x5b,
-0xff,
-0x64,
-0xff,
-0x6c,
-0xff,
-0x74,
-0xff,
-0x7d,
-0xff,
-0x83,
-0xff,
-0x87,
-0xff,
-0x96,
-0xff,
-0x9a,
-0xff,
-0xa4,
-0xff,
-0xa3,
-0xff,
-0xb2,
-0xff,
-0xb3,
-0xff,
-0xbf,
-0xff,
-0xca,
-0xff,
-0xcf,
-0xff,
-0xd6,
-0xff,
-0xd9,
-0xff,
-0xe0,
-0xff,
-0xe8,
-0xff,
-0xed,
-0xff,
-0xf7,
-0xff,
-0xf3,
-0xff,
-0xfc,
-0xff,
-0x7,
-0x0,
-0xa,
-0x0,
-0x19,
-0x0,
-0x19,
-0x0,
-0x1d,
-0x0,
-0x23,
-0x0,
-0x28,
-0x0,
-0x31,
-0x0,
-0x33,
-0x0,
-0x41,
-0x0,
-0x44,
-0x0,
-0x4a,
-0x0,
-0x53,
-0x0,
-0x5a,
-0x0,
-0x65,
-0x0,
-0x67,
-0x0,
-0x6b,
-0x0,
-0x69,
-0x0,
-0x73,
-0x0,
-0x78,
-0x0,
-0x7f,
-0x0,
-0x7e,
-0x0,
-0x8d,
-0x0,
-0x90,
-0x0,
-0x93,
-0x0,
-0x9d,
-0x0,
-0x98,
-0x0,
-0xa2,
-0x0,
-0xa2,
-0x0,
-0xa5,
-0x0,
-0xac,
-0x0,
-0xb0,
-0x0,
-0xab,
-0x0,
-0xb0,
-0x0,
-0xad,
-0x0,
-0xb9,
-0x0,
-0xb3,
-0x0,
-0xbf,
-0x0,
-0xb8,
-0x0,
-0xb9,
-0x0,
-0xbb,
-0x0,
-0xc2,
-0x0,
-0xcb,
-0x0,
-0xcb,
-0x0,
-0xd1,
-0x0,
-0xd1,
-0x0,
-0xdc,
-0x0,
-0xd6,
-0x0,
-0xde,
-0x0,
-0xda,
-0x0,
-0xd8,
-0x0,
-0xe0,
-0x0,
-0xde,
-0x0,
-0xe2,
-0x0,
-0xe5,
-0x0,
-0xe2,
-0x0,
-0xe7,
-0x0,
-0xe4,
-0x0,
-0xea,
-0x0,
-0xe4,
-0x0,
-0xe6,
-0x0,
-0xe5,
-0x0,
-0xe5,
-0x0,
-0xea,
-0x0,
-0xe6,
-0x0,
-0xea,
-0x0,
-0xe4,
-0x0,
-0xec,
-0x0,
-0xe8,
-0x0,
-0xec,
-0x0,
-0xec,
-0x0,
-0xf3,
-0x0,
-0xee,
-0x0,
-0xf5,
-0x0,
-0xee,
-0x0,
-0xf5,
-0x0,
-0xf3,
-0x0,
-0xf5,
-0x0,
-0xf6,
-0x0,
-0xf1,
-0x0,
-0xf9,
-0x0,
-0xf8,
-0x0,
-0x2,
-0x1,
-0x0,
-0x1,
-0x1,
-0x1,
-0x1,
-0x1,
-0x3,
-0x1,
-0x6,
-0x1,
-0x3,
-0x1,
-0x4,
-0x1,
-0xe,
-0x1,
-0xb,
-0x1,
-0x12,
-0x1,
-0xd,
-0x1,
-0x12,
-0x1,
-0x11,
-0x1,
-0x14,
-0x1,
-0x14,
-0x1,
-0x13,
-0x1,
-0xf,
-0x1,
-0x10,
-0x1,
-0x9,
-0x1,
-0xd,
-0x1,
-0x7,
-0x1,
-0xa,
-0x1,
-0x8,
-0x1,
-0x6,
-0x1,
-0x3,
-0x1,
-0xfd,
-0x0,
-0x0,
-0x1,
-0xfd,
-0x0,
-0xf8,
-0x0,
-0xf3,
-0x0,
-0xed,
-0x0,
-0xea,
-0x0,
-0xec,
-0x0,
-0xe7,
-0x0,
-0xe9,
-0x0,
-0xe1,
-0x0,
-0xe0,
-0x0,
-0xdd,
-0x0,
-0xdd,
-0x0,
-0xdb,
-0x0,
-0xde,
-0x0,
-0xde,
-0x0,
-0xd9,
-0x0,
-0xdd,
-0x0,
-0xd2,
-0x0,
-0xdc,
-0x0,
-0xd9,
-0x0,
-0xde,
-0x0,
-0xdf,
-0x0,
-0xdb,
-0x0,
-0xdd,
-0x0,
-0xdb,
-0x0,
-0xe0,
-0x0,
-0xe1,
-0x0,
-0xde,
-0x0,
-0xe4,
-0x0,
-0xe6,
-0x0,
-0xe7,
-0x0,
-0xec,
-0x0,
-0xea,
-0x0,
-0xed,
-0x0,
-0xf1,
-0x0,
-0xf1,
-0x0,
-0xf6,
-0x0,
-0xed,
-0x0,
-0xf0,
-0x0,
-0xef,
-0x0,
-0xf1,
-0x0,
-0xf1,
-0x0,
-0xf1,
-0x0,
-0xeb,
-0x0,
-0xef,
-0x0,
-0xe5,
-0x0,
-0xe8,
-0x0,
-0xde,
-0x0,
-0xdf,
-0x0,
-0xd9,
-0x0,
-0xd4,
-0x0,
-0xd1,
-0x0,
-0xd3,
-0x0,
-0xcf,
-0x0,
-0xcf,
-0x0,
-0xc6,
-0x0,
-0xc7,
-0x0,
-0xb8,
-0x0,
-0xbc,
-0x0,
-0xb9,
-0x0,
-0xb2,
-0x0,
-0xb0,
-0x0,
-0xa8,
-0x0,
-0x9b,
-0x0,
-0x98,
-0x0,
-0x91,
-0x0,
-0x91,
-0x0,
-0x89,
-0x0,
-0x85,
-0x0,
-0x82,
-0x0,
-0x7c,
-0x0,
-0x7e,
-0x0,
-0x79,
-0x0,
-0x74,
-0x0,
-0x73,
-0x0,
-0x70,
-0x0,
-0x65,
-0x0,
-0x67,
-0x0,
-0x5d,
-0x0,
-0x60,
-0x0,
-0x5c,
-0x0,
-0x63,
-0x0,
-0x5b,
-0x0,
-0x60,
-0x0,
-0x61,
-0x0,
-0x5f,
-0x0,
-0x63,
-0x0,
-0x61,
-0x0,
-0x61,
-0x0,
-0x5c,
-0x0,
-0x5e,
-0x0,
-0x5e,
-0x0,
-0x5d,
-0x0,
-0x5d,
-0x0,
-0x60,
-0x0,
-0x5d,
-0x0,
-0x5d,
-0x0,
-0x5a,
-0x0,
-0x62,
-0x0,
-0x65,
-0x0,
-0x6a,
-0x0,
-0x6a,
-0x0,
-0x6a,
-0x0,
-0x68,
-0x0,
-0x69,
-0x0,
-0x6c,
-0x0,
-0x6a,
-0x0,
-0x6e,
-0x0,
-0x6d,
-0x0,
-0x6e,
-0x0,
-0x74,
-0x0,
-0x71,
-0x0,
-0x7b,
-0x0,
-0x78,
-0x0,
-0x7f,
-0x0,
-0x78,
-0x0,
-0x7f,
-0x0,
-0x7f,
-0x0,
-0x88,
-0x0,
-0x84,
-0x0,
-0x86,
-0x0,
-0x90,
-0x0,
-0x8b,
-0x0,
-0x96,
-0x0,
-0x92,
-0x0,
-0x8f,
-0x0,
-0x94,
-0x0,
-0x92,
-0x0,
-0x98,
-0x0,
-0x95,
-0x0,
-0x9a,
-0x0,
-0x98,
-0x0,
-0x9a,
-0x0,
-0x98,
-0x0,
-0x9c,
-0x0,
-0xa5,
-0x0,
-0xa8,
-0x0,
-0xae,
-0x0,
-0xaf,
-0x0,
-0xb9,
-0x0,
-0xbe,
-0x0,
-0xc5,
-0x0,
-0xc7,
-0x0,
-0xcb,
-0x0,
-0xce,
-0x0,
-0xd5,
-0x0,
-0xde,
-0x0,
-0xe3,
-0x0,
-0xe6,
-0x0,
-0xeb,
-0x0,
-0xee,
-0x0,
-0xf0,
-0x0,
-0xf8,
-0x0,
-0xfc,
-0x0,
-0xfa,
-0x0,
-0x6,
-0x1,
-0x5,
-0x1,
-0xb,
-0x1,
-0xe,
-0x1,
-0xf,
-0x1,
-0x15,
-0x1,
-0x17,
-0x1,
-0x1d,
-0x1,
-0x1d,
-0x1,
-0x27,
-0x1,
-0x26,
-0x1,
-0x2b,
-0x1,
-0x2a,
-0x1,
-0x2f,
-0x1,
-0x32,
-0x1,
-0x31,
-0x1,
-0x36,
-0x1,
-0x38,
-0x1,
-0x3a,
-0x1,
-0x3d,
-0x1,
-0x3c,
-0x1,
-0x41,
-0x1,
-0x44,
-0x1,
-0x4b,
-0x1,
-0x4c,
-0x1,
-0x4c,
-0x1,
-0x54,
-0x1,
-0x58,
-0x1,
-0x5f,
-0x1,
-0x66,
-0x1,
-0x68,
-0x1,
-0x6f,
-0x1,
-0x6d,
-0x1,
-0x72,
-0x1,
-0x6f,
-0x1,
-0x72,
-0x1,
-0x79,
-0x1,
-0x7d,
-0x1,
-0x80,
-0x1,
-0x7d,
-0x1,
-0x87,
-0x1,
-0x8b,
-0x1,
-0x8a,
-0x1,
-0x8d,
-0x1,
-0x87,
-0x1,
-0x8e,
-0x1,
-0x8d,
-0x1,
-0x8b,
-0x1,
-0x8c,
-0x1,
-0x90,
-0x1,
-0x93,
-0x1,
-0x91,
-0x1,
-0x95,
-0x1,
-0x93,
-0x1,
-0x98,
-0x1,
-0x90,
-0x1,
-0x97,
-0x1,
-0x90,
-0x1,
-0x93,
-0x1,
-0x96,
-0x1,
-0x93,
-0x1,
-0x92,
-0x1,
-0x90,
-0x1,
-0x8d,
-0x1,
-0x85,
-0x1,
-0x89,
-0x1,
-0x85,
-0x1,
-0x86,
-0x1,
-0x87,
-0x1,
-0x84,
-0x1,
-0x85,
-0x1,
-0x7f,
-0x1,
-0x81,
-0x1,
-0x79,
-0x1,
-0x7e,
-0x1,
-0x7b,
-0x1,
-0x76,
-0x1,
-0x72,
-0x1,
-0x6f,
-0x1,
-0x6a,
-0x1,
-0x66,
-0x1,
-0x64,
-0x1,
-0x5c,
-0x1,
-0x5d,
-0x1,
-0x59,
-0x1,
-0x52,
-0x1,
-0x50,
-0x1,
-0x4a,
-0x1,
-0x46,
-0x1,
-0x44,
-0x1,
-0x42,
-0x1,
-0x3b,
-0x1,
-0x37,
-0x1,
-0x30,
-0x1,
-0x27,
-0x1,
-0x20,
-0x1,
-0x19,
-0x1,
-0x14,
-0x1,
-0xb,
-0x1,
-0x6,
-0x1,
-0x2,
-0x1,
-0xf9,
-0x0,
-0xf5,
-0x0,
-0xeb,
-0x0,
-0xe4,
-0x0,
-0xdc,
-0x0,
-0xcf,
-0x0,
-0xcc,
-0x0,
-0xbe,
-0x0,
-0xb8,
-0x0,
-0xae,
-0x0,
-0xab,
-0x0,
-0xaa,
-0x0,
-0xa0,
-0x0,
-0x96,
-0x0,
-0x8e,
-0x0,
-0x88,
-0x0,
-0x84,
-0x0,
-0x7d,
-0x0,
-0x74,
-0x0,
-0x6e,
-0x0,
-0x68,
-0x0,
-0x66,
-0x0,
-0x5a,
-0x0,
-0x5a,
-0x0,
-0x4a,
-0x0,
-0x48,
-0x0,
-0x40,
-0x0,
-0x39,
-0x0,
-0x32,
-0x0,
-0x2e,
-0x0,
-0x28,
-0x0,
-0x1f,
-0x0,
-0x1d,
-0x0,
-0x17,
-0x0,
-0x11,
-0x0,
-0x8,
-0x0,
-0x4,
-0x0,
-0xfc,
-0xff,
-0xf5,
-0xff,
-0xf6,
-0xff,
-0xe4,
-0xff,
-0xe7,
-0xff,
-0xd6,
-0xff,
-0xd4,
-0xff,
-0xc8,
-0xff,
-0xc6,
-0xff,
-0xb0,
-0xff,
-0xa8,
-0xff,
-0x9a,
-0xff,
-0x97,
-0xff,
-0x95,
-0xff,
-0x8c,
-0xff,
-0x81,
-0xff,
-0x79,
-0xff,
-0x73,
-0xff,
-0x6d,
-0xff,
-0x61,
-0xff,
-0x64,
-0xff,
-0x57,
-0xff,
-0x54,
-0xff,
-0x48,
-0xff,
-0x43,
-0xff,
-0x40,
-0xff,
-0x33,
-0xff,
-0x32,
-0xff,
-0x22,
-0xff,
-0x24,
-0xff,
-0x1a,
-0xff,
-0x17,
-0xff,
-0x10,
-0xff,
-0x7,
-0xff,
-0x2,
-0xff,
-0xf9,
-0xfe,
-0xf4,
-0xfe,
-0xec,
-0xfe,
-0xeb,
-0xfe,
-0xde,
-0xfe,
-0xdb,
-0xfe,
-0xd5,
-0xfe,
-0xcd,
-0xfe,
-0xce,
-0xfe,
-0xc0,
-0xfe,
-0xc4,
-0xfe,
-0xbe,
-0xfe,
-0xbe,
-0xfe,
-0xb6,
-0xfe,
-0xae,
-0xfe,
-0xa8,
-0xfe,
-0xa1,
-0xfe,
-0x9e,
-0xfe,
-0x9b,
-0xfe,
-0x96,
-0xfe,
-0x90,
-0xfe,
-0x88,
-0xfe,
-0x84,
-0xfe,
-0x80,
-0xfe,
-0x75,
-0xfe,
-0x70,
-0xfe,
-0x6e,
-0xfe,
-0x66,
-0xfe,
-0x65,
-0xfe,
-0x5f,
-0xfe,
-0x66,
-0xfe,
-0x61,
-0xfe,
-0x60,
-0xfe,
-0x58,
-0xfe,
-0x59,
-0xfe,
-0x52,
-0xfe,
-0x4f,
-0xfe,
-0x50,
-0xfe,
-0x45,
-0xfe,
-0x49,
-0xfe,
-0x3d,
-0xfe,
-0x40,
-0xfe,
-0x3d,
-0xfe,
-0x40,
-0xfe,
-0x37,
-0xfe,
-0x37,
-0xfe,
-0x33,
-0xfe,
-0x36,
-0xfe,
-0x37,
-0xfe,
-0x36,
-0xfe,
-0x38,
-0xfe,
-0x3b,
-0xfe,
-0x3c,
-0xfe,
-0x3b,
-0xfe,
-0x42,
-0xfe,
-0x3e,
-0xfe,
-0x41,
-0xfe,
-0x45,
-0xfe,
-0x3d,
-0xfe,
-0x45,
-0xfe,
-0x42,
-0xfe,
-0x49,
-0xfe,
-0x52,
-0xfe,
-0x54,
-0xfe,
-0x58,
-0xfe,
-0x5c,
-0xfe,
-0x5a,
-0xfe,
-0x5c,
-0xfe,
-0x64,
-0xfe,
-0x6a,
-0xfe,
-0x6e,
-0xfe,
-0x6f,
-0xfe,
-0x76,
-0xfe,
-0x73,
-0xfe,
-0x79,
-0xfe,
-0x7d,
-0xfe,
-0x7d,
-0xfe,
-0x8a,
-0xfe,
-0x89,
-0xfe,
-0x95,
-0xfe,
-0x99,
-0xfe,
-0x9f,
-0xfe,
-0xa1,
-0xfe,
-0xa7,
-0xfe,
-0xac,
-0xfe,
-0xb2,
-0xfe,
-0xb4,
-0xfe,
-0xb7,
-0xfe,
-0xbd,
-0xfe,
-0xc2,
-0xfe,
-0xc8,
-0xfe,
-0xcd,
-0xfe,
-0xcf,
-0xfe,
-0xda,
-0xfe,
-0xdd,
-0xfe,
-0xea,
-0xfe,
-0xe8,
-0xfe,
-0xf1,
-0xfe,
-0xf8,
-0xfe,
-0xfb,
-0xfe,
-0x8,
-0xff,
-0xc,
-0xff,
-0x1a,
-0xff,
-0x20,
-0xff,
-0x2d,
-0xff,
-0x35,
-0xff,
-0x41,
-0xff,
-0x48,
-0xff,
-0x52,
-0xff,
-0x58,
-0xff,
-0x68,
-0xff,
-0x76,
-0xff,
-0x80,
-0xff,
-0x8c,
-0xff,
-0x93,
-0xff,
-0xa0,
-0xff,
-0xaa,
-0xff,
-0xba,
-0xff,
-0xc7,
-0xff,
-0xd1,
-0xff,
-0xd0,
-0xff,
-0xe4,
-0xff,
-0xe6,
-0xff,
-0xf3,
-0xff,
-0xf6,
-0xff,
-0xfa,
-0xff,
-0x2,
-0x0,
-0x8,
-0x0,
-0xa,
-0x0,
-0x13,
-0x0,
-0x1b,
-0x0,
-0x22,
-0x0,
-0x26,
-0x0,
-0x2b,
-0x0,
-0x2f,
-0x0,
-0x3a,
-0x0,
-0x39,
-0x0,
-0x3f,
-0x0,
-0x47,
-0x0,
-0x50,
-0x0,
-0x56,
-0x0,
-0x5e,
-0x0,
-0x66,
-0x0,
-0x66,
-0x0,
-0x70,
-0x0,
-0x73,
-0x0,
-0x7f,
-0x0,
-0x82,
-0x0,
-0x81,
-0x0,
-0x85,
-0x0,
-0x87,
-0x0,
-0x87,
-0x0,
-0x8a,
-0x0,
-0x90,
-0x0,
-0x96,
-0x0,
-0x99,
-0x0,
-0x97,
-0x0,
-0x9c,
-0x0,
-0x99,
-0x0,
-0x9d,
-0x0,
-0x9b,
-0x0,
-0x9b,
-0x0,
-0x98,
-0x0,
-0x9f,
-0x0,
-0x9e,
-0x0,
-0xa1,
-0x0,
-0xa1,
-0x0,
-0xab,
-0x0,
-0xa4,
-0x0,
-0xa4,
-0x0,
-0xa1,
-0x0,
-0x9e,
-0x0,
-0xa4,
-0x0,
-0x95,
-0x0,
-0x9a,
-0x0,
-0x99,
-0x0,
-0xa0,
-0x0,
-0x95,
-0x0,
-0x98,
-0x0,
-0x8f,
-0x0,
-0x93,
-0x0,
-0x95,
-0x0,
-0x90,
-0x0,
-0x8f,
-0x0,
-0x8e,
-0x0,
-0x8b,
-0x0,
-0x8b,
-0x0,
-0x84,
-0x0,
-0x89,
-0x0,
-0x83,
-0x0,
-0x7c,
-0x0,
-0x7a,
-0x0,
-0x7a,
-0x0,
-0x81,
-0x0,
-0x76,
-0x0,
-0x7a,
-0x0,
-0x72,
-0x0,
-0x75,
-0x0,
-0x6b,
-0x0,
-0x67,
-0x0,
-0x68,
-0x0,
-0x5f,
-0x0,
-0x5e,
-0x0,
-0x5a,
-0x0,
-0x53,
-0x0,
-0x51,
-0x0,
-0x4d,
-0x0,
-0x47,
-0x0,
-0x43,
-0x0,
-0x3a,
-0x0,
-0x3e,
-0x0,
-0x36,
-0x0,
-0x37,
-0x0,
-0x2f,
-0x0,
-0x28,
-0x0,
-0x24,
-0x0,
-0x21,
-0x0,
-0x16,
-0x0,
-0x16,
-0x0,
-0xa,
-0x0,
-0xd,
-0x0,
-0x2,
-0x0,
-0xfe,
-0xff,
-0xfc,
-0xff,
-0xfd,
-0xff,
-0x0,
-0x0,
-0xfe,
-0xff,
-0xf6,
-0xff,
-0xf4,
-0xff,
-0xee,
-0xff,
-0xed,
-0xff,
-0xe9,
-0xff,
-0xe8,
-0xff,
-0xe4,
-0xff,
-0xdf,
-0xff,
-0xdf,
-0xff,
-0xdd,
-0xff,
-0xd9,
-0xff,
-0xd6,
-0xff,
-0xd4,
-0xff,
-0xd2,
-0xff,
-0xd3,
-0xff,
-0xd3,
-0xff,
-0xd3,
-0xff,
-0xcd,
-0xff,
-0xce,
-0xff,
-0xc8,
-0xff,
-0xcc,
-0xff,
-0xc9,
-0xff,
-0xcc,
-0xff,
-0xc9,
-0xff,
-0xc8,
-0xff,
-0xc8,
-0xff,
-0xc7,
-0xff,
-0xc6,
-0xff,
-0xc0,
-0xff,
-0xc0,
-0xff,
-0xbe,
-0xff,
-0xbe,
-0xff,
-0xbd,
-0xff,
-0xb9,
-0xff,
-0xba,
-0xff,
-0xb5,
-0xff,
-0xb6,
-0xff,
-0xb8,
-0xff,
-0xba,
-0xff,
-0xbd,
-0xff,
-0xbc,
-0xff,
-0xb8,
-0xff,
-0xbe,
-0xff,
-0xc0,
-0xff,
-0xc2,
-0xff,
-0xc7,
-0xff,
-0xc9,
-0xff,
-0xc7,
-0xff,
-0xcb,
-0xff,
-0xcd,
-0xff,
-0xd3,
-0xff,
-0xd0,
-0xff,
-0xd8,
-0xff,
-0xd4,
-0xff,
-0xe3,
-0xff,
-0xe6,
-0xff,
-0xee,
-0xff,
-0xf4,
-0xff,
-0xf7,
-0xff,
-0xf3,
-0xff,
-0xfd,
-0xff,
-0xf8,
-0xff,
-0x0,
-0x0,
-0xfd,
-0xff,
-0xfc,
-0xff,
-0x5,
-0x0,
-0x4,
-0x0,
-0x4,
-0x0,
-0x5,
-0x0,
-0xfe,
-0xff,
-0x2,
-0x0,
-0x0,
-0x0,
-0x2,
-0x0,
-0x0,
-0x0,
-0x7,
-0x0,
-0x2,
-0x0,
-0xa,
-0x0,
-0x2,
-0x0,
-0x1,
-0x0,
-0x4,
-0x0,
-0xff,
-0xff,
-0x1,
-0x0,
-0x3,
-0x0,
-0x0,
-0x0,
-0x8,
-0x0,
-0x1,
-0x0,
-0x8,
-0x0,
-0x6,
-0x0,
-0x8,
-0x0,
-0x8,
-0x0,
-0x9,
-0x0,
-0x9,
-0x0,
-0x8,
-0x0,
-0x3,
-0x0,
-0xc,
-0x0,
-0x4,
-0x0,
-0xb,
-0x0,
-0x1,
-0x0,
-0x0,
-0x0,
-0xfe,
-0xff,
-0x7,
-0x0,
-0x5,
-0x0,
-0xa,
-0x0,
-0x9,
-0x0,
-0xe,
-0x0,
-0x10,
-0x0,
-0x18,
-0x0,
-0x11,
-0x0,
-0x16,
-0x0,
-0x19,
-0x0,
-0x22,
-0x0,
-0x28,
-0x0,
-0x2d,
-0x0,
-0x2f,
-0x0,
-0x30,
-0x0,
-0x30,
-0x0,
-0x36,
-0x0,
-0x32,
-0x0,
-0x37,
-0x0,
-0x37,
-0x0,
-0x3d,
-0x0,
-0x3c,
-0x0,
-0x3c,
-0x0,
-0x40,
-0x0,
-0x42,
-0x0,
-0x47,
-0x0,
-0x44,
-0x0,
-0x4a,
-0x0,
-0x4c,
-0x0,
-0x4f,
-0x0,
-0x4e,
-0x0,
-0x50,
-0x0,
-0x54,
-0x0,
-0x54,
-0x0,
-0x57,
-0x0,
-0x5a,
-0x0,
-0x5c,
-0x0,
-0x5e,
-0x0,
-0x62,
-0x0,
-0x66,
-0x0,
-0x68,
-0x0,
-0x6a,
-0x0,
-0x6c,
-0x0,
-0x6a,
-0x0,
-0x72,
-0x0,
-0x73,
-0x0,
-0x7c,
-0x0,
-0x7d,
-0x0,
-0x7c,
-0x0,
-0x7d,
-0x0,
-0x7c,
-0x0,
-0x7e,
-0x0,
-0x80,
-0x0,
-0x83,
-0x0,
-0x84,
-0x0,
-0x88,
-0x0,
-0x8f,
-0x0,
-0x8b,
-0x0,
-0x92,
-0x0,
-0x8a,
-0x0,
-0x8a,
-0x0,
-0x88,
-0x0,
-0x89,
-0x0,
-0x84,
-0x0,
-0x86,
-0x0,
-0x7f,
-0x0,
-0x88,
-0x0,
-0x82,
-0x0,
-0x84,
-0x0,
-0x80,
-0x0,
-0x84,
-0x0,
-0x88,
-0x0,
-0x7f,
-0x0,
-0x87,
-0x0,
-0x7d,
-0x0,
-0x7d,
-0x0,
-0x77,
-0x0,
-0x75,
-0x0,
-0x75,
-0x0,
-0x73,
-0x0,
-0x6e,
-0x0,
-0x70,
-0x0,
-0x68,
-0x0,
-0x6c,
-0x0,
-0x63,
-0x0,
-0x68,
-0x0,
-0x63,
-0x0,
-0x64,
-0x0,
-0x64,
-0x0,
-0x5c,
-0x0,
-0x61,
-0x0,
-0x54,
-0x0,
-0x58,
-0x0,
-0x54,
-0x0,
-0x4e,
-0x0,
-0x4d,
-0x0,
-0x40,
-0x0,
-0x3d,
-0x0,
-0x39,
-0x0,
-0x34,
-0x0,
-0x37,
-0x0,
-0x2d,
-0x0,
-0x2d,
-0x0,
-0x23,
-0x0,
-0x20,
-0x0,
-0x14,
-0x0,
-0xa,
-0x0,
-0x5,
-0x0,
-0x0,
-0x0,
-0xfc,
-0xff,
-0xf5,
-0xff,
-0xef,
-0xff,
-0xe2,
-0xff,
-0xdd,
-0xff,
-0xd4,
-0xff,
-0xd5,
-0xff,
-0xc8,
-0xff,
-0xc5,
-0xff,
-0xba,
-0xff,
-0xbb,
-0xff,
-0xa9,
-0xff,
-0xae,
-0xff,
-0xa3,
-0xff,
-0xa2,
-0xff,
-0x9c,
-0xff,
-0x94,
-0xff,
-0x91,
-0xff,
-0x8f,
-0xff,
-0x89,
-0xff,
-0x87,
-0xff,
-0x82,
-0xff,
-0x7d,
-0xff,
-0x76,
-0xff,
-0x6d,
-0xff,
-0x69,
-0xff,
-0x63,
-0xff,
-0x62,
-0xff,
-0x5c,
-0xff,
-0x5b,
-0xff,
-0x5a,
-0xff,
-0x55,
-0xff,
-0x56,
-0xff,
-0x4e,
-0xff,
-0x48,
-0xff,
-0x3d,
-0xff,
-0x38,
-0xff,
-0x3c,
-0xff,
-0x2f,
-0xff,
-0x33,
-0xff,
-0x2c,
-0xff,
-0x26,
-0xff,
-0x23,
-0xff,
-0x1f,
-0xff,
-0x16,
-0xff,
-0x11,
-0xff,
-0x11,
-0xff,
-0xb,
-0xff,
-0x8,
-0xff,
-0x0,
-0xff,
-0xfc,
-0xfe,
-0xf1,
-0xfe,
-0xe9,
-0xfe,
-0xe7,
-0xfe,
-0xd8,
-0xfe,
-0xd4,
-0xfe,
-0xca,
-0xfe,
-0xca,
-0xfe,
-0xb8,
-0xfe,
-0xb3,
-0xfe,
-0xac,
-0xfe,
-0xad,
-0xfe,
-0x9c,
-0xfe,
-0x9f,
-0xfe,
-0x93,
-0xfe,
-0x92,
-0xfe,
-0x85,
-0xfe,
-0x80,
-0xfe,
-0x77,
-0xfe,
-0x6f,
-0xfe,
-0x70,
-0xfe,
-0x65,
-0xfe,
-0x61,
-0xfe,
-0x5c,
-0xfe,
-0x57,
-0xfe,
-0x53,
-0xfe,
-0x4d,
-0xfe,
-0x4c,
-0xfe,
-0x46,
-0xfe,
-0x40,
-0xfe,
-0x3d,
-0xfe,
-0x36,
-0xfe,
-0x39,
-0xfe,
-0x34,
-0xfe,
-0x37,
-0xfe,
-0x32,
-0xfe,
-0x37,
-0xfe,
-0x36,
-0xfe,
-0x34,
-0xfe,
-0x34,
-0xfe,
-0x34,
-0xfe,
-0x2c,
-0xfe,
-0x35,
-0xfe,
-0x29,
-0xfe,
-0x2b,
-0xfe,
-0x21,
-0xfe,
-0x25,
-0xfe,
-0x20,
-0xfe,
-0x1c,
-0xfe,
-0x1c,
-0xfe,
-0x16,
-0xfe,
-0x16,
-0xfe,
-0x11,
-0xfe,
-0x15,
-0xfe,
-0x16,
-0xfe,
-0x15,
-0xfe,
-0x12,
-0xfe,
-0xf,
-0xfe,
-0x13,
-0xfe,
-0xf,
-0xfe,
-0x18,
-0xfe,
-0x14,
-0xfe,
-0x16,
-0xfe,
-0x15,
-0xfe,
-0x1c,
-0xfe,
-0x1a,
-0xfe,
-0x1e,
-0xfe,
-0x1f,
-0xfe,
-0x26,
-0xfe,
-0x26,
-0xfe,
-0x2f,
-0xfe,
-0x33,
-0xfe,
-0x38,
-0xfe,
-0x3a,
-0xfe,
-0x47,
-0xfe,
-0x4d,
-0xfe,
-0x52,
-0xfe,
-0x58,
-0xfe,
-0x60,
-0xfe,
-0x67,
-0xfe,
-0x77,
-0xfe,
-0x77,
-0xfe,
-0x87,
-0xfe,
-0x85,
-0xfe,
-0x96,
-0xfe,
-0xa1,
-0xfe,
-0xaa,
-0xfe,
-0xb6,
-0xfe,
-0xc4,
-0xfe,
-0xca,
-0xfe,
-0xd3,
-0xfe,
-0xd8,
-0xfe,
-0xe8,
-0xfe,
-0xf1,
-0xfe,
-0xfd,
-0xfe,
-0x5,
-0xff,
-0xf,
-0xff,
-0x14,
-0xff,
-0x26,
-0xff,
-0x29,
-0xff,
-0x3c,
-0xff,
-0x41,
-0xff,
-0x4f,
-0xff,
-0x56,
-0xff,
-0x5d,
-0xff,
-0x6a,
-0xff,
-0x75,
-0xff,
-0x7c,
-0xff,
-0x82,
-0xff,
-0x8c,
-0xff,
-0x95,
-0xff,
-0xa0,
-0xff,
-0xa8,
-0xff,
-0xb0,
-0xff,
-0xbf,
-0xff,
-0xc0,
-0xff,
-0xcb,
-0xff,
-0xd5,
-0xff,
-0xde,
-0xff,
-0xe7,
-0xff,
-0xf4,
-0xff,
-0xfc,
-0xff,
-0x8,
-0x0,
-0x10,
-0x0,
-0x1b,
-0x0,
-0x21,
-0x0,
-0x33,
-0x0,
-0x3f,
-0x0,
-0x4d,
-0x0,
-0x59,
-0x0,
-0x61,
-0x0,
-0x73,
-0x0,
-0x7f,
-0x0,
-0x90,
-0x0,
-0x96,
-0x0,
-0xa1,
-0x0,
-0xab,
-0x0,
-0xb8,
-0x0,
-0xc5,
-0x0,
-0xd1,
-0x0,
-0xdc,
-0x0,
-0xe6,
-0x0,
-0xec,
-0x0,
-0xf7,
-0x0,
-0x2,
-0x1,
-0xd,
-0x1,
-0x10,
-0x1,
-0x1b,
-0x1,
-0x1e,
-0x1,
-0x2f,
-0x1,
-0x2e,
-0x1,
-0x3c,
-0x1,
-0x3c,
-0x1,
-0x41,
-0x1,
-0x4b,
-0x1,
-0x50,
-0x1,
-0x5b,
-0x1,
-0x61,
-0x1,
-0x6a,
-0x1,
-0x73,
-0x1,
-0x78,
-0x1,
-0x7b,
-0x1,
-0x8e,
-0x1,
-0x8b,
-0x1,
-0x9b,
-0x1,
-0x98,
-0x1,
-0xa3,
-0x1,
-0xa7,
-0x1,
-0xb3,
-0x1,
-0xb7,
-0x1,
-0xc0,
-0x1,
-0xc8,
-0x1,
-0xd3,
-0x1,
-0xd7,
-0x1,
-0xe1,
-0x1,
-0xe7,
-0x1,
-0xef,
-0x1,
-0xef,
-0x1,
-0xf5,
-0x1,
-0xf8,
-0x1,
-0xff,
-0x1,
-0x8,
-0x2,
-0xc,
-0x2,
-0x13,
-0x2,
-0x18,
-0x2,
-0x22,
-0x2,
-0x20,
-0x2,
-0x25,
-0x2,
-0x25,
-0x2,
-0x29,
-0x2,
-0x2d,
-0x2,
-0x30,
-0x2,
-0x2b,
-0x2,
-0x2d,
-0x2,
-0x2f,
-0x2,
-0x2e,
-0x2,
-0x33,
-0x2,
-0x37,
-0x2,
-0x33,
-0x2,
-0x35,
-0x2,
-0x3a,
-0x2,
-0x40,
-0x2,
-0x40,
-0x2,
-0x40,
-0x2,
-0x3e,
-0x2,
-0x42,
-0x2,
-0x45,
-0x2,
-0x42,
-0x2,
-0x47,
-0x2,
-0x3f,
-0x2,
-0x3d,
-0x2,
-0x46,
-0x2,
-0x3b,
-0x2,
-0x3e,
-0x2,
-0x3c,
-0x2,
-0x38,
-0x2,
-0x36,
-0x2,
-0x2f,
-0x2,
-0x35,
-0x2,
-0x26,
-0x2,
-0x2b,
-0x2,
-0x1f,
-0x2,
-0x1f,
-0x2,
-0x12,
-0x2,
-0xe,
-0x2,
-0x3,
-0x2,
-0xfe,
-0x1,
-0xf6,
-0x1,
-0xe9,
-0x1,
-0xe5,
-0x1,
-0xd0,
-0x1,
-0xcc,
-0x1,
-0xbe,
-0x1,
-0xb9,
-0x1,
-0xa8,
-0x1,
-0x99,
-0x1,
-0x91,
-0x1,
-0x84,
-0x1,
-0x7f,
-0x1,
-0x7c,
-0x1,
-0x72,
-0x1,
-0x6a,
-0x1,
-0x59,
-0x1,
-0x4e,
-0x1,
-0x42,
-0x1,
-0x3a,
-0x1,
-0x2d,
-0x1,
-0x21,
-0x1,
-0x15,
-0x1,
-0xb,
-0x1,
-0xfe,
-0x0,
-0xec,
-0x0,
-0xe4,
-0x0,
-0xd2,
-0x0,
-0xcc,
-0x0,
-0xbf,
-0x0,
-0xb8,
-0x0,
-0xb2,
-0x0,
-0xa4,
-0x0,
-0xa3,
-0x0,
-0x95,
-0x0,
-0x8f,
-0x0,
-0x82,
-0x0,
-0x73,
-0x0,
-0x73,
-0x0,
-0x67,
-0x0,
-0x69,
-0x0,
-0x5e,
-0x0,
-0x5c,
-0x0,
-0x54,
-0x0,
-0x53,
-0x0,
-0x49,
-0x0,
-0x48,
-0x0,
-0x37,
-0x0,
-0x37,
-0x0,
-0x29,
-0x0,
-0x29,
-0x0,
-0x1f,
-0x0,
-0x1b,
-0x0,
-0x15,
-0x0,
-0x13,
-0x0,
-0x8,
-0x0,
-0x6,
-0x0,
-0xfb,
-0xff,
-0xf9,
-0xff,
-0xf1,
-0xff,
-0xf8,
-0xff,
-0xed,
-0xff,
-0xf0,
-0xff,
-0xea,
-0xff,
-0xe5,
-0xff,
-0xdf,
-0xff,
-0xe2,
-0xff,
-0xe1,
-0xff,
-0xdd,
-0xff,
-0xde,
-0xff,
-0xda,
-0xff,
-0xdc,
-0xff,
-0xd9,
-0xff,
-0xd4,
-0xff,
-0xda,
-0xff,
-0xd6,
-0xff,
-0xde,
-0xff,
-0xd4,
-0xff,
-0xd6,
-0xff,
-0xce,
-0xff,
-0xd0,
-0xff,
-0xd0,
-0xff,
-0xd2,
-0xff,
-0xd2,
-0xff,
-0xce,
-0xff,
-0xc7,
-0xff,
-0xc3,
-0xff,
-0xc0,
-0xff,
-0xc2,
-0xff,
-0xbf,
-0xff,
-0xc1,
-0xff,
-0xc1,
-0xff,
-0xc0,
-0xff,
-0xc1,
-0xff,
-0xc4,
-0xff,
-0xc9,
-0xff,
-0xc6,
-0xff,
-0xcf,
-0xff,
-0xc6,
-0xff,
-0xd4,
-0xff,
-0xcc,
-0xff,
-0xd7,
-0xff,
-0xd0,
-0xff,
-0xdc,
-0xff,
-0xdf,
-0xff,
-0xe6,
-0xff,
-0xec,
-0xff,
-0xeb,
-0xff,
-0xf3,
-0xff,
-0xf4,
-0xff,
-0x1,
-0x0,
-0x7,
-0x0,
-0x12,
-0x0,
-0xf,
-0x0,
-0x16,
-0x0,
-0x1c,
-0x0,
-0x21,
-0x0,
-0x21,
-0x0,
-0x25,
-0x0,
-0x29,
-0x0,
-0x27,
-0x0,
-0x2b,
-0x0,
-0x32,
-0x0,
-0x32,
-0x0,
-0x38,
-0x0,
-0x30,
-0x0,
-0x3b,
-0x0,
-0x3c,
-0x0,
-0x45,
-0x0,
-0x4a,
-0x0,
-0x47,
-0x0,
-0x52,
-0x0,
-0x56,
-0x0,
-0x5e,
-0x0,
-0x61,
-0x0,
-0x69,
-0x0,
-0x66,
-0x0,
-0x72,
-0x0,
-0x6f,
-0x0,
-0x7d,
-0x0,
-0x7a,
-0x0,
-0x82,
-0x0,
-0x86,
-0x0,
-0x8e,
-0x0,
-0x93,
-0x0,
-0x9d,
-0x0,
-0xa2,
-0x0,
-0xa0,
-0x0,
-0xa6,
-0x0,
-0xa6,
-0x0,
-0xad,
-0x0,
-0xa9,
-0x0,
-0xb2,
-0x0,
-0xb2,
-0x0,
-0xb9,
-0x0,
-0xb2,
-0x0,
-0xbc,
-0x0,
-0xb6,
-0x0,
-0xbc,
-0x0,
-0xbb,
-0x0,
-0xb9,
-0x0,
-0xbe,
-0x0,
-0xc0,
-0x0,
-0xbd,
-0x0,
-0xbf,
-0x0,
-0xc5,
-0x0,
-0xc5,
-0x0,
-0xc9,
-0x0,
-0xc7,
-0x0,
-0xca,
-0x0,
-0xcd,
-0x0,
-0xd1,
-0x0,
-0xcf,
-0x0,
-0xd6,
-0x0,
-0xd1,
-0x0,
-0xd4,
-0x0,
-0xcc,
-0x0,
-0xd5,
-0x0,
-0xcb,
-0x0,
-0xd0,
-0x0,
-0xc9,
-0x0,
-0xc6,
-0x0,
-0xcb,
-0x0,
-0xc7,
-0x0,
-0xc9,
-0x0,
-0xc8,
-0x0,
-0xcb,
-0x0,
-0xce,
-0x0,
-0xcb,
-0x0,
-0xcf,
-0x0,
-0xcf,
-0x0,
-0xd3,
-0x0,
-0xd3,
-0x0,
-0xd0,
-0x0,
-0xd3,
-0x0,
-0xd2,
-0x0,
-0xd4,
-0x0,
-0xd2,
-0x0,
-0xcb,
-0x0,
-0xd3,
-0x0,
-0xce,
-0x0,
-0xcd,
-0x0,
-0xcf,
-0x0,
-0xd1,
-0x0,
-0xce,
-0x0,
-0xca,
-0x0,
-0xcd,
-0x0,
-0xcb,
-0x0,
-0xc7,
-0x0,
-0xc4,
-0x0,
-0xc6,
-0x0,
-0xc3,
-0x0,
-0xbf,
-0x0,
-0xbd,
-0x0,
-0xbb,
-0x0,
-0xb6,
-0x0,
-0xb2,
-0x0,
-0xad,
-0x0,
-0xa9,
-0x0,
-0xa9,
-0x0,
-0x9f,
-0x0,
-0x97,
-0x0,
-0x91,
-0x0,
-0x8d,
-0x0,
-0x8a,
-0x0,
-0x82,
-0x0,
-0x89,
-0x0,
-0x83,
-0x0,
-0x81,
-0x0,
-0x7a,
-0x0,
-0x79,
-0x0,
-0x72,
-0x0,
-0x76,
-0x0,
-0x6b,
-0x0,
-0x6a,
-0x0,
-0x66,
-0x0,
-0x60,
-0x0,
-0x5c,
-0x0,
-0x57,
-0x0,
-0x4b,
-0x0,
-0x49,
-0x0,
-0x48,
-0x0,
-0x3a,
-0x0,
-0x3a,
-0x0,
-0x34,
-0x0,
-0x31,
-0x0,
-0x2c,
-0x0,
-0x24,
-0x0,
-0x1f,
-0x0,
-0x17,
-0x0,
-0x18,
-0x0,
-0x13,
-0x0,
-0x11,
-0x0,
-0xa,
-0x0,
-0x7,
-0x0,
-0x1,
-0x0,
-0x1,
-0x0,
-0xf7,
-0xff,
-0xfe,
-0xff,
-0xf4,
-0xff,
-0xf0,
-0xff,
-0xef,
-0xff,
-0xe9,
-0xff,
-0xe8,
-0xff,
-0xe2,
-0xff,
-0xe7,
-0xff,
-0xe3,
-0xff,
-0xe2,
-0xff,
-0xde,
-0xff,
-0xe1,
-0xff,
-0xe2,
-0xff,
-0xe0,
-0xff,
-0xda,
-0xff,
-0xd4,
-0xff,
-0xd0,
-0xff,
-0xcb,
-0xff,
-0xcc,
-0xff,
-0xc3,
-0xff,
-0xc4,
-0xff,
-0xbd,
-0xff,
-0xbb,
-0xff,
-0xb2,
-0xff,
-0xa8,
-0xff,
-0xa5,
-0xff,
-0xa0,
-0xff,
-0x97,
-0xff,
-0x92,
-0xff,
-0x88,
-0xff,
-0x81,
-0xff,
-0x7d,
-0xff,
-0x78,
-0xff,
-0x74,
-0xff,
-0x6e,
-0xff,
-0x6c,
-0xff,
-0x62,
-0xff,
-0x65,
-0xff,
-0x58,
-0xff,
-0x5c,
-0xff,
-0x51,
-0xff,
-0x59,
-0xff,
-0x52,
-0xff,
-0x51,
-0xff,
-0x4a,
-0xff,
-0x42,
-0xff,
-0x45,
-0xff,
-0x3d,
-0xff,
-0x3d,
-0xff,
-0x34,
-0xff,
-0x31,
-0xff,
-0x2b,
-0xff,
-0x29,
-0xff,
-0x29,
-0xff,
-0x25,
-0xff,
-0x29,
-0xff,
-0x1e,
-0xff,
-0x18,
-0xff,
-0x14,
-0xff,
-0xf,
-0xff,
-0x13,
-0xff,
-0x11,
-0xff,
-0x14,
-0xff,
-0x12,
-0xff,
-0x11,
-0xff,
-0x12,
-0xff,
-0x11,
-0xff,
-0x10,
-0xff,
-0xd,
-0xff,
-0x8,
-0xff,
-0xb,
-0xff,
-0x1,
-0xff,
-0xc,
-0xff,
-0x4,
-0xff,
-0xff,
-0xfe,
-0x0,
-0xff,
-0xfb,
-0xfe,
-0xfd,
-0xfe,
-0xf7,
-0xfe,
-0xf2,
-0xfe,
-0xec,
-0xfe,
-0xf0,
-0xfe,
-0xe7,
-0xfe,
-0xe8,
-0xfe,
-0xe3,
-0xfe,
-0xdf,
-0xfe,
-0xdf,
-0xfe,
-0xd9,
-0xfe,
-0xdb,
-0xfe,
-0xd4,
-0xfe,
-0xd6,
-0xfe,
-0xd7,
-0xfe,
-0xd7,
-0xfe,
-0xd2,
-0xfe,
-0xd2,
-0xfe,
-0xce,
-0xfe,
-0xce,
-0xfe,
-0xcb,
-0xfe,
-0xcc,
-0xfe,
-0xc5,
-0xfe,
-0xc6,
-0xfe,
-0xc6,
-0xfe,
-0xc7,
-0xfe,
-0xc5,
-0xfe,
-0xc2,
-0xfe,
-0xc0,
-0xfe,
-0xc1,
-0xfe,
-0xc6,
-0xfe,
-0xc6,
-0xfe,
-0xcb,
-0xfe,
-0xc6,
-0xfe,
-0xd0,
-0xfe,
-0xc7,
-0xfe,
-0xd1,
-0xfe,
-0xd5,
-0xfe,
-0xd4,
-0xfe,
-0xdb,
-0xfe,
-0xd0,
-0xfe,
-0xd0,
-0xfe,
-0xd6,
-0xfe,
-0xdb,
-0xfe,
-0xd6,
-0xfe,
-0xdb,
-0xfe,
-0xd4,
-0xfe,
-0xd9,
-0xfe,
-0xde,
-0xfe,
-0xde,
-0xfe,
-0xe3,
-0xfe,
-0xdd,
-0xfe,
-0xe8,
-0xfe,
-0xe2,
-0xfe,
-0xea,
-0xfe,
-0xe9,
-0xfe,
-0xe8,
-0xfe,
-0xef,
-0xfe,
-0xee,
-0xfe,
-0xee,
-0xfe,
-0xec,
-0xfe,
-0xf4,
-0xfe,
-0xf0,
-0xfe,
-0xf6,
-0xfe,
-0xf3,
-0xfe,
-0xf4,
-0xfe,
-0xf7,
-0xfe,
-0xf6,
-0xfe,
-0xfe,
-0xfe,
-0xfd,
-0xfe,
-0x0,
-0xff,
-0x7,
-0xff,
-0xa,
-0xff,
-0x11,
-0xff,
-0x12,
-0xff,
-0x10,
-0xff,
-0x14,
-0xff,
-0x10,
-0xff,
-0x16,
-0xff,
-0x18,
-0xff,
-0x14,
-0xff,
-0x1d,
-0xff,
-0x1d,
-0xff,
-0x18,
-0xff,
-0x19,
-0xff,
-0x15,
-0xff,
-0x1b,
-0xff,
-0x1d,
-0xff,
-0x1c,
-0xff,
-0x1c,
-0xff,
-0x1d,
-0xff,
-0x25,
-0xff,
-0x26,
-0xff,
-0x31,
-0xff,
-0x2a,
-0xff,
-0x2f,
-0xff,
-0x38,
-0xff,
-0x3c,
-0xff,
-0x42,
-0xff,
-0x45,
-0xff,
-0x3f,
-0xff,
-0x45,
-0xff,
-0x43,
-0xff,
-0x4b,
-0xff,
-0x41,
-0xff,
-0x4d,
-0xff,
-0x4c,
-0xff,
-0x50,
-0xff,
-0x57,
-0xff,
-0x5b,
-0xff,
-0x5c,
-0xff,
-0x5e,
-0xff,
-0x60,
-0xff,
-0x65,
-0xff,
-0x64,
-0xff,
-0x6b,
-0xff,
-0x68,
-0xff,
-0x6c,
-0xff,
-0x6e,
-0xff,
-0x6f,
-0xff,
-0x6d,
-0xff,
-0x6f,
-0xff,
-0x6f,
-0xff,
-0x6f,
-0xff,
-0x6f,
-0xff,
-0x74,
-0xff,
-0x70,
-0xff,
-0x72,
-0xff,
-0x73,
-0xff,
-0x6f,
-0xff,
-0x74,
-0xff,
-0x7d,
-0xff,
-0x7b,
-0xff,
-0x7f,
-0xff,
-0x82,
-0xff,
-0x84,
-0xff,
-0x86,
-0xff,
-0x8f,
-0xff,
-0x8e,
-0xff,
-0x97,
-0xff,
-0x91,
-0xff,
-0x9e,
-0xff,
-0xa1,
-0xff,
-0xa7,
-0xff,
-0xae,
-0xff,
-0xad,
-0xff,
-0xb5,
-0xff,
-0xae,
-0xff,
-0xb5,
-0xff,
-0xb2,
-0xff,
-0xba,
-0xff,
-0xbd,
-0xff,
-0xbf,
-0xff,
-0xc6,
-0xff,
-0xcb,
-0xff,
-0xc8,
-0xff,
-0xca,
-0xff,
-0xcd,
-0xff,
-0xd3,
-0xff,
-0xd4,
-0xff,
-0xde,
-0xff,
-0xde,
-0xff,
-0xde,
-0xff,
-0xdf,
-0xff,
-0xe7,
-0xff,
-0xed,
-0xff,
-0xf2,
-0xff,
-0xf4,
-0xff,
-0xfb,
-0xff,
-0xf4,
-0xff,
-0xfe,
-0xff,
-0xfb,
-0xff,
-0xff,
-0xff,
-0xfc,
-0xff,
-0x6,
-0x0,
-0x2,
-0x0,
-0xe,
-0x0,
-0xa,
-0x0,
-0xc,
-0x0,
-0xc,
-0x0,
-0xf,
-0x0,
-0x16,
-0x0,
-0x16,
-0x0,
-0x19,
-0x0,
-0x10,
-0x0,
-0x15,
-0x0,
-0x10,
-0x0,
-0x18,
-0x0,
-0x17,
-0x0,
-0x14,
-0x0,
-0x12,
-0x0,
-0x10,
-0x0,
-0x11,
-0x0,
-0xe,
-0x0,
-0xa,
-0x0,
-0xd,
-0x0,
-0xf,
-0x0,
-0x12,
-0x0,
-0x10,
-0x0,
-0x11,
-0x0,
-0xb,
-0x0,
-0xf,
-0x0,
-0xa,
-0x0,
-0x9,
-0x0,
-0x8,
-0x0,
-0x9,
-0x0,
-0xe,
-0x0,
-0xf,
-0x0,
-0x12,
-0x0,
-0xc,
-0x0,
-0x10,
-0x0,
-0xb,
-0x0,
-0x11,
-0x0,
-0xf,
-0x0,
-0xd,
-0x0,
-0x10,
-0x0,
-0x12,
-0x0,
-0x16,
-0x0,
-0x16,
-0x0,
-0x17,
-0x0,
-0x12,
-0x0,
-0xf,
-0x0,
-0xd,
-0x0,
-0xd,
-0x0,
-0xd,
-0x0,
-0xe,
-0x0,
-0xd,
-0x0,
-0xf,
-0x0,
-0x9,
-0x0,
-0x9,
-0x0,
-0xa,
-0x0,
-0x7,
-0x0,
-0x6,
-0x0,
-0x4,
-0x0,
-0x2,
-0x0,
-0xff,
-0xff,
-0xf9,
-0xff,
-0x1,
-0x0,
-0xfe,
-0xff,
-0x2,
-0x0,
-0x3,
-0x0,
-0xff,
-0xff,
-0xb,
-0x0,
-0x3,
-0x0,
-0x9,
-0x0,
-0xa,
-0x0,
-0xc,
-0x0,
-0xa,
-0x0,
-0xa,
-0x0,
-0xb,
-0x0,
-0xb,
-0x0,
-0xf,
-0x0,
-0x9,
-0x0,
-0xd,
-0x0,
-0x7,
-0x0,
-0x7,
-0x0,
-0x4,
-0x0,
-0x3,
-0x0,
-0x6,
-0x0,
-0x2,
-0x0,
-0xff,
-0xff,
-0x4,
-0x0,
-0xfe,
-0xff,
-0x0,
-0x0,
-0xfc,
-0xff,
-0xf8,
-0xff,
-0xf4,
-0xff,
-0xfa,
-0xff,
-0xf5,
-0xff,
-0xf8,
-0xff,
-0xfd,
-0xff,
-0xfa,
-0xff,
-0xff,
-0xff,
-0xfe,
-0xff,
-0x4,
-0x0,
-0x0,
-0x0,
-0x6,
-0x0,
-0x2,
-0x0,
-0xfa,
-0xff,
-0x0,
-0x0,
-0xf9,
-0xff,
-0xfd,
-0xff,
-0xfb,
-0xff,
-0xf8,
-0xff,
-0xf7,
-0xff,
-0xf6,
-0xff,
-0xfc,
-0xff,
-0xf7,
-0xff,
-0xfb,
-0xff,
-0xf8,
-0xff,
-0xfa,
-0xff,
-0xf8,
-0xff,
-0x1,
-0x0,
-0xfd,
-0xff,
-0x3,
-0x0,
-0xff,
-0xff,
-0x5,
-0x0,
-0x5,
-0x0,
-0x9,
-0x0,
-0xe,
-0x0,
-0xe,
-0x0,
-0x16,
-0x0,
-0xf,
-0x0,
-0x1a,
-0x0,
-0x14,
-0x0,
-0x1e,
-0x0,
-0x1b,
-0x0,
-0x21,
-0x0,
-0x1c,
-0x0,
-0x21,
-0x0,
-0x26,
-0x0,
-0x22,
-0x0,
-0x2d,
-0x0,
-0x2a,
-0x0,
-0x2a,
-0x0,
-0x30,
-0x0,
-0x31,
-0x0,
-0x35,
-0x0,
-0x38,
-0x0,
-0x3a,
-0x0,
-0x3c,
-0x0,
-0x3b,
-0x0,
-0x42,
-0x0,
-0x42,
-0x0,
-0x4c,
-0x0,
-0x50,
-0x0,
-0x4f,
-0x0,
-0x51,
-0x0,
-0x58,
-0x0,
-0x57,
-0x0,
-0x63,
-0x0,
-0x5c,
-0x0,
-0x67,
-0x0,
-0x68,
-0x0,
-0x72,
-0x0,
-0x75,
-0x0,
-0x78,
-0x0,
-0x7c,
-0x0,
-0x7b,
-0x0,
-0x7e,
-0x0,
-0x81,
-0x0,
-0x89,
-0x0,
-0x8c,
-0x0,
-0x8c,
-0x0,
-0x8d,
-0x0,
-0x93,
-0x0,
-0x9d,
-0x0,
-0x9c,
-0x0,
-0xa4,
-0x0,
-0xa0,
-0x0,
-0xa6,
-0x0,
-0xa0,
-0x0,
-0xa7,
-0x0,
-0xa6,
-0x0,
-0xa5,
-0x0,
-0xa8,
-0x0,
-0xa5,
-0x0,
-0xb0,
-0x0,
-0xa7,
-0x0,
-0xae,
-0x0,
-0xa5,
-0x0,
-0xaf,
-0x0,
-0xad,
-0x0,
-0xb1,
-0x0,
-0xb3,
-0x0,
-0xb6,
-0x0,
-0xb5,
-0x0,
-0xb3,
-0x0,
-0xb6,
-0x0,
-0xb8,
-0x0,
-0xba,
-0x0,
-0xc3,
-0x0,
-0xc0,
-0x0,
-0xc7,
-0x0,
-0xc7,
-0x0,
-0xc8,
-0x0,
-0xcb,
-0x0,
-0xcc,
-0x0,
-0xca,
-0x0,
-0xca,
-0x0,
-0xce,
-0x0,
-0xcf,
-0x0,
-0xcc,
-0x0,
-0xca,
-0x0,
-0xcf,
-0x0,
-0xd1,
-0x0,
-0xd4,
-0x0,
-0xd5,
-0x0,
-0xd5,
-0x0,
-0xd7,
-0x0,
-0xd9,
-0x0,
-0xd8,
-0x0,
-0xd7,
-0x0,
-0xd3,
-0x0,
-0xd3,
-0x0,
-0xd7,
-0x0,
-0xd6,
-0x0,
-0xd8,
-0x0,
-0xd9,
-0x0,
-0xd4,
-0x0,
-0xd0,
-0x0,
-0xd4,
-0x0,
-0xd0,
-0x0,
-0xce,
-0x0,
-0xcd,
-0x0,
-0xcb,
-0x0,
-0xc7,
-0x0,
-0xc7,
-0x0,
-0xc3,
-0x0,
-0xbf,
-0x0,
-0xb9,
-0x0,
-0xb5,
-0x0,
-0xb6,
-0x0,
-0xac,
-0x0,
-0xab,
-0x0,
-0xa1,
-0x0,
-0x9f,
-0x0,
-0x9e,
-0x0,
-0xa0,
-0x0,
-0x94,
-0x0,
-0x97,
-0x0,
-0x94,
-0x0,
-0x96,
-0x0,
-0x91,
-0x0,
-0x8e,
-0x0,
-0x83,
-0x0,
-0x80,
-0x0,
-0x7d,
-0x0,
-0x79,
-0x0,
-0x79,
-0x0,
-0x6f,
-0x0,
-0x6c,
-0x0,
-0x68,
-0x0,
-0x63,
-0x0,
-0x5e,
-0x0,
-0x5a,
-0x0,
-0x4e,
-0x0,
-0x4b,
-0x0,
-0x46,
-0x0,
-0x43,
-0x0,
-0x40,
-0x0,
-0x3e,
-0x0,
-0x3c,
-0x0,
-0x3a,
-0x0,
-0x3d,
-0x0,
-0x37,
-0x0,
-0x38,
-0x0,
-0x2f,
-0x0,
-0x35,
-0x0,
-0x2c,
-0x0,
-0x31,
-0x0,
-0x26,
-0x0,
-0x29,
-0x0,
-0x20,
-0x0,
-0x1a,
-0x0,
-0x15,
-0x0,
-0xc,
-0x0,
-0xb,
-0x0,
-0x7,
-0x0,
-0x5,
-0x0,
-0x2,
-0x0,
-0x2,
-0x0,
-0x3,
-0x0,
-0xff,
-0xff,
-0xfe,
-0xff,
-0xfd,
-0xff,
-0xf5,
-0xff,
-0xf6,
-0xff,
-0xec,
-0xff,
-0xf4,
-0xff,
-0xe8,
-0xff,
-0xed,
-0xff,
-0xe9,
-0xff,
-0xeb,
-0xff,
-0xe9,
-0xff,
-0xea,
-0xff,
-0xe8,
-0xff,
-0xe6,
-0xff,
-0xe9,
-0xff,
-0xe3,
-0xff,
-0xeb,
-0xff,
-0xe7,
-0xff,
-0xe8,
-0xff,
-0xe6,
-0xff,
-0xe4,
-0xff,
-0xe6,
-0xff,
-0xe6,
-0xff,
-0xe7,
-0xff,
-0xea,
-0xff,
-0xe5,
-0xff,
-0xec,
-0xff,
-0xe5,
-0xff,
-0xe2,
-0xff,
-0xe1,
-0xff,
-0xe3,
-0xff,
-0xe4,
-0xff,
-0xe1,
-0xff,
-0xe7,
-0xff,
-0xdd,
-0xff,
-0xeb,
-0xff,
-0xdf,
-0xff,
-0xe3,
-0xff,
-0xdd,
-0xff,
-0xde,
-0xff,
-0xe3,
-0xff,
-0xdf,
-0xff,
-0xe0,
-0xff,
-0xe2,
-0xff,
-0xeb,
-0xff,
-0xeb,
-0xff,
-0xed,
-0xff,
-0xea,
-0xff,
-0xf2,
-0xff,
-0xed,
-0xff,
-0xfb,
-0xff,
-0xf7,
-0xff,
-0x0,
-0x0,
-0xfe,
-0xff,
-0x2,
-0x0,
-0x6,
-0x0,
-0xa,
-0x0,
-0xf,
-0x0,
-0x16,
-0x0,
-0x1c,
-0x0,
-0x20,
-0x0,
-0x1e,
-0x0,
-0x1f,
-0x0,
-0x21,
-0x0,
-0x29,
-0x0,
-0x2a,
-0x0,
-0x2b,
-0x0,
-0x29,
-0x0,
-0x33,
-0x0,
-0x2c,
-0x0,
-0x30,
-0x0,
-0x34,
-0x0,
-0x30,
-0x0,
-0x34,
-0x0,
-0x34,
-0x0,
-0x3a,
-0x0,
-0x33,
-0x0,
-0x3c,
-0x0,
-0x3d,
-0x0,
-0x40,
-0x0,
-0x3c,
-0x0,
-0x3f,
-0x0,
-0x45,
-0x0,
-0x45,
-0x0,
-0x49,
-0x0,
-0x47,
-0x0,
-0x4b,
-0x0,
-0x4d,
-0x0,
-0x4d,
-0x0,
-0x4e,
-0x0,
-0x51,
-0x0,
-0x57,
-0x0,
-0x57,
-0x0,
-0x5a,
-0x0,
-0x5e,
-0x0,
-0x61,
-0x0,
-0x69,
-0x0,
-0x69,
-0x0,
-0x6f,
-0x0,
-0x6e,
-0x0,
-0x78,
-0x0,
-0x78,
-0x0,
-0x7c,
-0x0,
-0x7d,
-0x0,
-0x83,
-0x0,
-0x84,
-0x0,
-0x85,
-0x0,
-0x8c,
-0x0,
-0x87,
-0x0,
-0x8f,
-0x0,
-0x8b,
-0x0,
-0x8a,
-0x0,
-0x84,
-0x0,
-0x87,
-0x0,
-0x86,
-0x0,
-0x82,
-0x0,
-0x82,
-0x0,
-0x7e,
-0x0,
-0x7f,
-0x0,
-0x7d,
-0x0,
-0x7c,
-0x0,
-0x79,
-0x0,
-0x77,
-0x0,
-0x72,
-0x0,
-0x76,
-0x0,
-0x6c,
-0x0,
-0x6e,
-0x0,
-0x5e,
-0x0,
-0x66,
-0x0,
-0x5b,
-0x0,
-0x60,
-0x0,
-0x5a,
-0x0,
-0x5c,
-0x0,
-0x55,
-0x0,
-0x54,
-0x0,
-0x4b,
-0x0,
-0x4c,
-0x0,
-0x49,
-0x0,
-0x4b,
-0x0,
-0x4c,
-0x0,
-0x46,
-0x0,
-0x43,
-0x0,
-0x3e,
-0x0,
-0x3e,
-0x0,
-0x3a,
-0x0,
-0x38,
-0x0,
-0x35,
-0x0,
-0x36,
-0x0,
-0x30,
-0x0,
-0x35,
-0x0,
-0x33,
-0x0,
-0x31,
-0x0,
-0x30,
-0x0,
-0x30,
-0x0,
-0x34,
-0x0,
-0x2f,
-0x0,
-0x34,
-0x0,
-0x31,
-0x0,
-0x34,
-0x0,
-0x2c,
-0x0,
-0x26,
-0x0,
-0x24,
-0x0,
-0x24,
-0x0,
-0x22,
-0x0,
-0x19,
-0x0,
-0x16,
-0x0,
-0xf,
-0x0,
-0xb,
-0x0,
-0x7,
-0x0,
-0x3,
-0x0,
-0x7,
-0x0,
-0xfc,
-0xff,
-0xfb,
-0xff,
-0xef,
-0xff,
-0xf4,
-0xff,
-0xec,
-0xff,
-0xf1,
-0xff,
-0xec,
-0xff,
-0xe5,
-0xff,
-0xe4,
-0xff,
-0xdf,
-0xff,
-0xe0,
-0xff,
-0xd7,
-0xff,
-0xde,
-0xff,
-0xd6,
-0xff,
-0xde,
-0xff,
-0xd6,
-0xff,
-0xd6,
-0xff,
-0xd4,
-0xff,
-0xd3,
-0xff,
-0xd2,
-0xff,
-0xd1,
-0xff,
-0xd6,
-0xff,
-0xd2,
-0xff,
-0xd1,
-0xff,
-0xd2,
-0xff,
-0xd4,
-0xff,
-0xd8,
-0xff,
-0xd7,
-0xff,
-0xd6,
-0xff,
-0xdc,
-0xff,
-0xd9,
-0xff,
-0xdc,
-0xff,
-0xd8,
-0xff,
-0xe2,
-0xff,
-0xda,
-0xff,
-0xe1,
-0xff,
-0xdd,
-0xff,
-0xe5,
-0xff,
-0xe1,
-0xff,
-0xe5,
-0xff,
-0xe5,
-0xff,
-0xe2,
-0xff,
-0xe4,
-0xff,
-0xe3,
-0xff,
-0xe7,
-0xff,
-0xed,
-0xff,
-0xef,
-0xff,
-0xee,
-0xff,
-0xef,
-0xff,
-0xf3,
-0xff,
-0xf3,
-0xff,
-0xf6,
-0xff,
-0xf5,
-0xff,
-0xfd,
-0xff,
-0xfa,
-0xff,
-0xff,
-0xff,
-0xfd,
-0xff,
-0xfe,
-0xff,
-0x1,
-0x0,
-0x1,
-0x0,
-0x8,
-0x0,
-0xb,
-0x0,
-0x13,
-0x0,
-0xf,
-0x0,
-0x15,
-0x0,
-0x1c,
-0x0,
-0x24,
-0x0,
-0x23,
-0x0,
-0x31,
-0x0,
-0x30,
-0x0,
-0x38,
-0x0,
-0x37,
-0x0,
-0x3d,
-0x0,
-0x39,
-0x0,
-0x41,
-0x0,
-0x47,
-0x0,
-0x4e,
-0x0,
-0x4d,
-0x0,
-0x50,
-0x0,
-0x4f,
-0x0,
-0x58,
-0x0,
-0x57,
-0x0,
-0x5c,
-0x0,
-0x5f,
-0x0,
-0x5e,
-0x0,
-0x6c,
-0x0,
-0x6a,
-0x0,
-0x6f,
-0x0,
-0x6e,
-0x0,
-0x7a,
-0x0,
-0x79,
-0x0,
-0x7f,
-0x0,
-0x82,
-0x0,
-0x83,
-0x0,
-0x8b,
-0x0,
-0x8a,
-0x0,
-0x93,
-0x0,
-0x8e,
-0x0,
-0x92,
-0x0,
-0x91,
-0x0,
-0x98,
-0x0,
-0x94,
-0x0,
-0x9d,
-0x0,
-0x9e,
-0x0,
-0x9f,
-0x0,
-0xa4,
-0x0,
-0x9e,
-0x0,
-0xa4,
-0x0,
-0xa2,
-0x0,
-0xa8,
-0x0,
-0xa9,
-0x0,
-0xb0,
-0x0,
-0xb3,
-0x0,
-0xb8,
-0x0,
-0xbe,
-0x0,
-0xc6,
-0x0,
-0xcc,
-0x0,
-0xd0,
-0x0,
-0xd8,
-0x0,
-0xdb,
-0x0,
-0xea,
-0x0,
-0xed,
-0x0,
-0xef,
-0x0,
-0xf9,
-0x0,
-0xfc,
-0x0,
-0xa,
-0x1,
-0xd,
-0x1,
-0x15,
-0x1,
-0xf,
-0x1,
-0x19,
-0x1,
-0x15,
-0x1,
-0x1f,
-0x1,
-0x1d,
-0x1,
-0x24,
-0x1,
-0x25,
-0x1,
-0x26,
-0x1,
-0x27,
-0x1,
-0x24,
-0x1,
-0x27,
-0x1,
-0x21,
-0x1,
-0x27,
-0x1,
-0x24,
-0x1,
-0x28,
-0x1,
-0x27,
-0x1,
-0x22,
-0x1,
-0x1d,
-0x1,
-0x1a,
-0x1,
-0x19,
-0x1,
-0x16,
-0x1,
-0x17,
-0x1,
-0x11,
-0x1,
-0xf,
-0x1,
-0xd,
-0x1,
-0x10,
-0x1,
-0xe,
-0x1,
-0xe,
-0x1,
-0x7,
-0x1,
-0x6,
-0x1,
-0x7,
-0x1,
-0x1,
-0x1,
-0x4,
-0x1,
-0x3,
-0x1,
-0xb,
-0x1,
-0x9,
-0x1,
-0xe,
-0x1,
-0x10,
-0x1,
-0xe,
-0x1,
-0x10,
-0x1,
-0x12,
-0x1,
-0x10,
-0x1,
-0x13,
-0x1,
-0x12,
-0x1,
-0x10,
-0x1,
-0xe,
-0x1,
-0x13,
-0x1,
-0xa,
-0x1,
-0x10,
-0x1,
-0x7,
-0x1,
-0x5,
-0x1,
-0xff,
-0x0,
-0xfd,
-0x0,
-0xf3,
-0x0,
-0xf1,
-0x0,
-0xe6,
-0x0,
-0xe4,
-0x0,
-0xd7,
-0x0,
-0xd5,
-0x0,
-0xce,
-0x0,
-0xce,
-0x0,
-0xc9,
-0x0,
-0xc6,
-0x0,
-0xc0,
-0x0,
-0xb3,
-0x0,
-0xb2,
-0x0,
-0xa6,
-0x0,
-0xa4,
-0x0,
-0x98,
-0x0,
-0x93,
-0x0,
-0x8f,
-0x0,
-0x80,
-0x0,
-0x7c,
-0x0,
-0x6b,
-0x0,
-0x69,
-0x0,
-0x5b,
-0x0,
-0x59,
-0x0,
-0x54,
-0x0,
-0x4e,
-0x0,
-0x4a,
-0x0,
-0x3e,
-0x0,
-0x36,
-0x0,
-0x2f,
-0x0,
-0x27,
-0x0,
-0x21,
-0x0,
-0x22,
-0x0,
-0x1a,
-0x0,
-0x1a,
-0x0,
-0x11,
-0x0,
-0xe,
-0x0,
-0xa,
-0x0,
-0x2,
-0x0,
-0xfb,
-0xff,
-0xf5,
-0xff,
-0xee,
-0xff,
-0xeb,
-0xff,
-0xe6,
-0xff,
-0xde,
-0xff,
-0xd2,
-0xff,
-0xd0,
-0xff,
-0xbf,
-0xff,
-0xb5,
-0xff,
-0xae,
-0xff,
-0xa3,
-0xff,
-0xa2,
-0xff,
-0x8e,
-0xff,
-0x8d,
-0xff,
-0x77,
-0xff,
-0x7a,
-0xff,
-0x6f,
-0xff,
-0x63,
-0xff,
-0x63,
-0xff,
-0x5a,
-0xff,
-0x59,
-0xff,
-0x50,
-0xff,
-0x4a,
-0xff,
-0x3f,
-0xff,
-0x41,
-0xff,
-0x34,
-0xff,
-0x30,
-0xff,
-0x20,
-0xff,
-0x20,
-0xff,
-0x16,
-0xff,
-0xd,
-0xff,
-0xa,
-0xff,
-0xfe,
-0xfe,
-0xfc,
-0xfe,
-0xef,
-0xfe,
-0xf2,
-0xfe,
-0xe3,
-0xfe,
-0xe4,
-0xfe,
-0xd6,
-0xfe,
-0xd7,
-0xfe,
-0xcc,
-0xfe,
-0xc5,
-0xfe,
-0xc5,
-0xfe,
-0xc1,
-0xfe,
-0xb6,
-0xfe,
-0xb7,
-0xfe,
-0xad,
-0xfe,
-0xb2,
-0xfe,
-0xa9,
-0xfe,
-0xa5,
-0xfe,
-0x9c,
-0xfe,
-0x99,
-0xfe,
-0x93,
-0xfe,
-0x8b,
-0xfe,
-0x84,
-0xfe,
-0x7c,
-0xfe,
-0x75,
-0xfe,
-0x79,
-0xfe,
-0x6e,
-0xfe,
-0x6e,
-0xfe,
-0x68,
-0xfe,
-0x61,
-0xfe,
-0x5b,
-0xfe,
-0x56,
-0xfe,
-0x52,
-0xfe,
-0x4e,
-0xfe,
-0x4a,
-0xfe,
-0x43,
-0xfe,
-0x44,
-0xfe,
-0x3e,
-0xfe,
-0x3a,
-0xfe,
-0x39,
-0xfe,
-0x36,
-0xfe,
-0x31,
-0xfe,
-0x2a,
-0xfe,
-0x25,
-0xfe,
-0x22,
-0xfe,
-0x1d,
-0xfe,
-0x19,
-0xfe,
-0x17,
-0xfe,
-0x12,
-0xfe,
-0x11,
-0xfe,
-0xc,
-0xfe,
-0xe,
-0xfe,
-0xd,
-0xfe,
-0x3,
-0xfe,
-0x3,
-0xfe,
-0xfd,
-0xfd,
-0xfe,
-0xfd,
-0xff,
-0xfd,
-0xf6,
-0xfd,
-0xf8,
-0xfd,
-0xf3,
-0xfd,
-0xef,
-0xfd,
-0xee,
-0xfd,
-0xef,
-0xfd,
-0xed,
-0xfd,
-0xf0,
-0xfd,
-0xea,
-0xfd,
-0xec,
-0xfd,
-0xe5,
-0xfd,
-0xe7,
-0xfd,
-0xe7,
-0xfd,
-0xe6,
-0xfd,
-0xe8,
-0xfd,
-0xe3,
-0xfd,
-0xe3,
-0xfd,
-0xe7,
-0xfd,
-0xe2,
-0xfd,
-0xe3,
-0xfd,
-0xdb,
-0xfd,
-0xe1,
-0xfd,
-0xda,
-0xfd,
-0xe2,
-0xfd,
-0xdb,
-0xfd,
-0xdd,
-0xfd,
-0xda,
-0xfd,
-0xd3,
-0xfd,
-0xd4,
-0xfd,
-0xd5,
-0xfd,
-0xd2,
-0xfd,
-0xdb,
-0xfd,
-0xd6,
-0xfd,
-0xd8,
-0xfd,
-0xd1,
-0xfd,
-0xd7,
-0xfd,
-0xd6,
-0xfd,
-0xd6,
-0xfd,
-0xd8,
-0xfd,
-0xd4,
-0xfd,
-0xe0,
-0xfd,
-0xdc,
-0xfd,
-0xe3,
-0xfd,
-0xe1,
-0xfd,
-0xef,
-0xfd,
-0xef,
-0xfd,
-0xf3,
-0xfd,
-0xf8,
-0xfd,
-0xf7,
-0xfd,
-0xfd,
-0xfd,
-0xf6,
-0xfd,
-0x7,
-0xfe,
-0xfd,
-0xfd,
-0x4,
-0xfe,
-0xfe,
-0xfd,
-0xfe,
-0xfd,
-0x0,
-0xfe,
-0xfa,
-0xfd,
-0xfb,
-0xfd,
-0xfd,
-0xfd,
-0x0,
-0xfe,
-0x2,
-0xfe,
-0x5,
-0xfe,
-0x2,
-0xfe,
-0xff,
-0xfd,
-0xfb,
-0xfd,
-0x7,
-0xfe,
-0x3,
-0xfe,
-0xb,
-0xfe,
-0xe,
-0xfe,
-0x17,
-0xfe,
-0x1a,
-0xfe,
-0x26,
-0xfe,
-0x25,
-0xfe,
-0x31,
-0xfe,
-0x32,
-0xfe,
-0x39,
-0xfe,
-0x3f,
-0xfe,
-0x47,
-0xfe,
-0x4c,
-0xfe,
-0x58,
-0xfe,
-0x59,
-0xfe,
-0x65,
-0xfe,
-0x65,
-0xfe,
-0x6b,
-0xfe,
-0x75,
-0xfe,
-0x7a,
-0xfe,
-0x7d,
-0xfe,
-0x85,
-0xfe,
-0x85,
-0xfe,
-0x94,
-0xfe,
-0x93,
-0xfe,
-0x9d,
-0xfe,
-0x9b,
-0xfe,
-0xa0,
-0xfe,
-0xac,
-0xfe,
-0xa9,
-0xfe,
-0xb2,
-0xfe,
-0xb0,
-0xfe,
-0xb9,
-0xfe,
-0xc1,
-0xfe,
-0xc5,
-0xfe,
-0xd5,
-0xfe,
-0xd4,
-0xfe,
-0xe1,
-0xfe,
-0xde,
-0xfe,
-0xed,
-0xfe,
-0xed,
-0xfe,
-0xfc,
-0xfe,
-0xfd,
-0xfe,
-0x2,
-0xff,
-0x8,
-0xff,
-0x13,
-0xff,
-0x17,
-0xff,
-0x1e,
-0xff,
-0x21,
-0xff,
-0x29,
-0xff,
-0x33,
-0xff,
-0x39,
-0xff,
-0x3d,
-0xff,
-0x4c,
-0xff,
-0x4d,
-0xff,
-0x58,
-0xff,
-0x62,
-0xff,
-0x66,
-0xff,
-0x6e,
-0xff,
-0x6d,
-0xff,
-0x78,
-0xff,
-0x7c,
-0xff,
-0x87,
-0xff,
-0x8d,
-0xff,
-0x9a,
-0xff,
-0x9a,
-0xff,
-0xa4,
-0xff,
-0xb4,
-0xff,
-0xb8,
-0xff,
-0xc4,
-0xff,
-0xca,
-0xff,
-0xd0,
-0xff,
-0xd7,
-0xff,
-0xde,
-0xff,
-0xe3,
-0xff,
-0xed,
-0xff,
-0xf1,
-0xff,
-0xff,
-0xff,
-0x5,
-0x0,
-0xb,
-0x0,
-0x16,
-0x0,
-0x15,
-0x0,
-0x23,
-0x0,
-0x26,
-0x0,
-0x33,
-0x0,
-0x37,
-0x0,
-0x3e,
-0x0,
-0x46,
-0x0,
-0x47,
-0x0,
-0x4a,
-0x0,
-0x58,
-0x0,
-0x53,
-0x0,
-0x61,
-0x0,
-0x5b,
-0x0,
-0x63,
-0x0,
-0x62,
-0x0,
-0x62,
-0x0,
-0x6a,
-0x0,
-0x63,
-0x0,
-0x67,
-0x0,
-0x62,
-0x0,
-0x63,
-0x0,
-0x64,
-0x0,
-0x67,
-0x0,
-0x67,
-0x0,
-0x67,
-0x0,
-0x6d,
-0x0,
-0x6f,
-0x0,
-0x6b,
-0x0,
-0x67,
-0x0,
-0x69,
-0x0,
-0x69,
-0x0,
-0x72,
-0x0,
-0x6e,
-0x0,
-0x74,
-0x0,
-0x71,
-0x0,
-0x72,
-0x0,
-0x75,
-0x0,
-0x7a,
-0x0,
-0x7c,
-0x0,
-0x82,
-0x0,
-0x7e,
-0x0,
-0x89,
-0x0,
-0x87,
-0x0,
-0x8a,
-0x0,
-0x8e,
-0x0,
-0x8c,
-0x0,
-0x8d,
-0x0,
-0x93,
-0x0,
-0x8b,
-0x0,
-0x92,
-0x0,
-0x8f,
-0x0,
-0x90,
-0x0,
-0x8e,
-0x0,
-0x8b,
-0x0,
-0x90,
-0x0,
-0x8d,
-0x0,
-0x92,
-0x0,
-0x8f,
-0x0,
-0x90,
-0x0,
-0x88,
-0x0,
-0x84,
-0x0,
-0x7b,
-0x0,
-0x7c,
-0x0,
-0x77,
-0x0,
-0x73,
-0x0,
-0x75,
-0x0,
-0x6b,
-0x0,
-0x70,
-0x0,
-0x69,
-0x0,
-0x67,
-0x0,
-0x65,
-0x0,
-0x6a,
-0x0,
-0x5d,
-0x0,
-0x60,
-0x0,
-0x5c,
-0x0,
-0x59,
-0x0,
-0x5b,
-0x0,
-0x57,
-0x0,
-0x56,
-0x0,
-0x58,
-0x0,
-0x56,
-0x0,
-0x54,
-0x0,
-0x4f,
-0x0,
-0x55,
-0x0,
-0x4e,
-0x0,
-0x50,
-0x0,
-0x47,
-0x0,
-0x4a,
-0x0,
-0x44,
-0x0,
-0x4c,
-0x0,
-0x43,
-0x0,
-0x3e,
-0x0,
-0x3b,
-0x0,
-0x39,
-0x0,
-0x3b,
-0x0,
-0x3a,
-0x0,
-0x3a,
-0x0,
-0x30,
-0x0,
-0x30,
-0x0,
-0x20,
-0x0,
-0x25,
-0x0,
-0x22,
-0x0,
-0x22,
-0x0,
-0x16,
-0x0,
-0x16,
-0x0,
-0x10,
-0x0,
-0x11,
-0x0,
-0x17,
-0x0,
-0xd,
-0x0,
-0x12,
-0x0,
-0xa,
-0x0,
-0xf,
-0x0,
-0xf,
-0x0,
-0xa,
-0x0,
-0xd,
-0x0,
-0x9,
-0x0,
-0xf,
-0x0,
-0xd,
-0x0,
-0x13,
-0x0,
-0x10,
-0x0,
-0x15,
-0x0,
-0x13,
-0x0,
-0x10,
-0x0,
-0x14,
-0x0,
-0x10,
-0x0,
-0x19,
-0x0
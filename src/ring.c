@@ -0,0 +1,188 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> mmap()able ring of PCM bytes, filled in the background.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h> // vmalloc_user
+#include <linux/wait.h>
+#include <linux/workqueue.h>
+#include <linux/poll.h>
+#include <linux/atomic.h>
+
+#include "devheart.h"
+#include "devheart_uapi.h"
+
+// interval in which the ring is topped up
+#define RING_REFILL_MS 20
+
+// ring shared with userspace and its producer
+struct devheart_ring_t {
+    void *area; // metadata page followed by the ring
+    struct devheart_ring_meta *meta;
+    char *data;
+    u64 producer;
+    struct devheart_sound_buffer_t *sound_buffer;
+    struct delayed_work refill; // runs while the ring is mapped somewhere
+    atomic_t mappings;
+    wait_queue_head_t wait;
+};
+
+static void ring_refill(struct work_struct *work) {
+    struct devheart_ring_t *ring = container_of(to_delayed_work(work), struct devheart_ring_t, refill);
+    struct devheart_sound_buffer_t *sound_buffer = ring->sound_buffer;
+    u64 consumer = smp_load_acquire(&ring->meta->consumer);
+    u64 producer = ring->producer;
+    size_t free, chunk, position;
+    const char *data;
+
+    // a bogus consumer index from userspace only stalls its own ring
+    free = DEVHEART_RING_SIZE - (size_t)(ring->producer - consumer);
+    if(free > DEVHEART_RING_SIZE) {
+        free = 0;
+    }
+    free = min(free, pace_available(&sound_buffer->pace));
+
+    mutex_lock(&sound_buffer->lock);
+    while(free) {
+        position = ring->producer & (DEVHEART_RING_SIZE - 1);
+        chunk = min3(free, heartbeat_span(sound_buffer, &data), DEVHEART_RING_SIZE - position);
+        memcpy(ring->data + position, data, chunk);
+
+        heartbeat_advance(sound_buffer, chunk);
+        pace_consume(&sound_buffer->pace, chunk);
+        ring->producer += chunk;
+        free -= chunk;
+    }
+    mutex_unlock(&sound_buffer->lock);
+
+    // publish the data before the index
+    smp_store_release(&ring->meta->producer, ring->producer);
+    stat_add(STAT_BYTES_SERVED, ring->producer - producer);
+
+    // only wake up consumers which asked for it, pairs with the barrier in ring_poll()
+    smp_mb();
+    if(READ_ONCE(ring->meta->flags) & DEVHEART_RING_NEED_WAKEUP) {
+        wake_up_interruptible(&ring->wait);
+    }
+
+    // nobody left to consume, the next mapping starts refilling again
+    if(atomic_read(&ring->mappings)) {
+        queue_delayed_work(system_wq, &ring->refill, msecs_to_jiffies(RING_REFILL_MS));
+    }
+}
+
+static void ring_vm_open(struct vm_area_struct *vma) {
+    struct devheart_ring_t *ring = vma->vm_private_data;
+
+    if(atomic_inc_return(&ring->mappings) == 1) {
+        queue_delayed_work(system_wq, &ring->refill, 0);
+    }
+}
+
+static void ring_vm_close(struct vm_area_struct *vma) {
+    struct devheart_ring_t *ring = vma->vm_private_data;
+
+    if(atomic_dec_and_test(&ring->mappings)) {
+        cancel_delayed_work(&ring->refill);
+    }
+}
+
+// the file stays open as long as any mapping exists, so does the ring
+static const struct vm_operations_struct ring_vm_ops = {
+    .open = ring_vm_open,
+    .close = ring_vm_close,
+};
+
+/*
+ * Maps the ring into userspace. The ring is created with the first
+ * mapping and from then on owns the heartbeat stream of the file.
+ */
+int ring_mmap(struct devheart_sound_buffer_t *sound_buffer, struct vm_area_struct *vma) {
+    struct devheart_ring_t *ring;
+    int ret;
+
+    if(vma->vm_pgoff || vma->vm_end - vma->vm_start != PAGE_SIZE + DEVHEART_RING_SIZE) {
+        return -EINVAL;
+    }
+
+    // a concurrent mmap() may have created the ring in the meantime
+    mutex_lock(&sound_buffer->lock);
+    ring = sound_buffer->ring;
+    if(!ring) {
+        ring = kzalloc(sizeof(*ring), GFP_KERNEL);
+        if(!ring) {
+            goto err_nomem;
+        }
+
+        ring->area = vmalloc_user(PAGE_SIZE + DEVHEART_RING_SIZE);
+        if(!ring->area) {
+            kfree(ring);
+            goto err_nomem;
+        }
+
+        ring->meta = ring->area;
+        ring->data = ring->area + PAGE_SIZE;
+        ring->meta->version = DEVHEART_RING_VERSION;
+        ring->meta->data_offset = PAGE_SIZE;
+        ring->meta->data_size = DEVHEART_RING_SIZE;
+        ring->sound_buffer = sound_buffer;
+        init_waitqueue_head(&ring->wait);
+        INIT_DELAYED_WORK(&ring->refill, ring_refill);
+
+        sound_buffer->ring = ring;
+    }
+    mutex_unlock(&sound_buffer->lock);
+
+    ret = remap_vmalloc_range(vma, ring->area, 0);
+    if(ret) {
+        return ret;
+    }
+
+    // mmap() does not call .open for the mapping it creates
+    vma->vm_private_data = ring;
+    vma->vm_ops = &ring_vm_ops;
+    ring_vm_open(vma);
+    return 0;
+
+err_nomem:
+    mutex_unlock(&sound_buffer->lock);
+    pr_err("could not allocate kernel memory for the heartbeat ring\n");
+    stat_inc(STAT_ALLOC_FAILURES);
+    return -ENOMEM;
+}
+
+__poll_t ring_poll(struct devheart_sound_buffer_t *sound_buffer, struct file *file, poll_table *wait) {
+    struct devheart_ring_t *ring = sound_buffer->ring;
+
+    poll_wait(file, &ring->wait, wait);
+    smp_mb();
+    if(smp_load_acquire(&ring->meta->producer) != READ_ONCE(ring->meta->consumer)) {
+        return EPOLLIN | EPOLLRDNORM;
+    }
+    return 0;
+}
+
+void ring_release(struct devheart_sound_buffer_t *sound_buffer) {
+    struct devheart_ring_t *ring = sound_buffer->ring;
+
+    if(!ring) {
+        return;
+    }
+
+    cancel_delayed_work_sync(&ring->refill);
+    vfree(ring->area);
+    kfree(ring);
+}
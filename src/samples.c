@@ -0,0 +1,572 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Beat samples: the built-in ones or a set loaded from /lib/firmware.
+ *
+ * A sample set is loaded with `echo <name> > /sys/module/devheart/parameters/samples`
+ * (or samples=<name> on insmod) from /lib/firmware/devheart/<name>/, which
+ * holds left_ventricle_beat.raw and right_ventricle_beat.raw as raw s16_le
+ * mono 44100 Hz PCM. `builtin` switches back to the samples compiled in,
+ * `synth` to beats synthesized for every tempo level.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/moduleparam.h>
+#include <linux/firmware.h>
+#include <linux/device.h>
+#include <linux/slab.h>
+#include <linux/vmalloc.h>
+#include <linux/mutex.h>
+#include <linux/rcupdate.h>
+#include <linux/string.h>
+#include <linux/ktime.h>
+#include <linux/bitops.h> // for_each_set_bit
+
+#include "devheart.h"
+
+#define BUILTIN_SAMPLES "builtin"
+#define SYNTH_SAMPLES "synth"
+
+// directory in /lib/firmware holding the sample sets
+#define SAMPLES_FIRMWARE_DIR "devheart"
+
+// longest beat sample accepted, 10 seconds
+#define SAMPLES_MAX_SIZE (SAMPLE_RATE * SAMPLE_SIZE * 10)
+
+static struct devheart_samples_t builtin_samples = {
+    // one reference for being the current samples, one the module keeps forever
+    .ref = KREF_INIT(2),
+    .templates_lock = __SPIN_LOCK_UNLOCKED(builtin_samples.templates_lock),
+    .name = BUILTIN_SAMPLES,
+};
+
+/*
+ * Samples new heartbeats are made of. Replaced under RCU, so streaming
+ * readers finish their current heartbeat with the samples they hold a
+ * reference to and pick up the new ones with their next heartbeat.
+ */
+static struct devheart_samples_t __rcu *current_samples = RCU_INITIALIZER(&builtin_samples);
+static DEFINE_MUTEX(samples_lock);
+
+// device firmware is requested for, NULL until the module is initialized
+static struct device *samples_device;
+
+// samples requested on insmod, loaded once the device exists
+static char pending_samples[DEVHEART_SAMPLES_NAME_MAX];
+
+// output formats listeners have chosen, every sample set is converted to them before it is published
+static unsigned long formats_in_use;
+
+static void samples_free_converted(struct devheart_samples_t *samples) {
+    unsigned int format;
+
+    for(format = 0; format < DEVHEART_NR_FORMATS; format++) {
+        if(samples->converted[format]) {
+            vfree(samples->converted[format]->data);
+            kfree(samples->converted[format]);
+            samples->converted[format] = NULL;
+        }
+    }
+}
+
+static void samples_free_rcu(struct rcu_head *rcu) {
+    struct devheart_samples_t *samples = container_of(rcu, struct devheart_samples_t, rcu);
+
+    // pages still referenced by pipes stay alive until the pipe releases them
+    samples_free_converted(samples);
+    vfree(samples->data);
+    kfree(samples);
+}
+
+static void samples_release(struct kref *ref) {
+    struct devheart_samples_t *samples = container_of(ref, struct devheart_samples_t, ref);
+
+    // samples_follow() may still be looking at them
+    call_rcu(&samples->rcu, samples_free_rcu);
+}
+
+void samples_put(struct devheart_samples_t *samples) {
+    if(samples) {
+        kref_put(&samples->ref, samples_release);
+    }
+}
+
+// Makes *held reference the given samples, dropping the ones it referenced before.
+void samples_hold(struct devheart_samples_t **held, struct devheart_samples_t *samples) {
+    if(*held == samples) {
+        return;
+    }
+
+    kref_get(&samples->ref);
+    samples_put(*held);
+    *held = samples;
+}
+
+// Makes *held reference the current samples, dropping the ones it referenced before.
+void samples_follow(struct devheart_samples_t **held) {
+    struct devheart_samples_t *samples;
+
+    rcu_read_lock();
+    // samples losing their last reference have already been replaced, so look again
+    do {
+        samples = rcu_dereference(current_samples);
+    } while(samples != *held && !kref_get_unless_zero(&samples->ref));
+    rcu_read_unlock();
+
+    if(samples != *held) {
+        samples_put(*held);
+        *held = samples;
+    }
+}
+
+unsigned int template_cache_levels(void) {
+    struct devheart_samples_t *samples;
+    unsigned int level, cached = 0;
+
+    rcu_read_lock();
+    samples = rcu_dereference(current_samples);
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        cached += smp_load_acquire(&samples->native.templates[level].ready);
+    }
+    rcu_read_unlock();
+    return cached;
+}
+
+static int samples_request(const struct firmware **firmware, const char *name, const char *sample) {
+    char path[64 + DEVHEART_SAMPLES_NAME_MAX];
+    int ret;
+
+    snprintf(path, sizeof(path), SAMPLES_FIRMWARE_DIR "/%s/%s.raw", name, sample);
+    ret = request_firmware(firmware, path, samples_device);
+    if(ret) {
+        pr_err("could not load beat sample %s: %d\n", path, ret);
+        return ret;
+    }
+
+    if(!(*firmware)->size || (*firmware)->size % SAMPLE_SIZE || (*firmware)->size > SAMPLES_MAX_SIZE) {
+        pr_err("beat sample %s is not 1 to %d bytes of s16_le frames\n", path, SAMPLES_MAX_SIZE);
+        release_firmware(*firmware);
+        return -EINVAL;
+    }
+    return 0;
+}
+
+// page aligned span of a sound holding size bytes in a sample block
+static size_t samples_span(size_t size) {
+    return PAGE_ALIGN(sizeof(struct devheart_sound_t) + size);
+}
+
+// Copies a beat sample to the given place of the sample data.
+static const struct devheart_sound_t *samples_copy(char *data, const struct firmware *firmware) {
+    struct devheart_sound_t *sound = (struct devheart_sound_t *)data;
+
+    sound->size = firmware->size;
+    memcpy(sound->data, firmware->data, firmware->size);
+    return sound;
+}
+
+/*
+ * Loads a sample set into one vmalloc()ed block, each sample starting on
+ * a page of its own, so splice hands out as few pages as possible. The
+ * block is never written again once the samples are published.
+ */
+static struct devheart_samples_t *samples_load(const char *name) {
+    const struct firmware *left, *right;
+    struct devheart_samples_t *samples;
+    unsigned int level;
+    size_t left_span;
+    int ret;
+
+    ret = samples_request(&left, name, "left_ventricle_beat");
+    if(ret) {
+        return ERR_PTR(ret);
+    }
+
+    ret = samples_request(&right, name, "right_ventricle_beat");
+    if(ret) {
+        goto err_release_left;
+    }
+
+    ret = -ENOMEM;
+    samples = kzalloc(sizeof(*samples), GFP_KERNEL);
+    if(!samples) {
+        goto err_alloc;
+    }
+
+    left_span = samples_span(left->size);
+    samples->data = vmalloc(left_span + sizeof(struct devheart_sound_t) + right->size);
+    if(!samples->data) {
+        kfree(samples);
+        goto err_alloc;
+    }
+
+    kref_init(&samples->ref);
+    spin_lock_init(&samples->templates_lock);
+    samples->native.left[0] = samples_copy(samples->data, left);
+    samples->native.right[0] = samples_copy(samples->data + left_span, right);
+    for(level = 1; level < TEMPO_LEVELS; level++) {
+        samples->native.left[level] = samples->native.left[0];
+        samples->native.right[level] = samples->native.right[0];
+    }
+    strscpy(samples->name, name, sizeof(samples->name));
+
+    release_firmware(right);
+    release_firmware(left);
+    return samples;
+
+err_alloc:
+    pr_err("could not allocate kernel memory for the beat samples\n");
+    stat_inc(STAT_ALLOC_FAILURES);
+    release_firmware(right);
+err_release_left:
+    release_firmware(left);
+    return ERR_PTR(ret);
+}
+
+/*
+ * Synthesizes the beats of every tempo level into one vmalloc()ed block,
+ * each starting on a page of its own. Rendered once here, reading them
+ * is a copy like for any other samples.
+ */
+static struct devheart_samples_t *samples_synthesize(void) {
+    struct devheart_synth_beat_t lub[TEMPO_LEVELS], dub[TEMPO_LEVELS];
+    struct devheart_samples_t *samples;
+    struct devheart_sound_t *sound;
+    size_t size = 0, offset = 0;
+    unsigned int level;
+
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        synth_beat_for_level(&lub[level], &synth_lub, level);
+        synth_beat_for_level(&dub[level], &synth_dub, level);
+        size += samples_span(synth_beat_size(&lub[level])) + samples_span(synth_beat_size(&dub[level]));
+    }
+
+    samples = kzalloc(sizeof(*samples), GFP_KERNEL);
+    if(!samples) {
+        goto err_alloc;
+    }
+
+    samples->data = vmalloc(size);
+    if(!samples->data) {
+        kfree(samples);
+        goto err_alloc;
+    }
+
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        sound = (struct devheart_sound_t *)(samples->data + offset);
+        synth_render_beat(sound, &lub[level]);
+        samples->native.left[level] = sound;
+        offset += samples_span(sound->size);
+
+        sound = (struct devheart_sound_t *)(samples->data + offset);
+        synth_render_beat(sound, &dub[level]);
+        samples->native.right[level] = sound;
+        offset += samples_span(sound->size);
+    }
+
+    kref_init(&samples->ref);
+    spin_lock_init(&samples->templates_lock);
+    strscpy(samples->name, SYNTH_SAMPLES, sizeof(samples->name));
+    return samples;
+
+err_alloc:
+    pr_err("could not allocate kernel memory for the synthesized beats\n");
+    stat_inc(STAT_ALLOC_FAILURES);
+    return ERR_PTR(-ENOMEM);
+}
+
+// Converts a beat into the format at the given offset of the block and moves the offset past it.
+static const struct devheart_sound_t *samples_convert_beat(const struct devheart_format_t *format, char *data,
+                                                           size_t *offset, const struct devheart_sound_t *beat) {
+    struct devheart_sound_t *sound = (struct devheart_sound_t *)(data + *offset);
+
+    sound->size = format_size(format, beat->size);
+    format_convert(format, sound->data, beat->data, beat->size);
+    *offset += samples_span(sound->size);
+    return sound;
+}
+
+/*
+ * Converts the native beats of the samples to the format into one
+ * vmalloc()ed block, each beat starting on a page of its own. Beats
+ * shared by several tempo levels are converted once.
+ */
+static int samples_convert(struct devheart_samples_t *samples, unsigned int format) {
+    const struct devheart_format_t *to = &devheart_formats[format];
+    const struct devheart_beats_t *native = &samples->native;
+    struct devheart_beats_t *beats;
+    size_t size = 0, offset = 0;
+    unsigned int level;
+
+    if(format == DEVHEART_FORMAT_S16_LE_44100 || samples->converted[format]) {
+        return 0;
+    }
+
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        if(!level || native->left[level] != native->left[level - 1]) {
+            size += samples_span(format_size(to, native->left[level]->size));
+        }
+        if(!level || native->right[level] != native->right[level - 1]) {
+            size += samples_span(format_size(to, native->right[level]->size));
+        }
+    }
+
+    beats = kzalloc(sizeof(*beats), GFP_KERNEL);
+    if(!beats) {
+        goto err_alloc;
+    }
+
+    beats->data = vmalloc(size);
+    if(!beats->data) {
+        kfree(beats);
+        goto err_alloc;
+    }
+
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        if(level && native->left[level] == native->left[level - 1]) {
+            beats->left[level] = beats->left[level - 1];
+        }
+        else {
+            beats->left[level] = samples_convert_beat(to, beats->data, &offset, native->left[level]);
+        }
+
+        if(level && native->right[level] == native->right[level - 1]) {
+            beats->right[level] = beats->right[level - 1];
+        }
+        else {
+            beats->right[level] = samples_convert_beat(to, beats->data, &offset, native->right[level]);
+        }
+    }
+
+    smp_store_release(&samples->converted[format], beats);
+    return 0;
+
+err_alloc:
+    pr_err("could not allocate kernel memory for the beats in %s\n", to->name);
+    stat_inc(STAT_ALLOC_FAILURES);
+    return -ENOMEM;
+}
+
+// Makes sure the current and all future samples are converted to the format.
+int samples_use_format(unsigned int format) {
+    struct devheart_samples_t *samples;
+    int ret;
+
+    mutex_lock(&samples_lock);
+    samples = rcu_dereference_protected(current_samples, lockdep_is_held(&samples_lock));
+    ret = samples_convert(samples, format);
+    if(!ret) {
+        __set_bit(format, &formats_in_use);
+    }
+    mutex_unlock(&samples_lock);
+    return ret;
+}
+
+/*
+ * Makes the given samples, and the reference passed with them, the
+ * current ones, once they are converted to every format in use.
+ */
+static int samples_publish(struct devheart_samples_t *samples) {
+    struct devheart_samples_t *old;
+    unsigned int format;
+    int ret;
+
+    mutex_lock(&samples_lock);
+    for_each_set_bit(format, &formats_in_use, DEVHEART_NR_FORMATS) {
+        ret = samples_convert(samples, format);
+        if(ret) {
+            mutex_unlock(&samples_lock);
+            samples_put(samples);
+            return ret;
+        }
+    }
+    old = rcu_replace_pointer(current_samples, samples, lockdep_is_held(&samples_lock));
+    mutex_unlock(&samples_lock);
+
+    samples_put(old);
+    return 0;
+}
+
+static int samples_switch(const char *name) {
+    struct devheart_samples_t *samples;
+    int ret;
+
+    if(!strcmp(name, BUILTIN_SAMPLES)) {
+        samples = &builtin_samples;
+        kref_get(&samples->ref);
+    }
+    else if(!strcmp(name, SYNTH_SAMPLES)) {
+        samples = samples_synthesize();
+        if(IS_ERR(samples)) {
+            return PTR_ERR(samples);
+        }
+    }
+    else {
+        samples = samples_load(name);
+        if(IS_ERR(samples)) {
+            return PTR_ERR(samples);
+        }
+    }
+
+    ret = samples_publish(samples);
+    if(ret) {
+        return ret;
+    }
+
+    pr_info("Master Tuxs heart now sounds like %s\n", name);
+    return 0;
+}
+
+static int samples_param_set(const char *val, const struct kernel_param *kp) {
+    char name[DEVHEART_SAMPLES_NAME_MAX];
+    size_t length = strcspn(val, "\n");
+
+    // a plain directory name below SAMPLES_FIRMWARE_DIR
+    if(!length || length >= sizeof(name) || val[0] == '.' || memchr(val, '/', length)) {
+        return -EINVAL;
+    }
+    memcpy(name, val, length);
+    name[length] = '\0';
+
+    if(!samples_device) {
+        strscpy(pending_samples, name, sizeof(pending_samples));
+        return 0;
+    }
+    return samples_switch(name);
+}
+
+static int samples_param_get(char *buffer, const struct kernel_param *kp) {
+    int ret;
+
+    rcu_read_lock();
+    ret = sysfs_emit(buffer, "%s\n", rcu_dereference(current_samples)->name);
+    rcu_read_unlock();
+    return ret;
+}
+
+static const struct kernel_param_ops samples_ops = {
+    .set = samples_param_set,
+    .get = samples_param_get,
+};
+
+module_param_cb(samples, &samples_ops, NULL, S_IRUGO | S_IWUSR);
+MODULE_PARM_DESC(samples, "Beat samples to use from /lib/firmware/" SAMPLES_FIRMWARE_DIR "/<name>/ or " SYNTH_SAMPLES " (default: " BUILTIN_SAMPLES ")");
+
+#ifndef DEVHEART_ADPCM
+// Copies a sound linked into the module to the given place of the sample data.
+static struct devheart_sound_t *samples_copy_builtin(char *data, const struct devheart_sound_t *builtin) {
+    struct devheart_sound_t *sound = (struct devheart_sound_t *)data;
+
+    sound->size = builtin->size;
+    memcpy(sound->data, builtin->data, builtin->size);
+    return sound;
+}
+#endif
+
+/*
+ * Puts the built-in samples into one vmalloc()ed block, each starting on
+ * a page of its own, decoding them first if they are compressed. Pipes
+ * may hold on to spliced pages after the module is unloaded, so no page
+ * of the module image itself is ever handed out.
+ */
+static int samples_init_builtin(void) {
+#ifdef DEVHEART_ADPCM
+    size_t left_size = left_ventricle_beat_adpcm.size, right_size = right_ventricle_beat_adpcm.size;
+#else
+    size_t left_size = left_ventricle_beat_sound.size, right_size = right_ventricle_beat_sound.size;
+#endif
+    size_t left_span = samples_span(left_size);
+    struct devheart_sound_t *left, *right;
+    unsigned int level;
+    u64 start = ktime_get_ns();
+
+    builtin_samples.data = vmalloc(left_span + samples_span(right_size));
+    if(!builtin_samples.data) {
+        pr_err("could not allocate kernel memory for the built-in beat samples\n");
+        stat_inc(STAT_ALLOC_FAILURES);
+        return -ENOMEM;
+    }
+
+#ifdef DEVHEART_ADPCM
+    left = (struct devheart_sound_t *)builtin_samples.data;
+    right = (struct devheart_sound_t *)(builtin_samples.data + left_span);
+    adpcm_decode(left, &left_ventricle_beat_adpcm);
+    adpcm_decode(right, &right_ventricle_beat_adpcm);
+#else
+    left = samples_copy_builtin(builtin_samples.data, &left_ventricle_beat_sound);
+    right = samples_copy_builtin(builtin_samples.data + left_span, &right_ventricle_beat_sound);
+#endif
+
+    for(level = 0; level < TEMPO_LEVELS; level++) {
+        builtin_samples.native.left[level] = left;
+        builtin_samples.native.right[level] = right;
+    }
+
+    pr_debug("prepared %zu bytes of built-in samples in %llu ns\n",
+             left->size + right->size, ktime_get_ns() - start);
+    return 0;
+}
+
+#ifdef DEVHEART_ADPCM
+// Checks that a compressed built-in sound holds every block its PCM size decodes from.
+static int samples_check_adpcm(const char *name, const struct devheart_adpcm_sound_t *adpcm) {
+    if(adpcm->encoded_size != adpcm_encoded_size(adpcm->size)) {
+        pr_err("built-in %s has %zu bytes of ADPCM, %zu bytes of PCM take %zu\n",
+               name, adpcm->encoded_size, adpcm->size, adpcm_encoded_size(adpcm->size));
+        return -EINVAL;
+    }
+    return 0;
+}
+#endif
+
+// Prepares the built-in samples, before any heartbeat is generated.
+int samples_init(void) {
+#ifdef DEVHEART_ADPCM
+    int ret;
+
+    ret = samples_check_adpcm("left_ventricle_beat", &left_ventricle_beat_adpcm);
+    if(ret) {
+        return ret;
+    }
+    ret = samples_check_adpcm("right_ventricle_beat", &right_ventricle_beat_adpcm);
+    if(ret) {
+        return ret;
+    }
+#endif
+    return samples_init_builtin();
+}
+
+// Loads the samples requested on insmod, firmware is requested for the given device from now on.
+int samples_attach(struct device *device) {
+    samples_device = device;
+    if(pending_samples[0]) {
+        return samples_switch(pending_samples);
+    }
+    return 0;
+}
+
+void samples_exit(void) {
+    samples_device = NULL;
+
+    // nobody listens anymore, so publishing the built-in samples needs no conversion and cannot fail
+    mutex_lock(&samples_lock);
+    formats_in_use = 0;
+    mutex_unlock(&samples_lock);
+
+    kref_get(&builtin_samples.ref);
+    samples_publish(&builtin_samples);
+
+    // wait for samples_free_rcu() of the samples just dropped
+    rcu_barrier();
+
+    samples_free_converted(&builtin_samples);
+    vfree(builtin_samples.data);
+}
@@ -0,0 +1,109 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Zero-copy splice of heartbeats into pipes.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+// use kernel module name in front of kernel log messages
+#define pr_fmt(fmt) KBUILD_MODNAME ": " fmt
+
+#include <linux/module.h>
+#include <linux/kernel.h>
+#include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h> // vmalloc_to_page
+#include <linux/pipe_fs_i.h>
+#include <linux/splice.h>
+
+#include "devheart.h"
+
+// Returns the page backing sound data, which lives in vmalloc memory or on a page of its own.
+static struct page *sound_data_page(const char *data) {
+    if(is_vmalloc_addr(data)) {
+        return vmalloc_to_page(data);
+    }
+    return virt_to_page(data);
+}
+
+static void heartbeat_spd_release(struct splice_pipe_desc *spd, unsigned int i) {
+    put_page(spd->pages[i]);
+}
+
+// Moves the read position on by length bytes of the current heartbeat.
+static void heartbeat_skip(struct devheart_sound_buffer_t *sound_buffer, size_t length) {
+    const char *data;
+    size_t chunk;
+
+    for(; length; length -= chunk) {
+        chunk = min(length, heartbeat_span(sound_buffer, &data));
+        heartbeat_advance(sound_buffer, chunk);
+    }
+}
+
+/*
+ * Splices up to length bytes of the current heartbeat into the pipe by
+ * handing out references to the pages of the sample data, the silence
+ * page and the WAV header page. None of them belong to the module image
+ * and the buffers use the core kernel's nosteal_pipe_buf_ops, so a pipe
+ * may outlive the open file and even the module. Pages of replaced
+ * samples stay alive until the pipe is drained.
+ *
+ * The read position only moves by what splice_to_pipe() accepted, so
+ * nothing is skipped if it takes less than was queued.
+ */
+ssize_t heartbeat_splice_read(struct devheart_sound_buffer_t *sound_buffer, struct pipe_inode_info *pipe,
+                              size_t length) {
+    struct page *pages[PIPE_DEF_BUFFERS];
+    struct partial_page partial[PIPE_DEF_BUFFERS];
+    struct splice_pipe_desc spd = {
+        .pages = pages,
+        .partial = partial,
+        .nr_pages_max = PIPE_DEF_BUFFERS,
+        .ops = &nosteal_pipe_buf_ops,
+        .spd_release = heartbeat_spd_release,
+    };
+    unsigned int slots;
+    size_t chunk, queued = 0;
+    const char *data;
+    ssize_t ret;
+
+    slots = pipe->max_usage - pipe_occupancy(pipe->head, pipe->tail);
+    slots = min_t(unsigned int, slots, PIPE_DEF_BUFFERS);
+
+    // start the next heartbeat if the current one is exhausted
+    if(length && slots) {
+        heartbeat_span(sound_buffer, &data);
+    }
+
+    while(queued < length && spd.nr_pages < slots) {
+        chunk = heartbeat_span_ahead(sound_buffer, queued, &data);
+        if(!chunk) {
+            break;
+        }
+        chunk = min(chunk, length - queued);
+        chunk = min_t(size_t, chunk, PAGE_SIZE - offset_in_page(data));
+
+        pages[spd.nr_pages] = sound_data_page(data);
+        get_page(pages[spd.nr_pages]);
+        partial[spd.nr_pages].offset = offset_in_page(data);
+        partial[spd.nr_pages].len = chunk;
+        spd.nr_pages++;
+
+        queued += chunk;
+    }
+
+    if(!spd.nr_pages) {
+        return 0;
+    }
+
+    ret = splice_to_pipe(pipe, &spd);
+    if(ret > 0) {
+        heartbeat_skip(sound_buffer, ret);
+        pace_consume(&sound_buffer->pace, ret);
+    }
+    return ret;
+}
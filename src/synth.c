@@ -0,0 +1,113 @@
+/**
+ *
+ * Kernel Module which creates a device to listen to Tuxs heart.
+ *
+ * -> Synthesis of heartbeat sounds, built into the module and into the userspace benchmarks.
+ *
+ * There is no FPU in kernel context, so everything is Q30 fixed point:
+ * a sine is generated by a two-pole resonator and shaped by a linear
+ * attack, an exponential decay and a short release against clicks.
+ *
+ * @copyright: GPLv2 (see LICENSE), by Timo Furrer <tuxtimo@gmail.com>
+ *
+ */
+
+#ifdef __KERNEL__
+#include <linux/math64.h> // div64_u64, div_u64, div_s64
+#endif
+
+#include "heartbeat.h"
+
+#define Q30_ONE (1LL << 30)
+
+// 2 * pi in Q30
+#define Q30_TWO_PI 6746518852ULL
+
+// fade out at the end of every beat, so it does not click into the silence
+#define SYNTH_RELEASE_MS 5
+
+// a low, long lub when the mitral and tricuspid valves close ...
+const struct devheart_synth_beat_t synth_lub = {
+    .frequency = 60000,
+    .attack_ms = 8,
+    .damping_ms = 40,
+    .duration_ms = 140,
+    .amplitude = 28000,
+};
+
+// ... and a higher, shorter dub when the aortic and pulmonary valves do
+const struct devheart_synth_beat_t synth_dub = {
+    .frequency = 90000,
+    .attack_ms = 5,
+    .damping_ms = 30,
+    .duration_ms = 110,
+    .amplitude = 22000,
+};
+
+/*
+ * Derives the beat of a tempo level from the base beat: the busier the
+ * CPUs, the higher the pitch and the harder the beat, up to 1.5 times
+ * the base frequency and 3/4 of its damping at full utilization.
+ */
+void synth_beat_for_level(struct devheart_synth_beat_t *beat, const struct devheart_synth_beat_t *base, unsigned int level) {
+    unsigned int strain = TEMPO_LEVELS - 1 - level;
+
+    *beat = *base;
+    beat->frequency += base->frequency * strain / (2 * (TEMPO_LEVELS - 1));
+    beat->damping_ms -= base->damping_ms * strain / (4 * (TEMPO_LEVELS - 1));
+}
+
+static u32 synth_frames(u32 ms) {
+    return div_u64((u64)ms * SAMPLE_RATE, 1000);
+}
+
+size_t synth_beat_size(const struct devheart_synth_beat_t *beat) {
+    return synth_frames(beat->duration_ms) * SAMPLE_SIZE;
+}
+
+// Renders the beat as s16_le into the sound, which must hold synth_beat_size() bytes.
+void synth_render_beat(struct devheart_sound_t *sound, const struct devheart_synth_beat_t *beat) {
+    u32 frames = synth_frames(beat->duration_ms);
+    u32 attack = max_t(u32, synth_frames(beat->attack_ms), 1);
+    u32 release = min_t(u32, synth_frames(SYNTH_RELEASE_MS), frames);
+    u32 tau = max_t(u32, synth_frames(beat->damping_ms), 1);
+    s64 w, w2, resonance, decay, envelope = Q30_ONE;
+    s64 previous, current, next, level;
+    s32 value;
+    u32 frame;
+    char *data = sound->data;
+
+    // angular frequency per frame, and its cosine and sine by Taylor series, w is far below 1
+    w = div64_u64((u64)beat->frequency * Q30_TWO_PI, 1000ULL * SAMPLE_RATE);
+    w2 = (w * w) >> 30;
+    resonance = 2 * (Q30_ONE - w2 / 2 + div_s64((w2 * w2) >> 30, 24));
+    previous = 0;
+    current = w - div_s64((w2 * w) >> 30, 6);
+
+    // exp(-1 / tau) ~ 1 - 1 / tau for decays of more than a few frames
+    decay = Q30_ONE - div_s64(Q30_ONE, tau);
+
+    for(frame = 0; frame < frames; frame++) {
+        if(frame < attack) {
+            level = div_s64(Q30_ONE * frame, attack);
+        }
+        else {
+            envelope = (envelope * decay) >> 30;
+            level = envelope;
+        }
+        if(frames - frame < release) {
+            level = div_s64(level * (frames - frame), release);
+        }
+
+        value = (((previous * level) >> 30) * beat->amplitude) >> 30;
+        value = clamp_t(s32, value, -32768, 32767);
+        data[frame * SAMPLE_SIZE] = value & 0xff;
+        data[frame * SAMPLE_SIZE + 1] = (value >> 8) & 0xff;
+
+        next = ((resonance * current) >> 30) - previous;
+        previous = current;
+        current = next;
+    }
+
+    sound->size = frames * SAMPLE_SIZE;
+}